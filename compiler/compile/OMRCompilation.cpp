@@ -2613,17 +2613,21 @@ void addDebug(const char * debugString)
       }
    }
 
+static bool addEnvironmentDebugValues()
+   {
+   TR_DEBUGValue = feGetEnv("TR_DEBUG");
+   if (!TR_DEBUGValue)
+      TR_DEBUGValue = "";
+   addDebug(TR_DEBUGValue);
+   return true;
+   }
+
 char * debug(const char *option)
    {
 
-   // Get a pointer to the environment variable.
-   if (!TR_DEBUGValue)
-      {
-      TR_DEBUGValue = feGetEnv("TR_DEBUG");
-      if (!TR_DEBUGValue)
-         TR_DEBUGValue = "";
-      addDebug(TR_DEBUGValue);
-      }
+   // Get a pointer to the environment variable. Compilation threads can get
+   // here concurrently, so the values are added exactly once
+   static bool environmentDebugValuesAdded = addEnvironmentDebugValues();
 
    // OK, now look for our option
    int32_t optionLen = (int32_t) strlen(option);
@@ -2635,7 +2639,6 @@ char * debug(const char *option)
              (val->value[optionLen] == 0 ||
               val->value[optionLen] == '='))
             {
-            head = val;
             if (val->value[optionLen])
                ++optionLen;
             return val->value+optionLen;
@@ -63,33 +63,34 @@
 #define snprintf _snprintf
 #endif
 
-static void
-writePerfToolEntry(void *start, uint32_t size, const char *name)
+static FILE *
+openPerfFile()
    {
-   // race condition
-   static bool firstAttempt = true;
-   static FILE *perfFile = 0;
-
-   if (firstAttempt)
-      {
-      firstAttempt = false;
+   FILE *perfFile = 0;
 #if defined(OMR_OS_WINDOWS)
-      int jvmPid = _getpid();
+   int jvmPid = _getpid();
 #else
-      pid_t jvmPid = getpid();
+   pid_t jvmPid = getpid();
 #endif
-      static const int maxPerfFilenameSize = 15 + sizeof(jvmPid)* 3; // "/tmp/perf-%ld.map"
-      char perfFilename[maxPerfFilenameSize] = { 0 };
+   static const int maxPerfFilenameSize = 15 + sizeof(jvmPid)* 3; // "/tmp/perf-%ld.map"
+   char perfFilename[maxPerfFilenameSize] = { 0 };
 
-      int numCharsWritten = snprintf(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map", static_cast<int64_t>(jvmPid));
-      if (numCharsWritten > 0 && numCharsWritten < maxPerfFilenameSize)
-         {
-         perfFile = fopen(perfFilename, "a");
-         }
-      if (!perfFile) // couldn't open the file
-         {
-         }
+   int numCharsWritten = snprintf(perfFilename, maxPerfFilenameSize, "/tmp/perf-%" OMR_PRId64 ".map", static_cast<int64_t>(jvmPid));
+   if (numCharsWritten > 0 && numCharsWritten < maxPerfFilenameSize)
+      {
+      perfFile = fopen(perfFilename, "a");
       }
+   return perfFile;
+   }
+
+static void
+writePerfToolEntry(void *start, uint32_t size, const char *name)
+   {
+   // Compilation threads may get here concurrently: the file is opened exactly
+   // once, and each entry is written with a single fprintf so that entries
+   // from different threads do not interleave
+   static FILE *perfFile = openPerfFile();
+
    if (perfFile)
       {
       // perf does not want 0x leading the hex start address and length of the compiled code region
@@ -272,7 +273,8 @@ compileMethodFromDetails(
       OMR_VMThread *omrVMThread,
       TR::IlGeneratorMethodDetails & details,
       TR_Hotness hotness,
-      int32_t &rc)
+      int32_t &rc,
+      int32_t compThreadID)
    {
    uint64_t translationStartTime = TR::Compiler->vm.getUSecClock();
    OMR::FrontEnd &fe = OMR::FrontEnd::singleton();
@@ -328,7 +330,8 @@ compileMethodFromDetails(
          &compilee,
          0,
          plan,
-         false);
+         false,
+         compThreadID);
 
    // FIXME: once we can do recompilation , we need to pass in the old start PC  -----------------------^
 
@@ -336,7 +339,7 @@ compileMethodFromDetails(
    // FIXME: perhaps use stack memory instead
 
    TR_ASSERT(TR::comp() == NULL, "there seems to be a current TLS TR::Compilation object %p for this thread. At this point there should be no current TR::Compilation object", TR::comp());
-   TR::Compilation compiler(0, omrVMThread, &fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
+   TR::Compilation compiler(compThreadID, omrVMThread, &fe, &compilee, request, options, dispatchRegion, &trMemory, plan);
    TR_ASSERT(TR::comp() == &compiler, "the TLS TR::Compilation object %p for this thread does not match the one %p just created.", TR::comp(), &compiler);
 
    try
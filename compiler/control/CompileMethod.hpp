@@ -31,4 +31,10 @@ namespace TR { class JitConfig; }
 int32_t init_options(TR::JitConfig *jitConfig, char * cmdLineOptions);
 int32_t commonJitInit(OMR::FrontEnd &fe, char * cmdLineOptions);
 uint8_t *compileMethod(OMR_VMThread *omrVMThread, TR_ResolvedMethod &compilee, TR_Hotness hotness, int32_t &rc);
-uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness, int32_t &rc);
+
+/**
+ * @brief compile the method described by details
+ * @param compThreadID identifies the compilation thread doing the compile, or 0 for an application thread;
+ *        threads compiling concurrently must use different IDs
+ */
+uint8_t *compileMethodFromDetails(OMR_VMThread *omrVMThread, TR::IlGeneratorMethodDetails &details, TR_Hotness hotness, int32_t &rc, int32_t compThreadID = 0);
@@ -38,9 +38,12 @@
 #include "il/ILOps.hpp"
 #include "il/Node.hpp"
 #include "il/Node_inlines.hpp"
+#include "infra/Monitor.hpp"
 
 TR::FECommon::FECommon()
-   : TR_FrontEnd()
+   : TR_FrontEnd(),
+   _logMonitor(TR::Monitor::create("JIT-LogMonitor")),
+   _verboseLogMonitor(TR::Monitor::create("JIT-VerboseLogMonitor"))
    {}
 
 
@@ -50,6 +53,18 @@ TR::FECommon::createDebug( TR::Compilation *comp)
    return createDebugObject(comp);
    }
 
+void
+TR::FECommon::acquireLogMonitor()
+   {
+   _logMonitor->enter();
+   }
+
+void
+TR::FECommon::releaseLogMonitor()
+   {
+   _logMonitor->exit();
+   }
+
 extern "C" {
 
 // use libc for all this stuff
@@ -57,12 +72,12 @@ extern "C" {
 
 void TR_VerboseLog::vlogAcquire()
    {
-   //NOT IMPLEMENTED for now
+   OMR::FrontEnd::singleton().getVerboseLogMonitor()->enter();
    }
 
 void TR_VerboseLog::vlogRelease()
    {
-   //NOT IMPLEMENTED for now
+   OMR::FrontEnd::singleton().getVerboseLogMonitor()->exit();
    }
 
 void TR_VerboseLog::vwrite(const char *format, va_list args)
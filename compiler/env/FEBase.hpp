@@ -32,6 +32,7 @@
 #include "env/CompilerEnv.hpp"
 
 class TR_ResolvedMethod;
+namespace TR { class Monitor; }
 
 namespace TR
 {
@@ -47,12 +48,20 @@ class FECommon : public ::TR_FrontEnd
    protected:
    FECommon();
 
+   private:
+   TR::Monitor *_logMonitor;         // serializes opening the logs of compilation threads
+   TR::Monitor *_verboseLogMonitor;  // keeps multi line verbose log messages together
 
    public:
    virtual TR_PersistentMemory       * persistentMemory() = 0;
 
    virtual TR_Debug *createDebug(TR::Compilation *comp = NULL);
 
+   virtual void acquireLogMonitor();
+   virtual void releaseLogMonitor();
+
+   TR::Monitor *getVerboseLogMonitor() { return _verboseLogMonitor; }
+
    virtual TR_OpaqueClassBlock * getClassFromSignature(const char * sig, int32_t length, TR_ResolvedMethod *method, bool isVettedForAOT=false) { return NULL; }
    virtual TR_OpaqueClassBlock * getClassFromSignature(const char * sig, int32_t length, TR_OpaqueMethodBlock *method, bool isVettedForAOT=false) { return NULL; }
    virtual const char *       sampleSignature(TR_OpaqueMethodBlock * aMethod, char *buf, int32_t bufLen, TR_Memory *memory) { return NULL; }
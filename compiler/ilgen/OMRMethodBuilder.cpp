@@ -42,6 +42,7 @@
 #include "control/Recompilation.hpp"
 #include "infra/Assert.hpp"
 #include "infra/Cfg.hpp"
+#include "infra/CriticalSection.hpp"
 #include "infra/STLUtils.hpp"
 #include "infra/List.hpp"
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
@@ -100,6 +101,7 @@ OMR::MethodBuilder::MemoryManager::~MemoryManager()
 OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineState *vmState)
    : TR::IlBuilder(asMethodBuilder(), types),
    _clientCallbackRequestFunction(0),
+   _clientCallbackCompilationComplete(0),
    _methodName("NoName"),
    _returnType(NoType),
    _numParameters(0),
@@ -133,6 +135,8 @@ OMR::MethodBuilder::MethodBuilder(TR::TypeDictionary *types, TR::VirtualMachineS
 // used when inlining:
 OMR::MethodBuilder::MethodBuilder(TR::MethodBuilder *callerMB, TR::VirtualMachineState *vmState)
    : TR::IlBuilder(asMethodBuilder(), callerMB->typeDictionary()),
+   _clientCallbackRequestFunction(0),
+   _clientCallbackCompilationComplete(0),
    _methodName("NoName"),
    _returnType(NoType),
    _numParameters(0),
@@ -720,13 +724,17 @@ OMR::MethodBuilder::GetNextBytecodeFromWorklist()
    }
 
 int32_t
-OMR::MethodBuilder::Compile(void **entry)
+OMR::MethodBuilder::Compile(void **entry, int32_t compThreadID)
    {
    TR::ResolvedMethod resolvedMethod(static_cast<TR::MethodBuilder *>(this));
    TR::IlGeneratorMethodDetails details(&resolvedMethod);
 
+   // other MethodBuilders sharing the TypeDictionary wait for this compilation
+   // to complete (and clear its symbol references) before starting their own
+   OMR::CriticalSection compiling(typeDictionary()->compilationMonitor());
+
    int32_t rc=0;
-   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc);
+   *entry = (void *) compileMethodFromDetails(NULL, details, warm, rc, compThreadID);
 
    // let TypeDictionary know to clear out sym refs used in this compilation so
    // no dangling pointers
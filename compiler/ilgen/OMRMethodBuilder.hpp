@@ -44,6 +44,7 @@ namespace TR { class Region; }
 extern "C"
 {
 typedef bool (*RequestFunctionCallback)(void *client, const char *name);
+typedef void (*CompilationCompleteCallback)(void *client, int32_t returnCode, void *entryPoint);
 }
 
 namespace OMR
@@ -144,7 +145,26 @@ class MethodBuilder : public TR::IlBuilder
                        int32_t          numParms,
                        TR::IlType     ** parmTypes);
 
-   int32_t Compile(void **entry);
+   /**
+    * @brief compile this method
+    * @param entry returns the entry point of the compiled code
+    * @param compThreadID identifies the compilation thread doing the compile, 0 for the application thread
+    * @returns the compilation return code, 0 on success
+    */
+   int32_t Compile(void **entry, int32_t compThreadID = 0);
+
+   /**
+    * @brief will be called on the compilation thread when an asynchronous compilation of this method
+    *        completes, to deliver the entry point of the compiled code. Once called, the compilation
+    *        no longer refers to this object.
+    * @param returnCode the compilation return code, 0 on success
+    * @param entryPoint the entry point of the compiled code, NULL if the compilation failed
+    */
+   virtual void CompilationComplete(int32_t returnCode, void *entryPoint)
+      {
+      if (_clientCallbackCompilationComplete)
+         (*_clientCallbackCompilationComplete)(client(), returnCode, entryPoint);
+      }
 
    /**
     * @brief will be called if a Call is issued to a function that has not yet been defined, provides a
@@ -266,6 +286,14 @@ class MethodBuilder : public TR::IlBuilder
       _clientCallbackRequestFunction = (RequestFunctionCallback) callback;
       }
 
+   /**
+    * @brief Store callback function to be called on client when CompilationComplete is called
+    */
+   void setClientCallback_CompilationComplete(void *callback)
+      {
+      _clientCallbackCompilationComplete = (CompilationCompleteCallback) callback;
+      }
+
    /**
     * @brief Set the Client Allocator function
     */
@@ -317,6 +345,11 @@ class MethodBuilder : public TR::IlBuilder
     */
    RequestFunctionCallback     _clientCallbackRequestFunction;
 
+   /**
+    * @brief client callback function to call when CompilationComplete is called
+    */
+   CompilationCompleteCallback _clientCallbackCompilationComplete;
+
    // These values are typically defined outside of a compilation
    const char                * _methodName;
    TR::IlType                * _returnType;
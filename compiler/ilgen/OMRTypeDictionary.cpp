@@ -33,6 +33,7 @@
 #include "env/TRMemory.hpp"
 #include "infra/Assert.hpp"
 #include "infra/BitVector.hpp"
+#include "infra/Monitor.hpp"
 #include "infra/STLUtils.hpp"
 
 
@@ -452,13 +453,15 @@ OMR::TypeDictionary::MemoryManager::~MemoryManager()
 OMR::TypeDictionary::TypeDictionary(const TypeDictionary &src) : 
    _client(0),
    _structsByName(str_comparator, trMemory()->heapMemoryRegion()),
-   _unionsByName(str_comparator, trMemory()->heapMemoryRegion()) 
+   _unionsByName(str_comparator, trMemory()->heapMemoryRegion()),
+   _compilationMonitor(TR::Monitor::create("JIT-TypeDictionaryCompilationMonitor"))
    {}
 
 OMR::TypeDictionary::TypeDictionary() :
    _client(0),
    _structsByName(str_comparator, trMemory()->heapMemoryRegion()),
-   _unionsByName(str_comparator, trMemory()->heapMemoryRegion())
+   _unionsByName(str_comparator, trMemory()->heapMemoryRegion()),
+   _compilationMonitor(TR::Monitor::create("JIT-TypeDictionaryCompilationMonitor"))
    {
    // primitive types
    NoType       = _primitiveType[TR::NoType]                = new (PERSISTENT_NEW) OMR::PrimitiveType("NoType", TR::NoType);
@@ -510,6 +513,8 @@ OMR::TypeDictionary::~TypeDictionary() throw()
    // the TypeDictionary::MemoryManager destructor
    _structsByName.clear();
    _unionsByName.clear();
+
+   TR::Monitor::destroy(_compilationMonitor);
    }
 
 TR::IlType *
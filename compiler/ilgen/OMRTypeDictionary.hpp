@@ -32,6 +32,7 @@ class TR_Memory;
 namespace OMR { class StructType; }
 namespace OMR { class UnionType; }
 namespace TR  { class IlReference; }
+namespace TR  { class Monitor; }
 namespace TR  { class SegmentProvider; }
 namespace TR  { class Region; }
 
@@ -161,6 +162,15 @@ public:
     */
    void NotifyCompilationDone();
 
+   /**
+    * @brief monitor held for the whole compilation of a MethodBuilder that uses this dictionary
+    *
+    * Compilations cache their symbol references in the struct and union types
+    * of the dictionary, so MethodBuilders that share a dictionary are compiled
+    * one at a time even when several compilation threads are active.
+    */
+   TR::Monitor *compilationMonitor() { return _compilationMonitor; }
+
    /**
     * @brief associates this object with a particular client object
     */
@@ -239,6 +249,8 @@ protected:
    typedef std::map<const char *, OMR::UnionType *, StrComparator, UnionMapAllocator> UnionMap;
    UnionMap           _unionsByName;
 
+   TR::Monitor      * _compilationMonitor;
+
 public:
    // convenience for primitive types
    TR::IlType       * _primitiveType[TR::NumOMRTypes];
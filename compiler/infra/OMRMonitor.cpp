@@ -68,9 +68,12 @@ OMR::Monitor::init(char *name)
    _name = name;
 #if defined(OMR_OS_WINDOWS)
    MUTEX_INIT(_monitor);
+   InitializeConditionVariable(&_condition);
 #else
    bool rc = MUTEX_INIT(_monitor);
    TR_ASSERT(rc == true, "error initializing monitor\n");
+   int32_t condRC = pthread_cond_init(&_condition, NULL);
+   TR_ASSERT(condRC == 0, "error initializing monitor condition\n");
 #endif /* defined(OMR_OS_WINDOWS) */
    return true;
    }
@@ -89,6 +92,8 @@ OMR::Monitor::destroy()
 #else
    int32_t rc = MUTEX_DESTROY(_monitor);
    TR_ASSERT(rc == 0, "error destroying monitor\n");
+   rc = pthread_cond_destroy(&_condition);
+   TR_ASSERT(rc == 0, "error destroying monitor condition\n");
 #endif /* defined(OMR_OS_WINDOWS) */
    }
 
@@ -116,6 +121,39 @@ OMR::Monitor::exit()
 #endif /* defined(OMR_OS_WINDOWS) */
    }
 
+void
+OMR::Monitor::wait()
+   {
+#if defined(OMR_OS_WINDOWS)
+   SleepConditionVariableCS(&_condition, &_monitor, INFINITE);
+#else
+   int32_t rc = pthread_cond_wait(&_condition, &_monitor);
+   TR_ASSERT(rc == 0, "error waiting on monitor\n");
+#endif /* defined(OMR_OS_WINDOWS) */
+   }
+
+void
+OMR::Monitor::notify()
+   {
+#if defined(OMR_OS_WINDOWS)
+   WakeConditionVariable(&_condition);
+#else
+   int32_t rc = pthread_cond_signal(&_condition);
+   TR_ASSERT(rc == 0, "error notifying monitor\n");
+#endif /* defined(OMR_OS_WINDOWS) */
+   }
+
+void
+OMR::Monitor::notifyAll()
+   {
+#if defined(OMR_OS_WINDOWS)
+   WakeAllConditionVariable(&_condition);
+#else
+   int32_t rc = pthread_cond_broadcast(&_condition);
+   TR_ASSERT(rc == 0, "error notifying monitor\n");
+#endif /* defined(OMR_OS_WINDOWS) */
+   }
+
 char const *
 OMR::Monitor::getName()
    {
@@ -50,10 +50,10 @@ class Monitor
    int32_t try_enter() { TR_UNIMPLEMENTED(); }
    int32_t exit(); // returns 0 on success
    void destroy();
-   void wait() { TR_UNIMPLEMENTED(); }
+   void wait(); // the monitor must be held by the caller
    intptr_t wait_timed(int64_t millis, int32_t nanos) { TR_UNIMPLEMENTED(); }
-   void notify() { TR_UNIMPLEMENTED(); }
-   void notifyAll() { TR_UNIMPLEMENTED(); }
+   void notify();
+   void notifyAll();
    int32_t num_waiting() { TR_UNIMPLEMENTED(); }
    char const *getName();
    bool init(char *name);
@@ -70,6 +70,11 @@ class Monitor
 
    char const *_name;
    MUTEX _monitor;
+#if defined(OMR_OS_WINDOWS)
+   CONDITION_VARIABLE _condition;
+#else
+   pthread_cond_t _condition;
+#endif /* defined(OMR_OS_WINDOWS) */
    };
 
 }
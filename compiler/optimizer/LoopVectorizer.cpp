@@ -0,0 +1,779 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "optimizer/LoopVectorizer.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/Block.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/CfgEdge.hpp"
+#include "infra/CfgNode.hpp"
+#include "infra/List.hpp"
+#include "optimizer/InductionVariable.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/Structure.hpp"
+#include "optimizer/TransformUtil.hpp"
+
+#define OPT_DETAILS "O^O LOOP VECTORIZER: "
+
+/* Width in bytes of the vector types in the IL */
+#define VECTOR_LENGTH_IN_BYTES 16
+
+/* Upper bound on the number of array overlap tests in the runtime guard of one loop */
+#define MAX_RUNTIME_CHECKS 8
+
+TR_LoopVectorizer::TR_LoopVectorizer(TR::OptimizationManager *manager)
+   : TR_LoopTransformer(manager),
+     _loopInfos(manager->trMemory())
+   {}
+
+bool TR_LoopVectorizer::shouldPerform()
+   {
+   if (!cg()->getSupportsAutoSIMD() || comp()->getOption(TR_DisableAutoSIMD))
+      {
+      if (trace())
+         traceMsg(comp(), "Vector code generation is not enabled -- returning from loop vectorization.\n");
+      return false;
+      }
+
+   // Address analysis only understands 64-bit address arithmetic
+   //
+   if (!comp()->target().is64Bit())
+      {
+      if (trace())
+         traceMsg(comp(), "Not enabled on 32-bit targets -- returning from loop vectorization.\n");
+      return false;
+      }
+
+   if (!comp()->mayHaveLoops())
+      {
+      if (trace())
+         traceMsg(comp(), "Method does not have loops -- returning from loop vectorization.\n");
+      return false;
+      }
+
+   return true;
+   }
+
+int32_t TR_LoopVectorizer::perform()
+   {
+   _cfg = comp()->getFlowGraph();
+   _rootStructure = _cfg->getStructure();
+   if (_rootStructure == NULL)
+      return 0;
+
+   // From here, down, stack memory allocations will die when the function returns
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+   _loopInfos.init();
+
+   collectLoops(_rootStructure);
+
+   if (_loopInfos.isEmpty())
+      {
+      dumpOptDetails(comp(), "Loop vectorization completed: no loops vectorized\n");
+      return 0;
+      }
+
+   _cfg->setStructure(NULL);
+
+   ListIterator<LoopInfo> it(&_loopInfos);
+   for (LoopInfo *li = it.getFirst(); li; li = it.getNext())
+      transformLoop(li);
+
+   // The vector array shadows are new to the alias sets
+   //
+   optimizer()->setAliasSetsAreValid(false);
+
+   // Induction variable information is lost with the structure
+   //
+   requestOpt(OMR::inductionVariableAnalysis, true);
+
+   return 1;
+   }
+
+const char *
+TR_LoopVectorizer::optDetailString() const throw()
+   {
+   return "O^O LOOP VECTORIZER: ";
+   }
+
+void TR_LoopVectorizer::collectLoops(TR_Structure *str)
+   {
+   TR_RegionStructure *region = str->asRegion();
+
+   if (region == NULL)
+      return;
+
+   bool isInnermost = true;
+   TR_RegionStructure::Cursor it(*region);
+   for (TR_StructureSubGraphNode *node = it.getCurrent(); node; node = it.getNext())
+      {
+      if (node->getStructure()->asRegion())
+         isInnermost = false;
+      collectLoops(node->getStructure());
+      }
+
+   if (!region->isNaturalLoop() || !isInnermost)
+      return;
+
+   if (trace())
+      traceMsg(comp(), "<analyzeLoop loop=%d addr=%p>\n", region->getNumber(), region);
+
+   LoopInfo *li = new (trStackMemory()) LoopInfo(region, trMemory()->currentStackRegion());
+   if (analyzeLoop(li) &&
+       performTransformation(comp(), "%sVectorizing loop %d with vector length %d\n", OPT_DETAILS,
+                             region->getNumber(), li->_vectorLength))
+      {
+      _loopInfos.add(li);
+      }
+
+   if (trace())
+      traceMsg(comp(), "</analyzeLoop>\n");
+   }
+
+bool TR_LoopVectorizer::analyzeLoop(LoopInfo *li)
+   {
+   TR_RegionStructure *region = li->_region;
+
+   TR_ScratchList<TR::Block> blocksInLoop(trMemory());
+   region->getBlocks(&blocksInLoop);
+   if (blocksInLoop.getSize() != 1)
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> body is not a single block\n", region->getNumber());
+      return false;
+      }
+   li->_loopBlock = region->getEntryBlock();
+
+   if (!analyzeLoopControl(li))
+      return false;
+
+   // Every tree in the body other than the induction variable update and the
+   // loop test must be an array element store of a vectorizable expression
+   //
+   NodeSet visited(std::less<TR::Node *>(), NodeSetAllocator(trMemory()->currentStackRegion()));
+   for (TR::TreeTop *tt = li->_loopBlock->getFirstRealTreeTop(); tt != li->_ivStoreTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *node = tt->getNode();
+      if (!node->getOpCode().isStoreIndirect() || !isArrayAccess(li, node))
+         {
+         if (trace())
+            traceMsg(comp(), "\tReject loop %d ==> tree [%p] is not an array element store\n", region->getNumber(), node);
+         return false;
+         }
+
+      if (!isVectorizableExpression(li, node->getSecondChild(), visited))
+         {
+         if (trace())
+            traceMsg(comp(), "\tReject loop %d ==> value stored by [%p] cannot be vectorized\n", region->getNumber(), node);
+         return false;
+         }
+      }
+
+   if (li->_accesses.empty())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> no array element stores\n", region->getNumber());
+      return false;
+      }
+
+   return analyzeDependences(li);
+   }
+
+/**
+ * Recognize the counted loop shape
+ *
+ *    loop:  ...
+ *           istore i (iadd (iload i) (iconst 1))
+ *           ificmplt (i) (bound) --> loop
+ *    exit:
+ *
+ * entered by falling through from a pre-header, where the bound is loop
+ * invariant and the compare may also be le, or gt/ge with swapped operands.
+ */
+bool TR_LoopVectorizer::analyzeLoopControl(LoopInfo *li)
+   {
+   TR_RegionStructure *region = li->_region;
+   TR::Block *loop = li->_loopBlock;
+
+   TR_PrimaryInductionVariable *piv = region->getPrimaryInductionVariable();
+   if (piv == NULL ||
+       piv->getBranchBlock() != loop ||
+       piv->getDeltaOnBackEdge() != 1 ||
+       !piv->getSymRef()->getSymbol()->getDataType().isInt32())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> no 32-bit primary induction variable with unit stride\n", region->getNumber());
+      return false;
+      }
+   li->_ivSymRef = piv->getSymRef();
+
+   if (loop->getPredecessors().size() != 2 ||
+       loop->getSuccessors().size() != 2 ||
+       !loop->getExceptionSuccessors().empty())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> loop has side entries or exits\n", region->getNumber());
+      return false;
+      }
+
+   TR::Block *preHeader = NULL;
+   for (auto e = loop->getPredecessors().begin(); e != loop->getPredecessors().end(); ++e)
+      {
+      TR::Block *from = toBlock((*e)->getFrom());
+      if (from != loop)
+         preHeader = from;
+      }
+
+   // The new blocks are placed between the pre-header and the loop, so the
+   // pre-header must fall through into the loop
+   //
+   if (preHeader == NULL ||
+       preHeader->getNextBlock() != loop ||
+       preHeader->getSuccessors().size() != 1 ||
+       !preHeader->getExceptionSuccessors().empty())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> no fall through pre-header\n", region->getNumber());
+      return false;
+      }
+
+   TR::ILOpCode &lastOp = preHeader->getLastRealTreeTop()->getNode()->getOpCode();
+   if (lastOp.isBranch() || lastOp.isJumpWithMultipleTargets() || lastOp.isReturn())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> pre-header ends in a branch\n", region->getNumber());
+      return false;
+      }
+   li->_preHeader = preHeader;
+
+   // The exit gains the vector epilogue as a predecessor
+   //
+   TR::Block *exit = loop->getNextBlock();
+   if (exit == NULL || exit->isExtensionOfPreviousBlock())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> loop exit is not a separate block\n", region->getNumber());
+      return false;
+      }
+   li->_exitBlock = exit;
+
+   TR::TreeTop *testTree = loop->getLastRealTreeTop();
+   TR::Node *test = testTree->getNode();
+   TR::Node *ivValue = NULL;
+   TR::Node *bound = NULL;
+   switch (test->getOpCodeValue())
+      {
+      case TR::ificmplt:
+      case TR::ificmple:
+         ivValue = test->getFirstChild();
+         bound = test->getSecondChild();
+         li->_inclusiveBound = test->getOpCodeValue() == TR::ificmple;
+         break;
+      case TR::ificmpgt:
+      case TR::ificmpge:
+         ivValue = test->getSecondChild();
+         bound = test->getFirstChild();
+         li->_inclusiveBound = test->getOpCodeValue() == TR::ificmpge;
+         break;
+      default:
+         break;
+      }
+
+   if (bound == NULL || test->getBranchDestination() != loop->getEntry())
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> loop test [%p] is not a signed compare branching back to the loop\n", region->getNumber(), test);
+      return false;
+      }
+
+   TR::TreeTop *ivStoreTree = testTree->getPrevTreeTop();
+   TR::Node *ivStore = ivStoreTree->getNode();
+   if (!ivStore->getOpCode().isStoreDirect() || ivStore->getSymbolReference() != li->_ivSymRef)
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> induction variable is not updated just before the loop test\n", region->getNumber());
+      return false;
+      }
+
+   TR::Node *increment = ivStore->getFirstChild();
+   bool isUnitIncrement = false;
+   if ((increment->getOpCodeValue() == TR::iadd || increment->getOpCodeValue() == TR::isub) &&
+       increment->getFirstChild()->getOpCode().isLoadVarDirect() &&
+       increment->getFirstChild()->getSymbolReference() == li->_ivSymRef &&
+       increment->getSecondChild()->getOpCodeValue() == TR::iconst)
+      {
+      int32_t value = increment->getSecondChild()->getInt();
+      isUnitIncrement = increment->getOpCodeValue() == TR::iadd ? value == 1 : value == -1;
+      }
+
+   if (!isUnitIncrement)
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> induction variable update [%p] is not i = i + 1\n", region->getNumber(), ivStore);
+      return false;
+      }
+
+   // The test must compare the updated value of the induction variable
+   //
+   if (ivValue != increment &&
+       !(ivValue->getOpCode().isLoadVarDirect() &&
+         ivValue->getSymbolReference() == li->_ivSymRef &&
+         ivValue->getReferenceCount() == 1))
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> loop test does not use the updated induction variable\n", region->getNumber());
+      return false;
+      }
+
+   if (!region->isExprInvariant(bound, false))
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject loop %d ==> loop bound [%p] is not invariant\n", region->getNumber(), bound);
+      return false;
+      }
+
+   li->_ivStoreTree = ivStoreTree;
+   li->_bound = bound;
+   return true;
+   }
+
+/**
+ * Check that every pair of accesses in which at least one is a store either
+ * touches the same element in every iteration or touches elements at least a
+ * vector apart. Pairs whose distance is only known at runtime are recorded
+ * for the overlap test in the guard.
+ */
+bool TR_LoopVectorizer::analyzeDependences(LoopInfo *li)
+   {
+   const int64_t vectorBytes = VECTOR_LENGTH_IN_BYTES;
+
+   for (size_t s = 0; s < li->_accesses.size(); ++s)
+      {
+      ArrayAccess &store = li->_accesses[s];
+      if (!store._node->getOpCode().isStore())
+         continue;
+
+      TR::SymbolReference *storeSymRef = store._node->getSymbolReference();
+      for (size_t a = 0; a < li->_accesses.size(); ++a)
+         {
+         ArrayAccess &other = li->_accesses[a];
+         if (a == s || (a < s && other._node->getOpCode().isStore()))
+            continue;
+
+         TR::SymbolReference *otherSymRef = other._node->getSymbolReference();
+         if (storeSymRef != otherSymRef &&
+             !storeSymRef->getUseDefAliases().contains(otherSymRef->getReferenceNumber(), comp()))
+            continue;
+
+         if (isSameBase(store._base, other._base))
+            {
+            int64_t distance = other._offset - store._offset;
+            if (distance == 0 || distance >= vectorBytes || distance <= -vectorBytes)
+               continue;
+
+            if (trace())
+               traceMsg(comp(), "\tReject loop %d ==> [%p] and [%p] are %lld bytes apart\n",
+                        li->_region->getNumber(), store._node, other._node, (long long)distance);
+            return false;
+            }
+
+         bool isDuplicate = false;
+         for (auto c = li->_runtimeChecks.begin(); c != li->_runtimeChecks.end(); ++c)
+            {
+            ArrayAccess &checkedStore = li->_accesses[c->first];
+            ArrayAccess &checkedOther = li->_accesses[c->second];
+            if (isSameBase(checkedStore._base, store._base) &&
+                isSameBase(checkedOther._base, other._base) &&
+                checkedOther._offset - checkedStore._offset == other._offset - store._offset)
+               {
+               isDuplicate = true;
+               break;
+               }
+            }
+         if (isDuplicate)
+            continue;
+
+         if (li->_runtimeChecks.size() == MAX_RUNTIME_CHECKS)
+            {
+            if (trace())
+               traceMsg(comp(), "\tReject loop %d ==> too many runtime overlap checks\n", li->_region->getNumber());
+            return false;
+            }
+
+         if (trace())
+            traceMsg(comp(), "\tRuntime overlap check between [%p] and [%p]\n", store._node, other._node);
+         li->_runtimeChecks.push_back(std::make_pair(s, a));
+         }
+      }
+
+   return true;
+   }
+
+bool TR_LoopVectorizer::isVectorizableExpression(LoopInfo *li, TR::Node *node, NodeSet &visited)
+   {
+   if (visited.find(node) != visited.end())
+      return true;
+
+   if (node->getDataType() != li->_elementType)
+      return false;
+
+   if (li->_region->isExprInvariant(node, false))
+      {
+      li->_invariantExpressions.insert(node);
+      }
+   else if (node->getOpCode().isLoadIndirect())
+      {
+      if (!isArrayAccess(li, node))
+         return false;
+      }
+   else
+      {
+      TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(node->getOpCodeValue());
+      switch (vectorOp)
+         {
+         case TR::vadd:
+         case TR::vsub:
+         case TR::vmul:
+         case TR::vdiv:
+         case TR::vand:
+         case TR::vor:
+         case TR::vxor:
+         case TR::vneg:
+            break;
+         default:
+            return false;
+         }
+
+      if (!cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(vectorOp), li->_elementType))
+         return false;
+
+      for (int32_t i = 0; i < node->getNumChildren(); ++i)
+         {
+         if (!isVectorizableExpression(li, node->getChild(i), visited))
+            return false;
+         }
+      }
+
+   visited.insert(node);
+   return true;
+   }
+
+/**
+ * Record an array element load or store of the loop's element type whose
+ * address is an affine function of the induction variable.
+ */
+bool TR_LoopVectorizer::isArrayAccess(LoopInfo *li, TR::Node *node)
+   {
+   TR::SymbolReference *symRef = node->getSymbolReference();
+   TR::Symbol *sym = symRef->getSymbol();
+   if (!sym->isArrayShadowSymbol() || sym->isVolatile() || symRef->isUnresolved() || node->getOpCode().isWrtBar())
+      return false;
+
+   TR::DataType dt = node->getDataType();
+   if (li->_elementType == TR::NoType)
+      {
+      if (!cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(TR::vloadi), dt) ||
+          !cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(TR::vstorei), dt))
+         return false;
+
+      li->_elementType = dt;
+      li->_vectorLength = VECTOR_LENGTH_IN_BYTES / TR::DataType::getSize(dt);
+      }
+   else if (dt != li->_elementType)
+      {
+      return false;
+      }
+
+   ArrayAccess access;
+   access._node = node;
+   if (!analyzeAddress(li, node->getFirstChild(), access))
+      return false;
+
+   li->_accesses.push_back(access);
+   return true;
+   }
+
+bool TR_LoopVectorizer::analyzeAddress(LoopInfo *li, TR::Node *address, ArrayAccess &access)
+   {
+   if (address->getOpCodeValue() != TR::aladd)
+      return false;
+
+   TR::Node *base = address->getFirstChild();
+   if (!li->_region->isExprInvariant(base, false))
+      return false;
+
+   int64_t constOffset = 0;
+   if (!analyzeOffset(li, address->getSecondChild(), constOffset))
+      return false;
+
+   access._base = base;
+   access._offset = constOffset;
+   return true;
+   }
+
+/**
+ * Match a byte offset of the form i * elementSize + constOffset
+ */
+bool TR_LoopVectorizer::analyzeOffset(LoopInfo *li, TR::Node *offset, int64_t &constOffset)
+   {
+   const int32_t elementSize = TR::DataType::getSize(li->_elementType);
+   TR::Node *secondChild = offset->getNumChildren() == 2 ? offset->getSecondChild() : NULL;
+   int64_t indexOffset = 0;
+
+   switch (offset->getOpCodeValue())
+      {
+      case TR::ladd:
+      case TR::lsub:
+         if (secondChild->getOpCodeValue() != TR::lconst ||
+             !analyzeOffset(li, offset->getFirstChild(), constOffset))
+            return false;
+         constOffset += offset->getOpCodeValue() == TR::ladd ? secondChild->getLongInt() : -secondChild->getLongInt();
+         return true;
+
+      case TR::lmul:
+         if (secondChild->getOpCodeValue() != TR::lconst ||
+             secondChild->getLongInt() != elementSize ||
+             !analyzeIndex(li, offset->getFirstChild(), indexOffset))
+            return false;
+         break;
+
+      case TR::lshl:
+         if (secondChild->getOpCodeValue() != TR::iconst ||
+             secondChild->getInt() < 0 || secondChild->getInt() > 3 ||
+             (1 << secondChild->getInt()) != elementSize ||
+             !analyzeIndex(li, offset->getFirstChild(), indexOffset))
+            return false;
+         break;
+
+      default:
+         if (elementSize != 1 || !analyzeIndex(li, offset, indexOffset))
+            return false;
+         break;
+      }
+
+   constOffset += indexOffset * elementSize;
+   return true;
+   }
+
+/**
+ * Match an element index of the form i2l(i + constOffset)
+ */
+bool TR_LoopVectorizer::analyzeIndex(LoopInfo *li, TR::Node *index, int64_t &constOffset)
+   {
+   if (index->getOpCodeValue() != TR::i2l)
+      return false;
+
+   TR::Node *iv = index->getFirstChild();
+   constOffset = 0;
+   if ((iv->getOpCodeValue() == TR::iadd || iv->getOpCodeValue() == TR::isub) &&
+       iv->getSecondChild()->getOpCodeValue() == TR::iconst)
+      {
+      int64_t value = iv->getSecondChild()->getInt();
+      constOffset = iv->getOpCodeValue() == TR::iadd ? value : -value;
+      iv = iv->getFirstChild();
+      }
+
+   return iv->getOpCode().isLoadVarDirect() && iv->getSymbolReference() == li->_ivSymRef;
+   }
+
+bool TR_LoopVectorizer::isSameBase(TR::Node *base1, TR::Node *base2)
+   {
+   if (base1 == base2)
+      return true;
+
+   return base1->getOpCode().isLoadVarDirect() &&
+          base1->getOpCodeValue() == base2->getOpCodeValue() &&
+          base1->getSymbolReference() == base2->getSymbolReference();
+   }
+
+void TR_LoopVectorizer::transformLoop(LoopInfo *li)
+   {
+   TR::Block *preHeader = li->_preHeader;
+   TR::Block *loop = li->_loopBlock;
+   TR::Block *exit = li->_exitBlock;
+   TR::Node *bbNode = loop->getEntry()->getNode();
+   const int32_t vectorLength = li->_vectorLength;
+
+   // remaining iterations >= vectorLength, adjusted for an inclusive bound
+   //
+   const int64_t threshold = li->_inclusiveBound ? vectorLength - 1 : vectorLength;
+
+   if (trace())
+      traceMsg(comp(), "Vectorizing loop %d: element type %s, vector length %d, %d runtime overlap checks\n",
+               li->_region->getNumber(), TR::DataType::getName(li->_elementType), vectorLength, (int32_t)li->_runtimeChecks.size());
+
+   // Guard: take the scalar loop if less than one vector of iterations remains
+   // or if the arrays overlap within a vector
+   //
+   TR::Block *guardBlock = createBlock(preHeader, preHeader->getFrequency());
+   TR::Node *useScalarLoop = TR::Node::create(TR::lcmplt, 2, createRemainingIterations(li), TR::Node::lconst(bbNode, threshold));
+   TR::Node *overlap = createRuntimeChecks(li);
+   if (overlap)
+      useScalarLoop = TR::Node::create(TR::ior, 2, useScalarLoop, overlap);
+   guardBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmpne, useScalarLoop, TR::Node::iconst(bbNode, 0), loop->getEntry())));
+
+   // Vector loop
+   //
+   TR::Block *vectorBlock = createBlock(loop, loop->getFrequency());
+   TR::SymbolReference *vectorSymRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(li->_elementType.scalarToVector());
+   NodeMap scalarMap(std::less<TR::Node *>(), NodeMapAllocator(trMemory()->currentStackRegion()));
+   NodeMap vectorMap(std::less<TR::Node *>(), NodeMapAllocator(trMemory()->currentStackRegion()));
+   for (TR::TreeTop *tt = loop->getFirstRealTreeTop(); tt != li->_ivStoreTree; tt = tt->getNextTreeTop())
+      {
+      TR::Node *store = tt->getNode();
+      TR::Node *address = cloneScalarExpression(store->getFirstChild(), scalarMap);
+      TR::Node *value = createVectorExpression(li, store->getSecondChild(), vectorMap, scalarMap);
+      vectorBlock->append(TR::TreeTop::create(comp(),
+         TR::Node::createWithSymRef(TR::vstorei, 2, 2, address, value, vectorSymRef)));
+      }
+
+   TR::Node *ivUpdate = TR::Node::create(TR::iadd, 2, TR::Node::createLoad(bbNode, li->_ivSymRef), TR::Node::iconst(bbNode, vectorLength));
+   vectorBlock->append(TR::TreeTop::create(comp(), TR::Node::createStore(li->_ivSymRef, ivUpdate)));
+   vectorBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::iflcmpge, createRemainingIterations(li), TR::Node::lconst(bbNode, threshold), vectorBlock->getEntry())));
+
+   // Epilogue: leave if no iterations remain, otherwise finish in the scalar loop
+   //
+   TR::Block *epilogueBlock = createBlock(preHeader, preHeader->getFrequency());
+   epilogueBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(li->_inclusiveBound ? TR::iflcmplt : TR::iflcmple,
+                         createRemainingIterations(li), TR::Node::lconst(bbNode, 0), exit->getEntry())));
+
+   // Place the new blocks between the pre-header and the loop
+   //
+   preHeader->getExit()->join(guardBlock->getEntry());
+   guardBlock->getExit()->join(vectorBlock->getEntry());
+   vectorBlock->getExit()->join(epilogueBlock->getEntry());
+   epilogueBlock->getExit()->join(loop->getEntry());
+
+   _cfg->addEdge(preHeader, guardBlock);
+   _cfg->addEdge(guardBlock, vectorBlock);
+   _cfg->addEdge(guardBlock, loop);
+   _cfg->addEdge(vectorBlock, vectorBlock);
+   _cfg->addEdge(vectorBlock, epilogueBlock);
+   _cfg->addEdge(epilogueBlock, exit);
+   _cfg->addEdge(epilogueBlock, loop);
+   _cfg->removeEdge(preHeader, loop);
+
+   if (trace())
+      traceMsg(comp(), "\tguard block_%d, vector block_%d, epilogue block_%d before scalar loop block_%d\n",
+               guardBlock->getNumber(), vectorBlock->getNumber(), epilogueBlock->getNumber(), loop->getNumber());
+   }
+
+/**
+ * The number of iterations left to run, as a 64-bit value so that it cannot overflow
+ */
+TR::Node *TR_LoopVectorizer::createRemainingIterations(LoopInfo *li)
+   {
+   TR::Node *bbNode = li->_loopBlock->getEntry()->getNode();
+   TR::Node *bound = TR::Node::create(TR::i2l, 1, li->_bound->duplicateTree());
+   TR::Node *iv = TR::Node::create(TR::i2l, 1, TR::Node::createLoad(bbNode, li->_ivSymRef));
+   return TR::Node::create(TR::lsub, 2, bound, iv);
+   }
+
+/**
+ * Any pair of accesses which may overlap within a vector makes the loop take the scalar path
+ */
+TR::Node *TR_LoopVectorizer::createRuntimeChecks(LoopInfo *li)
+   {
+   TR::Node *result = NULL;
+
+   for (auto c = li->_runtimeChecks.begin(); c != li->_runtimeChecks.end(); ++c)
+      {
+      ArrayAccess &store = li->_accesses[c->first];
+      ArrayAccess &other = li->_accesses[c->second];
+
+      TR::Node *overlap = TR::TransformUtil::createVectorOverlapTest(store._base, store._offset, other._base, other._offset, VECTOR_LENGTH_IN_BYTES);
+      result = result ? TR::Node::create(TR::ior, 2, result, overlap) : overlap;
+      }
+
+   return result;
+   }
+
+TR::Node *TR_LoopVectorizer::cloneScalarExpression(TR::Node *node, NodeMap &scalarMap)
+   {
+   NodeMap::iterator it = scalarMap.find(node);
+   if (it != scalarMap.end())
+      return it->second;
+
+   TR::Node *clone = TR::Node::copy(node);
+   clone->setReferenceCount(0);
+   for (int32_t i = 0; i < node->getNumChildren(); ++i)
+      clone->setAndIncChild(i, cloneScalarExpression(node->getChild(i), scalarMap));
+
+   scalarMap.insert(std::make_pair(node, clone));
+   return clone;
+   }
+
+TR::Node *TR_LoopVectorizer::createVectorExpression(LoopInfo *li, TR::Node *node, NodeMap &vectorMap, NodeMap &scalarMap)
+   {
+   NodeMap::iterator it = vectorMap.find(node);
+   if (it != vectorMap.end())
+      return it->second;
+
+   TR::Node *vectorNode = NULL;
+   if (li->_invariantExpressions.find(node) != li->_invariantExpressions.end())
+      {
+      vectorNode = TR::Node::create(TR::vsplats, 1, cloneScalarExpression(node, scalarMap));
+      }
+   else if (node->getOpCode().isLoadIndirect())
+      {
+      TR::SymbolReference *vectorSymRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(li->_elementType.scalarToVector());
+      vectorNode = TR::Node::createWithSymRef(TR::vloadi, 1, 1, cloneScalarExpression(node->getFirstChild(), scalarMap), vectorSymRef);
+      }
+   else
+      {
+      vectorNode = TR::Node::create(TR::ILOpCode::convertScalarToVector(node->getOpCodeValue()), node->getNumChildren());
+      for (int32_t i = 0; i < node->getNumChildren(); ++i)
+         vectorNode->setAndIncChild(i, createVectorExpression(li, node->getChild(i), vectorMap, scalarMap));
+      }
+
+   vectorMap.insert(std::make_pair(node, vectorNode));
+   return vectorNode;
+   }
+
+TR::Block *TR_LoopVectorizer::createBlock(TR::Block *templateBlock, int32_t frequency)
+   {
+   TR::Block *block = TR::Block::createEmptyBlock(templateBlock->getEntry()->getNode(), comp(), frequency, templateBlock);
+   _cfg->addNode(block);
+   return block;
+   }
@@ -0,0 +1,149 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef LOOPVECTORIZER_INCL
+#define LOOPVECTORIZER_INCL
+
+#include <map>
+#include <set>
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "env/TypedAllocator.hpp"
+#include "il/DataTypes.hpp"
+#include "infra/List.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/LoopCanonicalizer.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+class TR_RegionStructure;
+class TR_Structure;
+namespace TR { class Block; }
+namespace TR { class Node; }
+namespace TR { class Optimization; }
+namespace TR { class SymbolReference; }
+namespace TR { class TreeTop; }
+
+/**
+ * Loop vectorization of counted loops over primitive arrays.
+ *
+ * Innermost single block loops whose only side effects are array element
+ * stores indexed by the primary induction variable are given a vector copy
+ * of the loop body that processes one vector of elements per iteration. The
+ * original loop is kept as the scalar epilogue that finishes the remaining
+ * iterations, and as the fallback when a runtime test finds that the arrays
+ * accessed by the loop overlap within one vector.
+ *
+ * The transformed loop looks like:
+ *
+ *    preheader:  ...
+ *    guard:      if (remaining < VL || arrays overlap) goto scalar loop
+ *    vector:     <vector body>
+ *                i = i + VL
+ *                if (remaining >= VL) goto vector
+ *    epilogue:   if (remaining <= 0) goto loop exit
+ *    scalar:     <original loop>
+ */
+class TR_LoopVectorizer : public TR_LoopTransformer
+   {
+   public:
+   TR_LoopVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_LoopVectorizer(manager);
+      }
+
+   virtual bool    shouldPerform();
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+   typedef TR::typed_allocator<TR::Node *, TR::Region&> NodeSetAllocator;
+   typedef std::set<TR::Node *, std::less<TR::Node *>, NodeSetAllocator> NodeSet;
+
+   typedef TR::typed_allocator<std::pair<TR::Node * const, TR::Node *>, TR::Region&> NodeMapAllocator;
+   typedef std::map<TR::Node *, TR::Node *, std::less<TR::Node *>, NodeMapAllocator> NodeMap;
+
+   /* An array element load or store whose address is _base + i * elementSize + _offset */
+   struct ArrayAccess
+      {
+      TR::Node *_node;
+      TR::Node *_base;
+      int64_t _offset;
+      };
+
+   struct LoopInfo
+      {
+      LoopInfo(TR_RegionStructure *region, TR::Region &memRegion)
+         : _region(region),
+           _preHeader(NULL),
+           _loopBlock(NULL),
+           _exitBlock(NULL),
+           _ivSymRef(NULL),
+           _ivStoreTree(NULL),
+           _bound(NULL),
+           _inclusiveBound(false),
+           _elementType(TR::NoType),
+           _vectorLength(0),
+           _accesses(memRegion),
+           _runtimeChecks(memRegion),
+           _invariantExpressions(std::less<TR::Node *>(), NodeSetAllocator(memRegion))
+         {}
+
+      TR_RegionStructure *_region;
+      TR::Block *_preHeader;
+      TR::Block *_loopBlock;
+      TR::Block *_exitBlock;
+      TR::SymbolReference *_ivSymRef;
+      TR::TreeTop *_ivStoreTree;
+      TR::Node *_bound;
+      bool _inclusiveBound;
+      TR::DataType _elementType;
+      int32_t _vectorLength;
+
+      TR::vector<ArrayAccess, TR::Region&> _accesses;
+      TR::vector<std::pair<size_t, size_t>, TR::Region&> _runtimeChecks;
+      NodeSet _invariantExpressions;
+      };
+
+   TR_ScratchList<LoopInfo> _loopInfos;
+
+   void collectLoops(TR_Structure *str);
+   bool analyzeLoop(LoopInfo *li);
+   bool analyzeLoopControl(LoopInfo *li);
+   bool analyzeDependences(LoopInfo *li);
+   bool isVectorizableExpression(LoopInfo *li, TR::Node *node, NodeSet &visited);
+   bool isArrayAccess(LoopInfo *li, TR::Node *node);
+   bool analyzeAddress(LoopInfo *li, TR::Node *address, ArrayAccess &access);
+   bool analyzeOffset(LoopInfo *li, TR::Node *offset, int64_t &constOffset);
+   bool analyzeIndex(LoopInfo *li, TR::Node *index, int64_t &constOffset);
+   bool isSameBase(TR::Node *base1, TR::Node *base2);
+
+   void transformLoop(LoopInfo *li);
+   TR::Node *createRemainingIterations(LoopInfo *li);
+   TR::Node *createRuntimeChecks(LoopInfo *li);
+   TR::Node *cloneScalarExpression(TR::Node *node, NodeMap &scalarMap);
+   TR::Node *createVectorExpression(LoopInfo *li, TR::Node *node, NodeMap &vectorMap, NodeMap &scalarMap);
+   TR::Block *createBlock(TR::Block *templateBlock, int32_t frequency);
+   };
+
+#endif
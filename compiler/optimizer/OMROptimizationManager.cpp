@@ -189,6 +189,9 @@ OMR::OptimizationManager::OptimizationManager(TR::Optimizer *o, OptimizationFact
       case OMR::stripMining:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
+      case OMR::loopVectorization:
+         _flags.set(requiresStructure | checkStructure | dumpStructure);
+         break;
       case OMR::prefetchInsertion:
          _flags.set(requiresStructure | checkStructure | dumpStructure);
          break;
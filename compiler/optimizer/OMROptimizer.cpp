@@ -106,6 +106,8 @@
 #include "optimizer/OSRDefAnalysis.hpp"
 #include "optimizer/PrefetchInsertion.hpp"
 #include "optimizer/StripMiner.hpp"
+#include "optimizer/LoopVectorizer.hpp"
+#include "optimizer/SLPVectorizer.hpp"
 #include "optimizer/FieldPrivatizer.hpp"
 #include "optimizer/ReorderIndexExpr.hpp"
 #include "optimizer/GlobalRegisterAllocator.hpp"
@@ -444,6 +446,13 @@ const OptimizationStrategy stripMiningOpts[] =
    { endGroup                             }
    };
 
+const OptimizationStrategy loopVectorizationOpts[] =
+   {
+   { inductionVariableAnalysis,   IfLoops },
+   { loopVectorization,           IfLoops },
+   { endGroup                             }
+   };
+
 const OptimizationStrategy prefetchInsertionOpts[] =
    {
    { inductionVariableAnalysis            },
@@ -609,8 +618,10 @@ static const OptimizationStrategy omrHotStrategyOpts[] =
    { OMR::globalDeadStoreElimination,                        },
    { OMR::inductionVariableAnalysis,                         },
    { OMR::loopSpecializerGroup,                              },
+   { OMR::loopVectorizationGroup,                            }, // vectorize counted loops over arrays
    { OMR::inductionVariableAnalysis,                         },
    { OMR::generalLoopUnroller,                               }, // unroll Loops
+   { OMR::slpVectorization,                                  }, // pack adjacent array element stores
    { OMR::blockSplitter,            OMR::MarkLastRun         },
    { OMR::blockManipulationGroup                             },
    { OMR::lateLocalGroup                                     },
@@ -852,6 +863,10 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), TR_PrefetchInsertion::create, OMR::prefetchInsertion);
    _opts[OMR::stripMining] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_StripMiner::create, OMR::stripMining);
+   _opts[OMR::loopVectorization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVectorizer::create, OMR::loopVectorization);
+   _opts[OMR::slpVectorization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_SLPVectorizer::create, OMR::slpVectorization);
    _opts[OMR::fieldPrivatization] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_FieldPrivatizer::create, OMR::fieldPrivatization);
    _opts[OMR::reorderArrayIndexExpr] =
@@ -893,6 +908,8 @@ OMR::Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *metho
       new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::earlyLocalGroup, earlyLocalOpts);
    _opts[OMR::stripMiningGroup] =
       new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::stripMiningGroup, stripMiningOpts);
+   _opts[OMR::loopVectorizationGroup] =
+      new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::loopVectorizationGroup, loopVectorizationOpts);
    _opts[OMR::arrayPrivatizationGroup] =
       new (comp->allocator()) TR::OptimizationManager(self(), NULL, OMR::arrayPrivatizationGroup, arrayPrivatizationOpts);
    _opts[OMR::veryCheapGlobalValuePropagationGroup] =
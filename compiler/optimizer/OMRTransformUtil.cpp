@@ -395,6 +395,16 @@ OMR::TransformUtil::transformCallNodeToPassThrough(TR::Optimization* opt, TR::No
    node = TR::Node::recreateWithoutProperties(node, TR::PassThrough, 1, child);
    }
 
+TR::Node *
+OMR::TransformUtil::createVectorOverlapTest(TR::Node *firstBase, int64_t firstOffset, TR::Node *secondBase, int64_t secondOffset, int64_t vectorBytes)
+   {
+   TR::Node *distance = TR::Node::create(TR::lsub, 2,
+                                         TR::Node::create(TR::a2l, 1, secondBase->duplicateTree()),
+                                         TR::Node::create(TR::a2l, 1, firstBase->duplicateTree()));
+   distance = TR::Node::create(TR::ladd, 2, distance, TR::Node::lconst(distance, secondOffset - firstOffset + vectorBytes - 1));
+   return TR::Node::create(TR::lucmplt, 2, distance, TR::Node::lconst(distance, 2 * vectorBytes - 1));
+   }
+
 void
 OMR::TransformUtil::createConditionalAlternatePath(TR::Compilation* comp,
                                                    TR::TreeTop *ifTree,
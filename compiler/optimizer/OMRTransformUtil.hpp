@@ -122,6 +122,33 @@ class OMR_EXTENSIBLE TransformUtil
     */
    static void transformCallNodeToPassThrough(TR::Optimization* opt, TR::Node* node, TR::TreeTop * anchorTree, TR::Node* child);
 
+   /**
+    * \brief
+    *    Create a test of whether two array accesses overlap within one vector.
+    *    The accesses overlap when the distance d between them satisfies
+    *    -vectorBytes < d < vectorBytes, which is tested as one unsigned compare
+    *    of d + vectorBytes - 1.
+    *
+    * \parm firstBase
+    *    The base address of the first access; it is duplicated.
+    *
+    * \parm firstOffset
+    *    The constant byte offset of the first access from firstBase.
+    *
+    * \parm secondBase
+    *    The base address of the second access; it is duplicated.
+    *
+    * \parm secondOffset
+    *    The constant byte offset of the second access from secondBase.
+    *
+    * \parm vectorBytes
+    *    The length in bytes of the vectors the accesses are widened to.
+    *
+    * \return
+    *    An int node that is non-zero when the accesses overlap.
+    */
+   static TR::Node *createVectorOverlapTest(TR::Node *firstBase, int64_t firstOffset, TR::Node *secondBase, int64_t secondOffset, int64_t vectorBytes);
+
    /**
     *    \brief
     *       Create a conditional alternate implementation path for existing operations. Two blocks will be inserted, one
@@ -0,0 +1,870 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "optimizer/SLPVectorizer.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include "codegen/CodeGenerator.hpp"
+#include "compile/Compilation.hpp"
+#include "compile/SymbolReferenceTable.hpp"
+#include "control/Options.hpp"
+#include "control/Options_inlines.hpp"
+#include "env/CompilerEnv.hpp"
+#include "il/Block.hpp"
+#include "il/DataTypes.hpp"
+#include "il/ILOpCodes.hpp"
+#include "il/ILOps.hpp"
+#include "il/Node.hpp"
+#include "il/Node_inlines.hpp"
+#include "il/Symbol.hpp"
+#include "il/SymbolReference.hpp"
+#include "il/TreeTop.hpp"
+#include "il/TreeTop_inlines.hpp"
+#include "infra/Cfg.hpp"
+#include "infra/Checklist.hpp"
+#include "optimizer/Optimization_inlines.hpp"
+#include "optimizer/Optimizer.hpp"
+#include "optimizer/TransformUtil.hpp"
+#include "ras/DebugCounter.hpp"
+
+#define OPT_DETAILS "O^O SLP VECTORIZER: "
+
+/* Width in bytes of the vector types in the IL */
+#define VECTOR_LENGTH_IN_BYTES 16
+
+/* Upper bound on the number of overlap tests guarding one run of packs */
+#define MAX_OVERLAP_CHECKS 4
+
+/* Estimated cost, in scalar operations, of one overlap test and of the branches selecting a version */
+#define OVERLAP_CHECK_COST 4
+#define VERSIONING_COST 2
+
+TR_SLPVectorizer::TR_SLPVectorizer(TR::OptimizationManager *manager)
+   : TR::Optimization(manager)
+   {}
+
+bool TR_SLPVectorizer::shouldPerform()
+   {
+   if (!cg()->getSupportsAutoSIMD() || comp()->getOption(TR_DisableAutoSIMD))
+      {
+      if (trace())
+         traceMsg(comp(), "Vector code generation is not enabled -- returning from SLP vectorization.\n");
+      return false;
+      }
+
+   // Overlap tests are built on 64-bit address arithmetic
+   //
+   if (!comp()->target().is64Bit())
+      {
+      if (trace())
+         traceMsg(comp(), "Not enabled on 32-bit targets -- returning from SLP vectorization.\n");
+      return false;
+      }
+
+   return true;
+   }
+
+/**
+ * Walk the trees looking for runs of adjacent packs. The packs of a run are
+ * versioned together, so that one guard covers every overlap test the run
+ * needs, and the run is only transformed when the vector code, including the
+ * guard, is estimated to be cheaper than the scalar code it replaces.
+ */
+int32_t TR_SLPVectorizer::perform()
+   {
+   // From here, down, stack memory allocations will die when the function returns
+   TR::StackMemoryRegion stackMemoryRegion(*trMemory());
+   TR::Region &memRegion = trMemory()->currentStackRegion();
+
+   int32_t numPacksFormed = 0;
+   TR::Block *block = NULL;
+   TR::TreeTop *tt = comp()->getStartTree();
+   while (tt)
+      {
+      TR::Node *node = tt->getNode();
+      if (node->getOpCodeValue() == TR::BBStart)
+         block = node->getBlock();
+
+      if (!isCandidateStore(node))
+         {
+         tt = tt->getNextTreeTop();
+         continue;
+         }
+
+      TR::vector<OverlapCheck, TR::Region&> checks(memRegion);
+      NodeCountMap splats((std::less<TR::Node *>()), NodeCountMapAllocator(memRegion));
+      int32_t numPacks = 0;
+      int32_t scalar = 0;
+      int32_t vector = 0;
+      TR::TreeTop *lastTree = NULL;
+      for (TR::TreeTop *cursor = tt; isCandidateStore(cursor->getNode()); cursor = lastTree->getNextTreeTop())
+         {
+         Pack pack(memRegion);
+         if (!analyzePack(pack, cursor, false))
+            break;
+
+         size_t numChecks = checks.size();
+         for (auto c = pack._checks.begin(); c != pack._checks.end(); ++c)
+            addOverlapCheck(checks, NULL, *c);
+         if (checks.size() > MAX_OVERLAP_CHECKS)
+            {
+            checks.resize(numChecks);
+            break;
+            }
+
+         scalar += scalarCost(pack);
+         vector += vectorCost(pack, splats);
+         lastTree = pack._lastTree;
+         numPacks++;
+         }
+
+      if (numPacks == 0)
+         {
+         tt = tt->getNextTreeTop();
+         continue;
+         }
+
+      TR::TreeTop *nextTree = lastTree->getNextTreeTop();
+      bool needsVersioning = !checks.empty();
+      if (needsVersioning)
+         vector += (int32_t)checks.size() * OVERLAP_CHECK_COST + VERSIONING_COST;
+
+      if (trace())
+         traceMsg(comp(), "Run of %d packs starting at [%p] in block_%d: scalar cost %d, vector cost %d, %d overlap tests\n",
+                  numPacks, tt->getNode(), block->getNumber(), scalar, vector, (int32_t)checks.size());
+
+      if (vector >= scalar)
+         {
+         if (trace())
+            traceMsg(comp(), "\tReject run ==> not profitable\n");
+         tt = nextTree;
+         continue;
+         }
+
+      // Splitting does not uncommon nodes from the earlier blocks of an extended block
+      //
+      if (needsVersioning && block->isExtensionOfPreviousBlock())
+         {
+         if (trace())
+            traceMsg(comp(), "\tReject run ==> block_%d is an extension of the previous block\n", block->getNumber());
+         tt = nextTree;
+         continue;
+         }
+
+      if (!performTransformation(comp(), "%sPacking %d vectors of stores starting at [%p]%s\n", OPT_DETAILS,
+                                 numPacks, tt->getNode(), needsVersioning ? " guarded by an overlap test" : ""))
+         {
+         tt = nextTree;
+         continue;
+         }
+
+      if (needsVersioning)
+         tt = versionRun(tt, lastTree, numPacks);
+      else
+         tt = vectorizePacks(tt, numPacks, false);
+
+      numPacksFormed += numPacks;
+      }
+
+   if (numPacksFormed == 0)
+      return 0;
+
+   // The vector array shadows are new to the alias sets
+   //
+   optimizer()->setAliasSetsAreValid(false);
+
+   // Packing anchors the commoned children of the scalar stores
+   //
+   requestOpt(OMR::deadTreesElimination, true);
+
+   return numPacksFormed;
+   }
+
+const char *
+TR_SLPVectorizer::optDetailString() const throw()
+   {
+   return "O^O SLP VECTORIZER: ";
+   }
+
+bool TR_SLPVectorizer::isCandidateStore(TR::Node *node)
+   {
+   if (!node->getOpCode().isStoreIndirect() || node->getOpCode().isWrtBar())
+      return false;
+
+   TR::SymbolReference *symRef = node->getSymbolReference();
+   TR::Symbol *sym = symRef->getSymbol();
+   if (!sym->isArrayShadowSymbol() || sym->isVolatile() || symRef->isUnresolved())
+      return false;
+
+   TR::DataType dt = node->getDataType();
+   return dt.scalarToVector() != TR::NoType &&
+          cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(TR::vloadi), dt) &&
+          cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(TR::vstorei), dt);
+   }
+
+int32_t TR_SLPVectorizer::getNumLanes(TR::Node *store)
+   {
+   return VECTOR_LENGTH_IN_BYTES / TR::DataType::getSize(store->getDataType());
+   }
+
+/**
+ * Match one vector worth of adjacent stores starting at firstTree to the
+ * consecutive elements of an array, and build the vector expression for the
+ * values they store.
+ */
+bool TR_SLPVectorizer::analyzePack(Pack &pack, TR::TreeTop *firstTree, bool assumeNoOverlap)
+   {
+   TR::Node *firstStore = firstTree->getNode();
+   if (!isCandidateStore(firstStore))
+      return false;
+
+   const int32_t numLanes = getNumLanes(firstStore);
+   const int64_t elementSize = TR::DataType::getSize(firstStore->getDataType());
+   pack._firstTree = firstTree;
+   pack._elementType = firstStore->getDataType();
+   pack._numLanes = numLanes;
+
+   TR::TreeTop *trees[VECTOR_LENGTH_IN_BYTES];
+   TR::TreeTop *tt = firstTree;
+   for (int32_t i = 0; i < numLanes; ++i, tt = tt->getNextTreeTop())
+      {
+      if (!isCandidateStore(tt->getNode()) || tt->getNode()->getSymbolReference() != firstStore->getSymbolReference())
+         return false;
+      trees[i] = tt;
+      }
+   pack._lastTree = trees[numLanes - 1];
+
+   TR::NodeChecklist visited(comp());
+   for (int32_t i = 0; i < numLanes; ++i)
+      countInternalReferences(pack, trees[i]->getNode(), visited);
+
+   // Lane 0 stores the element with the lowest address
+   //
+   Address addresses[VECTOR_LENGTH_IN_BYTES];
+   int32_t lowest = 0;
+   for (int32_t i = 0; i < numLanes; ++i)
+      {
+      analyzeAddress(trees[i]->getNode()->getFirstChild(), addresses[i]);
+      if (addresses[i]._offset < addresses[lowest]._offset)
+         lowest = i;
+      }
+
+   pack._lanes.assign(numLanes, NULL);
+   for (int32_t i = 0; i < numLanes; ++i)
+      {
+      int64_t distance = addresses[i]._offset - addresses[lowest]._offset;
+      if (!isSameArray(&pack, addresses[i], addresses[lowest]) ||
+          distance % elementSize != 0 ||
+          distance / elementSize >= numLanes ||
+          pack._lanes[distance / elementSize] != NULL)
+         {
+         if (trace())
+            traceMsg(comp(), "\tReject pack at [%p] ==> stores are not to consecutive elements\n", firstStore);
+         return false;
+         }
+      pack._lanes[distance / elementSize] = trees[i];
+      }
+   pack._storeAddress = addresses[lowest];
+
+   TR::Node *values[VECTOR_LENGTH_IN_BYTES];
+   for (int32_t lane = 0; lane < numLanes; ++lane)
+      values[lane] = pack._lanes[lane]->getNode()->getSecondChild();
+
+   if (packExpression(pack, values) < 0)
+      {
+      if (trace())
+         traceMsg(comp(), "\tReject pack at [%p] ==> stored values are not isomorphic\n", firstStore);
+      return false;
+      }
+
+   return analyzeDependences(pack, assumeNoOverlap);
+   }
+
+void TR_SLPVectorizer::countInternalReferences(Pack &pack, TR::Node *node, TR::NodeChecklist &visited)
+   {
+   if (visited.contains(node))
+      return;
+   visited.add(node);
+
+   for (int32_t i = 0; i < node->getNumChildren(); ++i)
+      {
+      TR::Node *child = node->getChild(i);
+      pack._internalReferences[child] += 1;
+      countInternalReferences(pack, child, visited);
+      }
+   }
+
+/**
+ * A node whose every reference is in the trees of the pack is evaluated
+ * within the pack, so it can be moved along with the pack.
+ */
+bool TR_SLPVectorizer::isInternal(Pack &pack, TR::Node *node)
+   {
+   NodeCountMap::iterator it = pack._internalReferences.find(node);
+   return it != pack._internalReferences.end() && it->second == node->getReferenceCount();
+   }
+
+/**
+ * Build the vector node for the given node of every lane, returning its index
+ * in the pack or -1 if the lanes cannot be packed.
+ */
+int32_t TR_SLPVectorizer::packExpression(Pack &pack, TR::Node **nodes)
+   {
+   const int32_t numLanes = pack._numLanes;
+   const int64_t elementSize = TR::DataType::getSize(pack._elementType);
+   TR::Node *lane0 = nodes[0];
+
+   NodeCountMap::iterator it = pack._nodeIndex.find(lane0);
+   if (it != pack._nodeIndex.end())
+      {
+      int32_t index = it->second;
+      for (int32_t lane = 0; lane < numLanes; ++lane)
+         {
+         if (pack._laneNodes[index * numLanes + lane] != nodes[lane])
+            return -1;
+         }
+      return index;
+      }
+
+   if (lane0->getDataType() != pack._elementType)
+      return -1;
+
+   int32_t index = (int32_t)pack._nodes.size();
+   PackNode packNode;
+   packNode._kind = Splat;
+   packNode._lane0 = lane0;
+   packNode._children[0] = packNode._children[1] = -1;
+   pack._nodes.push_back(packNode);
+   for (int32_t lane = 0; lane < numLanes; ++lane)
+      pack._laneNodes.push_back(nodes[lane]);
+   pack._nodeIndex.insert(std::make_pair(lane0, index));
+
+   bool isSplat = isSplatCandidate(lane0);
+   for (int32_t lane = 1; isSplat && lane < numLanes; ++lane)
+      isSplat = isSameExpression(&pack, lane0, nodes[lane]);
+   if (isSplat)
+      return index;
+
+   TR::ILOpCodes op = lane0->getOpCodeValue();
+   for (int32_t lane = 0; lane < numLanes; ++lane)
+      {
+      if (nodes[lane]->getOpCodeValue() != op || !isInternal(pack, nodes[lane]))
+         return -1;
+      }
+
+   if (lane0->getOpCode().isLoadIndirect())
+      {
+      TR::SymbolReference *symRef = lane0->getSymbolReference();
+      TR::Symbol *sym = symRef->getSymbol();
+      if (!sym->isArrayShadowSymbol() || sym->isVolatile() || symRef->isUnresolved())
+         return -1;
+
+      Address lane0Address;
+      analyzeAddress(lane0->getFirstChild(), lane0Address);
+      for (int32_t lane = 1; lane < numLanes; ++lane)
+         {
+         Address address;
+         analyzeAddress(nodes[lane]->getFirstChild(), address);
+         if (nodes[lane]->getSymbolReference() != symRef ||
+             !isSameArray(&pack, address, lane0Address) ||
+             address._offset != lane0Address._offset + lane * elementSize)
+            return -1;
+         }
+
+      pack._nodes[index]._kind = VectorLoad;
+      pack._nodes[index]._address = lane0Address;
+      return index;
+      }
+
+   TR::ILOpCodes vectorOp = TR::ILOpCode::convertScalarToVector(op);
+   switch (vectorOp)
+      {
+      case TR::vadd:
+      case TR::vsub:
+      case TR::vmul:
+      case TR::vdiv:
+      case TR::vand:
+      case TR::vor:
+      case TR::vxor:
+      case TR::vneg:
+         break;
+      default:
+         return -1;
+      }
+
+   if (!cg()->getSupportsOpCodeForAutoSIMD(TR::ILOpCode(vectorOp), pack._elementType))
+      return -1;
+
+   for (int32_t i = 0; i < lane0->getNumChildren(); ++i)
+      {
+      TR::Node *children[VECTOR_LENGTH_IN_BYTES];
+      for (int32_t lane = 0; lane < numLanes; ++lane)
+         children[lane] = nodes[lane]->getChild(i);
+
+      int32_t child = packExpression(pack, children);
+      if (child < 0)
+         return -1;
+      pack._nodes[index]._children[i] = child;
+      }
+
+   pack._nodes[index]._kind = VectorOp;
+   return index;
+   }
+
+/**
+ * A value that can be computed ahead of the stores of the pack without
+ * reading memory they might write.
+ */
+bool TR_SLPVectorizer::isSplatCandidate(TR::Node *node)
+   {
+   TR::ILOpCode &op = node->getOpCode();
+   if (op.isLoadConst())
+      return true;
+
+   if (op.isLoadVarDirect())
+      {
+      TR::Symbol *sym = node->getSymbol();
+      return sym->isAutoOrParm() && !sym->isVolatile();
+      }
+
+   if (op.hasSymbolReference() || op.isCall() || node->getNumChildren() == 0)
+      return false;
+
+   for (int32_t i = 0; i < node->getNumChildren(); ++i)
+      {
+      if (!isSplatCandidate(node->getChild(i)))
+         return false;
+      }
+
+   return true;
+   }
+
+/**
+ * Whether two nodes compute the same value. Distinct loads of the same
+ * variable are only known to be equal if both are evaluated within the pack,
+ * which contains no direct stores; without a pack the caller guarantees that
+ * the variables are not written between the two loads.
+ */
+bool TR_SLPVectorizer::isSameExpression(Pack *pack, TR::Node *node1, TR::Node *node2)
+   {
+   if (node1 == node2)
+      return true;
+
+   if (node1->getOpCodeValue() != node2->getOpCodeValue() ||
+       node1->getNumChildren() != node2->getNumChildren())
+      return false;
+
+   TR::ILOpCode &op = node1->getOpCode();
+   if (op.isLoadConst())
+      {
+      switch (node1->getDataType())
+         {
+         case TR::Float:
+            return node1->getFloatBits() == node2->getFloatBits();
+         case TR::Double:
+            return node1->getDoubleBits() == node2->getDoubleBits();
+         case TR::Address:
+            return node1->getAddress() == node2->getAddress();
+         default:
+            return node1->getDataType().isIntegral() &&
+                   node1->get64bitIntegralValue() == node2->get64bitIntegralValue();
+         }
+      }
+
+   if (op.isLoadVarDirect())
+      {
+      return node1->getSymbolReference() == node2->getSymbolReference() &&
+             (pack == NULL || (isInternal(*pack, node1) && isInternal(*pack, node2)));
+      }
+
+   if (op.hasSymbolReference() || op.isCall())
+      return false;
+
+   for (int32_t i = 0; i < node1->getNumChildren(); ++i)
+      {
+      if (!isSameExpression(pack, node1->getChild(i), node2->getChild(i)))
+         return false;
+      }
+
+   return true;
+   }
+
+void TR_SLPVectorizer::analyzeAddress(TR::Node *address, Address &result)
+   {
+   result._base = address;
+   result._index = NULL;
+   result._scale = 0;
+   result._offset = 0;
+
+   if (address->getOpCodeValue() == TR::aladd || address->getOpCodeValue() == TR::aiadd)
+      {
+      result._base = address->getFirstChild();
+      analyzeOffset(address->getSecondChild(), 1, result);
+      }
+   }
+
+/**
+ * Split a byte offset into a constant and at most one variable index term
+ */
+void TR_SLPVectorizer::analyzeOffset(TR::Node *offset, int64_t scale, Address &result)
+   {
+   TR::Node *secondChild = offset->getNumChildren() == 2 ? offset->getSecondChild() : NULL;
+   bool isConstSecondChild = secondChild && secondChild->getOpCode().isLoadConst() && secondChild->getDataType().isIntegral();
+
+   switch (offset->getOpCodeValue())
+      {
+      case TR::lconst:
+      case TR::iconst:
+         result._offset += offset->get64bitIntegralValue() * scale;
+         return;
+
+      case TR::ladd:
+      case TR::iadd:
+         if (!isConstSecondChild)
+            break;
+         analyzeOffset(offset->getFirstChild(), scale, result);
+         result._offset += secondChild->get64bitIntegralValue() * scale;
+         return;
+
+      case TR::lsub:
+      case TR::isub:
+         if (!isConstSecondChild)
+            break;
+         analyzeOffset(offset->getFirstChild(), scale, result);
+         result._offset -= secondChild->get64bitIntegralValue() * scale;
+         return;
+
+      case TR::lmul:
+      case TR::imul:
+         if (!isConstSecondChild)
+            break;
+         analyzeOffset(offset->getFirstChild(), scale * secondChild->get64bitIntegralValue(), result);
+         return;
+
+      case TR::lshl:
+      case TR::ishl:
+         if (!isConstSecondChild || secondChild->get64bitIntegralValue() < 0 || secondChild->get64bitIntegralValue() > 31)
+            break;
+         analyzeOffset(offset->getFirstChild(), scale << secondChild->get64bitIntegralValue(), result);
+         return;
+
+      case TR::i2l:
+         analyzeOffset(offset->getFirstChild(), scale, result);
+         return;
+
+      default:
+         break;
+      }
+
+   result._index = offset;
+   result._scale = scale;
+   }
+
+bool TR_SLPVectorizer::isSameArray(Pack *pack, const Address &address1, const Address &address2)
+   {
+   if (!isSameExpression(pack, address1._base, address2._base) || address1._scale != address2._scale)
+      return false;
+
+   if (address1._index == NULL || address2._index == NULL)
+      return address1._index == address2._index;
+
+   return isSameExpression(pack, address1._index, address2._index);
+   }
+
+/**
+ * The loads of every lane are moved ahead of the stores of the other lanes.
+ * A load through the same array as the stores must not read an element that
+ * another lane stores; a load through a different array that may alias the
+ * stores needs a runtime test that the two are more than a vector apart.
+ */
+bool TR_SLPVectorizer::analyzeDependences(Pack &pack, bool assumeNoOverlap)
+   {
+   const int32_t numLanes = pack._numLanes;
+   const int64_t elementSize = TR::DataType::getSize(pack._elementType);
+   TR::SymbolReference *storeSymRef = pack._lanes[0]->getNode()->getSymbolReference();
+
+   for (auto n = pack._nodes.begin(); n != pack._nodes.end(); ++n)
+      {
+      if (n->_kind != VectorLoad)
+         continue;
+
+      TR::SymbolReference *loadSymRef = n->_lane0->getSymbolReference();
+      if (loadSymRef != storeSymRef &&
+          !storeSymRef->getUseDefAliases().contains(loadSymRef->getReferenceNumber(), comp()))
+         continue;
+
+      if (isSameArray(&pack, pack._storeAddress, n->_address))
+         {
+         int64_t distance = n->_address._offset - pack._storeAddress._offset;
+         for (int32_t storeLane = 0; storeLane < numLanes; ++storeLane)
+            {
+            for (int32_t loadLane = 0; loadLane < numLanes; ++loadLane)
+               {
+               int64_t laneDistance = distance + (loadLane - storeLane) * elementSize;
+               if (loadLane != storeLane && laneDistance > -elementSize && laneDistance < elementSize)
+                  {
+                  if (trace())
+                     traceMsg(comp(), "\tReject pack at [%p] ==> lane %d loads the element stored by lane %d\n",
+                              pack._firstTree->getNode(), loadLane, storeLane);
+                  return false;
+                  }
+               }
+            }
+         continue;
+         }
+
+      if (assumeNoOverlap)
+         continue;
+
+      // The distance between the arrays is only known at runtime, so the
+      // guard must be able to recompute both base addresses
+      //
+      bool isSameIndex = n->_address._scale == pack._storeAddress._scale &&
+                         (n->_address._index == NULL ?
+                            pack._storeAddress._index == NULL :
+                            pack._storeAddress._index != NULL && isSameExpression(&pack, n->_address._index, pack._storeAddress._index));
+      if (!isSameIndex || !isSplatCandidate(n->_address._base) || !isSplatCandidate(pack._storeAddress._base))
+         {
+         if (trace())
+            traceMsg(comp(), "\tReject pack at [%p] ==> cannot test the overlap with load [%p]\n", pack._firstTree->getNode(), n->_lane0);
+         return false;
+         }
+
+      OverlapCheck check;
+      check._store = pack._storeAddress;
+      check._load = n->_address;
+      addOverlapCheck(pack._checks, &pack, check);
+      }
+
+   return true;
+   }
+
+void TR_SLPVectorizer::addOverlapCheck(TR::vector<OverlapCheck, TR::Region&> &checks, Pack *pack, const OverlapCheck &check)
+   {
+   for (auto c = checks.begin(); c != checks.end(); ++c)
+      {
+      if (isSameArray(pack, c->_store, check._store) &&
+          isSameArray(pack, c->_load, check._load) &&
+          c->_load._offset - c->_store._offset == check._load._offset - check._store._offset)
+         return;
+      }
+
+   checks.push_back(check);
+   }
+
+/**
+ * Every lane evaluates its own store, loads and arithmetic; values that are
+ * the same in every lane are evaluated once.
+ */
+int32_t TR_SLPVectorizer::scalarCost(Pack &pack)
+   {
+   int32_t cost = 1;
+   for (auto n = pack._nodes.begin(); n != pack._nodes.end(); ++n)
+      {
+      if (n->_kind != Splat)
+         cost++;
+      }
+   return cost * pack._numLanes;
+   }
+
+/**
+ * One vector operation per node of the expression, plus one splat for each
+ * distinct value that is the same in every lane of the packs in the run.
+ */
+int32_t TR_SLPVectorizer::vectorCost(Pack &pack, NodeCountMap &splats)
+   {
+   int32_t cost = 1;
+   for (auto n = pack._nodes.begin(); n != pack._nodes.end(); ++n)
+      {
+      if (n->_kind != Splat)
+         cost++;
+      else if (splats.insert(std::make_pair(n->_lane0, 1)).second)
+         cost++;
+      }
+   return cost;
+   }
+
+/**
+ * Split the run out into its own block, copy it, and vectorize the copy,
+ * which is entered unless a runtime test finds that the arrays overlap.
+ */
+TR::TreeTop *TR_SLPVectorizer::versionRun(TR::TreeTop *firstTree, TR::TreeTop *lastTree, int32_t numPacks)
+   {
+   TR::Region &memRegion = trMemory()->currentStackRegion();
+   TR::CFG *cfg = comp()->getFlowGraph();
+   cfg->setStructure(NULL);
+
+   TR::Block *block = firstTree->getEnclosingBlock();
+   TR::Block *scalarBlock = block->split(firstTree, cfg, true);
+   TR::Block *remainderBlock = NULL;
+   if (lastTree->getNextTreeTop() == scalarBlock->getExit())
+      remainderBlock = scalarBlock->getNextBlock();
+   else
+      remainderBlock = scalarBlock->split(lastTree->getNextTreeTop(), cfg, true);
+
+   // The overlap tests are built from the trees as they are after splitting,
+   // where values commoned across the split have been replaced by temps
+   //
+   TR::vector<OverlapCheck, TR::Region&> checks(memRegion);
+   TR::TreeTop *tt = scalarBlock->getFirstRealTreeTop();
+   for (int32_t i = 0; i < numPacks && isCandidateStore(tt->getNode()); ++i)
+      {
+      Pack pack(memRegion);
+      if (analyzePack(pack, tt, false))
+         {
+         for (auto c = pack._checks.begin(); c != pack._checks.end(); ++c)
+            addOverlapCheck(checks, NULL, *c);
+         }
+
+      for (int32_t lane = getNumLanes(tt->getNode()); lane > 0; --lane)
+         tt = tt->getNextTreeTop();
+      }
+
+   if (checks.empty())
+      {
+      vectorizePacks(scalarBlock->getFirstRealTreeTop(), numPacks, false);
+      return remainderBlock->getEntry();
+      }
+
+   TR::Node *overlap = NULL;
+   for (auto c = checks.begin(); c != checks.end(); ++c)
+      {
+      TR::Node *test = TR::TransformUtil::createVectorOverlapTest(c->_store._base, c->_store._offset, c->_load._base, c->_load._offset, VECTOR_LENGTH_IN_BYTES);
+      overlap = overlap ? TR::Node::create(TR::ior, 2, overlap, test) : test;
+      }
+
+   TR_BlockCloner cloner(cfg, false, true);
+   TR::Block *vectorBlock = cloner.cloneBlocks(scalarBlock, scalarBlock);
+
+   block->append(TR::TreeTop::create(comp(),
+      TR::Node::createif(TR::ificmpne, overlap, TR::Node::iconst(overlap, 0), scalarBlock->getEntry())));
+   block->getExit()->join(vectorBlock->getEntry());
+   vectorBlock->getExit()->join(scalarBlock->getEntry());
+   vectorBlock->append(TR::TreeTop::create(comp(),
+      TR::Node::create(vectorBlock->getEntry()->getNode(), TR::Goto, 0, remainderBlock->getEntry())));
+   cfg->addEdge(block, vectorBlock);
+
+   if (trace())
+      traceMsg(comp(), "\tguard in block_%d, vector block_%d, scalar block_%d, remainder block_%d\n",
+               block->getNumber(), vectorBlock->getNumber(), scalarBlock->getNumber(), remainderBlock->getNumber());
+
+   TR::DebugCounter::incStaticDebugCounter(comp(),
+      TR::DebugCounter::debugCounterName(comp(), "slpVectorizer.versionedRuns/(%s)", comp()->signature()));
+
+   vectorizePacks(vectorBlock->getFirstRealTreeTop(), numPacks, true);
+   return remainderBlock->getEntry();
+   }
+
+/**
+ * Vectorize the packs of a run that need no overlap test, returning the tree
+ * following the run.
+ */
+TR::TreeTop *TR_SLPVectorizer::vectorizePacks(TR::TreeTop *firstTree, int32_t numPacks, bool assumeNoOverlap)
+   {
+   TR::Region &memRegion = trMemory()->currentStackRegion();
+   TR::TreeTop *tt = firstTree;
+   for (int32_t i = 0; i < numPacks && isCandidateStore(tt->getNode()); ++i)
+      {
+      Pack pack(memRegion);
+      if (analyzePack(pack, tt, assumeNoOverlap) && pack._checks.empty())
+         {
+         tt = transformPack(pack)->getNextTreeTop();
+         continue;
+         }
+
+      for (int32_t lane = getNumLanes(tt->getNode()); lane > 0; --lane)
+         tt = tt->getNextTreeTop();
+      }
+
+   return tt;
+   }
+
+/**
+ * Replace the stores of the pack with one vector store, placed where the
+ * first of them was. Children of the scalar stores that are still referenced
+ * elsewhere are anchored ahead of it.
+ */
+TR::TreeTop *TR_SLPVectorizer::transformPack(Pack &pack)
+   {
+   TR::Region &memRegion = trMemory()->currentStackRegion();
+   TR::vector<TR::Node *, TR::Region&> vectorNodes(pack._nodes.size(), NULL, memRegion);
+   TR::Node *value = createVectorExpression(pack, 0, vectorNodes);
+
+   TR::SymbolReference *vectorSymRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(pack._elementType.scalarToVector());
+   TR::Node *address = pack._lanes[0]->getNode()->getFirstChild();
+   TR::Node *vectorStore = TR::Node::createWithSymRef(TR::vstorei, 2, 2, address, value, vectorSymRef);
+   TR::TreeTop *vectorTree = TR::TreeTop::create(comp(), pack._firstTree->getPrevTreeTop(), vectorStore);
+
+   if (trace())
+      traceMsg(comp(), "\tPacked %d %s stores starting at [%p] into [%p]\n",
+               pack._numLanes, TR::DataType::getName(pack._elementType), pack._firstTree->getNode(), vectorStore);
+
+   TR::TreeTop *tt = pack._firstTree;
+   for (int32_t i = 0; i < pack._numLanes; ++i)
+      {
+      TR::TreeTop *next = tt->getNextTreeTop();
+      prepareToStopUsingNode(tt->getNode(), vectorTree);
+      TR::TransformUtil::removeTree(comp(), tt);
+      tt = next;
+      }
+
+   TR::DebugCounter::incStaticDebugCounter(comp(),
+      TR::DebugCounter::debugCounterName(comp(), "slpVectorizer.packs/%s/(%s)", TR::DataType::getName(pack._elementType), comp()->signature()));
+
+   return vectorTree;
+   }
+
+TR::Node *TR_SLPVectorizer::createVectorExpression(Pack &pack, int32_t index, TR::vector<TR::Node *, TR::Region&> &vectorNodes)
+   {
+   if (vectorNodes[index])
+      return vectorNodes[index];
+
+   PackNode &packNode = pack._nodes[index];
+   TR::Node *vectorNode = NULL;
+   switch (packNode._kind)
+      {
+      case Splat:
+         vectorNode = TR::Node::create(TR::vsplats, 1, packNode._lane0);
+         break;
+
+      case VectorLoad:
+         {
+         TR::SymbolReference *vectorSymRef = comp()->getSymRefTab()->findOrCreateArrayShadowSymbolRef(pack._elementType.scalarToVector());
+         vectorNode = TR::Node::createWithSymRef(TR::vloadi, 1, 1, packNode._lane0->getFirstChild(), vectorSymRef);
+         break;
+         }
+
+      case VectorOp:
+         {
+         TR::Node *lane0 = packNode._lane0;
+         vectorNode = TR::Node::create(TR::ILOpCode::convertScalarToVector(lane0->getOpCodeValue()), lane0->getNumChildren());
+         for (int32_t i = 0; i < lane0->getNumChildren(); ++i)
+            vectorNode->setAndIncChild(i, createVectorExpression(pack, packNode._children[i], vectorNodes));
+         break;
+         }
+      }
+
+   vectorNodes[index] = vectorNode;
+   return vectorNode;
+   }
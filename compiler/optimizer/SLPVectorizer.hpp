@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef SLPVECTORIZER_INCL
+#define SLPVECTORIZER_INCL
+
+#include <map>
+#include <stdint.h>
+#include "env/TRMemory.hpp"
+#include "env/TypedAllocator.hpp"
+#include "il/DataTypes.hpp"
+#include "infra/vector.hpp"
+#include "optimizer/Optimization.hpp"
+#include "optimizer/OptimizationManager.hpp"
+
+namespace TR { class Node; }
+namespace TR { class NodeChecklist; }
+namespace TR { class TreeTop; }
+
+/**
+ * Superword level parallelism (SLP) vectorization of straight line code.
+ *
+ * Adjacent trees that store consecutive elements of the same array, and whose
+ * values are computed by isomorphic expressions, are packed into one vector
+ * store of a vector expression. Element loads in the same position of each
+ * lane become one vector load, and values that are the same in every lane are
+ * splatted.
+ *
+ * Packing evaluates the loads of all lanes before the stores of any lane. When
+ * a store may write an element that a later lane loads through a different
+ * base address, the trees are versioned on a runtime test of the distance
+ * between the two addresses:
+ *
+ *    block:    ...
+ *              if (arrays overlap) goto scalar
+ *    vector:   <packed trees>
+ *              goto remainder
+ *    scalar:   <original trees>
+ *    remainder:
+ */
+class TR_SLPVectorizer : public TR::Optimization
+   {
+   public:
+   TR_SLPVectorizer(TR::OptimizationManager *manager);
+   static TR::Optimization *create(TR::OptimizationManager *manager)
+      {
+      return new (manager->allocator()) TR_SLPVectorizer(manager);
+      }
+
+   virtual bool    shouldPerform();
+   virtual int32_t perform();
+   virtual const char * optDetailString() const throw();
+
+   private:
+   typedef TR::typed_allocator<std::pair<TR::Node * const, int32_t>, TR::Region&> NodeCountMapAllocator;
+   typedef std::map<TR::Node *, int32_t, std::less<TR::Node *>, NodeCountMapAllocator> NodeCountMap;
+
+   /* An address of the form _base + _index * _scale + _offset, where _index may be NULL */
+   struct Address
+      {
+      TR::Node *_base;
+      TR::Node *_index;
+      int64_t _scale;
+      int64_t _offset;
+      };
+
+   enum PackKind
+      {
+      Splat,
+      VectorLoad,
+      VectorOp
+      };
+
+   /* A node of the vector expression, made from the nodes in the same position of every lane */
+   struct PackNode
+      {
+      PackKind _kind;
+      TR::Node *_lane0;
+      Address _address;
+      int32_t _children[2];
+      };
+
+   /* The elements stored through _store must not be within one vector of those loaded through _load */
+   struct OverlapCheck
+      {
+      Address _store;
+      Address _load;
+      };
+
+   /* Adjacent trees that store the elements of one vector, with _lanes in element order */
+   struct Pack
+      {
+      Pack(TR::Region &memRegion)
+         : _firstTree(NULL),
+           _lastTree(NULL),
+           _elementType(TR::NoType),
+           _numLanes(0),
+           _lanes(memRegion),
+           _nodes(memRegion),
+           _laneNodes(memRegion),
+           _checks(memRegion),
+           _nodeIndex(std::less<TR::Node *>(), NodeCountMapAllocator(memRegion)),
+           _internalReferences(std::less<TR::Node *>(), NodeCountMapAllocator(memRegion))
+         {}
+
+      TR::TreeTop *_firstTree;
+      TR::TreeTop *_lastTree;
+      TR::DataType _elementType;
+      int32_t _numLanes;
+      Address _storeAddress;
+      TR::vector<TR::TreeTop *, TR::Region&> _lanes;
+      TR::vector<PackNode, TR::Region&> _nodes;
+      TR::vector<TR::Node *, TR::Region&> _laneNodes;
+      TR::vector<OverlapCheck, TR::Region&> _checks;
+      NodeCountMap _nodeIndex;
+      NodeCountMap _internalReferences;
+      };
+
+   bool analyzePack(Pack &pack, TR::TreeTop *firstTree, bool assumeNoOverlap);
+   bool isCandidateStore(TR::Node *node);
+   int32_t getNumLanes(TR::Node *store);
+   int32_t packExpression(Pack &pack, TR::Node **nodes);
+   bool isSplatCandidate(TR::Node *node);
+   bool isSameExpression(Pack *pack, TR::Node *node1, TR::Node *node2);
+   bool isInternal(Pack &pack, TR::Node *node);
+   void countInternalReferences(Pack &pack, TR::Node *node, TR::NodeChecklist &visited);
+   void analyzeAddress(TR::Node *address, Address &result);
+   void analyzeOffset(TR::Node *offset, int64_t scale, Address &result);
+   bool isSameArray(Pack *pack, const Address &address1, const Address &address2);
+   bool analyzeDependences(Pack &pack, bool assumeNoOverlap);
+   void addOverlapCheck(TR::vector<OverlapCheck, TR::Region&> &checks, Pack *pack, const OverlapCheck &check);
+   int32_t scalarCost(Pack &pack);
+   int32_t vectorCost(Pack &pack, NodeCountMap &splats);
+
+   TR::TreeTop *versionRun(TR::TreeTop *firstTree, TR::TreeTop *lastTree, int32_t numPacks);
+   TR::TreeTop *vectorizePacks(TR::TreeTop *firstTree, int32_t numPacks, bool assumeNoOverlap);
+   TR::TreeTop *transformPack(Pack &pack);
+   TR::Node *createVectorExpression(Pack &pack, int32_t index, TR::vector<TR::Node *, TR::Region&> &vectorNodes);
+   };
+
+#endif
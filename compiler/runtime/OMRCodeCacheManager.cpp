@@ -880,6 +880,9 @@ void
 OMR::CodeCacheManager::registerCompiledMethod(const char *sig, uint8_t *startPC, uint32_t codeSize)
    {
 #if (HOST_OS == OMR_LINUX)
+   // Compilation threads register their methods concurrently; the symbol and
+   // relocation lists are only updated while holding the cache list mutex
+   CacheListCriticalSection updateSymbols(self());
 
    TR::CodeCacheSymbol *newSymbol = static_cast<TR::CodeCacheSymbol *> (self()->getMemory(sizeof(TR::CodeCacheSymbol)));
    uint32_t nameLength = strlen(sig) + 1;
@@ -923,6 +926,8 @@ OMR::CodeCacheManager::registerStaticRelocation(const TR::StaticRelocation &relo
 #if (HOST_OS == OMR_LINUX)
    if (_elfRelocatableGenerator)
       {
+      CacheListCriticalSection updateSymbols(self());
+
       const char * const symbolName(relocation.symbol());
       uint32_t nameLength = strlen(symbolName) + 1;
       char *name = static_cast<char *>(self()->getMemory(nameLength * sizeof(char)));
@@ -998,6 +998,18 @@ OMR::X86::CodeGenerator::getSupportsOpCodeForAutoSIMD(TR::ILOpCode opcode, TR::D
             return true;
          else
             return false;
+      case TR::vimin:
+      case TR::vimax:
+         if (dt == TR::Int32 && self()->getX86ProcessorInfo().supportsSSE4_1())
+            return true;
+         else
+            return false;
+      case TR::vicmpeq:
+      case TR::vicmpgt:
+         if (dt == TR::Int32)
+            return true;
+         else
+            return false;
       case TR::vneg:
       case TR::vrem:
          return false;
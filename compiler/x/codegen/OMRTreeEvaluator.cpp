@@ -1920,6 +1920,12 @@ static void generateArrayElementStore(TR::Node* node, TR::Register* addressReg,
          case 16:
             storeOpcode = MOVDQUMemReg;
             break;
+         case 32:
+            storeOpcode = VMOVDQUMemReg;
+            break;
+         case 64:
+            storeOpcode = VMOVDQU32ZMemReg;
+            break;
          default:
             TR_ASSERT(0, "Unsupported size in generateArrayElementStore, size: %d", size);
             break;
@@ -1991,6 +1997,12 @@ static void generateArrayElementLoad(TR::Node* node, TR::Register* valueReg, uin
          case 16:
             loadOpCode  = MOVDQURegMem;
             break;
+         case 32:
+            loadOpCode  = VMOVDQURegMem;
+            break;
+         case 64:
+            loadOpCode  = VMOVDQU32ZRegMem;
+            break;
          default:
             TR_ASSERT(0, "Unsupported size in generateArrayElementLoad, size: %d", size);
             break;
@@ -2441,6 +2453,60 @@ static void packXMMWithMultipleValues(TR::Node* node, TR::Register* XMMReg, TR::
       }
    }
 
+/** \brief
+ *    Select the widest vector store usable for a constant length arrayset
+ *
+ *  \param totalSize
+ *     The number of bytes to be set
+ *
+ *  \param cg
+ *     The code generator
+ *
+ *  \return
+ *     64 when AVX-512 is available, 32 when AVX2 is available and 16 otherwise; never wider than totalSize
+ */
+static uint8_t getArraySetVectorWidth(uintptr_t totalSize, TR::CodeGenerator* cg)
+   {
+   if (totalSize >= 64 && cg->getX86ProcessorInfo().supportsAVX512F())
+      return 64;
+   if (totalSize >= 32 && cg->getX86ProcessorInfo().supportsAVX2())
+      return 32;
+   return 16;
+   }
+
+/** \brief
+ *    Replicate the low 128 bits of a vector register across the given width
+ *
+ *  \param node
+ *     The tree node
+ *
+ *  \param XMMReg
+ *     The vector register holding the 128-bit pattern
+ *
+ *  \param width
+ *     The vector width in bytes, as returned by getArraySetVectorWidth
+ *
+ *  \param cg
+ *     The code generator
+ */
+static void broadcastXMMToVectorWidth(TR::Node* node, TR::Register* XMMReg, uint8_t width, TR::CodeGenerator* cg)
+   {
+   switch (width)
+      {
+      case 16:
+         break;
+      case 32:
+         generateRegRegImmInstruction(VPERM2I128RegRegImm1, node, XMMReg, XMMReg, 0x00, cg);
+         break;
+      case 64:
+         generateRegRegImmInstruction(VSHUFI32X4ZRegRegImm1, node, XMMReg, XMMReg, 0x00, cg);
+         break;
+      default:
+         TR_ASSERT(0, "Arrayset Evaluator: unsupported vector width");
+         break;
+      }
+   }
+
 static void arraySetToZeroForShortConstantArrays(TR::Node* node, TR::Register* addressReg, uintptr_t size, TR::CodeGenerator* cg)
    {
    // We do special optimization for zero because it happens very frequent.
@@ -2448,8 +2514,8 @@ static void arraySetToZeroForShortConstantArrays(TR::Node* node, TR::Register* a
    //     zero out a GPR
    //     use a greedy approach to store
    // if size >= 16:
-   //     zero out a XMM
-   //     store XMM as many as we can
+   //     zero out a XMM, using a VEX encoded XOR when wider stores are used so the upper YMM/ZMM bits are cleared too
+   //     store the widest vector as many as we can
    //     handle the reminder using shifting window
 
    TR::Register* tempReg = NULL;
@@ -2473,14 +2539,16 @@ static void arraySetToZeroForShortConstantArrays(TR::Node* node, TR::Register* a
       }
    else
       {
+      const uint8_t width = getArraySetVectorWidth(size, cg);
       tempReg = cg->allocateRegister(TR_FPR);
-      generateRegRegInstruction(XORPDRegReg, node, tempReg, tempReg, cg);
-      int32_t moves = size/16;
+      generateRegRegInstruction(width > 16 ? VPXORRegReg : XORPDRegReg, node, tempReg, tempReg, cg);
+      int32_t moves = size/width;
       for (int32_t i=0; i<moves; i++)
          {
-         generateArrayElementStore(node, addressReg, i*16, tempReg, 16, cg);
+         generateArrayElementStore(node, addressReg, i*width, tempReg, width, cg);
          }
-      if (size%16 != 0) generateArrayElementStore(node, addressReg, size-16, tempReg, 16, cg);
+      if (size%width != 0) generateArrayElementStore(node, addressReg, size-width, tempReg, width, cg);
+      if (width > 16) generateInstruction(VZEROUPPER, node, cg);
       }
    cg->stopUsingRegister(tempReg);
    }
@@ -2572,22 +2640,26 @@ static void arraySetForShortConstantArrays(TR::Node* node, uint8_t elementSize,
          }
       else
          {
+         const uint8_t width = getArraySetVectorWidth(totalSize, cg);
+         const int32_t vectorMoves = totalSize/width;
          TR::Register* XMM = cg->allocateRegister(TR_FPR);
          packXMMWithMultipleValues(node, XMM, valueReg, elementSize, cg);
+         broadcastXMMToVectorWidth(node, XMM, width, cg);
 
-         for (int32_t i=0; i<moves[0]; i++)
+         for (int32_t i=0; i<vectorMoves; i++)
             {
-            generateArrayElementStore(node, addressReg, i*16, XMM, 16, cg);
+            generateArrayElementStore(node, addressReg, i*width, XMM, width, cg);
             }
-         const int32_t reminder = totalSize - moves[0]*16;
+         const int32_t reminder = totalSize - vectorMoves*width;
          if (reminder == elementSize)
             {
-            generateArrayElementStore(node, addressReg, moves[0]*16, valueReg, elementSize, cg);
+            generateArrayElementStore(node, addressReg, vectorMoves*width, valueReg, elementSize, cg);
             }
          else if (reminder != 0)
             {
-            generateArrayElementStore(node, addressReg, totalSize-16, XMM, 16, cg);
+            generateArrayElementStore(node, addressReg, totalSize-width, XMM, width, cg);
             }
+         if (width > 16) generateInstruction(VZEROUPPER, node, cg);
          cg->stopUsingRegister(XMM);
          }
       }
@@ -4132,47 +4204,51 @@ enum BinaryArithmeticOps : uint32_t
    BinaryArithmeticAnd,
    BinaryArithmeticOr,
    BinaryArithmeticXor,
+   BinaryArithmeticMin,
+   BinaryArithmeticMax,
+   BinaryArithmeticCmpEq,
+   BinaryArithmeticCmpGt,
    NumBinaryArithmeticOps
    };
 
 static const TR_X86OpCodes BinaryArithmeticOpCodesForReg[TR::NumOMRTypes][NumBinaryArithmeticOps] =
    {
-   //  Invalid,       Add,         Sub,         Mul,         Div,          And,         Or,       Xor
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // NoType
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int8
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int16
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int32
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int64
-   { BADIA32Op, ADDSSRegReg, SUBSSRegReg, MULSSRegReg,  DIVSSRegReg, BADIA32Op,  BADIA32Op, BADIA32Op  }, // Float
-   { BADIA32Op, ADDSDRegReg, SUBSDRegReg, MULSDRegReg,  DIVSDRegReg, BADIA32Op,  BADIA32Op, BADIA32Op  }, // Double
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Address
-   { BADIA32Op, PADDBRegReg, PSUBBRegReg, BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorInt8
-   { BADIA32Op, PADDWRegReg, PSUBWRegReg, PMULLWRegReg, BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorInt16
-   { BADIA32Op, PADDDRegReg, PSUBDRegReg, PMULLDRegReg, BADIA32Op,   PANDRegReg, PORRegReg, PXORRegReg }, // VectorInt32
-   { BADIA32Op, PADDQRegReg, PSUBQRegReg, BADIA32Op,    BADIA32Op,   PANDRegReg, PORRegReg, PXORRegReg }, // VectorInt64
-   { BADIA32Op, ADDPSRegReg, SUBPSRegReg, MULPSRegReg,  DIVPSRegReg, BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorFloat
-   { BADIA32Op, ADDPDRegReg, SUBPDRegReg, MULPDRegReg,  DIVPDRegReg, BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorDouble
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Aggregate
+   //  Invalid,  Add,         Sub,         Mul,          Div,         And,        Or,        Xor,        Min,          Max,          CmpEq,         CmpGt
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // NoType
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Int8
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Int16
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Int32
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Int64
+   { BADIA32Op, ADDSSRegReg, SUBSSRegReg, MULSSRegReg,  DIVSSRegReg, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Float
+   { BADIA32Op, ADDSDRegReg, SUBSDRegReg, MULSDRegReg,  DIVSDRegReg, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Double
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Address
+   { BADIA32Op, PADDBRegReg, PSUBBRegReg, BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // VectorInt8
+   { BADIA32Op, PADDWRegReg, PSUBWRegReg, PMULLWRegReg, BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // VectorInt16
+   { BADIA32Op, PADDDRegReg, PSUBDRegReg, PMULLDRegReg, BADIA32Op,   PANDRegReg, PORRegReg, PXORRegReg, PMINSDRegReg, PMAXSDRegReg, PCMPEQDRegReg, PCMPGTDRegReg  }, // VectorInt32
+   { BADIA32Op, PADDQRegReg, PSUBQRegReg, BADIA32Op,    BADIA32Op,   PANDRegReg, PORRegReg, PXORRegReg, BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // VectorInt64
+   { BADIA32Op, ADDPSRegReg, SUBPSRegReg, MULPSRegReg,  DIVPSRegReg, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // VectorFloat
+   { BADIA32Op, ADDPDRegReg, SUBPDRegReg, MULPDRegReg,  DIVPDRegReg, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // VectorDouble
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op,    BADIA32Op,    BADIA32Op,     BADIA32Op      }, // Aggregate
    };
 
 static const TR_X86OpCodes BinaryArithmeticOpCodesForMem[TR::NumOMRTypes][NumBinaryArithmeticOps] =
    {
-   //  Invalid,       Add,         Sub,         Mul,         Div,          And,         Or,       Xor
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // NoType
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int8
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int16
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int32
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Int64
-   { BADIA32Op, ADDSSRegMem, SUBSSRegMem, MULSSRegMem,  DIVSSRegMem, BADIA32Op,  BADIA32Op, BADIA32Op  }, // Float
-   { BADIA32Op, ADDSDRegMem, SUBSDRegMem, MULSDRegMem,  DIVSDRegMem, BADIA32Op,  BADIA32Op, BADIA32Op  }, // Double
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Address
-   { BADIA32Op, PADDBRegMem, PSUBBRegMem, BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorInt8
-   { BADIA32Op, PADDWRegMem, PSUBWRegMem, PMULLWRegMem, BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorInt16
-   { BADIA32Op, PADDDRegMem, PSUBDRegMem, PMULLDRegMem, BADIA32Op,   PANDRegMem, PORRegMem, PXORRegMem }, // VectorInt32
-   { BADIA32Op, PADDQRegMem, PSUBQRegMem, BADIA32Op,    BADIA32Op,   PANDRegMem, PORRegMem, PXORRegMem }, // VectorInt64
-   { BADIA32Op, ADDPSRegMem, SUBPSRegMem, MULPSRegMem,  DIVPSRegMem, BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorFloat
-   { BADIA32Op, ADDPDRegMem, SUBPDRegMem, MULPDRegMem,  DIVPDRegMem, BADIA32Op,  BADIA32Op, BADIA32Op  }, // VectorDouble
-   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op  }, // Aggregate
+   //  Invalid,  Add,         Sub,         Mul,          Div,         And,        Or,        Xor,        Min,       Max,       CmpEq,     CmpGt
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // NoType
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Int8
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Int16
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Int32
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Int64
+   { BADIA32Op, ADDSSRegMem, SUBSSRegMem, MULSSRegMem,  DIVSSRegMem, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Float
+   { BADIA32Op, ADDSDRegMem, SUBSDRegMem, MULSDRegMem,  DIVSDRegMem, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Double
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Address
+   { BADIA32Op, PADDBRegMem, PSUBBRegMem, BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // VectorInt8
+   { BADIA32Op, PADDWRegMem, PSUBWRegMem, PMULLWRegMem, BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // VectorInt16
+   { BADIA32Op, PADDDRegMem, PSUBDRegMem, PMULLDRegMem, BADIA32Op,   PANDRegMem, PORRegMem, PXORRegMem, BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // VectorInt32
+   { BADIA32Op, PADDQRegMem, PSUBQRegMem, BADIA32Op,    BADIA32Op,   PANDRegMem, PORRegMem, PXORRegMem, BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // VectorInt64
+   { BADIA32Op, ADDPSRegMem, SUBPSRegMem, MULPSRegMem,  DIVPSRegMem, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // VectorFloat
+   { BADIA32Op, ADDPDRegMem, SUBPDRegMem, MULPDRegMem,  DIVPDRegMem, BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // VectorDouble
+   { BADIA32Op, BADIA32Op,   BADIA32Op,   BADIA32Op,    BADIA32Op,   BADIA32Op,  BADIA32Op, BADIA32Op,  BADIA32Op, BADIA32Op, BADIA32Op, BADIA32Op  }, // Aggregate
    };
 
 static const TR::ILOpCodes MemoryLoadOpCodes[TR::NumOMRTypes] =
@@ -4230,6 +4306,18 @@ TR::Register* OMR::X86::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEva
       case TR::vxor:
          arithmetic = BinaryArithmeticXor;
          break;
+      case TR::vimin:
+         arithmetic = BinaryArithmeticMin;
+         break;
+      case TR::vimax:
+         arithmetic = BinaryArithmeticMax;
+         break;
+      case TR::vicmpeq:
+         arithmetic = BinaryArithmeticCmpEq;
+         break;
+      case TR::vicmpgt:
+         arithmetic = BinaryArithmeticCmpGt;
+         break;
       default:
          TR_ASSERT(false, "Unsupported OpCode");
       }
@@ -1450,7 +1450,7 @@ uint8_t* TR::X86RegRegRegInstruction::generateOperand(uint8_t* cursor)
       {
       applySourceRegisterToModRMByte(modRM);
       }
-   applySource2ndRegisterToVEX(modRM - 2);
+   applySource2ndRegisterToVEX(modRM - (getOpCode().info().isEVEX() ? 3 : 2));
    return cursor;
    }
 
@@ -1891,6 +1891,10 @@ uint8_t TR::X86MemInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86MemInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
+   // EVEX scales 8-bit displacements by the operand size; use 32-bit displacements instead
+   if (getOpCode().info().isEVEX())
+      getMemoryReference()->setForceWideDisplacement();
+
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
    int32_t length = 0;
    if (getOpCode().needsLockPrefix() || (barrier & LockPrefix))
@@ -2334,6 +2338,10 @@ uint8_t TR::X86RegMemInstruction::getBinaryLengthLowerBound()
 
 int32_t TR::X86RegMemInstruction::estimateBinaryLength(int32_t currentEstimate)
    {
+   // EVEX scales 8-bit displacements by the operand size; use 32-bit displacements instead
+   if (getOpCode().info().isEVEX())
+      getMemoryReference()->setForceWideDisplacement();
+
    int32_t barrier = memoryBarrierRequired(getOpCode(), getMemoryReference(), cg(), false);
 
    int32_t length = getMemoryReference()->estimateBinaryLength(cg());
@@ -2376,7 +2384,7 @@ uint8_t* TR::X86RegRegMemInstruction::generateOperand(uint8_t* cursor)
       {
       applyTargetRegisterToModRMByte(modRM);
       }
-   applySource2ndRegisterToVEX(modRM - 2);
+   applySource2ndRegisterToVEX(modRM - (getOpCode().info().isEVEX() ? 3 : 2));
    cursor = getMemoryReference()->generateBinaryEncoding(modRM, this, cg());
    return cursor;
    }
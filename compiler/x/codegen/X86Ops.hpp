@@ -406,6 +406,11 @@ class TR_X86OpCode
          {
          return vex_l != VEX_L___;
          }
+      // check if the instruction can only be encoded as AVX-512
+      inline bool isEVEX() const
+         {
+         return vex_l == VEX_L512;
+         }
       // check if the instruction is X87
       inline bool isX87() const
          {
@@ -423,7 +428,7 @@ class TR_X86OpCode
          }
       // TBuffer should only be one of the two: Estimator when calculating length, and Writer when generating binaries.
       template <class TBuffer> inline typename TBuffer::cursor_t encode(typename TBuffer::cursor_t cursor, uint8_t rexbits) const;
-      // finalize instruction prefix information, currently only in-use for AVX instructions for VEX.vvvv field
+      // finalize instruction prefix information, currently only in-use for AVX instructions for VEX.vvvv and EVEX.vvvv fields
       inline void finalize(uint8_t* cursor) const;
       };
    template <typename TCursor>
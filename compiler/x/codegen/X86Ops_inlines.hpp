@@ -36,8 +36,19 @@ template <typename TBuffer> inline typename TBuffer::cursor_t TR_X86OpCode::OpCo
    // Prefixes
    TR::Instruction::REX rex(rexbits);
    rex.W = rex_w;
+   // 512-bit instructions only exist in EVEX form
+   if (isEVEX())
+      {
+      TR_ASSERT_FATAL(TR::CodeGenerator::getX86ProcessorInfo().supportsAVX512F(), "512-bit instructions require AVX-512");
+      TR::Instruction::EVEX evex(rex, modrm_opcode);
+      evex.m = escape;
+      evex.L = vex_l;
+      evex.p = prefixes;
+      evex.opcode = opcode;
+      buffer.append(evex);
+      }
    // Use AVX if possible
-   if (supportsAVX() && TR::CodeGenerator::getX86ProcessorInfo().supportsAVX())
+   else if (supportsAVX() && TR::CodeGenerator::getX86ProcessorInfo().supportsAVX())
       {
       TR::Instruction::VEX<3> vex(rex, modrm_opcode);
       vex.m = escape;
@@ -52,9 +63,15 @@ template <typename TBuffer> inline typename TBuffer::cursor_t TR_X86OpCode::OpCo
          {
          buffer.append(vex);
          }
+      // The VEX prefix structures carry a ModRM byte; drop it for instructions without one
+      if (modrm_form == ModRM_NONE)
+         {
+         return (typename TBuffer::cursor_t)buffer - 1;
+         }
       }
    else
       {
+      TR_ASSERT_FATAL(vex_l != VEX_L256, "256-bit instructions require AVX");
       switch (prefixes)
          {
          case PREFIX___:
@@ -129,6 +146,15 @@ inline void TR_X86OpCode::OpCode_t::finalize(uint8_t* cursor) const
             }
          }
          break;
+      case 0x62:
+         {
+         auto pEVEX = (TR::Instruction::EVEX*)cursor;
+         if (isEVEX() && vex_v == VEX_vReg_)
+            {
+            pEVEX->v = ~(modrm_form == ModRM_EXT_ ? pEVEX->RM() : pEVEX->Reg());
+            }
+         }
+         break;
       default:
          break;
       }
@@ -423,14 +423,14 @@
    TR::TreeEvaluator::BBStartEvaluator,                                // TR::BBStart
    TR::TreeEvaluator::BBEndEvaluator,                                  // TR::BBEnd
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::virem
-   TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vimin
-   TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vimax
+   TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator, // TR::vimin
+   TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator, // TR::vimax
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vigetelem
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::visetelem
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vimergel
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vimergeh
-   TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vicmpeq
-   TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vicmpgt
+   TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator, // TR::vicmpeq
+   TR::TreeEvaluator::FloatingPointAndVectorBinaryArithmeticEvaluator, // TR::vicmpgt
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vicmpge
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vicmplt
    TR::TreeEvaluator::unImpOpEvaluator,                                // TR::vicmple
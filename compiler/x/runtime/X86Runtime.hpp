@@ -94,6 +94,11 @@ inline bool jitGetCPUID(TR_X86CPUIDBuffer* pBuffer)
             // Unset OSXSAVE if not enabled via CR0
             pBuffer->_featureFlags2 &= ~TR_OSXSAVE;
             }
+         // '0xE6' = mask for XCR0[7:5,2:1]='111b,11b' (opmask, ZMM_Hi256 and Hi16_ZMM state are also enabled)
+         else if(((0xE6 & _xgetbv(0)) != 0xE6) || feGetEnv("TR_DisableAVX512"))
+            {
+            pBuffer->_featureFlags8 &= ~(TR_AVX512F | TR_AVX512DQ | TR_AVX512_IFMA | TR_AVX512PF | TR_AVX512ER | TR_AVX512CD | TR_AVX512BW | TR_AVX512VL);
+            }
          }
 
       /* Mask out the bits the compiler does not care about.
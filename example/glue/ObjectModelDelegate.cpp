@@ -38,6 +38,14 @@ GC_ObjectModelDelegate::initializeAllocation(MM_EnvironmentBase *env, void *allo
 	return objectPtr;
 }
 
+const char *
+GC_ObjectModelDelegate::getObjectTypeNameForCensus(MM_EnvironmentBase *env, uintptr_t type, char *buffer, uintptr_t bufferLength)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	omrstr_printf(buffer, bufferLength, "object[%zu]", type);
+	return buffer;
+}
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 void
 GC_ObjectModelDelegate::calculateObjectDetailsForCopy(MM_EnvironmentBase *env, MM_ForwardedHeader *forwardedHeader, uintptr_t *objectCopySizeInBytes, uintptr_t *reservedObjectSizeInBytes, uintptr_t *hotFieldAlignmentDescriptor)
@@ -157,6 +157,34 @@ public:
 		return getObjectSizeInBytesWithHeader(objectPtr);
 	}
 
+	/**
+	 * Identify the type of an object for the live object census (-Xgc:liveObjectCensus). The census
+	 * ranks types by this key, so it must be the same for all objects of a type and must not be 0.
+	 * A class pointer is the natural choice. The example objects have no class, so objects of the
+	 * same size are taken to be of the same type.
+	 *
+	 * @param[in] objectPtr points to the object
+	 * @return the non-zero type key of the object
+	 */
+	MMINLINE uintptr_t
+	getObjectTypeForCensus(omrobjectptr_t objectPtr)
+	{
+		return getObjectSizeInBytesWithHeader(objectPtr);
+	}
+
+	/**
+	 * Describe a type returned by getObjectTypeForCensus() for verbose GC. The type may not have been
+	 * seen in the heap since it was sampled, so implementations should not dereference it unless types
+	 * are known to outlive a collect.
+	 *
+	 * @param[in] env points to the environment for the calling thread
+	 * @param[in] type the type key
+	 * @param[out] buffer receives the type name if the name must be formatted
+	 * @param[in] bufferLength size of buffer
+	 * @return the type name
+	 */
+	const char *getObjectTypeNameForCensus(MM_EnvironmentBase *env, uintptr_t type, char *buffer, uintptr_t bufferLength);
+
 	/**
 	 * If object initialization fails for any reason, this method must return NULL. In that case, the heap
 	 * memory allocated for the object will become floating garbage in the heap and will be recovered in
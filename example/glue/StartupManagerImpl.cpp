@@ -36,6 +36,16 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 #define OMR_SEGREGATEDHEAP "-Xgcpolicy:segregated"
 #define OMR_SEGREGATEDHEAP_LENGTH 21
+#define OMR_SEGREGATEDLAZYSWEEP "-Xgc:segregatedLazySweep"
+#define OMR_SEGREGATEDLAZYSWEEP_LENGTH 24
+#define OMR_SEGREGATEDGENERATIONAL "-Xgc:segregatedGenerational"
+#define OMR_SEGREGATEDGENERATIONAL_LENGTH 27
+#define OMR_SEGREGATEDMAXMINORCOLLECTS "-Xgc:segregatedMaxMinorCollects="
+#define OMR_SEGREGATEDMAXMINORCOLLECTS_LENGTH 32
+#define OMR_SIZECLASSPROFILEOUTPUT "-Xgc:sizeClassProfileOutput="
+#define OMR_SIZECLASSPROFILEOUTPUT_LENGTH 28
+#define OMR_SIZECLASSPROFILEINPUT "-Xgc:sizeClassProfileInput="
+#define OMR_SIZECLASSPROFILEINPUT_LENGTH 27
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 bool
@@ -51,6 +61,36 @@ MM_StartupManagerImpl::handleOption(MM_GCExtensionsBase *extensions, char *optio
 			 */
 			_useSegregatedGC = true;
 			result = true;
+		} else if (0 == strncmp(option, OMR_SEGREGATEDLAZYSWEEP, OMR_SEGREGATEDLAZYSWEEP_LENGTH)) {
+			extensions->segregatedLazySweep = true;
+			result = true;
+		} else if (0 == strncmp(option, OMR_SEGREGATEDGENERATIONAL, OMR_SEGREGATEDGENERATIONAL_LENGTH)) {
+			extensions->segregatedGenerational = true;
+			result = true;
+		} else if (0 == strncmp(option, OMR_SEGREGATEDMAXMINORCOLLECTS, OMR_SEGREGATEDMAXMINORCOLLECTS_LENGTH)) {
+			uintptr_t maxMinorCollects = 0;
+			if ((0 >= getUDATAValue(option + OMR_SEGREGATEDMAXMINORCOLLECTS_LENGTH, &maxMinorCollects)) || (0 == maxMinorCollects)) {
+				result = false;
+			} else {
+				extensions->segregatedMaxMinorCollects = maxMinorCollects;
+				result = true;
+			}
+		} else if (0 == strncmp(option, OMR_SIZECLASSPROFILEOUTPUT, OMR_SIZECLASSPROFILEOUTPUT_LENGTH)) {
+			OMRPORT_ACCESS_FROM_OMRVM(extensions->getOmrVM());
+			/* freed by MM_ConfigurationSegregated::tearDown() */
+			extensions->sizeClassProfileOutput = (char *) omrmem_allocate_memory(strlen(option + OMR_SIZECLASSPROFILEOUTPUT_LENGTH) + 1, OMRMEM_CATEGORY_MM);
+			if (NULL != extensions->sizeClassProfileOutput) {
+				strcpy(extensions->sizeClassProfileOutput, option + OMR_SIZECLASSPROFILEOUTPUT_LENGTH);
+				result = true;
+			}
+		} else if (0 == strncmp(option, OMR_SIZECLASSPROFILEINPUT, OMR_SIZECLASSPROFILEINPUT_LENGTH)) {
+			OMRPORT_ACCESS_FROM_OMRVM(extensions->getOmrVM());
+			/* freed by MM_ConfigurationSegregated::tearDown() */
+			extensions->sizeClassProfileInput = (char *) omrmem_allocate_memory(strlen(option + OMR_SIZECLASSPROFILEINPUT_LENGTH) + 1, OMRMEM_CATEGORY_MM);
+			if (NULL != extensions->sizeClassProfileInput) {
+				strcpy(extensions->sizeClassProfileInput, option + OMR_SIZECLASSPROFILEINPUT_LENGTH);
+				result = true;
+			}
 		}
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	}
@@ -80,12 +120,17 @@ MM_StartupManagerImpl::getOptions(void)
 MM_Configuration *
 MM_StartupManagerImpl::createConfiguration(MM_EnvironmentBase *env)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_SEGREGATED_HEAP)
 	MM_GCExtensionsBase *ext = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	if (_useSegregatedGC) {
 		return MM_ConfigurationSegregated::newInstance(env);
+	} else if (ext->segregatedGenerational) {
+		/* The write barrier records old to young references in the MM_SegregatedGC remembered set */
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrtty_printf("-Xgc:segregatedGenerational requires -Xgcpolicy:segregated\n");
+		return NULL;
 	} else
 #endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_MODRON_SCAVENGER)
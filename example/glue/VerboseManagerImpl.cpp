@@ -27,6 +27,9 @@
 #include "GCExtensionsBase.hpp"
 #include "VerboseManagerImpl.hpp"
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "VerboseHandlerOutputSegregated.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #include "VerboseHandlerOutputStandard.hpp"
 
 #if defined(OMR_OS_WINDOWS)
@@ -120,5 +123,10 @@ MM_VerboseManagerImpl::reconfigureVerboseGC(OMR_VM *omrVM)
 MM_VerboseHandlerOutput *
 MM_VerboseManagerImpl::createVerboseHandlerOutputObject(MM_EnvironmentBase *env)
 {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (env->getExtensions()->isSegregatedHeap()) {
+		return MM_VerboseHandlerOutputSegregated::newInstance(env, this);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 	return MM_VerboseHandlerOutputStandard::newInstance(env, this);
 }
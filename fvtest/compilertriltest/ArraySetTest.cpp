@@ -0,0 +1,129 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "JitTest.hpp"
+#include "default_compiler.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+/**
+ * @brief Parameters for a constant length arrayset test
+ *
+ * The byte lengths straddle the 16, 32 and 64 byte vector widths used by the
+ * x86 constant arrayset evaluator so that each store width and each remainder
+ * path is exercised.
+ */
+struct ArraySetParam
+   {
+   const char *typeName;
+   const char *constOp;
+   int64_t value;
+   int32_t elementSize;
+   int32_t byteLength;
+   };
+
+static std::ostream& operator<<(std::ostream &os, const ArraySetParam &p)
+   {
+   return os << p.typeName << " value=" << p.value << " length=" << p.byteLength;
+   }
+
+class ArraySetTest : public TRTest::JitTest, public ::testing::WithParamInterface<ArraySetParam> {};
+
+TEST_P(ArraySetTest, ConstantLength) {
+    auto param = GetParam();
+    OMRPORT_ACCESS_FROM_OMRPORT(TRTest::TestWithPortLib::privateOmrPortLibrary);
+
+    bool isX86 = (0 == strcmp(OMRPORT_ARCH_X86, omrsysinfo_get_CPU_architecture()))
+                 || (0 == strcmp(OMRPORT_ARCH_HAMMER, omrsysinfo_get_CPU_architecture()));
+    SKIP_IF(!isX86, MissingImplementation) << "arrayset trees are only verified on x86";
+
+    char inputTrees[512] = {0};
+    std::snprintf(inputTrees, sizeof(inputTrees),
+        "(method return=NoType args=[Address]"
+        "  (block"
+        "    (treetop"
+        "      (arrayset"
+        "        (aload parm=0)"
+        "        (%s %lld)"
+        "        (iconst %d)))"
+        "    (return)))",
+        param.constOp, (long long)param.value, param.byteLength);
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(uint8_t *)>();
+
+    const int32_t guard = 64;
+    const uint8_t sentinel = 0xCC;
+    std::vector<uint8_t> buffer(param.byteLength + 2 * guard, sentinel);
+
+    entry_point(&buffer[guard]);
+
+    for (int32_t i = 0; i < guard; i++) {
+        ASSERT_EQ(sentinel, buffer[i]) << "Store before the array at offset " << (i - guard);
+        ASSERT_EQ(sentinel, buffer[guard + param.byteLength + i]) << "Store past the end of the array at offset " << i;
+    }
+    for (int32_t i = 0; i < param.byteLength; i++) {
+        /* elements are stored little endian on x86 */
+        uint8_t expected = (uint8_t)(param.value >> (8 * (i % param.elementSize)));
+        ASSERT_EQ(expected, buffer[guard + i]) << "Byte " << i << " of the array";
+    }
+}
+
+static std::vector<ArraySetParam> arraySetParams()
+   {
+   static const int32_t lengths[] = { 8, 16, 24, 32, 40, 48, 56, 64, 72, 96, 120, 128, 136, 192, 200, 248, 256 };
+   static const int32_t oddByteLengths[] = { 1, 15, 17, 31, 33, 63, 65, 127, 129, 255 };
+   static const ArraySetParam kinds[] = {
+      { "Int8", "bconst", 0, 1, 0 },
+      { "Int8", "bconst", 0x5a, 1, 0 },
+      { "Int16", "sconst", 0x1234, 2, 0 },
+      { "Int32", "iconst", 0x12345678, 4, 0 },
+      { "Int64", "lconst", 0x0102030405060708LL, 8, 0 },
+      };
+
+   std::vector<ArraySetParam> params;
+   for (size_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k++) {
+      for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++) {
+         ArraySetParam p = kinds[k];
+         p.byteLength = lengths[l];
+         params.push_back(p);
+      }
+      if (1 == kinds[k].elementSize) {
+         for (size_t l = 0; l < sizeof(oddByteLengths) / sizeof(oddByteLengths[0]); l++) {
+            ArraySetParam p = kinds[k];
+            p.byteLength = oddByteLengths[l];
+            params.push_back(p);
+         }
+      }
+   }
+   return params;
+   }
+
+INSTANTIATE_TEST_CASE_P(ArraySet, ArraySetTest, ::testing::ValuesIn(arraySetParams()));
@@ -22,6 +22,10 @@
 #include "JitTest.hpp"
 #include "default_compiler.hpp"
 
+#include <algorithm>
+#include <cstdio>
+#include <climits>
+
 class VectorTest : public TRTest::JitTest {};
 
 
@@ -65,3 +69,66 @@ TEST_F(VectorTest, VDoubleAdd) {
     EXPECT_DOUBLE_EQ(inputA[0] + inputB[0], output[0]); // Epsilon = 4ULP -- is this necessary? 
     EXPECT_DOUBLE_EQ(inputA[1] + inputB[1], output[1]); // Epsilon = 4ULP -- is this necessary? 
 }
+
+static int32_t vimin_oracle(int32_t l, int32_t r) { return std::min(l, r); }
+static int32_t vimax_oracle(int32_t l, int32_t r) { return std::max(l, r); }
+static int32_t vicmpeq_oracle(int32_t l, int32_t r) { return l == r ? -1 : 0; }
+static int32_t vicmpgt_oracle(int32_t l, int32_t r) { return l > r ? -1 : 0; }
+
+struct VectorInt32BinaryParam
+   {
+   const char *opName;
+   int32_t (*oracle)(int32_t, int32_t);
+   bool requiresSSE4_1;
+   };
+
+class VectorInt32BinaryTest : public VectorTest, public ::testing::WithParamInterface<VectorInt32BinaryParam> {};
+
+TEST_P(VectorInt32BinaryTest, UsingLoadParam) {
+    auto param = GetParam();
+    OMRPORT_ACCESS_FROM_OMRPORT(TRTest::TestWithPortLib::privateOmrPortLibrary);
+
+    bool isX86 = (0 == strcmp(OMRPORT_ARCH_X86, omrsysinfo_get_CPU_architecture()))
+                 || (0 == strcmp(OMRPORT_ARCH_HAMMER, omrsysinfo_get_CPU_architecture()));
+    SKIP_IF(!isX86, MissingImplementation) << "Integer vector " << param.opName << " is only implemented on x86";
+
+    OMRProcessorDesc desc;
+    omrsysinfo_get_processor_description(&desc);
+    SKIP_IF(param.requiresSSE4_1 && !omrsysinfo_processor_has_feature(&desc, OMR_FEATURE_X86_SSE4_1), UnsupportedFeature)
+        << param.opName << " requires SSE4.1";
+
+    char inputTrees[1024] = {0};
+    std::snprintf(inputTrees, sizeof(inputTrees),
+        "(method return= NoType args=[Address,Address,Address]"
+        "  (block"
+        "     (vstorei type=VectorInt32 offset=0"
+        "         (aload parm=0)"
+        "            (%s"
+        "                 (vloadi type=VectorInt32 (aload parm=1))"
+        "                 (vloadi type=VectorInt32 (aload parm=2))))"
+        "     (return)))",
+        param.opName);
+
+    auto trees = parseString(inputTrees);
+    ASSERT_NOTNULL(trees);
+
+    Tril::DefaultCompiler compiler(trees);
+    ASSERT_EQ(0, compiler.compile()) << "Compilation failed unexpectedly\n" << "Input trees: " << inputTrees;
+
+    auto entry_point = compiler.getEntryPoint<void (*)(int32_t[], int32_t[], int32_t[])>();
+
+    int32_t output[] = {0, 0, 0, 0};
+    int32_t inputA[] = {-5, 7, INT32_MIN, 42};
+    int32_t inputB[] = {3, 7, INT32_MAX, -42};
+
+    entry_point(output, inputA, inputB);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(param.oracle(inputA[i], inputB[i]), output[i]) << param.opName << " lane " << i;
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(VectorTest, VectorInt32BinaryTest, ::testing::Values(
+    VectorInt32BinaryParam { "vimin", vimin_oracle, true },
+    VectorInt32BinaryParam { "vimax", vimax_oracle, true },
+    VectorInt32BinaryParam { "vicmpeq", vicmpeq_oracle, false },
+    VectorInt32BinaryParam { "vicmpgt", vicmpgt_oracle, false }));
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <math.h>
+
+#include "omrTest.h"
+
+#include "AllocationSampler.hpp"
+
+/* Seeds are fixed so that the statistical checks below are reproducible */
+#define SAMPLER_SEED 0x5DEECE66DULL
+
+/* Accept observations within this many standard deviations of their expectation */
+#define SIGMA_TOLERANCE 5.0
+
+/**
+ * The sampler must take one sample every mean interval bytes on average, whatever the allocation size.
+ */
+TEST(AllocationSamplerTest, samplingRate)
+{
+	const uintptr_t meanInterval = 4096;
+	const uintptr_t objectSize = 64;
+	const uintptr_t allocations = 1000000;
+	MM_AllocationSampler sampler;
+	sampler.initialize(meanInterval, SAMPLER_SEED);
+
+	uintptr_t samples = 0;
+	uintptr_t sampledBytes = 0;
+	for (uintptr_t i = 0; i < allocations; i++) {
+		if (sampler.allocated(objectSize)) {
+			samples += 1;
+			sampledBytes += sampler.takeSampledBytes();
+		}
+	}
+
+	/* Samples form a Poisson process over the allocated bytes */
+	double expected = (double)(allocations * objectSize) / (double)meanInterval;
+	EXPECT_LE(fabs((double)samples - expected), SIGMA_TOLERANCE * sqrt(expected))
+		<< samples << " samples, expected " << expected;
+
+	/* The weights of the samples account for every byte allocated up to the last sample */
+	EXPECT_LE(sampledBytes, allocations * objectSize);
+	EXPECT_GE(sampledBytes + (32 * meanInterval), allocations * objectSize);
+}
+
+/**
+ * Every byte is equally likely to be sampled, so an object of size s is sampled with probability 1 - e^(-s/mean),
+ * and small objects are not starved by large ones.
+ */
+TEST(AllocationSamplerTest, samplingIsUnbiasedBySize)
+{
+	const uintptr_t meanInterval = 4096;
+	const uintptr_t sizes[] = {16, 1024, 65536};
+	const uintptr_t sizeCount = sizeof(sizes) / sizeof(sizes[0]);
+	const uintptr_t rounds = 200000;
+	uintptr_t samples[sizeCount] = {0};
+	uintptr_t weights[sizeCount] = {0};
+	MM_AllocationSampler sampler;
+	sampler.initialize(meanInterval, SAMPLER_SEED + 1);
+
+	for (uintptr_t i = 0; i < rounds; i++) {
+		for (uintptr_t s = 0; s < sizeCount; s++) {
+			if (sampler.allocated(sizes[s])) {
+				samples[s] += 1;
+				weights[s] += sampler.takeSampledBytes();
+			}
+		}
+	}
+
+	uintptr_t totalWeight = 0;
+	for (uintptr_t s = 0; s < sizeCount; s++) {
+		double probability = 1.0 - exp(-(double)sizes[s] / (double)meanInterval);
+		double expected = (double)rounds * probability;
+		double deviation = sqrt((double)rounds * probability * (1.0 - probability));
+		EXPECT_LE(fabs((double)samples[s] - expected), SIGMA_TOLERANCE * deviation)
+			<< "size " << sizes[s] << ": " << samples[s] << " samples, expected " << expected;
+		totalWeight += weights[s];
+	}
+
+	/* The weights of the samples estimate the bytes allocated */
+	double allocated = (double)rounds * (double)(sizes[0] + sizes[1] + sizes[2]);
+	EXPECT_LE(fabs((double)totalWeight - allocated), allocated / 100.0);
+}
+
+/**
+ * The distance between samples is randomized: exponentially distributed intervals have a standard deviation
+ * equal to their mean, where a fixed interval would have none.
+ */
+TEST(AllocationSamplerTest, intervalsAreRandomized)
+{
+	const uintptr_t meanInterval = 8192;
+	const uintptr_t intervals = 100000;
+	MM_AllocationSampler sampler;
+	sampler.initialize(meanInterval, SAMPLER_SEED + 2);
+
+	double sum = 0.0;
+	double sumOfSquares = 0.0;
+	for (uintptr_t i = 0; i < intervals; i++) {
+		double interval = (double)sampler.nextInterval();
+		sum += interval;
+		sumOfSquares += interval * interval;
+	}
+	double mean = sum / (double)intervals;
+	double deviation = sqrt((sumOfSquares / (double)intervals) - (mean * mean));
+
+	/* the standard error of the mean of exponential samples is mean / sqrt(n) */
+	EXPECT_LE(fabs(mean - (double)meanInterval), SIGMA_TOLERANCE * (double)meanInterval / sqrt((double)intervals));
+	EXPECT_GT(deviation, 0.9 * (double)meanInterval);
+	EXPECT_LT(deviation, 1.1 * (double)meanInterval);
+}
+
+/**
+ * An allocation spanning several sample points is reported once, carrying the weight of all of them.
+ */
+TEST(AllocationSamplerTest, largeAllocationIsSampledOnce)
+{
+	const uintptr_t meanInterval = 1024;
+	MM_AllocationSampler sampler;
+	sampler.initialize(meanInterval, SAMPLER_SEED + 3);
+
+	/* Start right after a sample */
+	while (!sampler.allocated(8)) {
+	}
+	sampler.takeSampledBytes();
+
+	EXPECT_TRUE(sampler.allocated(1024 * meanInterval));
+	EXPECT_EQ(1024 * meanInterval, sampler.takeSampledBytes());
+	EXPECT_EQ((uintptr_t)0, sampler.takeSampledBytes());
+}
+
+TEST(AllocationSamplerTest, disabled)
+{
+	MM_AllocationSampler sampler;
+	EXPECT_FALSE(sampler.isEnabled());
+
+	sampler.initialize(0, SAMPLER_SEED);
+	EXPECT_FALSE(sampler.isEnabled());
+	for (uintptr_t i = 0; i < 100000; i++) {
+		EXPECT_FALSE(sampler.allocated(4096));
+	}
+}
@@ -19,13 +19,28 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include <algorithm>
+#include <math.h>
+
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCConfigTest.hpp"
+#include "Heap.hpp"
+#include "HeapRegionDescriptor.hpp"
+#include "HeapRegionIterator.hpp"
+#include "HeapRegionManager.hpp"
+#include "mmomrhook.h"
+#include "MemoryPool.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
 #include "ObjectAllocationModel.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ObjectModel.hpp"
 #include "omrExampleVM.hpp"
 #include "omrgc.h"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelGlobalGC.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 #include "SlotObject.hpp"
 #include "StandardWriteBarrier.hpp"
 #include "VerboseWriterChain.hpp"
@@ -43,12 +58,34 @@
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/workstealing_GC_config.xml"
+                        , "fvtest/gctest/configuration/task_timeline_GC_config.xml"
+                        , "fvtest/gctest/configuration/adaptive_GC_threads_config.xml"
+                        , "fvtest/gctest/configuration/live_object_census_GC_config.xml"
+                        , "fvtest/gctest/configuration/async_logging_GC_config.xml"
+                        , "fvtest/gctest/configuration/json_verbose_GC_config.xml"
+                        , "fvtest/gctest/configuration/predictive_heap_resize_GC_config.xml"
+                        , "fvtest/gctest/configuration/split_freelist_lockfree_TLH_GC_config.xml"
+                        , "fvtest/gctest/configuration/allocation_sampling_GC_config.xml"
+                        , "fvtest/gctest/configuration/heap_walk_GC_config.xml"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_card_cleaning_pacing_GC_config.xml"
+#endif
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/compact_region_partitioned_GC_config.xml"
+#endif
+#if defined(OMR_GC_SEGREGATED_HEAP)
+                        , "fvtest/gctest/configuration/segregated_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregated_lazy_sweep_GC_config.xml"
+                        , "fvtest/gctest/configuration/segregated_generational_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_NUMA_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_remembered_set_map_GC_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_adaptive_scan_GC_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
@@ -57,7 +94,185 @@ const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/tlh_refresh_locked.xml",
+								"perftest/gctest/configuration/tlh_refresh_lockfree.xml",
+								"perftest/gctest/configuration/heap_walk_batched.xml"};
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+/**
+ * State shared by the threads of one round of the TLH refresh benchmark.
+ */
+typedef struct TLHRefreshBenchmark {
+	OMR_VM *omrVM;
+	MM_MemoryPool *memoryPool;
+	omrthread_monitor_t monitor;
+	uintptr_t refreshSize;
+	uintptr_t refreshesPerThread;
+	uintptr_t threadsReady;
+	uintptr_t threadsDone;
+	bool start;
+	bool failed;
+} TLHRefreshBenchmark;
+
+/**
+ * Per thread state of the TLH refresh benchmark.
+ */
+typedef struct TLHRefreshBenchmarkThread {
+	TLHRefreshBenchmark *benchmark;
+	uint64_t *latencies; /**< nanoseconds taken by each refresh */
+	uintptr_t refreshes; /**< number of refreshes completed */
+	uintptr_t bytes; /**< number of bytes in the TLHs refreshed */
+} TLHRefreshBenchmarkThread;
+
+static int J9THREAD_PROC
+tlhRefreshBenchmarkThread(void *arg)
+{
+	TLHRefreshBenchmarkThread *thread = (TLHRefreshBenchmarkThread *)arg;
+	TLHRefreshBenchmark *benchmark = thread->benchmark;
+	OMRPORT_ACCESS_FROM_OMRVM(benchmark->omrVM);
+	OMR_VMThread *omrVMThread = NULL;
+	bool attached = (OMR_ERROR_NONE == OMR_Thread_Init(benchmark->omrVM, NULL, &omrVMThread, "TLHRefreshBenchmarkThread"));
+
+	/* Wait for every thread to attach, so that the refreshes overlap as much as possible */
+	omrthread_monitor_enter(benchmark->monitor);
+	benchmark->failed |= !attached;
+	benchmark->threadsReady += 1;
+	omrthread_monitor_notify_all(benchmark->monitor);
+	while (!benchmark->start) {
+		omrthread_monitor_wait(benchmark->monitor);
+	}
+	omrthread_monitor_exit(benchmark->monitor);
+
+	if (attached) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		for (uintptr_t i = 0; i < benchmark->refreshesPerThread; i++) {
+			MM_AllocateDescription allocDescription(benchmark->refreshSize, 0, false, true);
+			void *addrBase = NULL;
+			void *addrTop = NULL;
+			int64_t startTime = omrtime_nano_time();
+			void *tlhBase = benchmark->memoryPool->allocateTLH(env, &allocDescription, benchmark->refreshSize, addrBase, addrTop);
+			int64_t endTime = omrtime_nano_time();
+			if (NULL == tlhBase) {
+				/* the pool is exhausted; keep what was measured so far */
+				break;
+			}
+			thread->latencies[thread->refreshes] = (uint64_t)(endTime - startTime);
+			thread->refreshes += 1;
+			thread->bytes += (uintptr_t)addrTop - (uintptr_t)addrBase;
+			/* leave the heap walkable, as flushing the TLH would */
+			benchmark->memoryPool->abandonTlhHeapChunk(addrBase, addrTop);
+		}
+		OMR_Thread_Free(omrVMThread);
+	}
+
+	omrthread_monitor_enter(benchmark->monitor);
+	benchmark->threadsDone += 1;
+	omrthread_monitor_notify_all(benchmark->monitor);
+	omrthread_monitor_exit(benchmark->monitor);
+
+	return 0;
+}
+
+/**
+ * State of the allocation sampling test, shared by the allocating thread and the sampling hook.
+ */
+typedef struct AllocationSamplingTest {
+	OMR_VM *omrVM;
+	omrthread_monitor_t monitor;
+	OMR_VMThread *omrVMThread; /**< the allocating thread; samples reported for other threads are ignored */
+	uintptr_t objectSize;
+	uintptr_t objects;
+	uintptr_t largeObjectSize;
+	uintptr_t largeObjects;
+	uintptr_t allocatedBytes; /**< bytes allocated by the thread, as the allocation path accounts them */
+	uintptr_t largeAllocations; /**< number of large objects allocated */
+	uintptr_t largeAllocatedBytes; /**< part of allocatedBytes which was allocated in large objects */
+	uintptr_t samples;
+	uintptr_t largeSamples;
+	uintptr_t sampledBytes; /**< sum of the weights of all samples */
+	bool done;
+	bool failed;
+} AllocationSamplingTest;
+
+static void
+allocationSampledHook(J9HookInterface **hook, uintptr_t eventNum, void *eventData, void *userData)
+{
+	MM_ObjectAllocationSampledEvent *event = (MM_ObjectAllocationSampledEvent *)eventData;
+	AllocationSamplingTest *test = (AllocationSamplingTest *)userData;
+
+	if (event->currentThread == test->omrVMThread) {
+		/* the object is not initialized yet, so its size can only be checked against what was requested */
+		MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(test->omrVM);
+		test->samples += 1;
+		if (event->objectSize == extensions->objectModel.adjustSizeInBytes(test->largeObjectSize)) {
+			test->largeSamples += 1;
+		} else if ((NULL == event->object) || (event->objectSize != extensions->objectModel.adjustSizeInBytes(test->objectSize))) {
+			test->failed = true;
+		}
+		test->sampledBytes += event->sampledBytes;
+	}
+}
+
+static omrobjectptr_t
+allocationSamplingAllocate(MM_EnvironmentBase *env, uintptr_t size)
+{
+	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
+	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
+			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
+	omrobjectptr_t object = OMR_GC_AllocateObject(env->getOmrVMThread(), noGc);
+	if (NULL == object) {
+		MM_ObjectAllocationModel *withGc = new(objectAllocationModelSpace)
+				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
+		object = OMR_GC_AllocateObject(env->getOmrVMThread(), withGc);
+	}
+	return object;
+}
+
+static int J9THREAD_PROC
+allocationSamplingThread(void *arg)
+{
+	AllocationSamplingTest *test = (AllocationSamplingTest *)arg;
+	OMR_VMThread *omrVMThread = NULL;
+
+	/* A fresh thread starts sampling from a fresh sampler, so every sampled byte is one allocated here */
+	if (OMR_ERROR_NONE == OMR_Thread_Init(test->omrVM, NULL, &omrVMThread, "AllocationSamplingThread")) {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		MM_GCExtensionsBase *extensions = env->getExtensions();
+		uintptr_t objectsPerLargeObject = test->objects / test->largeObjects;
+		test->omrVMThread = omrVMThread;
+		for (uintptr_t i = 0; (i < test->objects) && !test->failed; i++) {
+			/* Small objects are allocated from TLHs; the large ones, interleaved, never fit a TLH and are allocated out of line */
+			uintptr_t sizes[] = { test->objectSize, test->largeObjectSize };
+			uintptr_t allocations = (0 == ((i + 1) % objectsPerLargeObject)) ? 2 : 1;
+			for (uintptr_t j = 0; (j < allocations) && !test->failed; j++) {
+				omrobjectptr_t object = allocationSamplingAllocate(env, sizes[j]);
+				if (NULL == object) {
+					test->failed = true;
+				} else {
+					uintptr_t consumedSize = extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+					test->allocatedBytes += consumedSize;
+					if (0 != j) {
+						test->largeAllocations += 1;
+						test->largeAllocatedBytes += consumedSize;
+					}
+				}
+			}
+		}
+		test->omrVMThread = NULL;
+		OMR_Thread_Free(omrVMThread);
+	} else {
+		test->failed = true;
+	}
+
+	omrthread_monitor_enter(test->monitor);
+	test->done = true;
+	omrthread_monitor_notify_all(test->monitor);
+	omrthread_monitor_exit(test->monitor);
+
+	return 0;
+}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 void
 GCConfigTest::SetUp()
 {
@@ -809,6 +1024,168 @@ printFile(const char *name)
 }
 #endif
 
+/**
+ * Decode the JSON string at *cursor in place, leaving *cursor just past its closing quote.
+ * @return the NUL terminated string, or NULL if the string is not terminated
+ */
+static char *
+parseJSONString(char **cursor)
+{
+	char *read = *cursor + 1;
+	char *write = *cursor;
+	char *result = write;
+
+	while ('"' != *read) {
+		if ('\0' == *read) {
+			return NULL;
+		} else if ('\\' == *read) {
+			read += 1;
+			switch (*read) {
+			case 'n': *write++ = '\n'; read += 1; break;
+			case 't': *write++ = '\t'; read += 1; break;
+			case 'r': *write++ = '\r'; read += 1; break;
+			case 'u': {
+				/* the writer only escapes control characters this way */
+				char hex[5] = {read[1], read[2], read[3], read[4], '\0'};
+				*write++ = (char)strtol(hex, NULL, 16);
+				read += 5;
+				break;
+			}
+			case '\0': return NULL;
+			default: *write++ = *read++; break;
+			}
+		} else {
+			*write++ = *read++;
+		}
+	}
+	*write = '\0';
+	*cursor = read + 1;
+	return result;
+}
+
+/**
+ * Parse one JSON lines stanza object at *cursor and append it as an element of parent,
+ * inverting the transcoding done by MM_VerboseJSONTranscoder.
+ * @return true on success, false if the text is not a stanza object
+ */
+static bool
+parseJSONElement(char **cursor, pugi::xml_node parent)
+{
+	pugi::xml_node node;
+	char *read = *cursor;
+
+	read += strspn(read, " \t\r\n");
+	if ('{' != *read) {
+		return false;
+	}
+	read += 1;
+	while (true) {
+		read += strspn(read, " \t\r\n,");
+		if ('}' == *read) {
+			read += 1;
+			break;
+		} else if ('"' != *read) {
+			return false;
+		}
+		char *name = parseJSONString(&read);
+		if ((NULL == name) || (':' != *read)) {
+			return false;
+		}
+		read += 1;
+		if (0 == strcmp(name, "element")) {
+			char *value = parseJSONString(&read);
+			if (NULL == value) {
+				return false;
+			}
+			node = parent.append_child(value);
+		} else if (!node) {
+			/* "element" is always the first member */
+			return false;
+		} else if (0 == strcmp(name, "children")) {
+			if ('[' != *read) {
+				return false;
+			}
+			read += 1;
+			while (true) {
+				read += strspn(read, " \t\r\n,");
+				if (']' == *read) {
+					read += 1;
+					break;
+				}
+				if (!parseJSONElement(&read, node)) {
+					return false;
+				}
+			}
+		} else if ('"' == *read) {
+			char *value = parseJSONString(&read);
+			if (NULL == value) {
+				return false;
+			}
+			node.append_attribute(name).set_value(value);
+		} else {
+			/* a number; terminate it temporarily to copy it */
+			char *end = read + strcspn(read, ",}");
+			char delimiter = *end;
+			*end = '\0';
+			node.append_attribute(name).set_value(read);
+			*end = delimiter;
+			read = end;
+		}
+	}
+	*cursor = read;
+	return true;
+}
+
+/**
+ * Load a verbose GC log into verboseDoc. JSON lines logs (-Xgc:verboseFormat=json) are converted
+ * back into the XML document they were transcoded from, so the same xpath verification applies
+ * to both formats.
+ */
+pugi::xml_parse_status
+GCConfigTest::loadVerboseLog(const char *fileName, pugi::xml_document *verboseDoc)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = (MM_GCExtensionsBase *)exampleVM->_omrVM->_gcOmrVMExtensions;
+
+	if (MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES != extensions->verboseFormat) {
+		pugi::xml_parse_status status = verboseDoc->load_file(fileName).status;
+		/* the log is still open, so its closing </verbosegc> has not been written yet */
+		return (pugi::status_end_element_mismatch == status) ? pugi::status_ok : status;
+	}
+
+	intptr_t fileDescriptor = omrfile_open(fileName, EsOpenRead, 0444);
+	if (-1 == fileDescriptor) {
+		return pugi::status_file_not_found;
+	}
+	pugi::xml_parse_status status = pugi::status_ok;
+	int64_t length = omrfile_flength(fileDescriptor);
+	char *contents = (char *)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_MM);
+	if (NULL == contents) {
+		status = pugi::status_out_of_memory;
+	} else if (length != omrfile_read(fileDescriptor, contents, (intptr_t)length)) {
+		status = pugi::status_io_error;
+	} else {
+		contents[length] = '\0';
+		/* the first line is the verbosegc header object; every following line is one of its stanzas */
+		char *cursor = contents;
+		if (!parseJSONElement(&cursor, *verboseDoc)) {
+			status = pugi::status_bad_start_element;
+		} else {
+			pugi::xml_node root = verboseDoc->first_child();
+			while ('\0' != *(cursor += strspn(cursor, " \t\r\n"))) {
+				if (!parseJSONElement(&cursor, root)) {
+					gcTestEnv->log(LEVEL_ERROR, "%s:%d Malformed JSON lines verbose log %s near offset %zu.\n", __FILE__, __LINE__, fileName, (size_t)(cursor - contents));
+					status = pugi::status_bad_start_element;
+					break;
+				}
+			}
+		}
+	}
+	omrmem_free_memory(contents);
+	omrfile_close(fileDescriptor);
+	return status;
+}
+
 int32_t
 GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 {
@@ -830,7 +1207,9 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 	do {
 		pugi::xml_document verboseDoc;
 		if (0 == numOfFiles) {
-			verboseDoc.load_file(verboseFile);
+			if (pugi::status_ok != loadVerboseLog(verboseFile, &verboseDoc)) {
+				rt = 1;
+			}
 			gcTestEnv->log("Parsing verbose log %s:\n", verboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
 			printFile(verboseFile);
@@ -838,9 +1217,11 @@ GCConfigTest::verifyVerboseGC(pugi::xpath_node_set verboseGCs)
 		} else {
 			char currentVerboseFile[MAX_NAME_LENGTH];
 			omrstr_printf(currentVerboseFile, MAX_NAME_LENGTH, "%s.%03zu", verboseFile, seq++);
-			pugi::xml_parse_result result = verboseDoc.load_file(currentVerboseFile);
-			if (pugi::status_file_not_found == result.status) {
+			pugi::xml_parse_status status = loadVerboseLog(currentVerboseFile, &verboseDoc);
+			if (pugi::status_file_not_found == status) {
 				break;
+			} else if (pugi::status_ok != status) {
+				rt = 1;
 			}
 			gcTestEnv->log("Parsing verbose log %s:\n", currentVerboseFile);
 #if defined(OMRGCTEST_PRINTFILE)
@@ -973,9 +1354,391 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "tlhRefreshBenchmark")) {
+			rt = tlhRefreshBenchmark(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "heapWalkBenchmark")) {
+			rt = heapWalkBenchmark(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "liveObjectCensus")) {
+			rt = verifyLiveObjectCensus(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "allocationSampling")) {
+			rt = verifyAllocationSampling(node);
+			OMRGCTEST_CHECK_RT(rt);
+		}
+	}
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::tlhRefreshBenchmark(pugi::xml_node node)
+{
+	int32_t rt = 0;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	AttributeElem *threadCountElem = NULL;
+	const char *threadsStr = node.attribute("threads").value();
+	uintptr_t refreshSize = (uintptr_t)node.attribute("refreshSize").as_uint();
+	uintptr_t refreshes = (uintptr_t)node.attribute("refreshes").as_uint();
+	MM_MemoryPool *memoryPool = env->getMemorySpace()->getDefaultMemorySubSpace()->getMemoryPool();
+
+	if (0 == strcmp(threadsStr, "")) {
+		threadsStr = "1";
+	}
+	if ((0 == refreshSize) || (0 == refreshes) || (NULL == memoryPool)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid tlhRefreshBenchmark: refreshSize and refreshes are required.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	rt = parseAttribute(&threadCountElem, threadsStr);
+	OMRGCTEST_CHECK_RT(rt);
+
+	for (AttributeElem *elem = threadCountElem; 0 == rt; elem = elem->linkNext) {
+		uintptr_t threadCount = OMR_MAX(1, elem->value);
+		TLHRefreshBenchmark benchmark;
+		benchmark.omrVM = exampleVM->_omrVM;
+		benchmark.memoryPool = memoryPool;
+		benchmark.refreshSize = refreshSize;
+		benchmark.refreshesPerThread = refreshes / threadCount;
+		benchmark.threadsReady = 0;
+		benchmark.threadsDone = 0;
+		benchmark.start = false;
+		benchmark.failed = false;
+
+		uint64_t *latencies = (uint64_t *)omrmem_allocate_memory(sizeof(uint64_t) * benchmark.refreshesPerThread * threadCount, OMRMEM_CATEGORY_MM);
+		TLHRefreshBenchmarkThread *threads = (TLHRefreshBenchmarkThread *)omrmem_allocate_memory(sizeof(TLHRefreshBenchmarkThread) * threadCount, OMRMEM_CATEGORY_MM);
+		if ((NULL == latencies) || (NULL == threads) || (0 != omrthread_monitor_init_with_name(&benchmark.monitor, 0, "TLHRefreshBenchmark"))) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to allocate native memory.\n", __FILE__, __LINE__);
+			omrmem_free_memory(latencies);
+			omrmem_free_memory(threads);
+			break;
+		}
+
+		/* Free memory only shrinks by what was handed out in TLHs, however the TLHs were carved */
+		uintptr_t freeBefore = memoryPool->getApproximateFreeMemorySize();
+		uintptr_t threadsStarted = 0;
+		omrthread_monitor_enter(benchmark.monitor);
+		for (; threadsStarted < threadCount; threadsStarted++) {
+			omrthread_t handle = NULL;
+			threads[threadsStarted].benchmark = &benchmark;
+			threads[threadsStarted].latencies = latencies + (threadsStarted * benchmark.refreshesPerThread);
+			threads[threadsStarted].refreshes = 0;
+			threads[threadsStarted].bytes = 0;
+			if (0 != omrthread_create_ex(&handle, J9THREAD_ATTR_DEFAULT, 0, tlhRefreshBenchmarkThread, &threads[threadsStarted])) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to create benchmark thread.\n", __FILE__, __LINE__);
+				break;
+			}
+		}
+		while (benchmark.threadsReady < threadsStarted) {
+			omrthread_monitor_wait(benchmark.monitor);
+		}
+		benchmark.start = true;
+		omrthread_monitor_notify_all(benchmark.monitor);
+		while (benchmark.threadsDone < threadsStarted) {
+			omrthread_monitor_wait(benchmark.monitor);
+		}
+		omrthread_monitor_exit(benchmark.monitor);
+		omrthread_monitor_destroy(benchmark.monitor);
+
+		if (benchmark.failed) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Benchmark thread failed to attach to the VM.\n", __FILE__, __LINE__);
+		}
+
+		/* Gather the latencies of all threads at the front of the array */
+		uintptr_t sampleCount = 0;
+		uintptr_t refreshedBytes = 0;
+		for (uintptr_t i = 0; i < threadsStarted; i++) {
+			memmove(latencies + sampleCount, threads[i].latencies, sizeof(uint64_t) * threads[i].refreshes);
+			sampleCount += threads[i].refreshes;
+			refreshedBytes += threads[i].bytes;
+		}
+		uintptr_t freeAfter = memoryPool->getApproximateFreeMemorySize();
+		if ((0 == rt) && ((freeBefore - freeAfter) != refreshedBytes)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Free memory shrank by %zu bytes, but %zu bytes were refreshed.\n", __FILE__, __LINE__, freeBefore - freeAfter, refreshedBytes);
+		}
+		if ((0 == rt) && (0 == sampleCount)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d No TLH could be refreshed.\n", __FILE__, __LINE__);
+		}
+		if (0 == rt) {
+			std::sort(latencies, latencies + sampleCount);
+			gcTestEnv->log("TLH refresh benchmark: %zu threads, %zu refreshes of %zu bytes, p50 %llu ns, p99 %llu ns\n",
+					threadCount, sampleCount, refreshSize, latencies[((sampleCount - 1) * 50) / 100], latencies[((sampleCount - 1) * 99) / 100]);
+		}
+		omrmem_free_memory(latencies);
+		omrmem_free_memory(threads);
+
+		/* Recover the refreshed TLHs before the next round */
+		if (0 == rt) {
+			rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC);
+			if (OMR_ERROR_NONE != rt) {
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
+			}
+			verboseManager->getWriterChain()->endOfCycle(env);
+		}
+		if (elem->linkNext == threadCountElem) {
+			break;
 		}
 	}
+
+done:
+	freeAttributeList(threadCountElem);
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyAllocationSampling(pugi::xml_node node)
+{
+	int32_t rt = 0;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	J9HookInterface **omrHooks = J9_HOOK_INTERFACE(extensions->omrHookInterface);
+	uintptr_t interval = extensions->allocationSamplingInterval;
+	omrthread_t handle = NULL;
+	AllocationSamplingTest test;
+	memset(&test, 0, sizeof(test));
+	test.omrVM = exampleVM->_omrVM;
+	test.objectSize = (uintptr_t)node.attribute("objectSize").as_uint();
+	test.objects = (uintptr_t)node.attribute("objects").as_uint();
+	test.largeObjectSize = (uintptr_t)node.attribute("largeObjectSize").as_uint();
+	test.largeObjects = (uintptr_t)node.attribute("largeObjects").as_uint();
+
+	if ((0 == interval) || (0 == test.objects) || (0 == test.largeObjects) || (test.largeObjects > test.objects)
+		|| (test.objectSize > extensions->tlhMinimumSize) || (test.largeObjectSize <= extensions->tlhMaximumSize)
+	) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid allocationSampling: allocationSamplingInterval must be set, objectSize must fit a TLH, largeObjectSize must exceed the TLH maximum size and largeObjects must not exceed objects.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	if (0 != omrthread_monitor_init_with_name(&test.monitor, 0, "AllocationSamplingTest")) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to initialize monitor.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	if (0 != (*omrHooks)->J9HookRegisterWithCallSite(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED, allocationSampledHook, OMR_GET_CALLSITE(), &test)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to register J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED.\n", __FILE__, __LINE__);
+		omrthread_monitor_destroy(test.monitor);
+		goto done;
+	}
+
+	omrthread_monitor_enter(test.monitor);
+	if (0 == omrthread_create_ex(&handle, J9THREAD_ATTR_DEFAULT, 0, allocationSamplingThread, &test)) {
+		while (!test.done) {
+			omrthread_monitor_wait(test.monitor);
+		}
+	} else {
+		test.failed = true;
+	}
+	omrthread_monitor_exit(test.monitor);
+	(*omrHooks)->J9HookUnregister(omrHooks, J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED, allocationSampledHook, &test);
+	omrthread_monitor_destroy(test.monitor);
+
+	if (test.failed) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation sampling thread failed to allocate, or a sample did not describe its object.\n", __FILE__, __LINE__);
+		goto done;
+	}
+	{
+		/* Every byte is sampled with the same probability: the small objects see a sample point once every interval
+		 * bytes on average, each large object holds at least one sample point with probability 1 - e^(-size / interval).
+		 * Both counts must be within 5 standard deviations of their expectation.
+		 */
+		uintptr_t smallSamples = test.samples - test.largeSamples;
+		double expectedSmallSamples = (double)(test.allocatedBytes - test.largeAllocatedBytes) / (double)interval;
+		double largeProbability = 1.0 - exp(-(double)test.largeAllocatedBytes / (double)(test.largeAllocations * interval));
+		double expectedLargeSamples = (double)test.largeAllocations * largeProbability;
+		double largeDeviation = sqrt(expectedLargeSamples * (1.0 - largeProbability));
+		if ((fabs((double)smallSamples - expectedSmallSamples) > (5.0 * sqrt(expectedSmallSamples)))
+			|| (fabs((double)test.largeSamples - expectedLargeSamples) > (5.0 * largeDeviation))
+		) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation sampling took %zu small and %zu large samples, expected %.1f and %.1f.\n",
+					__FILE__, __LINE__, smallSamples, test.largeSamples, expectedSmallSamples, expectedLargeSamples);
+			goto done;
+		}
+		/* The weights cover every allocated byte up to the last sample, and what follows it holds no sample point */
+		if ((test.sampledBytes > test.allocatedBytes) || ((test.allocatedBytes - test.sampledBytes) >= (32 * interval))) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Allocation samples weigh %zu bytes, but %zu bytes were allocated.\n",
+					__FILE__, __LINE__, test.sampledBytes, test.allocatedBytes);
+			goto done;
+		}
+		gcTestEnv->log("Allocation sampling: %zu bytes allocated, %zu small and %zu large samples (expected %.1f and %.1f) weighing %zu bytes\n",
+				test.allocatedBytes, smallSamples, test.largeSamples, expectedSmallSamples, expectedLargeSamples, test.sampledBytes);
+	}
+
+	rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	verboseManager->getWriterChain()->endOfCycle(env);
+
+done:
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyLiveObjectCensus(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	uintptr_t minTypes = (uintptr_t)node.attribute("minTypes").as_uint(1);
+	uintptr_t rankings[] = {OMR_GC_LIVE_OBJECT_CENSUS_BY_OBJECTS, OMR_GC_LIVE_OBJECT_CENSUS_BY_BYTES};
+	OMR_GC_LiveObjectCensusEntry entries[64];
+
+	for (uintptr_t i = 0; i < sizeof(rankings) / sizeof(rankings[0]); i++) {
+		uintptr_t entryCount = sizeof(entries) / sizeof(entries[0]);
+		rt = (int32_t)OMR_GC_GetLiveObjectCensus(exampleVM->_omrVMThread, rankings[i], entries, &entryCount);
+		if (OMR_ERROR_NONE != rt) {
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to get the live object census with error code %d.\n", __FILE__, __LINE__, rt);
+			goto done;
+		}
+		if (entryCount < minTypes) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Live object census reported %zu types, expected at least %zu.\n", __FILE__, __LINE__, entryCount, minTypes);
+			goto done;
+		}
+		for (uintptr_t rank = 1; rank < entryCount; rank++) {
+			if ((0 == entries[rank].type) || (entries[rank - 1].value < entries[rank].value)) {
+				rt = 1;
+				gcTestEnv->log(LEVEL_ERROR, "%s:%d Live object census rank %zu is out of order.\n", __FILE__, __LINE__, rank + 1);
+				goto done;
+			}
+		}
+		gcTestEnv->log("Live object census reported %zu types, top type %zx with %zu %s.\n", entryCount, entries[0].type, entries[0].value,
+			(OMR_GC_LIVE_OBJECT_CENSUS_BY_BYTES == rankings[i]) ? "bytes" : "objects");
+	}
+
+done:
+	return rt;
+}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+static void
+heapWalkBenchmarkCountObject(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	uintptr_t *counts = (uintptr_t *)userData;
+	counts[0] += 1;
+	counts[1] += MM_GCExtensionsBase::getExtensions(omrVMThread->_vm)->objectModel.getConsumedSizeInBytesWithHeader(object);
+}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+int32_t
+GCConfigTest::heapWalkBenchmark(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t iterations = (uintptr_t)node.attribute("iterations").as_uint(1);
+	uintptr_t batchSize = (uintptr_t)node.attribute("batchSize").as_uint(1024);
+	/* size in MB of the buffer written between the walks; it must be larger than the last level cache */
+	uintptr_t evictSize = (uintptr_t)node.attribute("evictSize").as_uint(64) * 1024 * 1024;
+	omrobjectptr_t *batch = (omrobjectptr_t *)omrmem_allocate_memory(sizeof(omrobjectptr_t) * batchSize, OMRMEM_CATEGORY_MM);
+	void *evictBuffer = omrmem_allocate_memory(OMR_MAX(evictSize, 1), OMRMEM_CATEGORY_MM);
+	uintptr_t lastObjects = 0;
+	uintptr_t lastBytes = 0;
+	enum {
+		BUFFERED = 0,
+		BATCHED = 1
+	};
+
+	if ((0 == iterations) || (0 == batchSize) || (NULL == batch) || (NULL == evictBuffer)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Invalid heapWalkBenchmark: iterations and batchSize must be non-zero.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	/* Collect first so that no active TLH leaves an unwalkable gap in the heap */
+	rt = (int32_t)OMR_GC_SystemCollect(exampleVM->_omrVMThread, J9MMCONSTANT_EXPLICIT_GC_SYSTEM_GC);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_SystemCollect with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	verboseManager->getWriterChain()->endOfCycle(env);
+
+	for (uintptr_t iteration = 0; iteration < iterations; iteration++) {
+		uintptr_t objects[2] = { 0, 0 };
+		uintptr_t bytes[2] = { 0, 0 };
+		uint64_t times[2] = { 0, 0 };
+
+		/* Alternate which walk goes first, so that neither consistently inherits the other's warm caches */
+		for (uintptr_t walk = 0; walk < 2; walk++) {
+			uintptr_t variant = (iteration + walk) % 2;
+			MM_HeapRegionDescriptor *region = NULL;
+
+			/* Evict the heap from the caches by writing a buffer larger than them */
+			memset(evictBuffer, (int)(iteration + walk), evictSize);
+
+			uint64_t startTime = omrtime_hires_clock();
+			GC_HeapRegionIterator regionIterator(extensions->heap->getHeapRegionManager());
+			while (NULL != (region = regionIterator.nextRegion())) {
+				GC_ObjectHeapBufferedIterator objectIterator(extensions, region);
+				if (BUFFERED == variant) {
+					/* Walk with the per-object iterator... */
+					omrobjectptr_t object = NULL;
+					while (NULL != (object = objectIterator.nextObject())) {
+						objects[variant] += 1;
+						bytes[variant] += extensions->objectModel.getConsumedSizeInBytesWithHeader(object);
+					}
+				} else {
+					/* ...and in batches, prefetching ahead of the object being visited */
+					uintptr_t count = 0;
+					while (0 != (count = objectIterator.nextObjects(batch, batchSize))) {
+						for (uintptr_t i = 0; i < count; i++) {
+							if ((i + GC_ObjectHeapBufferedIterator::PREFETCH_DISTANCE) < count) {
+								GC_ObjectHeapBufferedIterator::prefetchObject(batch[i + GC_ObjectHeapBufferedIterator::PREFETCH_DISTANCE]);
+							}
+							objects[variant] += 1;
+							bytes[variant] += extensions->objectModel.getConsumedSizeInBytesWithHeader(batch[i]);
+						}
+					}
+				}
+			}
+			times[variant] = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+		}
+
+		if ((objects[BUFFERED] != objects[BATCHED]) || (bytes[BUFFERED] != bytes[BATCHED])) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Batched heap walk found %zu objects (%zu bytes), expected %zu objects (%zu bytes).\n",
+					__FILE__, __LINE__, objects[BATCHED], bytes[BATCHED], objects[BUFFERED], bytes[BUFFERED]);
+			break;
+		}
+		gcTestEnv->log("Heap walk benchmark: %zu objects (%zu bytes), %s first, buffered %llu objects/sec, batched by %zu %llu objects/sec\n",
+				objects[BUFFERED], bytes[BUFFERED], (BUFFERED == (iteration % 2)) ? "buffered" : "batched",
+				(0 == times[BUFFERED]) ? 0 : ((uint64_t)objects[BUFFERED] * 1000000000) / times[BUFFERED],
+				batchSize,
+				(0 == times[BATCHED]) ? 0 : ((uint64_t)objects[BATCHED] * 1000000000) / times[BATCHED]);
+		lastObjects = objects[BUFFERED];
+		lastBytes = bytes[BUFFERED];
+	}
+
+#if defined(OMR_GC_MODRON_STANDARD)
+	if ((0 == rt) && extensions->isStandardGC()) {
+		/* The collector's own serial heap walk fetches its objects in batches too, and must find the same ones */
+		uintptr_t walkerCounts[2] = { 0, 0 };
+		MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+		globalCollector->getHeapWalker()->allObjectsDo(env, heapWalkBenchmarkCountObject, walkerCounts, 0, false, false);
+		if ((walkerCounts[0] != lastObjects) || (walkerCounts[1] != lastBytes)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Heap walker found %zu objects (%zu bytes), expected %zu objects (%zu bytes).\n",
+					__FILE__, __LINE__, walkerCounts[0], walkerCounts[1], lastObjects, lastBytes);
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
 done:
+	omrmem_free_memory(evictBuffer);
+	omrmem_free_memory(batch);
 	return rt;
 }
 
@@ -1044,6 +1807,8 @@ TEST_P(GCConfigTest, test)
 			/* select verboseGC nodes with right spec info */
 			omrstr_printf(verboseNodeSet, MAX_NAME_LENGTH, "verboseGC[not(@spec) or @spec = '%s']", STRINGFY(SPEC));
 			pugi::xpath_node_set verboseGCs = configChild.select_nodes(verboseNodeSet);
+			/* writers may defer their output; make sure everything reported so far is in the log */
+			verboseManager->flushStreams(env);
 			rt = verifyVerboseGC(verboseGCs);
 			ASSERT_EQ(0, rt) << "Failed in verbose GC verification.";
 			gcTestEnv->log("[ Verification Successful ]\n\n");
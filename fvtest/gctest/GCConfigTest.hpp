@@ -107,9 +107,14 @@ protected:
 #if defined(OMRGCTEST_PRINTFILE)
 	void printFile(const char *name);
 #endif
+	pugi::xml_parse_status loadVerboseLog(const char *fileName, pugi::xml_document *verboseDoc);
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t tlhRefreshBenchmark(pugi::xml_node node);
+	int32_t heapWalkBenchmark(pugi::xml_node node);
+	int32_t verifyLiveObjectCensus(pugi::xml_node node);
+	int32_t verifyAllocationSampling(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
@@ -24,6 +24,51 @@
 #include <string.h>
 #include "pugixml.hpp"
 
+/**
+ * An option of the test configuration which maps straight to a field of MM_GCExtensionsBase.
+ */
+struct BooleanOption {
+	const char *name; /**< attribute name in the option element */
+	bool *value; /**< field set from the attribute */
+};
+
+struct UDATAOption {
+	const char *name; /**< attribute name in the option element */
+	uintptr_t *value; /**< field set from the attribute */
+};
+
+/**
+ * Set the boolean option named by attr, if it is one of options, from the attribute value ("true" or anything else).
+ * @return true if attr names one of options
+ */
+static bool
+parseBooleanOption(pugi::xml_attribute attr, const BooleanOption *options, uintptr_t optionCount)
+{
+	for (uintptr_t i = 0; i < optionCount; i++) {
+		if (0 == strcmp(attr.name(), options[i].name)) {
+			*options[i].value = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Set the numeric option named by attr, if it is one of options, from the attribute value multiplied by unitSize.
+ * @return true if attr names one of options
+ */
+static bool
+parseUDATAOption(pugi::xml_attribute attr, const UDATAOption *options, uintptr_t optionCount, uintptr_t unitSize)
+{
+	for (uintptr_t i = 0; i < optionCount; i++) {
+		if (0 == strcmp(attr.name(), options[i].name)) {
+			*options[i].value = atoi(attr.value()) * unitSize;
+			return true;
+		}
+	}
+	return false;
+}
+
 bool
 MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensions)
 {
@@ -37,7 +82,7 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 		/* parse options */
 		pugi::xpath_node option = doc.select_node("/gc-config/option");
 
-		int32_t unitSize = 1;
+		uintptr_t unitSize = 1;
 		const char *unit = option.node().attribute("sizeUnit").value();
 		if (0 != strcmp(unit, "")) {
 			if (0 == j9_cmdla_stricmp(unit, "B")) {
@@ -54,36 +99,92 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 			}
 		}
 
+		/* Options which are set straight from the attribute value */
+		const BooleanOption booleanOptions[] = {
+			{ "workStealingMark", &extensions->workStealingMark },
+			{ "splitFreeListLockFreeTLHCarving", &extensions->splitFreeListLockFreeTLHCarving },
+			{ "taskTimeline", &extensions->taskTimeline },
+			{ "adaptiveGCThreads", &extensions->adaptiveGCThreads },
+			{ "liveObjectCensus", &extensions->liveObjectCensus },
+			{ "heapResizePredictive", &extensions->heapResizePredictive },
+			{ "asyncLogging", &extensions->asyncLogging },
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+			{ "cardCleaningPacing", &extensions->cardCleaningPacing },
+			{ "optimizeConcurrentWB", &extensions->optimizeConcurrentWB },
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+			{ "compactRegionPartitioned", &extensions->compactRegionPartitioned },
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+			{ "segregatedLazySweep", &extensions->segregatedLazySweep },
+			{ "segregatedGenerational", &extensions->segregatedGenerational },
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+			{ "forceBackOut", &extensions->fvtest_forceScavengerBackout },
+			{ "forcePoisonEvacuate", &extensions->fvtest_forcePoisonEvacuate },
+			{ "scavengerNUMAAware", &extensions->scavengerNUMAAware },
+			{ "scavengerRememberedSetMap", &extensions->scavengerRememberedSetMap },
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+		};
+		const UDATAOption sizeOptions[] = {
+			{ "memoryMax", &extensions->memoryMax },
+			{ "initialMemorySize", &extensions->initialMemorySize },
+			{ "minNewSpaceSize", &extensions->minNewSpaceSize },
+			{ "newSpaceSize", &extensions->newSpaceSize },
+			{ "maxNewSpaceSize", &extensions->maxNewSpaceSize },
+			{ "minOldSpaceSize", &extensions->minOldSpaceSize },
+			{ "oldSpaceSize", &extensions->oldSpaceSize },
+			{ "maxOldSpaceSize", &extensions->maxOldSpaceSize },
+			{ "allocationIncrement", &extensions->allocationIncrement },
+			{ "fixedAllocationIncrement", &extensions->fixedAllocationIncrement },
+			{ "lowMinimum", &extensions->lowMinimum },
+			{ "allowMergedSpaces", &extensions->allowMergedSpaces },
+			{ "maxSizeDefaultMemorySpace", &extensions->maxSizeDefaultMemorySpace },
+			{ "splitFreeListCarveWindowSize", &extensions->splitFreeListCarveWindowSize },
+			{ "asyncLoggingBufferSize", &extensions->asyncLoggingBufferSize },
+			{ "allocationSamplingInterval", &extensions->allocationSamplingInterval },
+		};
+		const UDATAOption countOptions[] = {
+			{ "splitFreeListSplitAmount", &extensions->splitFreeListSplitAmount },
+			{ "liveObjectCensusSampleRate", &extensions->liveObjectCensusSampleRate },
+			{ "heapResizeTargetGCOverhead", &extensions->heapResizeTargetGCOverhead },
+			{ "heapResizeHysteresis", &extensions->heapResizeHysteresis },
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+			{ "cardCleaningPacingBound", &extensions->cardCleaningPacingBound },
+			{ "cardCleaningPacingBudget", &extensions->cardCleaningPacingBudget },
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_MODRON_COMPACTION)
+			{ "compactPartitionsPerThread", &extensions->compactPartitionsPerThread },
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+			{ "segregatedMaxMinorCollects", &extensions->segregatedMaxMinorCollects },
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+			{ "scavengerRememberedSetListMaxSize", &extensions->scavengerRememberedSetListMaxSize },
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+		};
+
 		if (result) {
 			for (pugi::xml_attribute attr = option.node().first_attribute(); attr; attr = attr.next_attribute()) {
-				if (0 == strcmp(attr.name(), "memoryMax")) {
-					extensions->memoryMax = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "initialMemorySize")) {
-					extensions->initialMemorySize = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "minNewSpaceSize")) {
-					extensions->minNewSpaceSize = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "newSpaceSize")) {
-					extensions->newSpaceSize = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "maxNewSpaceSize")) {
-					extensions->maxNewSpaceSize = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "minOldSpaceSize")) {
-					extensions->minOldSpaceSize = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "oldSpaceSize")) {
-					extensions->oldSpaceSize = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "maxOldSpaceSize")) {
-					extensions->maxOldSpaceSize = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "allocationIncrement")) {
-					extensions->allocationIncrement = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "fixedAllocationIncrement")) {
-					extensions->fixedAllocationIncrement = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "lowMinimum")) {
-					extensions->lowMinimum = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "allowMergedSpaces")) {
-					extensions->allowMergedSpaces = atoi(attr.value()) * unitSize;
-				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
-					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
+				if (parseBooleanOption(attr, booleanOptions, sizeof(booleanOptions) / sizeof(booleanOptions[0]))
+					|| parseUDATAOption(attr, sizeOptions, sizeof(sizeOptions) / sizeof(sizeOptions[0]), unitSize)
+					|| parseUDATAOption(attr, countOptions, sizeof(countOptions) / sizeof(countOptions[0]), 1)
+				) {
+					continue;
+				}
+
+				if (0 == strcmp(attr.name(), "verboseFormat")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "xml")) {
+						extensions->verboseFormat = MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_XML;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "json")) {
+						extensions->verboseFormat = MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized verbose format (expected xml or json): %s\n", attr.value());
+						result = false;
+					}
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -91,8 +192,14 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=gencon ignored, requires OMR_GC_MODRON_SCAVENGER (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "segregated")) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+						_useSegregatedGC = true;
+#else
+						gcTestEnv->log(LEVEL_ERROR, "WARNING: GCPolicy=segregated ignored, requires OMR_GC_SEGREGATED_HEAP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 					} else  if (0 != j9_cmdla_stricmp(attr.value(), "optavgpause")) {
-						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon or optavgpause): %s\n", attr.value());
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized GC policy (expected gencon, segregated or optavgpause): %s\n", attr.value());
 						result = false;
 					}
 				} else if (0 == strcmp(attr.name(), "concurrentMark")) {
@@ -101,11 +208,27 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+#if defined(OMR_GC_MODRON_COMPACTION)
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->compactOnGlobalGC = 1;
+					}
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
 #if defined(OMR_GC_MODRON_SCAVENGER)
-				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
-					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
-				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
-					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerScanOrdering")) {
+					if (0 == j9_cmdla_stricmp(attr.value(), "breadthFirst")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "hierarchical")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+					} else if (0 == j9_cmdla_stricmp(attr.value(), "adaptive")) {
+						extensions->scavengerScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_ADAPTIVE;
+					} else {
+						gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized scavenger scan ordering (expected breadthFirst, hierarchical or adaptive): %s\n", attr.value());
+						result = false;
+					}
+				} else if (0 == strcmp(attr.name(), "simulatedNUMANodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "BitmapScanner.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#define BITMAPSCANNER_TEST_MAP_BYTES ((uintptr_t)16 * 1024)
+#define BITMAPSCANNER_BENCHMARK_MAP_BYTES ((uintptr_t)32 * 1024 * 1024)
+#define BITMAPSCANNER_BENCHMARK_ITERATIONS 4
+
+/**
+ * Deterministic pseudo random numbers, so that every implementation scans the same maps.
+ */
+static uint32_t
+nextRandom(uint32_t *seed)
+{
+	*seed = (*seed * 1103515245) + 12345;
+	return *seed >> 8;
+}
+
+/**
+ * Fill map with zeroes, setting one random bit in (on average) one in every sparseness bytes.
+ */
+static void
+fillMap(uint8_t *map, uintptr_t bytes, uint32_t sparseness, uint32_t seed)
+{
+	memset(map, 0, bytes);
+	for (uintptr_t i = 0; i < bytes; i++) {
+		if (0 == (nextRandom(&seed) % sparseness)) {
+			map[i] = (uint8_t)(1 << (nextRandom(&seed) % 8));
+		}
+	}
+}
+
+static uint8_t *
+referenceSkipZeroBytes(uint8_t *current, uint8_t *top)
+{
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t
+referenceCountBits(uint8_t *base, uint8_t *top)
+{
+	uintptr_t count = 0;
+	for (uint8_t *current = base; current < top; current++) {
+		for (uint8_t value = *current; 0 != value; value &= (value - 1)) {
+			count += 1;
+		}
+	}
+	return count;
+}
+
+static uintptr_t
+referenceCountNonZeroBytes(uint8_t *base, uint8_t *top)
+{
+	uintptr_t count = 0;
+	for (uint8_t *current = base; current < top; current++) {
+		count += (0 != *current) ? 1 : 0;
+	}
+	return count;
+}
+
+/**
+ * Compare every implementation the processor supports with a byte at a time reference, over
+ * maps of varying density and ranges which start and end at every alignment within a vector block.
+ */
+TEST(TestBitmapScanner, skipAndCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	/* over allocate so that the map can be aligned to a cache line, making the alignments tested deterministic */
+	void *allocation = omrmem_allocate_memory(BITMAPSCANNER_TEST_MAP_BYTES + 128, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != allocation);
+	uint8_t *map = (uint8_t *)(((uintptr_t)allocation + 127) & ~(uintptr_t)127);
+	uint32_t sparsenesses[] = { 1, 3, 97, 4099, 0xFFFFFFFF };
+
+	MM_BitmapScanner scanner;
+	scanner.initialize(OMRPORTLIB);
+	gcTestEnv->log("Bitmap scanner supports %s\n", MM_BitmapScanner::getImplementationName(scanner.getSupportedImplementation()));
+	EXPECT_EQ(scanner.getSupportedImplementation(), scanner.getImplementation());
+
+	for (uintptr_t implementation = MM_BitmapScanner::SCAN_SCALAR; implementation <= (uintptr_t)scanner.getSupportedImplementation(); implementation++) {
+		ASSERT_TRUE(scanner.setImplementation((MM_BitmapScanner::Implementation)implementation));
+		for (uintptr_t s = 0; s < sizeof(sparsenesses) / sizeof(sparsenesses[0]); s++) {
+			fillMap(map, BITMAPSCANNER_TEST_MAP_BYTES, sparsenesses[s], (uint32_t)(s + 1));
+			for (uintptr_t baseOffset = 0; baseOffset < 128; baseOffset += 7) {
+				for (uintptr_t topOffset = 0; topOffset < 128; topOffset += 5) {
+					uint8_t *base = map + baseOffset;
+					uint8_t *top = map + BITMAPSCANNER_TEST_MAP_BYTES - topOffset;
+
+					/* every non-zero byte must be found, in order */
+					uint8_t *expected = base;
+					uint8_t *found = base;
+					do {
+						expected = referenceSkipZeroBytes(expected, top);
+						found = scanner.skipZeroBytes(found, top);
+						ASSERT_EQ(expected, found) << MM_BitmapScanner::getImplementationName((MM_BitmapScanner::Implementation)implementation)
+								<< " sparseness " << sparsenesses[s] << " base " << baseOffset << " top " << topOffset;
+						expected += 1;
+						found += 1;
+					} while (expected <= top);
+
+					ASSERT_EQ(referenceCountNonZeroBytes(base, top), scanner.countNonZeroBytes(base, top));
+
+					uintptr_t *slotBase = (uintptr_t *)(map + (baseOffset & ~(sizeof(uintptr_t) - 1)));
+					uintptr_t *slotTop = (uintptr_t *)(map + BITMAPSCANNER_TEST_MAP_BYTES - (topOffset & ~(sizeof(uintptr_t) - 1)));
+					ASSERT_EQ(referenceCountBits((uint8_t *)slotBase, (uint8_t *)slotTop), scanner.countBits(slotBase, slotTop));
+
+					uintptr_t *expectedSlot = slotBase;
+					while ((expectedSlot < slotTop) && (0 == *expectedSlot)) {
+						expectedSlot += 1;
+					}
+					ASSERT_EQ(expectedSlot, scanner.skipEmptySlots(slotBase, slotTop));
+				}
+			}
+		}
+	}
+
+	omrmem_free_memory(allocation);
+}
+
+/**
+ * Measure the rate at which each supported implementation scans a mark map, visiting every
+ * non-empty slot as sweep does and counting the marked bits, for a sparse and a dense heap.
+ */
+TEST(TestBitmapScanner, scanBandwidth)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	void *allocation = omrmem_allocate_memory(BITMAPSCANNER_BENCHMARK_MAP_BYTES + 128, OMRMEM_CATEGORY_MM);
+	ASSERT_TRUE(NULL != allocation);
+	uint8_t *map = (uint8_t *)(((uintptr_t)allocation + 127) & ~(uintptr_t)127);
+	uintptr_t *base = (uintptr_t *)map;
+	uintptr_t *top = (uintptr_t *)(map + BITMAPSCANNER_BENCHMARK_MAP_BYTES);
+	/* one marked object per 4KB of map (sparse), one per 8 bytes of map (dense) */
+	uint32_t sparsenesses[] = { 4096, 8 };
+	const char *heapNames[] = { "sparse", "dense" };
+
+	MM_BitmapScanner scanner;
+	scanner.initialize(OMRPORTLIB);
+
+	for (uintptr_t s = 0; s < sizeof(sparsenesses) / sizeof(sparsenesses[0]); s++) {
+		uintptr_t expectedSlots = 0;
+		uintptr_t expectedBits = 0;
+		fillMap(map, BITMAPSCANNER_BENCHMARK_MAP_BYTES, sparsenesses[s], (uint32_t)(s + 1));
+
+		for (uintptr_t implementation = MM_BitmapScanner::SCAN_SCALAR; implementation <= (uintptr_t)scanner.getSupportedImplementation(); implementation++) {
+			ASSERT_TRUE(scanner.setImplementation((MM_BitmapScanner::Implementation)implementation));
+			uint64_t skipTime = 0;
+			uint64_t countTime = 0;
+
+			for (uintptr_t iteration = 0; iteration < BITMAPSCANNER_BENCHMARK_ITERATIONS; iteration++) {
+				uintptr_t slots = 0;
+				uint64_t startTime = omrtime_hires_clock();
+				for (uintptr_t *slot = scanner.skipEmptySlots(base, top); slot < top; slot = scanner.skipEmptySlots(slot + 1, top)) {
+					slots += 1;
+				}
+				skipTime += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+				startTime = omrtime_hires_clock();
+				uintptr_t bits = scanner.countBits(base, top);
+				countTime += omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_NANOSECONDS);
+
+				if ((0 == expectedSlots) && (0 == expectedBits)) {
+					expectedSlots = slots;
+					expectedBits = bits;
+				}
+				ASSERT_EQ(expectedSlots, slots);
+				ASSERT_EQ(expectedBits, bits);
+			}
+
+			/* bytes per nanosecond is GB/s */
+			uint64_t bytesScanned = (uint64_t)BITMAPSCANNER_BENCHMARK_MAP_BYTES * BITMAPSCANNER_BENCHMARK_ITERATIONS;
+			gcTestEnv->log("Bitmap scan benchmark: %s heap, %s: %zu non-empty of %zu slots, skip %llu.%03llu GB/s, %zu bits, count %llu.%03llu GB/s\n",
+					heapNames[s], MM_BitmapScanner::getImplementationName((MM_BitmapScanner::Implementation)implementation),
+					expectedSlots, (uintptr_t)(top - base),
+					(0 == skipTime) ? 0 : (bytesScanned / skipTime), (0 == skipTime) ? 0 : (((bytesScanned * 1000) / skipTime) % 1000),
+					expectedBits,
+					(0 == countTime) ? 0 : (bytesScanned / countTime), (0 == countTime) ? 0 : (((bytesScanned * 1000) / countTime) % 1000));
+		}
+	}
+
+	omrmem_free_memory(allocation);
+}
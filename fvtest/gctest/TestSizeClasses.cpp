@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "EnvironmentBase.hpp"
+#include "SizeClasses.hpp"
+#include "StartupManagerTestExample.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <string.h>
+
+#include <gtest/gtest.h>
+
+#define SIZECLASSES_TEST_PROFILE_FILE "TestSizeClasses_profile.txt"
+
+/**
+ * Profile allocating exactly one size per size class. The only table which wastes nothing has those sizes as its cells.
+ */
+static const uintptr_t knownProfileSizes[OMR_SIZECLASSES_NUM_SMALL] = { 16, 40, 72, 128, 200, 256, 384, 520, 640, 800, 1024, 1280, 1536, 1800, 2048 };
+
+static void
+fillKnownProfile(uintptr_t *profile)
+{
+	memset(profile, 0, sizeof(uintptr_t) * OMR_SIZECLASSES_PROFILE_ENTRIES);
+	for (uintptr_t i = 0; i < OMR_SIZECLASSES_NUM_SMALL; i++) {
+		profile[knownProfileSizes[i] / sizeof(uintptr_t)] = 1000 + i;
+	}
+}
+
+TEST(TestSizeClasses, deriveEmptyProfile)
+{
+	uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	uintptr_t staticCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+
+	memset(profile, 0, sizeof(profile));
+	MM_SizeClasses::deriveCellSizes(profile, cellSizes);
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		EXPECT_EQ(staticCellSizes[sizeClass], cellSizes[sizeClass]) << "size class " << sizeClass;
+	}
+}
+
+TEST(TestSizeClasses, deriveKnownProfile)
+{
+	uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	uintptr_t staticCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+
+	fillKnownProfile(profile);
+	MM_SizeClasses::deriveCellSizes(profile, cellSizes);
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		EXPECT_EQ(knownProfileSizes[sizeClass - 1], cellSizes[sizeClass]) << "size class " << sizeClass;
+	}
+	EXPECT_EQ((uintptr_t)0, MM_SizeClasses::calculateFragmentation(profile, cellSizes));
+	EXPECT_LT((uintptr_t)0, MM_SizeClasses::calculateFragmentation(profile, staticCellSizes));
+}
+
+TEST(TestSizeClasses, deriveSingleSizeProfile)
+{
+	uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+
+	/* 104 bytes is not a cell size of the static table */
+	memset(profile, 0, sizeof(profile));
+	profile[104 / sizeof(uintptr_t)] = 1;
+	MM_SizeClasses::deriveCellSizes(profile, cellSizes);
+
+	bool hasAllocatedSize = false;
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+		EXPECT_EQ((uintptr_t)0, cellSizes[sizeClass] % 8) << "size class " << sizeClass;
+		EXPECT_LT(cellSizes[sizeClass - 1], cellSizes[sizeClass]) << "size class " << sizeClass;
+		hasAllocatedSize = hasAllocatedSize || (104 == cellSizes[sizeClass]);
+	}
+	EXPECT_TRUE(hasAllocatedSize);
+	EXPECT_LE((uintptr_t)1 << OMR_SIZECLASSES_LOG_SMALLEST, cellSizes[OMR_SIZECLASSES_MIN_SMALL]);
+	EXPECT_EQ((uintptr_t)OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES, cellSizes[OMR_SIZECLASSES_MAX_SMALL]);
+}
+
+/**
+ * Reading and writing a profile needs the forge and port library of a running GC.
+ */
+class TestSizeClassesProfile : public ::testing::Test
+{
+protected:
+	OMR_VM_Example *exampleVM;
+	MM_EnvironmentBase *env;
+
+	virtual void SetUp()
+	{
+		exampleVM = &gcTestEnv->exampleVM;
+		MM_StartupManagerTestExample startupManager(exampleVM->_omrVM, "fvtest/gctest/configuration/segregated_GC_config.xml");
+
+		omr_error_t rc = OMR_GC_IntializeHeapAndCollector(exampleVM->_omrVM, &startupManager);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "SetUp(): OMR_GC_IntializeHeapAndCollector failed, rc=" << rc;
+
+		rc = OMR_Thread_Init(exampleVM->_omrVM, NULL, &exampleVM->_omrVMThread, "OMRTestThread");
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "SetUp(): OMR_Thread_Init failed, rc=" << rc;
+
+		env = MM_EnvironmentBase::getEnvironment(exampleVM->_omrVMThread);
+	}
+
+	virtual void TearDown()
+	{
+		OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+		omrfile_unlink(SIZECLASSES_TEST_PROFILE_FILE);
+
+		omr_error_t rc = OMR_Thread_Free(exampleVM->_omrVMThread);
+		ASSERT_EQ(OMR_ERROR_NONE, rc) << "TearDown(): OMR_Thread_Free failed, rc=" << rc;
+		exampleVM->_omrVMThread = NULL;
+
+		ASSERT_EQ(OMR_ERROR_NONE, OMR_GC_ShutdownHeapAndCollector(exampleVM->_omrVM));
+	}
+};
+
+TEST_F(TestSizeClassesProfile, roundTrip)
+{
+	uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	uintptr_t readProfile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	uintptr_t staticCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+
+	fillKnownProfile(profile);
+	MM_SizeClasses::writeAllocationProfile(env, SIZECLASSES_TEST_PROFILE_FILE, profile, staticCellSizes);
+	ASSERT_TRUE(MM_SizeClasses::readAllocationProfile(env, SIZECLASSES_TEST_PROFILE_FILE, readProfile));
+
+	for (uintptr_t i = 0; i < OMR_SIZECLASSES_PROFILE_ENTRIES; i++) {
+		EXPECT_EQ(profile[i], readProfile[i]) << "size " << (i * sizeof(uintptr_t));
+	}
+}
+
+TEST_F(TestSizeClassesProfile, readUnalignedSizes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->portLib);
+	uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+
+	intptr_t fd = omrfile_open(SIZECLASSES_TEST_PROFILE_FILE, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd);
+	/* sizes round up to the next uintptr_t, sizes too large for a small size class are dropped */
+	omrfile_printf(fd, "# comment 101 100\n101 3\n104 4\n4096 5\n");
+	omrfile_close(fd);
+
+	ASSERT_TRUE(MM_SizeClasses::readAllocationProfile(env, SIZECLASSES_TEST_PROFILE_FILE, profile));
+	for (uintptr_t i = 0; i < OMR_SIZECLASSES_PROFILE_ENTRIES; i++) {
+		EXPECT_EQ((uintptr_t)((104 == (i * sizeof(uintptr_t))) ? 7 : 0), profile[i]) << "size " << (i * sizeof(uintptr_t));
+	}
+}
+
+TEST_F(TestSizeClassesProfile, readMissingFile)
+{
+	uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	EXPECT_FALSE(MM_SizeClasses::readAllocationProfile(env, SIZECLASSES_TEST_PROFILE_FILE, profile));
+}
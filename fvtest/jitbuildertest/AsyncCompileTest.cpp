@@ -0,0 +1,503 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+ * These tests queue MethodBuilders with compileMethodBuilderAsync() and check
+ * that each one is compiled on a compilation thread, that the result is
+ * delivered through CompilationComplete(), and that the compiled code works.
+ */
+
+typedef int32_t (AddConstantFunction)(int32_t);
+
+/*
+ * Counts down as the compiles in a batch complete, so that the thread that
+ * queued them can wait for all of them.
+ */
+class CompletionLatch
+   {
+   public:
+   CompletionLatch(int32_t count) : _count(count) { }
+
+   void countDown()
+      {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (--_count == 0)
+         _completed.notify_all();
+      }
+
+   void wait()
+      {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _completed.wait(lock, [this] { return _count == 0; });
+      }
+
+   private:
+   std::mutex _mutex;
+   std::condition_variable _completed;
+   int32_t _count;
+   };
+
+/*
+ * Returns its argument plus a constant that is different for every method,
+ * and records the result of its compile when CompilationComplete() is called.
+ */
+class AddConstantMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+   AddConstantMethod(OMR::JitBuilder::TypeDictionary *types, int32_t constant, CompletionLatch *latch)
+      : OMR::JitBuilder::MethodBuilder(types),
+        _constant(constant),
+        _latch(latch),
+        _returnCode(-1),
+        _entryPoint(NULL)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("addConstant");
+      DefineParameter("x", Int32);
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         Add(
+            Load("x"),
+            ConstInt32(_constant)));
+      return true;
+      }
+
+   virtual void CompilationComplete(int32_t returnCode, void *entryPoint)
+      {
+      _returnCode = returnCode;
+      _entryPoint = entryPoint;
+      if (_latch != NULL)
+         _latch->countDown();
+      }
+
+   int32_t constant() const { return _constant; }
+   int32_t returnCode() const { return _returnCode; }
+   AddConstantFunction *function() const { return (AddConstantFunction *)_entryPoint; }
+
+   private:
+   int32_t _constant;
+   CompletionLatch *_latch;
+   int32_t _returnCode;
+   void *_entryPoint;
+   };
+
+/*
+ * A compiled method and the type dictionary it was built from. Methods that
+ * share a type dictionary are compiled one at a time, so methods that should
+ * be compiled concurrently each get their own.
+ */
+struct AsyncMethod
+   {
+   AsyncMethod(int32_t constant, CompletionLatch *latch)
+      : types(), method(&types, constant, latch) { }
+
+   OMR::JitBuilder::TypeDictionary types;
+   AddConstantMethod method;
+   };
+
+class AsyncCompileTest : public ::testing::Test
+   {
+   public:
+   static const int32_t NUM_COMPILATION_THREADS = 4;
+
+   static void SetUpTestCase()
+      {
+      ASSERT_TRUE(initializeJitWithOptions((char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,compilationThreads=4"));
+      }
+
+   static void TearDownTestCase()
+      {
+      shutdownJit();
+      }
+   };
+
+TEST_F(AsyncCompileTest, CompileOneMethod)
+   {
+   CompletionLatch latch(1);
+   AsyncMethod m(42, &latch);
+   ASSERT_TRUE(compileMethodBuilderAsync(&m.method, 0));
+   latch.wait();
+
+   ASSERT_EQ(0, m.method.returnCode()) << "Compilation failed";
+   ASSERT_NE(nullptr, m.method.function()) << "No entry point delivered";
+   EXPECT_EQ(42, m.method.function()(0));
+   EXPECT_EQ(40, m.method.function()(-2));
+   }
+
+TEST_F(AsyncCompileTest, WaitForAsyncCompilations)
+   {
+   const int32_t numMethods = 64;
+   std::vector<AsyncMethod *> methods;
+   for (int32_t i = 0; i < numMethods; i++)
+      {
+      methods.push_back(new AsyncMethod(i, NULL));
+      ASSERT_TRUE(compileMethodBuilderAsync(&methods.back()->method, i % 3));
+      }
+
+   waitForAsyncCompilations();
+
+   for (int32_t i = 0; i < numMethods; i++)
+      {
+      AddConstantMethod &method = methods[i]->method;
+      ASSERT_EQ(0, method.returnCode()) << "Compilation of method " << i << " failed";
+      EXPECT_EQ(i + 7, method.function()(7));
+      delete methods[i];
+      }
+   }
+
+/*
+ * Several application threads each queue thousands of compiles, in batches
+ * to bound the memory held by outstanding MethodBuilders, and call every
+ * method once its batch has been compiled.
+ */
+TEST_F(AsyncCompileTest, StressManyMethodsFromManyThreads)
+   {
+   const int32_t numSubmitters = 4;
+   const int32_t numBatches = 10;
+   const int32_t batchSize = 100;
+
+   std::vector<int32_t> numFailures(numSubmitters, 0);
+   std::vector<std::thread> submitters;
+   for (int32_t s = 0; s < numSubmitters; s++)
+      {
+      submitters.push_back(std::thread([s, &numFailures]
+         {
+         for (int32_t b = 0; b < numBatches; b++)
+            {
+            CompletionLatch latch(batchSize);
+            std::vector<AsyncMethod *> batch;
+            for (int32_t i = 0; i < batchSize; i++)
+               {
+               int32_t constant = (s * numBatches + b) * batchSize + i;
+               batch.push_back(new AsyncMethod(constant, &latch));
+               if (!compileMethodBuilderAsync(&batch.back()->method, (constant * 7) % 5))
+                  {
+                  numFailures[s]++;
+                  latch.countDown();
+                  }
+               }
+
+            latch.wait();
+
+            for (auto it = batch.begin(); it != batch.end(); ++it)
+               {
+               AddConstantMethod &method = (*it)->method;
+               if (method.returnCode() != 0 || method.function()(1) != method.constant() + 1)
+                  numFailures[s]++;
+               delete *it;
+               }
+            }
+         }));
+      }
+
+   for (auto it = submitters.begin(); it != submitters.end(); ++it)
+      it->join();
+
+   for (int32_t s = 0; s < numSubmitters; s++)
+      EXPECT_EQ(0, numFailures[s]) << "Submitting thread " << s << " saw failed or incorrect compiles";
+   }
+
+/*
+ * Methods that share a type dictionary may be queued together; their
+ * compiles take turns on the dictionary while other compiles proceed.
+ */
+TEST_F(AsyncCompileTest, SharedTypeDictionary)
+   {
+   const int32_t numMethods = 64;
+   CompletionLatch latch(numMethods);
+   OMR::JitBuilder::TypeDictionary types;
+   std::vector<AddConstantMethod *> methods;
+   for (int32_t i = 0; i < numMethods; i++)
+      {
+      methods.push_back(new AddConstantMethod(&types, i, &latch));
+      ASSERT_TRUE(compileMethodBuilderAsync(methods.back(), 0));
+      }
+
+   latch.wait();
+
+   for (int32_t i = 0; i < numMethods; i++)
+      {
+      ASSERT_EQ(0, methods[i]->returnCode()) << "Compilation of method " << i << " failed";
+      EXPECT_EQ(i - 3, methods[i]->function()(-3));
+      delete methods[i];
+      }
+   }
+
+/*
+ * compileMethodBuilder() may be called from several application threads at
+ * once, each compiling on its own compilation thread ID.
+ */
+TEST_F(AsyncCompileTest, SynchronousCompilesFromManyThreads)
+   {
+   const int32_t numThreads = 4;
+   const int32_t methodsPerThread = 50;
+
+   std::vector<int32_t> numFailures(numThreads, 0);
+   std::vector<std::thread> compilers;
+   for (int32_t t = 0; t < numThreads; t++)
+      {
+      compilers.push_back(std::thread([t, &numFailures]
+         {
+         for (int32_t i = 0; i < methodsPerThread; i++)
+            {
+            int32_t constant = t * methodsPerThread + i;
+            AsyncMethod m(constant, NULL);
+            void *entry = NULL;
+            if (compileMethodBuilder(&m.method, &entry) != 0 || ((AddConstantFunction *)entry)(2) != constant + 2)
+               numFailures[t]++;
+            }
+         }));
+      }
+
+   for (auto it = compilers.begin(); it != compilers.end(); ++it)
+      it->join();
+
+   for (int32_t t = 0; t < numThreads; t++)
+      EXPECT_EQ(0, numFailures[t]) << "Compiling thread " << t << " saw failed or incorrect compiles";
+   }
+
+/*
+ * Defines a Pair struct whose field order depends on the dictionary, so that
+ * a compile which picked up the field offsets of another dictionary reads
+ * the wrong field.
+ */
+class PairTypes : public OMR::JitBuilder::TypeDictionary
+   {
+   public:
+   PairTypes(bool swapped)
+      : OMR::JitBuilder::TypeDictionary()
+      {
+      DefineStruct("Pair");
+      DefineField("Pair", swapped ? "second" : "first", Int32);
+      DefineField("Pair", swapped ? "first" : "second", Int32);
+      CloseStruct("Pair");
+      }
+   };
+
+typedef int32_t (PairFunction)(int32_t *);
+
+/*
+ * Returns pair->first - pair->second plus a constant that is different for
+ * every method, and records the result of its compile when
+ * CompilationComplete() is called.
+ */
+class PairMethod : public OMR::JitBuilder::MethodBuilder
+   {
+   public:
+   PairMethod(PairTypes *types, int32_t constant, CompletionLatch *latch)
+      : OMR::JitBuilder::MethodBuilder(types),
+        _constant(constant),
+        _latch(latch),
+        _entryPoint(NULL)
+      {
+      DefineLine(LINETOSTR(__LINE__));
+      DefineFile(__FILE__);
+      DefineName("pairDifference");
+      DefineParameter("pair", types->PointerTo("Pair"));
+      DefineReturnType(Int32);
+      }
+
+   virtual bool buildIL()
+      {
+      Return(
+         Add(
+            Sub(
+               LoadIndirect("Pair", "first", Load("pair")),
+               LoadIndirect("Pair", "second", Load("pair"))),
+            ConstInt32(_constant)));
+      return true;
+      }
+
+   virtual void CompilationComplete(int32_t returnCode, void *entryPoint)
+      {
+      _entryPoint = returnCode == 0 ? entryPoint : NULL;
+      if (_latch != NULL)
+         _latch->countDown();
+      }
+
+   PairFunction *function() const { return (PairFunction *)_entryPoint; }
+
+   private:
+   int32_t _constant;
+   CompletionLatch *_latch;
+   void *_entryPoint;
+   };
+
+/*
+ * Several application threads compile methods that each have a type
+ * dictionary of their own, half of them through the compilation queue and
+ * half of them synchronously, so that compiles of distinct dictionaries
+ * overlap on every thread. Adjacent methods lay out their Pair differently.
+ */
+TEST_F(AsyncCompileTest, StressDistinctTypeDictionaries)
+   {
+   const int32_t numSubmitters = 4;
+   const int32_t numBatches = 5;
+   const int32_t batchSize = 40;
+
+   std::vector<int32_t> numFailures(numSubmitters, 0);
+   std::vector<std::thread> submitters;
+   for (int32_t s = 0; s < numSubmitters; s++)
+      {
+      submitters.push_back(std::thread([s, &numFailures]
+         {
+         bool async = (s % 2) == 0;
+         int32_t values[2] = { 1000, 1 };
+         for (int32_t b = 0; b < numBatches; b++)
+            {
+            CompletionLatch latch(async ? batchSize : 0);
+            std::vector<PairTypes *> types;
+            std::vector<PairMethod *> methods;
+            std::vector<void *> entries(batchSize, NULL);
+            for (int32_t i = 0; i < batchSize; i++)
+               {
+               int32_t constant = (s * numBatches + b) * batchSize + i;
+               types.push_back(new PairTypes((constant % 2) != 0));
+               methods.push_back(new PairMethod(types.back(), constant, async ? &latch : NULL));
+               if (async)
+                  {
+                  if (!compileMethodBuilderAsync(methods.back(), constant % 3))
+                     {
+                     numFailures[s]++;
+                     latch.countDown();
+                     }
+                  }
+               else if (compileMethodBuilder(methods.back(), &entries[i]) != 0)
+                  {
+                  numFailures[s]++;
+                  }
+               }
+
+            latch.wait();
+
+            for (int32_t i = 0; i < batchSize; i++)
+               {
+               int32_t constant = (s * numBatches + b) * batchSize + i;
+               int32_t expected = ((constant % 2) != 0 ? values[1] - values[0] : values[0] - values[1]) + constant;
+               PairFunction *function = async ? methods[i]->function() : (PairFunction *)entries[i];
+               if (function == NULL || function(values) != expected)
+                  numFailures[s]++;
+               delete methods[i];
+               delete types[i];
+               }
+            }
+         }));
+      }
+
+   for (auto it = submitters.begin(); it != submitters.end(); ++it)
+      it->join();
+
+   for (int32_t s = 0; s < numSubmitters; s++)
+      EXPECT_EQ(0, numFailures[s]) << "Compiling thread " << s << " saw failed or incorrect compiles";
+   }
+
+/*
+ * With a single compilation thread held busy by a first request, the
+ * requests queued behind it are compiled highest priority first, and in
+ * the order they were queued when their priorities are equal.
+ */
+class AsyncCompilePriorityTest : public ::testing::Test
+   {
+   public:
+   static void SetUpTestCase()
+      {
+      ASSERT_TRUE(initializeJitWithOptions((char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,compilationThreads=1"));
+      }
+
+   static void TearDownTestCase()
+      {
+      shutdownJit();
+      }
+   };
+
+/*
+ * Records the order in which its compiles complete. A method given a gate
+ * counts down `started` and then blocks the compilation thread until the
+ * test opens the gate.
+ */
+class OrderedMethod : public AddConstantMethod
+   {
+   public:
+   OrderedMethod(OMR::JitBuilder::TypeDictionary *types, int32_t constant, std::vector<int32_t> *order,
+                 CompletionLatch *started = NULL, CompletionLatch *gate = NULL)
+      : AddConstantMethod(types, constant, started), _order(order), _gate(gate) { }
+
+   virtual void CompilationComplete(int32_t returnCode, void *entryPoint)
+      {
+      AddConstantMethod::CompilationComplete(returnCode, entryPoint);
+      if (_gate != NULL)
+         _gate->wait();
+      _order->push_back(constant());
+      }
+
+   private:
+   std::vector<int32_t> *_order;
+   CompletionLatch *_gate;
+   };
+
+TEST_F(AsyncCompilePriorityTest, HighestPriorityFirst)
+   {
+   std::vector<int32_t> order;
+   CompletionLatch started(1);
+   CompletionLatch gate(1);
+   OMR::JitBuilder::TypeDictionary types;
+
+   OrderedMethod first(&types, 100, &order, &started, &gate);
+   ASSERT_TRUE(compileMethodBuilderAsync(&first, 0));
+   started.wait();
+
+   // constant, priority pairs queued while the first request holds the compilation thread
+   const int32_t requests[][2] = { {0, 1}, {1, 5}, {2, 3}, {3, 5}, {4, 1}, {5, 9} };
+   const int32_t numRequests = sizeof(requests) / sizeof(requests[0]);
+   std::vector<OrderedMethod *> methods;
+   for (int32_t i = 0; i < numRequests; i++)
+      {
+      methods.push_back(new OrderedMethod(&types, requests[i][0], &order));
+      ASSERT_TRUE(compileMethodBuilderAsync(methods.back(), requests[i][1]));
+      }
+
+   gate.countDown();
+   waitForAsyncCompilations();
+
+   const int32_t expected[] = { 100, 5, 1, 3, 2, 0, 4 };
+   ASSERT_EQ(sizeof(expected) / sizeof(expected[0]), order.size());
+   for (size_t i = 0; i < order.size(); i++)
+      EXPECT_EQ(expected[i], order[i]) << "Unexpected compile at position " << i;
+
+   for (auto it = methods.begin(); it != methods.end(); ++it)
+      {
+      EXPECT_EQ((*it)->constant() + 1, (*it)->function()(1));
+      delete *it;
+      }
+   }
@@ -26,6 +26,9 @@
 
 #include "JitBuilder.hpp"
 
+#include <fstream>
+#include <iterator>
+#include <string>
 #include <vector>
 #include <utility>
 
@@ -304,4 +307,28 @@ void try_compile(Function& f)
    ASSERT_FALSE(::testing::Test::HasFatalFailure()); \
 } while (0)
 
+/**
+ * @brief countInFile counts the occurrences of a string in a file
+ *
+ * This is mostly useful to check that an optimization transformed a method,
+ * by counting the messages it wrote to the JIT log (set with the `log=`
+ * option) before and after compiling the method. A file which cannot be read
+ * holds no occurrences.
+ *
+ * Example use:
+ *
+ *    int32_t before = countInFile("MyTest.log", "Transformed loop");
+ *    ASSERT_COMPILE(MyTypeDictionary, MyMethodBuilder, myFunction);
+ *    EXPECT_LT(before, countInFile("MyTest.log", "Transformed loop"));
+ */
+inline int32_t countInFile(const char *fileName, const char *text)
+   {
+   std::ifstream file(fileName);
+   std::string contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+   int32_t count = 0;
+   for (std::string::size_type position = contents.find(text); position != std::string::npos; position = contents.find(text, position + 1))
+      count++;
+   return count;
+   }
+
 #endif // JB_TEST_UTIL_HPP
@@ -0,0 +1,260 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <vector>
+
+/*
+ * The methods below are counted loops over primitive arrays in the shape the
+ * loop vectorizer looks for. Each is checked against a scalar reference for a
+ * range of trip counts around the vector length, so that the vector loop, the
+ * scalar epilogue and the runtime guard that falls back to the scalar loop
+ * are all exercised. The loop vectorizer traces to a log, which is checked to
+ * make sure that the loop was actually vectorized.
+ */
+
+#define LOOP_VECTORIZER_LOG "LoopVectorizerTest.log"
+
+DEFINE_BUILDER(DoubleMulLoop,
+               NoType,
+               PARAM("result", PointerTo(Double)),
+               PARAM("vector1", PointerTo(Double)),
+               PARAM("vector2", PointerTo(Double)),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pDouble = PointerTo(Double);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("length"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pDouble, loop->Load("result"), loop->Load("i")),
+   loop->   Mul(
+   loop->      LoadAt(pDouble, loop->IndexAt(pDouble, loop->Load("vector1"), loop->Load("i"))),
+   loop->      LoadAt(pDouble, loop->IndexAt(pDouble, loop->Load("vector2"), loop->Load("i")))));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(Int32AddInvariantLoop,
+               NoType,
+               PARAM("result", PointerTo(Int32)),
+               PARAM("vector", PointerTo(Int32)),
+               PARAM("value", Int32),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("length"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pInt32, loop->Load("result"), loop->Load("i")),
+   loop->   Add(
+   loop->      LoadAt(pInt32, loop->IndexAt(pInt32, loop->Load("vector"), loop->Load("i"))),
+   loop->      Load("value")));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(FloatScaleLoop,
+               NoType,
+               PARAM("vector", PointerTo(Float)),
+               PARAM("scale", Float),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pFloat = PointerTo(Float);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("length"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pFloat, loop->Load("vector"), loop->Load("i")),
+   loop->   Mul(
+   loop->      LoadAt(pFloat, loop->IndexAt(pFloat, loop->Load("vector"), loop->Load("i"))),
+   loop->      Load("scale")));
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(Int64XorLoop,
+               NoType,
+               PARAM("result", PointerTo(Int64)),
+               PARAM("vector1", PointerTo(Int64)),
+               PARAM("vector2", PointerTo(Int64)),
+               PARAM("length", Int32))
+   {
+   OMR::JitBuilder::IlType *pInt64 = PointerTo(Int64);
+   OMR::JitBuilder::IlBuilder *loop = NULL;
+   ForLoopUp((char *)"i", &loop, ConstInt32(0), Load("length"), ConstInt32(1));
+
+   loop->StoreAt(
+   loop->   IndexAt(pInt64, loop->Load("result"), loop->Load("i")),
+   loop->   Xor(
+   loop->      LoadAt(pInt64, loop->IndexAt(pInt64, loop->Load("vector1"), loop->Load("i"))),
+   loop->      LoadAt(pInt64, loop->IndexAt(pInt64, loop->Load("vector2"), loop->Load("i")))));
+
+   Return();
+   return true;
+   }
+
+class LoopVectorizerTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      ASSERT_TRUE(initializeJitWithOptions((char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+         "traceLoopVectorization,log=" LOOP_VECTORIZER_LOG)) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      shutdownJit();
+      remove(LOOP_VECTORIZER_LOG);
+      }
+
+   /*
+    * The pass stands down on targets which cannot generate vector code, and
+    * notes that in the log.
+    */
+   static bool targetVectorizes()
+      {
+      return countInFile(LOOP_VECTORIZER_LOG, "Vector code generation is not enabled") == 0
+         && countInFile(LOOP_VECTORIZER_LOG, "Not enabled on 32-bit targets") == 0;
+      }
+   };
+
+/*
+ * Compile a method and check that the loop vectorizer vectorized one more loop.
+ */
+#define ASSERT_COMPILE_VECTORIZED(TypeDictionary, MethodBuilder, function) do {\
+   int32_t vectorizedLoops = countInFile(LOOP_VECTORIZER_LOG, "Vectorizing loop"); \
+   ASSERT_COMPILE(TypeDictionary, MethodBuilder, function); \
+   if (targetVectorizes()) \
+      ASSERT_EQ(vectorizedLoops + 1, countInFile(LOOP_VECTORIZER_LOG, "Vectorizing loop")) << #MethodBuilder " was not vectorized"; \
+} while (0)
+
+static const int32_t MAX_LENGTH = 37;
+
+typedef void (*DoubleMulLoopFunction)(double *, double *, double *, int32_t);
+TEST_F(LoopVectorizerTest, DoubleMulLoop)
+   {
+   DoubleMulLoopFunction testFunction;
+   ASSERT_COMPILE_VECTORIZED(OMR::JitBuilder::TypeDictionary, DoubleMulLoop, testFunction);
+
+   for (int32_t length = 0; length <= MAX_LENGTH; length++)
+      {
+      std::vector<double> v1(length + 1), v2(length + 1), result(length + 1, -1.0);
+      for (int32_t i = 0; i < length; i++)
+         {
+         v1[i] = i * 0.5;
+         v2[i] = 3.0 - i;
+         }
+      testFunction(&result[0], &v1[0], &v2[0], length);
+      for (int32_t i = 0; i < length; i++)
+         ASSERT_EQ(v1[i] * v2[i], result[i]) << "length " << length << ", index " << i;
+      ASSERT_EQ(-1.0, result[length]) << "store past the end of the loop for length " << length;
+      }
+   }
+
+typedef void (*Int32AddInvariantLoopFunction)(int32_t *, int32_t *, int32_t, int32_t);
+TEST_F(LoopVectorizerTest, Int32AddInvariantLoop)
+   {
+   Int32AddInvariantLoopFunction testFunction;
+   ASSERT_COMPILE_VECTORIZED(OMR::JitBuilder::TypeDictionary, Int32AddInvariantLoop, testFunction);
+
+   for (int32_t length = 0; length <= MAX_LENGTH; length++)
+      {
+      std::vector<int32_t> vector(length + 1), result(length + 1, -1);
+      for (int32_t i = 0; i < length; i++)
+         vector[i] = i * 7 - 50;
+      testFunction(&result[0], &vector[0], 11, length);
+      for (int32_t i = 0; i < length; i++)
+         ASSERT_EQ(vector[i] + 11, result[i]) << "length " << length << ", index " << i;
+      ASSERT_EQ(-1, result[length]) << "store past the end of the loop for length " << length;
+      }
+   }
+
+TEST_F(LoopVectorizerTest, Int32AddInvariantLoopOverlapping)
+   {
+   Int32AddInvariantLoopFunction testFunction;
+   ASSERT_COMPILE_VECTORIZED(OMR::JitBuilder::TypeDictionary, Int32AddInvariantLoop, testFunction);
+
+   /*
+    * result[i] = vector[i] + 1 with result == vector + 1 carries a dependence
+    * from each iteration to the next, so every element must end up equal to
+    * vector[0] plus its distance from it. The runtime guard must route this
+    * case to the scalar loop.
+    */
+   for (int32_t length = 0; length <= MAX_LENGTH; length++)
+      {
+      std::vector<int32_t> data(length + 1, 0);
+      data[0] = 5;
+      testFunction(&data[1], &data[0], 1, length);
+      for (int32_t i = 0; i <= length; i++)
+         ASSERT_EQ(5 + i, data[i]) << "length " << length << ", index " << i;
+      }
+   }
+
+typedef void (*FloatScaleLoopFunction)(float *, float, int32_t);
+TEST_F(LoopVectorizerTest, FloatScaleLoop)
+   {
+   FloatScaleLoopFunction testFunction;
+   ASSERT_COMPILE_VECTORIZED(OMR::JitBuilder::TypeDictionary, FloatScaleLoop, testFunction);
+
+   for (int32_t length = 0; length <= MAX_LENGTH; length++)
+      {
+      std::vector<float> vector(length + 1), expected(length + 1);
+      for (int32_t i = 0; i <= length; i++)
+         vector[i] = expected[i] = i - 10.25f;
+      for (int32_t i = 0; i < length; i++)
+         expected[i] = expected[i] * 2.5f;
+      testFunction(&vector[0], 2.5f, length);
+      for (int32_t i = 0; i <= length; i++)
+         ASSERT_EQ(expected[i], vector[i]) << "length " << length << ", index " << i;
+      }
+   }
+
+typedef void (*Int64XorLoopFunction)(int64_t *, int64_t *, int64_t *, int32_t);
+TEST_F(LoopVectorizerTest, Int64XorLoop)
+   {
+   Int64XorLoopFunction testFunction;
+   ASSERT_COMPILE_VECTORIZED(OMR::JitBuilder::TypeDictionary, Int64XorLoop, testFunction);
+
+   for (int32_t length = 0; length <= MAX_LENGTH; length++)
+      {
+      std::vector<int64_t> v1(length + 1), v2(length + 1), result(length + 1, -1);
+      for (int32_t i = 0; i < length; i++)
+         {
+         v1[i] = (int64_t)i << 40 | i;
+         v2[i] = 0x0123456789abcdefLL + i;
+         }
+      testFunction(&result[0], &v1[0], &v2[0], length);
+      for (int32_t i = 0; i < length; i++)
+         ASSERT_EQ(v1[i] ^ v2[i], result[i]) << "length " << length << ", index " << i;
+      ASSERT_EQ(-1, result[length]) << "store past the end of the loop for length " << length;
+      }
+   }
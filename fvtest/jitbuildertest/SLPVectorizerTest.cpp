@@ -0,0 +1,272 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "JBTestUtil.hpp"
+
+#include <stdio.h>
+#include <vector>
+
+/*
+ * The methods below are straight line sequences of adjacent array element
+ * stores, the way unrolled pixel math and struct copies come out of
+ * JitBuilder. Some of them can be packed into vector operations by the SLP
+ * vectorizer and some of them must not be; each is checked against the
+ * result of executing the stores one at a time. The SLP vectorizer traces to
+ * a log, which is checked to make sure that packs were formed exactly when
+ * they should have been.
+ */
+
+#define SLP_VECTORIZER_LOG "SLPVectorizerTest.log"
+
+static const int32_t NUM_ELEMENTS = 8;
+
+DEFINE_BUILDER(DoubleScaleBias,
+               NoType,
+               PARAM("result", PointerTo(Double)),
+               PARAM("pixels", PointerTo(Double)),
+               PARAM("scale", Double))
+   {
+   OMR::JitBuilder::IlType *pDouble = PointerTo(Double);
+   for (int32_t k = 0; k < NUM_ELEMENTS; k++)
+      {
+      StoreAt(
+         IndexAt(pDouble, Load("result"), ConstInt32(k)),
+         Add(
+            Mul(
+               LoadAt(pDouble, IndexAt(pDouble, Load("pixels"), ConstInt32(k))),
+               Load("scale")),
+            ConstDouble(0.5)));
+      }
+
+   Return();
+   return true;
+   }
+
+DEFINE_BUILDER(Int32Copy,
+               NoType,
+               PARAM("destination", PointerTo(Int32)),
+               PARAM("source", PointerTo(Int32)))
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   for (int32_t k = 0; k < NUM_ELEMENTS; k++)
+      {
+      StoreAt(
+         IndexAt(pInt32, Load("destination"), ConstInt32(k)),
+         LoadAt(pInt32, IndexAt(pInt32, Load("source"), ConstInt32(k))));
+      }
+
+   Return();
+   return true;
+   }
+
+/* The lanes are stored in the order 1, 0, 3, 2 */
+DEFINE_BUILDER(FloatSquareMinusSelf,
+               NoType,
+               PARAM("vector", PointerTo(Float)))
+   {
+   OMR::JitBuilder::IlType *pFloat = PointerTo(Float);
+   for (int32_t k = 0; k < 4; k++)
+      {
+      int32_t lane = k ^ 1;
+      OMR::JitBuilder::IlValue *element = LoadAt(pFloat, IndexAt(pFloat, Load("vector"), ConstInt32(lane)));
+      StoreAt(
+         IndexAt(pFloat, Load("vector"), ConstInt32(lane)),
+         Sub(Mul(element, element), element));
+      }
+
+   Return();
+   return true;
+   }
+
+/* Adjacent lanes compute different operations, so there is nothing to pack */
+DEFINE_BUILDER(Int64AddSub,
+               NoType,
+               PARAM("result", PointerTo(Int64)),
+               PARAM("vector1", PointerTo(Int64)),
+               PARAM("vector2", PointerTo(Int64)))
+   {
+   OMR::JitBuilder::IlType *pInt64 = PointerTo(Int64);
+   for (int32_t k = 0; k < 4; k++)
+      {
+      OMR::JitBuilder::IlValue *v1 = LoadAt(pInt64, IndexAt(pInt64, Load("vector1"), ConstInt32(k)));
+      OMR::JitBuilder::IlValue *v2 = LoadAt(pInt64, IndexAt(pInt64, Load("vector2"), ConstInt32(k)));
+      StoreAt(
+         IndexAt(pInt64, Load("result"), ConstInt32(k)),
+         (k & 1) ? Sub(v1, v2) : Add(v1, v2));
+      }
+
+   Return();
+   return true;
+   }
+
+/* Each store feeds the load of the next lane, so the lanes must stay in order */
+DEFINE_BUILDER(Int32PrefixIncrement,
+               NoType,
+               PARAM("vector", PointerTo(Int32)))
+   {
+   OMR::JitBuilder::IlType *pInt32 = PointerTo(Int32);
+   for (int32_t k = 0; k < 4; k++)
+      {
+      StoreAt(
+         IndexAt(pInt32, Load("vector"), ConstInt32(k + 1)),
+         Add(
+            LoadAt(pInt32, IndexAt(pInt32, Load("vector"), ConstInt32(k))),
+            ConstInt32(1)));
+      }
+
+   Return();
+   return true;
+   }
+
+class SLPVectorizerTest : public JitBuilderTest
+   {
+   public:
+
+   static void SetUpTestCase()
+      {
+      ASSERT_TRUE(initializeJitWithOptions((char *)"-Xjit:acceptHugeMethods,enableBasicBlockHoisting,omitFramePointer,useILValidator,"
+         "traceSLPVectorization,log=" SLP_VECTORIZER_LOG)) << "Failed to initialize the JIT.";
+      }
+
+   static void TearDownTestCase()
+      {
+      shutdownJit();
+      remove(SLP_VECTORIZER_LOG);
+      }
+
+   /*
+    * The pass stands down on targets which cannot generate vector code, and
+    * notes that in the log.
+    */
+   static bool targetVectorizes()
+      {
+      return countInFile(SLP_VECTORIZER_LOG, "Vector code generation is not enabled") == 0
+         && countInFile(SLP_VECTORIZER_LOG, "Not enabled on 32-bit targets") == 0;
+      }
+   };
+
+/*
+ * Compile a method and check whether the SLP vectorizer formed any packs.
+ */
+#define ASSERT_COMPILE_PACKED(TypeDictionary, MethodBuilder, function, expectPacks) do {\
+   int32_t packs = countInFile(SLP_VECTORIZER_LOG, "\tPacked "); \
+   ASSERT_COMPILE(TypeDictionary, MethodBuilder, function); \
+   if (targetVectorizes() || !(expectPacks)) \
+      ASSERT_EQ((expectPacks), packs < countInFile(SLP_VECTORIZER_LOG, "\tPacked ")) << #MethodBuilder << ((expectPacks) ? " was not packed" : " was packed"); \
+} while (0)
+
+typedef void (*DoubleScaleBiasFunction)(double *, double *, double);
+TEST_F(SLPVectorizerTest, DoubleScaleBias)
+   {
+   DoubleScaleBiasFunction testFunction;
+   ASSERT_COMPILE_PACKED(OMR::JitBuilder::TypeDictionary, DoubleScaleBias, testFunction, true);
+
+   std::vector<double> pixels(NUM_ELEMENTS), result(NUM_ELEMENTS + 1, -1.0);
+   for (int32_t i = 0; i < NUM_ELEMENTS; i++)
+      pixels[i] = i * 1.25 - 3.0;
+   testFunction(&result[0], &pixels[0], 2.0);
+   for (int32_t i = 0; i < NUM_ELEMENTS; i++)
+      ASSERT_EQ(pixels[i] * 2.0 + 0.5, result[i]) << "index " << i;
+   ASSERT_EQ(-1.0, result[NUM_ELEMENTS]) << "store past the last element";
+   }
+
+typedef void (*Int32CopyFunction)(int32_t *, int32_t *);
+TEST_F(SLPVectorizerTest, Int32Copy)
+   {
+   Int32CopyFunction testFunction;
+   ASSERT_COMPILE_PACKED(OMR::JitBuilder::TypeDictionary, Int32Copy, testFunction, true);
+
+   std::vector<int32_t> source(NUM_ELEMENTS), destination(NUM_ELEMENTS + 1, -1);
+   for (int32_t i = 0; i < NUM_ELEMENTS; i++)
+      source[i] = i * 3 + 1;
+   testFunction(&destination[0], &source[0]);
+   for (int32_t i = 0; i < NUM_ELEMENTS; i++)
+      ASSERT_EQ(source[i], destination[i]) << "index " << i;
+   ASSERT_EQ(-1, destination[NUM_ELEMENTS]) << "store past the last element";
+   }
+
+TEST_F(SLPVectorizerTest, Int32CopyOverlapping)
+   {
+   Int32CopyFunction testFunction;
+   ASSERT_COMPILE_PACKED(OMR::JitBuilder::TypeDictionary, Int32Copy, testFunction, true);
+
+   /*
+    * For every distance between the arrays, the result must match copying
+    * one element at a time in increasing order, so arrays that overlap
+    * within a vector must take the scalar path.
+    */
+   for (int32_t distance = -NUM_ELEMENTS; distance <= NUM_ELEMENTS; distance++)
+      {
+      std::vector<int32_t> data(3 * NUM_ELEMENTS), expected(3 * NUM_ELEMENTS);
+      for (int32_t i = 0; i < 3 * NUM_ELEMENTS; i++)
+         data[i] = expected[i] = i * 5 - 7;
+      int32_t *source = &data[NUM_ELEMENTS];
+      int32_t *destination = source + distance;
+      for (int32_t i = 0; i < NUM_ELEMENTS; i++)
+         expected[NUM_ELEMENTS + distance + i] = expected[NUM_ELEMENTS + i];
+      testFunction(destination, source);
+      for (int32_t i = 0; i < 3 * NUM_ELEMENTS; i++)
+         ASSERT_EQ(expected[i], data[i]) << "distance " << distance << ", index " << i;
+      }
+   }
+
+typedef void (*FloatSquareMinusSelfFunction)(float *);
+TEST_F(SLPVectorizerTest, FloatSquareMinusSelf)
+   {
+   FloatSquareMinusSelfFunction testFunction;
+   ASSERT_COMPILE_PACKED(OMR::JitBuilder::TypeDictionary, FloatSquareMinusSelf, testFunction, true);
+
+   float vector[5] = { 1.5f, -2.0f, 0.25f, 10.0f, 42.0f };
+   float expected[5];
+   for (int32_t i = 0; i < 5; i++)
+      expected[i] = i < 4 ? vector[i] * vector[i] - vector[i] : vector[i];
+   testFunction(vector);
+   for (int32_t i = 0; i < 5; i++)
+      ASSERT_EQ(expected[i], vector[i]) << "index " << i;
+   }
+
+typedef void (*Int64AddSubFunction)(int64_t *, int64_t *, int64_t *);
+TEST_F(SLPVectorizerTest, Int64AddSub)
+   {
+   Int64AddSubFunction testFunction;
+   ASSERT_COMPILE_PACKED(OMR::JitBuilder::TypeDictionary, Int64AddSub, testFunction, false);
+
+   int64_t v1[4] = { 100, 200, 300, 400 };
+   int64_t v2[4] = { 1, 2, 3, 4 };
+   int64_t result[4] = { 0 };
+   testFunction(result, v1, v2);
+   for (int32_t i = 0; i < 4; i++)
+      ASSERT_EQ((i & 1) ? v1[i] - v2[i] : v1[i] + v2[i], result[i]) << "index " << i;
+   }
+
+typedef void (*Int32PrefixIncrementFunction)(int32_t *);
+TEST_F(SLPVectorizerTest, Int32PrefixIncrement)
+   {
+   Int32PrefixIncrementFunction testFunction;
+   ASSERT_COMPILE_PACKED(OMR::JitBuilder::TypeDictionary, Int32PrefixIncrement, testFunction, false);
+
+   int32_t vector[6] = { 7, 0, 0, 0, 0, -1 };
+   testFunction(vector);
+   for (int32_t i = 0; i < 5; i++)
+      ASSERT_EQ(7 + i, vector[i]) << "index " << i;
+   ASSERT_EQ(-1, vector[5]) << "store past the last element";
+   }
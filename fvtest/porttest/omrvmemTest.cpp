@@ -30,6 +30,7 @@
  * @note port library virtual memory management operations are not optional in the port library table.
  *
  */
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -4232,6 +4233,193 @@ exit:
 	EXPECT_EQ(0, result) << "Test Failed!";
 }
 
+#if defined(LINUX)
+/**
+ * @internal
+ * Accounting for one mapping, as reported by /proc/self/smaps.
+ */
+typedef struct SmapsMapping {
+	BOOLEAN found; /**< TRUE if a mapping containing the address was found */
+	uintptr_t rssKB; /**< Rss: resident memory */
+	uintptr_t anonHugePagesKB; /**< AnonHugePages: resident memory backed by transparent huge pages */
+	uintptr_t lazyFreeKB; /**< LazyFree: memory released with MADV_FREE which the kernel has not reclaimed yet */
+	intptr_t thpEligible; /**< THPeligible: 1 if the mapping may use transparent huge pages, -1 if not reported */
+	BOOLEAN hugePageFlag; /**< VmFlags hg: advised with MADV_HUGEPAGE */
+	BOOLEAN noHugePageFlag; /**< VmFlags nh: advised with MADV_NOHUGEPAGE */
+} SmapsMapping;
+
+/**
+ * @internal
+ * Read the /proc/self/smaps entry of the mapping which contains address.
+ *
+ * @param[in] address An address within the mapping
+ * @param[out] mapping The accounting for the mapping
+ *
+ * @return TRUE if smaps could be read, FALSE otherwise
+ */
+static BOOLEAN
+readSmapsMapping(void *address, SmapsMapping *mapping)
+{
+	char line[512];
+	BOOLEAN inMapping = FALSE;
+	FILE *smaps = fopen("/proc/self/smaps", "r");
+
+	memset(mapping, 0, sizeof(SmapsMapping));
+	mapping->thpEligible = -1;
+	if (NULL == smaps) {
+		return FALSE;
+	}
+
+	while (NULL != fgets(line, sizeof(line), smaps)) {
+		unsigned long start = 0;
+		unsigned long end = 0;
+		unsigned long value = 0;
+
+		if (2 == sscanf(line, "%lx-%lx ", &start, &end)) {
+			/* header line of the next mapping */
+			if (inMapping) {
+				break;
+			}
+			inMapping = ((start <= (uintptr_t)address) && ((uintptr_t)address < end));
+			mapping->found = inMapping;
+		} else if (inMapping) {
+			if (1 == sscanf(line, "Rss: %lu kB", &value)) {
+				mapping->rssKB = value;
+			} else if (1 == sscanf(line, "AnonHugePages: %lu kB", &value)) {
+				mapping->anonHugePagesKB = value;
+			} else if (1 == sscanf(line, "LazyFree: %lu kB", &value)) {
+				mapping->lazyFreeKB = value;
+			} else if (1 == sscanf(line, "THPeligible: %lu", &value)) {
+				mapping->thpEligible = (intptr_t)value;
+			} else if (0 == strncmp(line, "VmFlags:", 8)) {
+				mapping->hugePageFlag = (NULL != strstr(line, " hg"));
+				mapping->noHugePageFlag = (NULL != strstr(line, " nh"));
+			}
+		}
+	}
+
+	fclose(smaps);
+	return TRUE;
+}
+
+/**
+ * @internal
+ * @return TRUE if transparent huge pages are not disabled for the whole system
+ */
+static BOOLEAN
+transparentHugePagesEnabled(void)
+{
+	char setting[128];
+	BOOLEAN enabled = FALSE;
+	FILE *file = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+	if (NULL != file) {
+		if (NULL != fgets(setting, sizeof(setting), file)) {
+			enabled = (NULL == strstr(setting, "[never]"));
+		}
+		fclose(file);
+	}
+	return enabled;
+}
+
+/**
+ * Verify the transparent huge page advice given by OMRPORT_VMEM_ADVISE_HUGEPAGE, OMRPORT_VMEM_ADVISE_NOHUGEPAGE
+ * and OMRPORT_VMEM_ADVISE_FREE_ON_DECOMMIT.
+ *
+ * Reserve, commit and touch default page memory with each advice, then check the page size accounting of the
+ * mapping in /proc/self/smaps:
+ * - memory advised with MADV_HUGEPAGE is flagged hg, and only huge page multiples are reported in AnonHugePages
+ * - memory advised with MADV_NOHUGEPAGE is flagged nh and never backed by huge pages
+ * - decommitted memory is released from Rss or, with MADV_FREE, reported in LazyFree
+ */
+TEST(PortVmemTest, vmem_test_transparentHugePageAdvice)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrvmem_test_transparentHugePageAdvice";
+	uintptr_t *pageSizes = omrvmem_supported_page_sizes();
+	uintptr_t adviceOptions[] = {
+		OMRPORT_VMEM_ADVISE_HUGEPAGE | OMRPORT_VMEM_ADVISE_FREE_ON_DECOMMIT,
+		OMRPORT_VMEM_ADVISE_NOHUGEPAGE,
+	};
+	BOOLEAN thpEnabled = transparentHugePagesEnabled();
+	uintptr_t i = 0;
+
+	reportTestEntry(OMRPORTLIB, testName);
+	portTestEnv->log("transparent huge pages are %s\n", thpEnabled ? "enabled" : "disabled");
+
+	for (i = 0; i < sizeof(adviceOptions) / sizeof(adviceOptions[0]); i++) {
+		struct J9PortVmemIdentifier vmemID;
+		J9PortVmemParams params;
+		SmapsMapping mapping;
+		char *memPtr = NULL;
+		uintptr_t rssBeforeDecommitKB = 0;
+		BOOLEAN advisedHugePage = OMR_ARE_ANY_BITS_SET(adviceOptions[i], OMRPORT_VMEM_ADVISE_HUGEPAGE);
+		intptr_t rc = 0;
+
+		omrvmem_vmem_params_init(&params);
+		params.byteAmount = 4 * D2M;
+		params.pageSize = pageSizes[0];
+		params.mode |= OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE | OMRPORT_VMEM_MEMORY_MODE_COMMIT;
+		params.options |= adviceOptions[i];
+		params.category = OMRMEM_CATEGORY_PORT_LIBRARY;
+
+		memPtr = (char *)omrvmem_reserve_memory_ex(&vmemID, &params);
+		if (NULL == memPtr) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "unable to reserve 0x%zx bytes with options 0x%zx\n", params.byteAmount, params.options);
+			continue;
+		}
+
+		/* fault in every page */
+		memset(memPtr, 0xA5, params.byteAmount);
+
+		if (!readSmapsMapping(memPtr, &mapping) || !mapping.found) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "no /proc/self/smaps entry for the mapping at %p\n", memPtr);
+		} else {
+			portTestEnv->log("options 0x%zx: Rss %zu kB, AnonHugePages %zu kB, THPeligible %zd\n",
+				params.options, mapping.rssKB, mapping.anonHugePagesKB, mapping.thpEligible);
+			if (advisedHugePage && !mapping.hugePageFlag) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "mapping at %p is not flagged hg after MADV_HUGEPAGE\n", memPtr);
+			}
+			if (!advisedHugePage && !mapping.noHugePageFlag) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "mapping at %p is not flagged nh after MADV_NOHUGEPAGE\n", memPtr);
+			}
+			if ((0 != (mapping.anonHugePagesKB % (D2M / 1024))) || (mapping.anonHugePagesKB > mapping.rssKB)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "AnonHugePages %zu kB is not a multiple of huge pages within Rss %zu kB\n",
+					mapping.anonHugePagesKB, mapping.rssKB);
+			}
+			if (!advisedHugePage && (0 != mapping.anonHugePagesKB)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "%zu kB of the mapping at %p is in huge pages after MADV_NOHUGEPAGE\n",
+					mapping.anonHugePagesKB, memPtr);
+			}
+			if (-1 != mapping.thpEligible) {
+				intptr_t expectedEligible = (advisedHugePage && thpEnabled) ? 1 : 0;
+				if (expectedEligible != mapping.thpEligible) {
+					outputErrorMessage(PORTTEST_ERROR_ARGS, "THPeligible is %zd, expected %zd\n", mapping.thpEligible, expectedEligible);
+				}
+			}
+			rssBeforeDecommitKB = mapping.rssKB;
+		}
+
+		rc = omrvmem_decommit_memory(memPtr, params.byteAmount, &vmemID);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_decommit_memory returned %zd with options 0x%zx\n", rc, params.options);
+		} else if (readSmapsMapping(memPtr, &mapping) && mapping.found) {
+			portTestEnv->log("options 0x%zx after decommit: Rss %zu kB, LazyFree %zu kB\n", params.options, mapping.rssKB, mapping.lazyFreeKB);
+			if ((mapping.rssKB >= rssBeforeDecommitKB) && (0 == mapping.lazyFreeKB)) {
+				outputErrorMessage(PORTTEST_ERROR_ARGS, "decommitted memory at %p was neither released nor lazily freed\n", memPtr);
+			}
+		}
+
+		rc = omrvmem_free_memory(memPtr, params.byteAmount, &vmemID);
+		if (0 != rc) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_free_memory returned %zd when trying to free 0x%zx bytes at %p\n", rc, params.byteAmount, memPtr);
+		}
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+#endif /* defined(LINUX) */
+
 /**
  * Queries process virtual, physical, and private memory sizes.
  *
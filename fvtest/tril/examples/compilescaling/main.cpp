@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Compilation scaling benchmark.
+ *
+ * Compiles every method found in a corpus of Tril files repeatedly, first on
+ * one compilation thread, then on two, and so on up to the requested maximum,
+ * and reports the compilation throughput achieved at each thread count. The
+ * results are intended to help size compilation thread pools: the point at
+ * which adding a thread stops improving compiles/second is the point at which
+ * shared compiler state (code cache reservation, persistent allocation, ...)
+ * becomes the bottleneck.
+ *
+ * Usage: compilescaling <max threads> <compiles per method> file.tril [file.tril ...]
+ */
+
+#include "default_compiler.hpp"
+#include "Jit.hpp"
+#include "env/ConcreteFE.hpp"
+#include "runtime/CodeCacheManager.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Compiles methods from the corpus until the shared work counter is exhausted
+ * @param corpus the methods to compile
+ * @param totalCompiles the number of compilations to perform across all threads
+ * @param nextCompile the index of the next compilation to be claimed by a thread
+ * @param failures the number of compilations that did not succeed
+ * @param compThreadID the compilation thread ID used to reserve code caches
+ */
+static void compileWorker(const std::vector<const ASTNode*>& corpus,
+                          int32_t totalCompiles,
+                          std::atomic<int32_t>& nextCompile,
+                          std::atomic<int32_t>& failures,
+                          int32_t compThreadID) {
+    for (auto i = nextCompile++; i < totalCompiles; i = nextCompile++) {
+        Tril::DefaultCompiler compiler(corpus[i % corpus.size()]);
+        if (compiler.compileWithVerifier(NULL, compThreadID) != 0) {
+            ++failures;
+        }
+    }
+}
+
+int main(int argc, char const * const * const argv) {
+    if (argc < 4) {
+        fprintf(stderr, "Usage: %s <max threads> <compiles per method> file.tril [file.tril ...]\n", argv[0]);
+        exit(-1);
+    }
+
+    const auto maxThreads = atoi(argv[1]);
+    const auto compilesPerMethod = atoi(argv[2]);
+    if (maxThreads < 1 || compilesPerMethod < 1) {
+        fprintf(stderr, "FAIL: thread and compile counts must be positive\n");
+        exit(-1);
+    }
+
+    // gather every method from every file in the corpus
+    std::vector<const ASTNode*> corpus;
+    for (auto f = 3; f < argc; ++f) {
+        FILE* inputFile = fopen(argv[f], "r");
+        if (inputFile == NULL) {
+            fprintf(stderr, "FAIL: could not open %s\n", argv[f]);
+            exit(-1);
+        }
+        ASTNode* trees = parseFile(inputFile);
+        fclose(inputFile);
+
+        for (const ASTNode* method = trees; method != NULL; method = method->next) {
+            corpus.push_back(method);
+        }
+    }
+    if (corpus.empty()) {
+        fprintf(stderr, "FAIL: no methods found in corpus\n");
+        exit(-1);
+    }
+
+    bool initialized = initializeJit();
+    if (!initialized) {
+        fprintf(stderr, "FAIL: could not initialize JIT\n");
+        exit(-1);
+    }
+
+    const auto totalCompiles = static_cast<int32_t>(corpus.size()) * compilesPerMethod;
+    auto baseline = 0.0;
+    auto totalFailures = 0;
+
+    printf("%zu methods, %d compiles per thread count\n", corpus.size(), totalCompiles);
+    printf("%8s %10s %10s %12s %8s %12s\n", "threads", "compiles", "seconds", "compiles/s", "speedup", "code caches");
+
+    for (auto threadCount = 1; threadCount <= maxThreads; ++threadCount) {
+        std::atomic<int32_t> nextCompile(0);
+        std::atomic<int32_t> failures(0);
+        std::vector<std::thread> threads;
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto t = 0; t < threadCount; ++t) {
+            // compilation thread IDs start at 1 so that each thread reserves its own code cache
+            threads.emplace_back(compileWorker, std::cref(corpus), totalCompiles, std::ref(nextCompile), std::ref(failures), t + 1);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        const auto rate = totalCompiles / elapsed.count();
+        if (threadCount == 1) {
+            baseline = rate;
+        }
+        totalFailures += failures;
+
+        printf("%8d %10d %10.3f %12.1f %7.2fx %12d\n",
+               threadCount,
+               totalCompiles,
+               elapsed.count(),
+               rate,
+               rate / baseline,
+               OMR::FrontEnd::singleton().codeCacheManager().getCurrentNumberOfCodeCaches());
+    }
+
+    shutdownJit();
+
+    if (totalFailures != 0) {
+        fprintf(stderr, "FAIL: %d compilations failed\n", totalFailures);
+        exit(-2);
+    }
+    return 0;
+}
@@ -28,7 +28,9 @@ TR::Node* CallConverter::impl(const ASTNode* tree, IlGenState* state) {
     TR::Node* node = NULL;
     auto childCount = tree->getChildCount();
     auto opcode = OpCodeTable(tree->getName());
-    if (opcode.isCall()) {
+    // arrayset is flagged as a call but is lowered by the code generator, so it
+    // has no target address and is created by the generic converter instead
+    if (opcode.isCall() && opcode.getOpCodeValue() != TR::arrayset) {
         auto compilation = TR::comp();
 
         const auto addressArg = tree->getArgByName("address");
@@ -193,6 +193,10 @@ TR::Node* GenericNodeConverter::impl(const ASTNode* tree, IlGenState* state) {
         node = TR::Node::create(opcode.getOpCodeValue(), childCount);
         node->setBranchDestination(targetEntry);
     }
+    else if (opcode.getOpCodeValue() == TR::arrayset) {
+        TraceIL("  is arrayset\n", "");
+        node = TR::Node::createWithSymRef(opcode.getOpCodeValue(), childCount, TR::comp()->getSymRefTab()->findOrCreateArraySetSymbol());
+    }
     else {
         TraceIL("  unrecognized opcode; using default creation mechanism\n", "");
         node = TR::Node::create(opcode.getOpCodeValue(), childCount);
@@ -30,8 +30,6 @@
 
 #include <string>
 
-std::map<std::string, TR::ILOpCodes> Tril::OpCodeTable::_opcodeNameMap;
-
 /*
  * The general algorithm for generating a TR::Node from it's AST representation
  * is like this:
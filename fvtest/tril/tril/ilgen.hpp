@@ -56,16 +56,11 @@ class OpCodeTable : public TR::ILOpCode {
        * @brief Given an opcode name, returns the corresponding TR::OpCodes value
        */
       static TR::ILOpCodes getOpCodeFromName(const std::string& name) {
-         auto opcode = _opcodeNameMap.find(name);
-         if (opcode == _opcodeNameMap.end()) {
-            for (int i = TR::FirstOMROp; i< TR::NumIlOps; i++) {
-               const auto p_opCode = static_cast<TR::ILOpCodes>(i);
-               const auto& p = TR::ILOpCode::_opCodeProperties[p_opCode];
-               if (name == p.name) {
-                  _opcodeNameMap[name] = p.opcode;
-                  return p.opcode;
-               }
-            }
+         // Several threads may generate IL at once, so the map is filled in
+         // completely the first time it is used and only read after that
+         static const std::map<std::string, TR::ILOpCodes> opcodeNameMap = buildOpCodeNameMap();
+         auto opcode = opcodeNameMap.find(name);
+         if (opcode == opcodeNameMap.end()) {
             return TR::BadILOp;
          }
          else {
@@ -74,7 +69,15 @@ class OpCodeTable : public TR::ILOpCode {
       }
 
    private:
-      static std::map<std::string, TR::ILOpCodes> _opcodeNameMap;
+      static std::map<std::string, TR::ILOpCodes> buildOpCodeNameMap() {
+         std::map<std::string, TR::ILOpCodes> opcodeNameMap;
+         for (int i = TR::FirstOMROp; i< TR::NumIlOps; i++) {
+            const auto p_opCode = static_cast<TR::ILOpCodes>(i);
+            const auto& p = TR::ILOpCode::_opCodeProperties[p_opCode];
+            opcodeNameMap.insert(std::make_pair(std::string(p.name), p.opcode));
+         }
+         return opcodeNameMap;
+      }
 };
 
 /**
@@ -514,9 +514,8 @@ ASTNode* buildAST(TokenIter &tokenIt) {
  */
 ASTNode* parseFile(FILE *in) {
     std::string result;
-    while(!feof(in)) {
-        char temp[100];
-        fgets(temp, 100, in);
+    char temp[100];
+    while (fgets(temp, 100, in) != NULL) {
         result += temp;
     }
     std::vector<Token> scanToken = scan(result);
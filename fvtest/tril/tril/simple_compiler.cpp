@@ -36,6 +36,7 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 
 #if defined(AIXPPC)
+#include "env/ConcreteFE.hpp"
 #include "p/codegen/PPCTableOfConstants.hpp"
 #endif
 
@@ -45,7 +46,7 @@ int32_t Tril::SimpleCompiler::compile() {
    return compileWithVerifier(NULL);
 }
 
-int32_t Tril::SimpleCompiler::compileWithVerifier(TR::IlVerifier* verifier) {
+int32_t Tril::SimpleCompiler::compileWithVerifier(TR::IlVerifier* verifier, int32_t compThreadID) {
     // construct an IL generator for the method
     auto methodInfo = getMethodInfo();
     TR::TypeDictionary types;
@@ -78,7 +79,7 @@ int32_t Tril::SimpleCompiler::compileWithVerifier(TR::IlVerifier* verifier) {
        }
 
     int32_t rc = 0;
-    auto entry_point = compileMethodFromDetails(NULL, methodDetails, warm, rc);
+    auto entry_point = compileMethodFromDetails(NULL, methodDetails, warm, rc, compThreadID);
 
     // if compilation was successful, set the entry point for the compiled body
     if (rc == 0)
@@ -107,7 +108,7 @@ int32_t Tril::SimpleCompiler::compileWithVerifier(TR::IlVerifier* verifier) {
        fd->func = entry_point;
        // TODO: There should really be a better way to get this. Usually, we would use
        // cg->getTOCBase(), but the code generator has already been destroyed by now...
-       fd->toc = toPPCTableOfConstants(TR_PersistentMemory::getNonThreadSafePersistentInfo()->getPersistentTOC())->getTOCBase();
+       fd->toc = toPPCTableOfConstants(OMR::FrontEnd::singleton().getPersistentInfo()->getPersistentTOC())->getTOCBase();
        fd->environment = NULL;
 
        entry_point = (uint8_t*) fd;
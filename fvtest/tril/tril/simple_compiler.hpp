@@ -45,9 +45,11 @@ class SimpleCompiler : public Tril::MethodCompiler {
         /**
          * @brief Start compilation with a verifier. 
          * @param verifier The verifier to run. 
+         * @param compThreadID The ID of the thread compiling, so that several
+         *        threads can compile at once. 0 for the application thread.
          * @return 0 on complilation success, an error code or exception otherwise. 
          */
-        int32_t compileWithVerifier(TR::IlVerifier* verifier);
+        int32_t compileWithVerifier(TR::IlVerifier* verifier, int32_t compThreadID = 0);
 };
 
 } // namespace Tril
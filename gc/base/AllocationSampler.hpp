@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(ALLOCATIONSAMPLER_HPP_)
+#define ALLOCATIONSAMPLER_HPP_
+
+#include <math.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+
+/**
+ * Per thread byte interval allocation sampler.
+ * The distance in bytes between two samples is drawn from an exponential distribution whose mean is the
+ * sampling interval, so samples form a Poisson process over the bytes a thread allocates: every byte is
+ * equally likely to be sampled regardless of object size or allocation pattern.  Each sample carries the
+ * number of bytes allocated since the previous one, which is the weight a profiler should attribute to
+ * the sampled allocation site.
+ *
+ * The sampler owns no resources and has no dependencies on the rest of the collector, so it is embedded
+ * by value in the allocation interfaces.
+ *
+ * @ingroup GC_Base_Core
+ */
+class MM_AllocationSampler : public MM_Base
+{
+/*
+ * Data members
+ */
+public:
+protected:
+private:
+	uintptr_t _meanInterval; /**< Mean number of bytes between two samples, or 0 if sampling is disabled */
+	uintptr_t _bytesUntilSample; /**< Bytes still to be allocated before the next sample is taken */
+	uintptr_t _bytesSinceSample; /**< Bytes allocated since the previous sample was taken */
+	uint64_t _seed; /**< State of the xorshift generator used to draw the sampling intervals */
+
+/*
+ * Function members
+ */
+public:
+	/**
+	 * Start sampling with the given mean interval.
+	 * @param meanInterval mean number of bytes between two samples, 0 disables sampling
+	 * @param seed seed for the interval generator; threads should use distinct seeds
+	 */
+	void
+	initialize(uintptr_t meanInterval, uint64_t seed)
+	{
+		_meanInterval = meanInterval;
+		/* xorshift never leaves the zero state */
+		_seed = (0 == seed) ? (uint64_t)0x9E3779B97F4A7C15 : seed;
+		_bytesSinceSample = 0;
+		_bytesUntilSample = (0 == meanInterval) ? UDATA_MAX : nextInterval();
+	}
+
+	MMINLINE bool isEnabled() const { return 0 != _meanInterval; }
+	MMINLINE uintptr_t getMeanInterval() const { return _meanInterval; }
+
+	/**
+	 * Account for bytes allocated by the owning thread.
+	 * @param bytes the number of bytes allocated
+	 * @return true if a sample point falls within the allocation, in which case the caller must report
+	 * a sample and consume its weight with takeSampledBytes()
+	 */
+	MMINLINE bool
+	allocated(uintptr_t bytes)
+	{
+		_bytesSinceSample += bytes;
+		if (bytes < _bytesUntilSample) {
+			_bytesUntilSample -= bytes;
+			return false;
+		}
+		/* Several sample points may fall into one large allocation; they are folded into a single
+		 * sample whose weight covers all of them.
+		 */
+		uintptr_t overshoot = bytes - _bytesUntilSample;
+		_bytesUntilSample = nextInterval();
+		while (overshoot >= _bytesUntilSample) {
+			overshoot -= _bytesUntilSample;
+			_bytesUntilSample = nextInterval();
+		}
+		_bytesUntilSample -= overshoot;
+		return true;
+	}
+
+	/**
+	 * Consume the weight of the sample just taken.
+	 * @return the number of bytes allocated since the previous sample, including the sampled allocation
+	 */
+	MMINLINE uintptr_t
+	takeSampledBytes()
+	{
+		uintptr_t bytes = _bytesSinceSample;
+		_bytesSinceSample = 0;
+		return bytes;
+	}
+
+	/**
+	 * Draw the distance in bytes to the next sample point.
+	 * @return a value in [1, 32 * mean interval]
+	 */
+	uintptr_t
+	nextInterval()
+	{
+		/* xorshift64* */
+		_seed ^= _seed >> 12;
+		_seed ^= _seed << 25;
+		_seed ^= _seed >> 27;
+		uint64_t random = _seed * (uint64_t)0x2545F4914F6CDD1D;
+
+		/* uniform in (0, 1], using the 53 high bits */
+		double uniform = ((double)(random >> 11) + 1.0) / 9007199254740992.0;
+		double interval = -log(uniform) * (double)_meanInterval;
+		/* the exponential tail beyond 32 means has a probability of e^-32 */
+		double limit = 32.0 * (double)_meanInterval;
+		if (interval > limit) {
+			interval = limit;
+		}
+		uintptr_t result = (uintptr_t)interval;
+		return (0 == result) ? 1 : result;
+	}
+
+	MM_AllocationSampler()
+		: MM_Base()
+		, _meanInterval(0)
+		, _bytesUntilSample(UDATA_MAX)
+		, _bytesSinceSample(0)
+		, _seed(0)
+	{}
+};
+
+#endif /* ALLOCATIONSAMPLER_HPP_ */
@@ -0,0 +1,439 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include "BitmapScanner.hpp"
+
+#include "Bits.hpp"
+
+#if defined(J9HAMMER) || defined(J9X86)
+#define OMR_GC_BITMAPSCAN_X86
+#include <immintrin.h>
+
+/* The vector routines are compiled for their instruction set regardless of the baseline
+ * the rest of the GC is compiled for, and are only called once the processor is known to support it.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define BITMAPSCAN_TARGET(isa) __attribute__((target(isa)))
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define BITMAPSCAN_TARGET(isa)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+#endif /* defined(J9HAMMER) || defined(J9X86) */
+
+/* Bytes tested by one iteration of the vector skip loops */
+#define BITMAPSCAN_SSE2_BLOCK 64
+#define BITMAPSCAN_AVX2_BLOCK 128
+
+/* Iterations of the vector byte counters before the per-lane 8-bit counters must be widened */
+#define BITMAPSCAN_MAX_BYTE_LANE_ITERATIONS 255
+
+/**
+ * Scalar implementation, used on every platform without a vector implementation.
+ */
+static uint8_t *
+skipZeroBytesScalar(uint8_t *current, uint8_t *top)
+{
+	/* byte at a time up to the first slot boundary */
+	while ((current < top) && (0 != ((uintptr_t)current & (sizeof(uintptr_t) - 1)))) {
+		if (0 != *current) {
+			return current;
+		}
+		current += 1;
+	}
+
+	/* then four slots at a time while they are all zero */
+	uintptr_t *slot = (uintptr_t *)current;
+	uintptr_t *slotTop = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)top);
+	while (((slot + 4) <= slotTop) && (0 == (slot[0] | slot[1] | slot[2] | slot[3]))) {
+		slot += 4;
+	}
+
+	/* and locate the first non-zero byte at or after it */
+	current = (uint8_t *)slot;
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+static uintptr_t
+countBitsScalar(uintptr_t *base, uintptr_t *top)
+{
+	uintptr_t count = 0;
+	for (uintptr_t *slot = base; slot < top; slot++) {
+		count += MM_Bits::populationCount(*slot);
+	}
+	return count;
+}
+
+static uintptr_t
+countNonZeroBytesScalar(uint8_t *base, uint8_t *top)
+{
+	uintptr_t count = 0;
+	for (uint8_t *current = base; current < top; current++) {
+		if (0 != *current) {
+			count += 1;
+		}
+	}
+	return count;
+}
+
+#if defined(OMR_GC_BITMAPSCAN_X86)
+/**
+ * SSE2 implementation.
+ */
+BITMAPSCAN_TARGET("sse2") static MMINLINE uintptr_t
+sumLanes(__m128i sums)
+{
+	__m128i high = _mm_unpackhi_epi64(sums, sums);
+#if defined(J9HAMMER)
+	return (uintptr_t)_mm_cvtsi128_si64(sums) + (uintptr_t)_mm_cvtsi128_si64(high);
+#else /* defined(J9HAMMER) */
+	return (uintptr_t)_mm_cvtsi128_si32(sums) + (uintptr_t)_mm_cvtsi128_si32(high);
+#endif /* defined(J9HAMMER) */
+}
+
+BITMAPSCAN_TARGET("sse2") static uint8_t *
+skipZeroBytesSSE2(uint8_t *current, uint8_t *top)
+{
+	const __m128i zero = _mm_setzero_si128();
+
+	/* test the first vector unaligned, then continue from the next vector boundary */
+	if ((current + sizeof(__m128i)) <= top) {
+		uintptr_t nonZero = (~(uintptr_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((__m128i *)current), zero))) & 0xFFFF;
+		if (0 != nonZero) {
+			return current + MM_Bits::leadingZeroes(nonZero);
+		}
+		current = (uint8_t *)MM_Math::roundToFloor(sizeof(__m128i), (uintptr_t)current + sizeof(__m128i));
+	}
+
+	while ((current + BITMAPSCAN_SSE2_BLOCK) <= top) {
+		/* each vector is loaded once, so the block is examined consistently even if it is being modified */
+		__m128i v0 = _mm_load_si128((__m128i *)current);
+		__m128i v1 = _mm_load_si128((__m128i *)(current + 16));
+		__m128i v2 = _mm_load_si128((__m128i *)(current + 32));
+		__m128i v3 = _mm_load_si128((__m128i *)(current + 48));
+		__m128i any = _mm_or_si128(_mm_or_si128(v0, v1), _mm_or_si128(v2, v3));
+		if (0xFFFF != _mm_movemask_epi8(_mm_cmpeq_epi8(any, zero))) {
+			uintptr_t nonZero = (~(uintptr_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v0, zero))) & 0xFFFF;
+			if (0 != nonZero) {
+				return current + MM_Bits::leadingZeroes(nonZero);
+			}
+			nonZero = (~(uintptr_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v1, zero))) & 0xFFFF;
+			if (0 != nonZero) {
+				return current + 16 + MM_Bits::leadingZeroes(nonZero);
+			}
+			nonZero = (~(uintptr_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v2, zero))) & 0xFFFF;
+			if (0 != nonZero) {
+				return current + 32 + MM_Bits::leadingZeroes(nonZero);
+			}
+			nonZero = (~(uintptr_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v3, zero))) & 0xFFFF;
+			return current + 48 + MM_Bits::leadingZeroes(nonZero);
+		}
+		current += BITMAPSCAN_SSE2_BLOCK;
+	}
+
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+BITMAPSCAN_TARGET("sse2") static uintptr_t
+countBitsSSE2(uintptr_t *base, uintptr_t *top)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i m1 = _mm_set1_epi8(0x55);
+	const __m128i m2 = _mm_set1_epi8(0x33);
+	const __m128i m4 = _mm_set1_epi8(0x0F);
+	__m128i total = _mm_setzero_si128();
+	uintptr_t count = 0;
+
+	while ((base < top) && (0 != ((uintptr_t)base & (sizeof(__m128i) - 1)))) {
+		count += MM_Bits::populationCount(*base);
+		base += 1;
+	}
+
+	uint8_t *current = (uint8_t *)base;
+	uint8_t *vectorTop = (uint8_t *)MM_Math::roundToFloor(sizeof(__m128i), (uintptr_t)top);
+	for (; current < vectorTop; current += sizeof(__m128i)) {
+		/* count the bits of each byte in parallel, then sum the bytes of each half */
+		__m128i v = _mm_load_si128((__m128i *)current);
+		v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+		v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+		v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+		total = _mm_add_epi64(total, _mm_sad_epu8(v, zero));
+	}
+	count += sumLanes(total);
+
+	for (base = (uintptr_t *)current; base < top; base++) {
+		count += MM_Bits::populationCount(*base);
+	}
+	return count;
+}
+
+BITMAPSCAN_TARGET("sse2") static uintptr_t
+countNonZeroBytesSSE2(uint8_t *base, uint8_t *top)
+{
+	const __m128i zero = _mm_setzero_si128();
+	uintptr_t count = 0;
+
+	while ((base < top) && (0 != ((uintptr_t)base & (sizeof(__m128i) - 1)))) {
+		if (0 != *base) {
+			count += 1;
+		}
+		base += 1;
+	}
+
+	uint8_t *current = base;
+	uint8_t *vectorTop = (uint8_t *)MM_Math::roundToFloor(sizeof(__m128i), (uintptr_t)top);
+	while (current < vectorTop) {
+		/* count the zero bytes in 8-bit lanes (cmpeq yields -1 for each zero byte), widening before a lane can overflow */
+		__m128i zeroBytes = _mm_setzero_si128();
+		uintptr_t iterations = OMR_MIN(BITMAPSCAN_MAX_BYTE_LANE_ITERATIONS, (uintptr_t)(vectorTop - current) / sizeof(__m128i));
+		uint8_t *chunkTop = current + (iterations * sizeof(__m128i));
+		for (; current < chunkTop; current += sizeof(__m128i)) {
+			zeroBytes = _mm_sub_epi8(zeroBytes, _mm_cmpeq_epi8(_mm_load_si128((__m128i *)current), zero));
+		}
+		count += (iterations * sizeof(__m128i)) - sumLanes(_mm_sad_epu8(zeroBytes, zero));
+	}
+
+	return count + countNonZeroBytesScalar(current, top);
+}
+
+/**
+ * AVX2 implementation.
+ */
+BITMAPSCAN_TARGET("avx2") static uint8_t *
+skipZeroBytesAVX2(uint8_t *current, uint8_t *top)
+{
+	/* test the first vector unaligned, then continue from the next vector boundary */
+	if ((current + sizeof(__m256i)) <= top) {
+		uint32_t nonZero = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i *)current), _mm256_setzero_si256()));
+		if (0 != nonZero) {
+			return current + MM_Bits::leadingZeroes(nonZero);
+		}
+		current = (uint8_t *)MM_Math::roundToFloor(sizeof(__m256i), (uintptr_t)current + sizeof(__m256i));
+	}
+
+	while ((current + BITMAPSCAN_AVX2_BLOCK) <= top) {
+		/* each vector is loaded once, so the block is examined consistently even if it is being modified */
+		__m256i v0 = _mm256_load_si256((__m256i *)current);
+		__m256i v1 = _mm256_load_si256((__m256i *)(current + 32));
+		__m256i v2 = _mm256_load_si256((__m256i *)(current + 64));
+		__m256i v3 = _mm256_load_si256((__m256i *)(current + 96));
+		__m256i any = _mm256_or_si256(_mm256_or_si256(v0, v1), _mm256_or_si256(v2, v3));
+		if (!_mm256_testz_si256(any, any)) {
+			const __m256i zero = _mm256_setzero_si256();
+			uint32_t nonZero = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v0, zero));
+			if (0 != nonZero) {
+				return current + MM_Bits::leadingZeroes(nonZero);
+			}
+			nonZero = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v1, zero));
+			if (0 != nonZero) {
+				return current + 32 + MM_Bits::leadingZeroes(nonZero);
+			}
+			nonZero = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v2, zero));
+			if (0 != nonZero) {
+				return current + 64 + MM_Bits::leadingZeroes(nonZero);
+			}
+			nonZero = ~(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v3, zero));
+			return current + 96 + MM_Bits::leadingZeroes(nonZero);
+		}
+		current += BITMAPSCAN_AVX2_BLOCK;
+	}
+
+	while ((current < top) && (0 == *current)) {
+		current += 1;
+	}
+	return current;
+}
+
+BITMAPSCAN_TARGET("avx2") static MMINLINE uintptr_t
+sumLanes(__m256i sums)
+{
+	return sumLanes(_mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1)));
+}
+
+BITMAPSCAN_TARGET("avx2") static uintptr_t
+countBitsAVX2(uintptr_t *base, uintptr_t *top)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	/* bits set in each value of a nibble */
+	const __m256i nibbleCounts = _mm256_setr_epi8(
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+			0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i lowNibbles = _mm256_set1_epi8(0x0F);
+	__m256i total = _mm256_setzero_si256();
+	uintptr_t count = 0;
+
+	while ((base < top) && (0 != ((uintptr_t)base & (sizeof(__m256i) - 1)))) {
+		count += MM_Bits::populationCount(*base);
+		base += 1;
+	}
+
+	uint8_t *current = (uint8_t *)base;
+	uint8_t *vectorTop = (uint8_t *)MM_Math::roundToFloor(sizeof(__m256i), (uintptr_t)top);
+	for (; current < vectorTop; current += sizeof(__m256i)) {
+		/* look up the bit count of both nibbles of every byte, then sum the bytes of each quarter */
+		__m256i v = _mm256_load_si256((__m256i *)current);
+		__m256i low = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(v, lowNibbles));
+		__m256i high = _mm256_shuffle_epi8(nibbleCounts, _mm256_and_si256(_mm256_srli_epi16(v, 4), lowNibbles));
+		total = _mm256_add_epi64(total, _mm256_sad_epu8(_mm256_add_epi8(low, high), zero));
+	}
+	count += sumLanes(total);
+
+	for (base = (uintptr_t *)current; base < top; base++) {
+		count += MM_Bits::populationCount(*base);
+	}
+	return count;
+}
+
+BITMAPSCAN_TARGET("avx2") static uintptr_t
+countNonZeroBytesAVX2(uint8_t *base, uint8_t *top)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	uintptr_t count = 0;
+
+	while ((base < top) && (0 != ((uintptr_t)base & (sizeof(__m256i) - 1)))) {
+		if (0 != *base) {
+			count += 1;
+		}
+		base += 1;
+	}
+
+	uint8_t *current = base;
+	uint8_t *vectorTop = (uint8_t *)MM_Math::roundToFloor(sizeof(__m256i), (uintptr_t)top);
+	while (current < vectorTop) {
+		/* count the zero bytes in 8-bit lanes (cmpeq yields -1 for each zero byte), widening before a lane can overflow */
+		__m256i zeroBytes = _mm256_setzero_si256();
+		uintptr_t iterations = OMR_MIN(BITMAPSCAN_MAX_BYTE_LANE_ITERATIONS, (uintptr_t)(vectorTop - current) / sizeof(__m256i));
+		uint8_t *chunkTop = current + (iterations * sizeof(__m256i));
+		for (; current < chunkTop; current += sizeof(__m256i)) {
+			zeroBytes = _mm256_sub_epi8(zeroBytes, _mm256_cmpeq_epi8(_mm256_load_si256((__m256i *)current), zero));
+		}
+		count += (iterations * sizeof(__m256i)) - sumLanes(_mm256_sad_epu8(zeroBytes, zero));
+	}
+
+	return count + countNonZeroBytesScalar(current, top);
+}
+
+/**
+ * @return true if the operating system saves the AVX (YMM) register state across context switches
+ */
+static bool
+isAVXStateEnabled()
+{
+	uint64_t xcr0 = 0;
+#if defined(_MSC_VER)
+	xcr0 = _xgetbv(0);
+#else /* defined(_MSC_VER) */
+	uint32_t eax = 0;
+	uint32_t edx = 0;
+	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	xcr0 = ((uint64_t)edx << 32) | eax;
+#endif /* defined(_MSC_VER) */
+	/* XMM and YMM state */
+	return 0x6 == (xcr0 & 0x6);
+}
+#endif /* defined(OMR_GC_BITMAPSCAN_X86) */
+
+MM_BitmapScanner::MM_BitmapScanner()
+	: _skipZeroBytes(skipZeroBytesScalar)
+	, _countBits(countBitsScalar)
+	, _countNonZeroBytes(countNonZeroBytesScalar)
+	, _implementation(SCAN_SCALAR)
+	, _supportedImplementation(SCAN_SCALAR)
+{
+}
+
+void
+MM_BitmapScanner::initialize(OMRPortLibrary *portLibrary)
+{
+	_supportedImplementation = SCAN_SCALAR;
+
+#if defined(OMR_GC_BITMAPSCAN_X86)
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	OMRProcessorDesc processorDesc;
+	if (0 == omrsysinfo_get_processor_description(&processorDesc)) {
+		if (omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_SSE2)) {
+			_supportedImplementation = SCAN_SSE2;
+			if (omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_AVX2)
+				&& omrsysinfo_processor_has_feature(&processorDesc, OMR_FEATURE_X86_OSXSAVE)
+				&& isAVXStateEnabled()
+			) {
+				_supportedImplementation = SCAN_AVX2;
+			}
+		}
+	}
+#endif /* defined(OMR_GC_BITMAPSCAN_X86) */
+
+	setImplementation(_supportedImplementation);
+}
+
+bool
+MM_BitmapScanner::setImplementation(Implementation implementation)
+{
+	if (implementation > _supportedImplementation) {
+		return false;
+	}
+
+	switch (implementation) {
+#if defined(OMR_GC_BITMAPSCAN_X86)
+	case SCAN_AVX2:
+		_skipZeroBytes = skipZeroBytesAVX2;
+		_countBits = countBitsAVX2;
+		_countNonZeroBytes = countNonZeroBytesAVX2;
+		break;
+	case SCAN_SSE2:
+		_skipZeroBytes = skipZeroBytesSSE2;
+		_countBits = countBitsSSE2;
+		_countNonZeroBytes = countNonZeroBytesSSE2;
+		break;
+#endif /* defined(OMR_GC_BITMAPSCAN_X86) */
+	default:
+		_skipZeroBytes = skipZeroBytesScalar;
+		_countBits = countBitsScalar;
+		_countNonZeroBytes = countNonZeroBytesScalar;
+		break;
+	}
+	_implementation = implementation;
+
+	return true;
+}
+
+const char *
+MM_BitmapScanner::getImplementationName(Implementation implementation)
+{
+	switch (implementation) {
+	case SCAN_AVX2:
+		return "avx2";
+	case SCAN_SSE2:
+		return "sse2";
+	default:
+		return "scalar";
+	}
+}
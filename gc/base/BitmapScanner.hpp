@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(BITMAPSCANNER_HPP_)
+#define BITMAPSCANNER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrport.h"
+
+#include "Math.hpp"
+
+/**
+ * Range skip and population routines over mark map slots and card table bytes.
+ * Sweep, heap map iteration and card cleaning spend much of their time skipping runs of empty
+ * mark map slots or clean cards; these routines test a cache line of the map at a time and
+ * only fall back to a slot or a byte at a time to locate the first non-zero entry.
+ *
+ * The implementation is chosen once, at initialization, from the vector extensions the
+ * processor supports (AVX2 or SSE2 on x86, a scalar loop everywhere else) and may be
+ * forced to a less capable one with -Xgc:bitmapScan=.
+ *
+ * Every routine reads only the range it is given and tolerates the map being modified
+ * concurrently: entries that change while they are being scanned may or may not be seen.
+ * @ingroup GC_Base
+ */
+class MM_BitmapScanner
+{
+	/* Data Members */
+public:
+	/**
+	 * Implementations of the routines, from least to most capable.
+	 */
+	enum Implementation {
+		SCAN_SCALAR = 0,
+		SCAN_SSE2,
+		SCAN_AVX2
+	};
+
+private:
+	uint8_t *(*_skipZeroBytes)(uint8_t *current, uint8_t *top);
+	uintptr_t (*_countBits)(uintptr_t *base, uintptr_t *top);
+	uintptr_t (*_countNonZeroBytes)(uint8_t *base, uint8_t *top);
+	Implementation _implementation; /**< implementation in use */
+	Implementation _supportedImplementation; /**< most capable implementation the processor supports */
+
+	/* Member Functions */
+public:
+	/**
+	 * Detect the vector extensions of the processor and select the most capable implementation.
+	 * @param[in] portLibrary the port library used to query the processor features
+	 */
+	void initialize(OMRPortLibrary *portLibrary);
+
+	/**
+	 * Select the implementation used by the routines.
+	 * @param[in] implementation the implementation to use
+	 * @return true if the processor supports implementation, false (and the selection is unchanged) otherwise
+	 */
+	bool setImplementation(Implementation implementation);
+
+	MMINLINE Implementation getImplementation() { return _implementation; }
+	MMINLINE Implementation getSupportedImplementation() { return _supportedImplementation; }
+
+	/**
+	 * @param[in] implementation an implementation
+	 * @return the name of implementation, as accepted by -Xgc:bitmapScan=
+	 */
+	static const char *getImplementationName(Implementation implementation);
+
+	/**
+	 * Find the first non-zero slot in [current, top).
+	 * @param[in] current first slot to examine
+	 * @param[in] top slot following the last slot to examine
+	 * @return the first non-zero slot, or top if every slot in the range is zero
+	 */
+	MMINLINE uintptr_t *
+	skipEmptySlots(uintptr_t *current, uintptr_t *top)
+	{
+		/* a slot is empty when all of its bytes are; the first non-zero byte is in the first non-empty slot */
+		uint8_t *nonZeroByte = _skipZeroBytes((uint8_t *)current, (uint8_t *)top);
+		return (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)nonZeroByte);
+	}
+
+	/**
+	 * Find the first non-zero byte in [current, top), such as the first card which is not CARD_CLEAN.
+	 * @param[in] current first byte to examine
+	 * @param[in] top byte following the last byte to examine
+	 * @return the first non-zero byte, or top if every byte in the range is zero
+	 */
+	MMINLINE uint8_t *
+	skipZeroBytes(uint8_t *current, uint8_t *top)
+	{
+		return _skipZeroBytes(current, top);
+	}
+
+	/**
+	 * Count the bits set in the slots [base, top), such as the marked objects in a range of the mark map.
+	 * @param[in] base first slot to count
+	 * @param[in] top slot following the last slot to count
+	 * @return the number of bits set
+	 */
+	MMINLINE uintptr_t
+	countBits(uintptr_t *base, uintptr_t *top)
+	{
+		return _countBits(base, top);
+	}
+
+	/**
+	 * Count the non-zero bytes in [base, top), such as the cards which are not CARD_CLEAN.
+	 * @param[in] base first byte to count
+	 * @param[in] top byte following the last byte to count
+	 * @return the number of non-zero bytes
+	 */
+	MMINLINE uintptr_t
+	countNonZeroBytes(uint8_t *base, uint8_t *top)
+	{
+		return _countNonZeroBytes(base, top);
+	}
+
+	/**
+	 * Create a scanner which uses the scalar implementation until it is initialized.
+	 */
+	MM_BitmapScanner();
+};
+
+#endif /* BITMAPSCANNER_HPP_ */
@@ -29,6 +29,9 @@
 #include "ModronAssertions.h"
 #include "ObjectAllocationInterface.hpp"
 #include "OMRVMThreadListIterator.hpp"
+#include "ParallelDispatcher.hpp"
+#include "TaskThreadCountController.hpp"
+#include "TaskTimeline.hpp"
 
 class MM_MemorySubSpace;
 class MM_MemorySpace;
@@ -430,6 +433,16 @@ MM_Collector::postCollect(MM_EnvironmentBase* env, MM_MemorySubSpace* subSpace)
 
 	internalPostCollect(env, subSpace);
 
+	/* The cycle end has been reported, so the task timeline and thread count predictions can start on the next cycle */
+	MM_TaskTimeline *taskTimeline = extensions->dispatcher->getTaskTimeline();
+	if (NULL != taskTimeline) {
+		taskTimeline->cycleCompleted(env);
+	}
+	MM_TaskThreadCountController *threadCountController = extensions->dispatcher->getTaskThreadCountController();
+	if (NULL != threadCountController) {
+		threadCountController->resetCycle();
+	}
+
 	extensions->bytesAllocatedMost = 0;
 	extensions->vmThreadAllocatedMost = NULL;
 
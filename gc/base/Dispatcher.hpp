@@ -36,6 +36,8 @@
 
 class MM_EnvironmentBase;
 class MM_Task;
+class MM_TaskThreadCountController;
+class MM_TaskTimeline;
 
 /**
  * @todo Provide define documentation
@@ -78,6 +80,16 @@ public:
 	void run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount = UDATA_MAX);
 	virtual void reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThreadCount) {}
 
+	/**
+	 * @return the timeline recording per thread task timing, or NULL if -Xgc:taskTimeline is not enabled
+	 */
+	virtual MM_TaskTimeline *getTaskTimeline() { return NULL; }
+
+	/**
+	 * @return the controller choosing thread counts per task type, or NULL if -Xgc:adaptiveGCThreads is not enabled
+	 */
+	virtual MM_TaskThreadCountController *getTaskThreadCountController() { return NULL; }
+
 	/**
 	 * Create a Dispatcher object.
 	 */
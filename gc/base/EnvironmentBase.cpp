@@ -40,6 +40,8 @@
 #include "ModronAssertions.h"
 #include "OMRVMInterface.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "ParallelDispatcher.hpp"
+#include "TaskTimeline.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 #include "HeapRegionQueue.hpp"
@@ -464,6 +466,12 @@ MM_EnvironmentBase::releaseExclusiveVMAccessForGC()
 		omrthread_monitor_exit(extensions->gcExclusiveAccessMutex);
 		reportExclusiveAccessRelease();
 		_delegate.releaseExclusiveVMAccess();
+
+		/* The pause is over; write out the task timeline records of the collections it held */
+		MM_TaskTimeline *taskTimeline = (NULL != extensions->dispatcher) ? extensions->dispatcher->getTaskTimeline() : NULL;
+		if (NULL != taskTimeline) {
+			taskTimeline->flush(this);
+		}
 	}
 }
 
@@ -40,6 +40,7 @@
 #include "RootScannerStats.hpp"
 #include "ScavengerStats.hpp"
 #include "SweepStats.hpp"
+#include "TaskThreadStats.hpp"
 #include "WorkPacketStats.hpp"
 #include "WorkStack.hpp"
 
@@ -47,6 +48,7 @@ class MM_AllocationContext;
 class MM_AllocateDescription;
 class MM_Collector;
 class MM_HeapRegionQueue;
+class MM_LiveObjectCensusSketch;
 class MM_MemorySpace;
 class MM_ObjectAllocationInterface;
 class MM_SegregatedAllocationTracker;
@@ -144,6 +146,12 @@ public:
 
 	uint64_t _slaveThreadCpuTimeNanos;	/**< Total CPU time used by this slave thread (or 0 for non-slaves) */
 
+	MM_TaskThreadStats _taskThreadStats; /**< Timing of this thread over the task it is currently running, used by the task timeline */
+
+	MM_LiveObjectCensusSketch *_liveObjectCensusSketch; /**< Sketch this thread records live object census samples in */
+	uintptr_t _liveObjectCensusNumber; /**< Census _liveObjectCensusSketch was claimed for */
+	uintptr_t _liveObjectCensusCountdown; /**< Objects this thread scans before it takes the next census sample */
+
 	MM_FreeEntrySizeClassStats _freeEntrySizeClassStats;  /**< GC thread local statistics structure for heap free entry size (sizeClass) distribution */
 
 	uintptr_t _oolTraceAllocationBytes; /**< Tracks the bytes allocated since the last ool object trace */
@@ -651,6 +659,10 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_slaveThreadCpuTimeNanos(0)
+		,_taskThreadStats()
+		,_liveObjectCensusSketch(NULL)
+		,_liveObjectCensusNumber(0)
+		,_liveObjectCensusCountdown(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,approxScanCacheCount(0)
@@ -703,6 +715,10 @@ public:
 		,_failAllocOnExcessiveGC(false)
 		,_currentTask(NULL)
 		,_slaveThreadCpuTimeNanos(0)
+		,_taskThreadStats()
+		,_liveObjectCensusSketch(NULL)
+		,_liveObjectCensusNumber(0)
+		,_liveObjectCensusCountdown(0)
 		,_freeEntrySizeClassStats()
 		,_oolTraceAllocationBytes(0)
 		,approxScanCacheCount(0)
@@ -74,6 +74,8 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 
 	_omrVM = env->getOmrVM();
 
+	bitmapScanner.initialize(env->getPortLibrary());
+
 	if (compressObjectReferences()) {
 		heapCeiling = LOW_MEMORY_HEAP_CEILING; /* By default, compressed pointers builds run in the low 64GiB */
 	}
@@ -232,6 +234,12 @@ MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 	}
 #endif /* defined(OMR_GC_REALTIME) */
 
+	if (NULL != taskTimelineFileName) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrmem_free_memory(taskTimelineFileName);
+		taskTimelineFileName = NULL;
+	}
+
 	objectModel.tearDown(this);
 	mixedObjectModel.tearDown(this);
 	indexableObjectModel.tearDown(this);
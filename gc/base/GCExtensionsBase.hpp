@@ -33,6 +33,7 @@
 #include "AllocationStats.hpp"
 #include "ArrayObjectModel.hpp"
 #include "BaseVirtual.hpp"
+#include "BitmapScanner.hpp"
 #include "ExcessiveGCStats.hpp"
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
@@ -61,6 +62,7 @@ class MM_GlobalCollector;
 class MM_Heap;
 class MM_HeapMap;
 class MM_HeapRegionManager;
+class MM_LiveObjectCensus;
 
 class MM_InterRegionRememberedSet;
 class MM_MemoryManager;
@@ -70,6 +72,7 @@ class MM_ObjectMap;
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 class MM_ReferenceChainWalkerMarkMap;
 class MM_RememberedSetCardBucket;
+class MM_RememberedSetMap;
 #if defined(OMR_GC_REALTIME)
 class MM_RememberedSetSATB;
 #endif /* defined(OMR_GC_REALTIME) */
@@ -228,6 +231,7 @@ public:
 	GC_ObjectModel objectModel; /**< generic object model for mixed and indexable objects */
 	GC_MixedObjectModel mixedObjectModel; /**< object model for mixed objects */
 	GC_ArrayObjectModel indexableObjectModel; /**< object model for arrays */
+	MM_BitmapScanner bitmapScanner; /**< vectorized range skip and population routines for the mark map and card table (-Xgc:bitmapScan=) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_Scavenger *scavenger;
@@ -264,9 +268,11 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	bool transparentHugePages; /**< Set by -Xgc:transparentHugePages.  Advise default page heap memory to use transparent huge pages, keep GC metadata in default pages and release decommitted heap memory lazily (Linux only) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	MM_SublistPool rememberedSet;
+	MM_RememberedSetMap *rememberedSetMap; /**< Remembered objects that did not fit in rememberedSet, NULL unless scavengerRememberedSetMap is set */
 	uintptr_t oldHeapSizeOnLastGlobalGC;
 	uintptr_t freeOldHeapSizeOnLastGlobalGC;
 	float concurrentKickoffTenuringHeadroom; /**< percentage of free memory remaining in tenure heap. Used in conjunction with free memory to determine concurrent mark kickoff */
@@ -333,6 +339,8 @@ public:
 	const char* gcModeString;
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
+	bool splitFreeListLockFreeTLHCarving; /**< if true, MPSAOL carves mutator TLHs lock free from windows detached from the head of each split free list */
+	uintptr_t splitFreeListCarveWindowSize; /**< size of the windows used by splitFreeListLockFreeTLHCarving, 0 to derive it from tlhMaximumSize */
 	bool enableHybridMemoryPool;
 
 	bool largeObjectArea;
@@ -372,6 +380,9 @@ public:
 	uintptr_t heapContractionGCTimeThreshold; /**< min percentage of time spent in gc before contraction */
 	uintptr_t heapExpansionStabilizationCount; /**< GC count required before the heap is allowed to expand due to excessvie time after last heap expansion */
 	uintptr_t heapContractionStabilizationCount; /**< GC count required before the heap is allowed to contract due to excessvie time after last heap expansion */
+	bool heapResizePredictive; /**< if true, a flat heap is sized from forecast allocation rate and GC cost instead of the GC time ratio (-Xgc:heapResizePredictive) */
+	uintptr_t heapResizeTargetGCOverhead; /**< percentage of time the predictive heap sizing aims to spend in gc (-Xgc:heapResizeTargetGCOverhead=) */
+	uintptr_t heapResizeHysteresis; /**< percentage of the heap size the predictive target must move by before the heap expands; twice this before it contracts (-Xgc:heapResizeHysteresis=) */
 
 	float heapSizeStartupHintConservativeFactor; /**< Use only a fraction of hints stored in SC */
 	float heapSizeStartupHintWeightNewValue;		/**< Learn slowly by historic averaging of stored hints */	
@@ -379,6 +390,7 @@ public:
 
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool workStealingMark; /**< if true, stop-the-world marking hands off work packets through per-thread work stealing deques instead of the shared packet lists */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
@@ -436,11 +448,14 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool adaptiveGCThreads; /**< Enabled by -Xgc:adaptiveGCThreads.  Dispatch each task type with the thread count its measured parallel efficiency predicts to be fastest */
+	uintptr_t adaptiveGCThreadsProbeInterval; /**< Every this many dispatches of a task type run it with the full thread count to keep its model current */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
 		OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST = 0,
 		OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL,
+		OMR_GC_SCAVENGER_SCANORDERING_ADAPTIVE, /**< choose breadth first or hierarchical for each cycle from the copy/scan history of the previous cycle */
 	};
 	ScavengerScanOrdering scavengerScanOrdering; /**< scan ordering in Scavenger */
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -456,6 +471,11 @@ public:
 	bool scavengerEnabled;
 	bool scavengerRsoScanUnsafe;
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool scavengerNUMAAware; /**< if true, the survivor space is split per NUMA node and GC threads copy into memory of their own node first */
+	bool scavengerRememberedSetMap; /**< if true, remembered objects that do not fit in the remembered set list are recorded in a bitmap of old space instead of overflowing the remembered set (not used with concurrent scavenger) */
+	uintptr_t scavengerRememberedSetListMaxSize; /**< maximum size in bytes of the remembered set list when scavengerRememberedSetMap is set, 0 for no limit */
+	uintptr_t scavengerAdaptiveScanOrderingCopyScanPercent; /**< adaptive scan ordering goes hierarchical if slots copied were at least this percentage of slots scanned in the previous cycle */
+	uintptr_t scavengerAdaptiveScanOrderingStallPercent; /**< adaptive scan ordering goes breadth first if more than this percentage of GC threads were stalled on average in the previous cycle */
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool softwareRangeCheckReadBarrier; /**< enable software read barrier instead of hardware guarded loads when running with CS */
 	bool concurrentScavenger; /**< CS enabled/disabled flag */
@@ -529,6 +549,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactRegionPartitioned; /**< if true, parallel compaction evacuates and fixes up partitions of the heap balanced by live bytes rather than fixed size sub areas */
+	uintptr_t compactPartitionsPerThread; /**< number of partitions per GC thread for a region partitioned compaction */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -545,6 +567,9 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool cardCleaningPacing; /**< if true, delay concurrent card cleaning so that the cards left for final card cleaning stay under cardCleaningPacingBound */
+	uintptr_t cardCleaningPacingBound; /**< number of dirty cards final card cleaning is expected to find when card cleaning is paced */
+	uintptr_t cardCleaningPacingBudget; /**< final card cleaning time budget in microseconds used to tighten cardCleaningPacingBound (0 for no budget) */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -648,6 +673,12 @@ public:
 	uintptr_t allocationCacheInitialSize;
 	uintptr_t allocationCacheIncrementSize;
 	bool nonDeterministicSweep;
+	bool segregatedLazySweep; /**< If true, the segregated collector leaves small regions unswept and the allocation path sweeps them on demand */
+	bool segregatedGenerational; /**< If true, the segregated collector runs minor collects which only trace objects allocated since the previous collect */
+	uintptr_t segregatedMaxMinorCollects; /**< Maximum number of minor collects between two full marks of the segregated heap */
+	uintptr_t segregatedMinorMinimumFreeRatio; /**< Percentage of the heap that must be free after a minor collect, otherwise the next collect is a full mark */
+	char *sizeClassProfileOutput; /**< If set, small allocation sizes are histogrammed and the profile is written to this file at shutdown */
+	char *sizeClassProfileInput; /**< If set, the small size class table is derived at startup from the profile recorded in this file */
 /* OMR_GC_REALTIME (in for all) */
 
 	MM_ConfigurationOptions configurationOptions; /**< holds the options struct, used during startup for selecting a Configuration */
@@ -659,6 +690,20 @@ public:
 	bool verboseExtensions;
 	bool verboseNewFormat; /**< a flag, enabled by -XXgc:verboseNewFormat, to enable the new verbose GC format */
 	bool bufferedLogging; /**< Enabled by -Xgc:bufferedLogging.  Use buffered filestreams when writing logs (e.g. verbose:gc) to a file */
+	bool asyncLogging; /**< Enabled by -Xgc:asyncLogging.  Queue verbose:gc output in a ring buffer written to file by a dedicated thread */
+	uintptr_t asyncLoggingBufferSize; /**< Set by -Xgc:asyncLoggingBufferSize=.  Size of the ring buffer used by -Xgc:asyncLogging (rounded up to a power of two) */
+	enum VerboseFormat {
+		OMR_GC_VERBOSE_FORMAT_XML = 0, /**< stanzas as described by gc/verbose/schema.xsd */
+		OMR_GC_VERBOSE_FORMAT_JSON_LINES, /**< one JSON object per top level stanza, carrying the same elements and attributes */
+	};
+	VerboseFormat verboseFormat; /**< Set by -Xgc:verboseFormat=.  Output format given to the verbose:gc writer configured next */
+	bool taskTimeline; /**< Enabled by -Xgc:taskTimeline.  Record per thread timing of every dispatched task and report load imbalance per cycle */
+	char *taskTimelineFileName; /**< Set by -Xgc:taskTimelineFile=.  Also write a binary timeline of every dispatched task to this file */
+	bool liveObjectCensus; /**< Enabled by -Xgc:liveObjectCensus.  Sample the objects marked by global collects and report the types which dominate the live set */
+	uintptr_t liveObjectCensusSampleRate; /**< One in this many objects scanned by marking is sampled for the live object census */
+	uintptr_t liveObjectCensusTopK; /**< Number of types the live object census reports */
+	MM_LiveObjectCensus *objectCensus; /**< The live object census, owned by the marking scheme, or NULL */
+	uintptr_t allocationSamplingInterval; /**< Set by -Xgc:allocationSamplingInterval=.  Mean number of bytes a thread allocates between two J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED events, 0 to disable */
 
 	uintptr_t lowAllocationThreshold; /**< the lower bound of the allocation threshold range */
 	uintptr_t highAllocationThreshold; /**< the upper bound of the allocation threshold range */
@@ -1365,8 +1410,10 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
+		, transparentHugePages(false)
 #if defined(OMR_GC_MODRON_SCAVENGER)
 		, rememberedSet()
+		, rememberedSetMap(NULL)
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, freeOldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, concurrentKickoffTenuringHeadroom((float)0.02)
@@ -1417,6 +1464,8 @@ public:
 		, gcModeString(NULL)
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
+		, splitFreeListLockFreeTLHCarving(false)
+		, splitFreeListCarveWindowSize(0)
 		, enableHybridMemoryPool(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -1446,11 +1495,15 @@ public:
 		, heapContractionGCTimeThreshold(5)
 		, heapExpansionStabilizationCount(0)
 		, heapContractionStabilizationCount(3)
+		, heapResizePredictive(false)
+		, heapResizeTargetGCOverhead(8)
+		, heapResizeHysteresis(10)
 		, heapSizeStartupHintConservativeFactor((float)0.7)
 		, heapSizeStartupHintWeightNewValue((float)0.8)	
 		, useGCStartupHints(true)	
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
+		, workStealingMark(false)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
 		, rootScannerStatsEnabled(false)
@@ -1497,6 +1550,8 @@ public:
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
+		, adaptiveGCThreads(false)
+		, adaptiveGCThreadsProbeInterval(16)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
@@ -1513,6 +1568,11 @@ public:
 		, scavengerEnabled(false)
 		, scavengerRsoScanUnsafe(false)
 		, cacheListSplit(0)
+		, scavengerNUMAAware(false)
+		, scavengerRememberedSetMap(false)
+		, scavengerRememberedSetListMaxSize(64 * OMR_SCV_REMSET_SIZE)
+		, scavengerAdaptiveScanOrderingCopyScanPercent(40)
+		, scavengerAdaptiveScanOrderingStallPercent(25)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, softwareRangeCheckReadBarrier(false)
 		, concurrentScavenger(false)
@@ -1574,6 +1634,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactRegionPartitioned(false)
+		, compactPartitionsPerThread(4)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1588,6 +1650,9 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, cardCleaningPacing(false)
+		, cardCleaningPacingBound(4096)
+		, cardCleaningPacingBudget(0)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1666,12 +1731,28 @@ public:
 		, allocationCacheInitialSize(256)
 		, allocationCacheIncrementSize(256)
 		, nonDeterministicSweep(false)
+		, segregatedLazySweep(false)
+		, segregatedGenerational(false)
+		, segregatedMaxMinorCollects(16)
+		, segregatedMinorMinimumFreeRatio(10)
+		, sizeClassProfileOutput(NULL)
+		, sizeClassProfileInput(NULL)
 		, configuration(NULL)
 		, verboseGCManager(NULL)
 		, verbosegcCycleTime(1000)  /* by default metronome outputs verbosegc every 1sec */
 		, verboseExtensions(false)
 		, verboseNewFormat(true)
 		, bufferedLogging(false)
+		, asyncLogging(false)
+		, asyncLoggingBufferSize(1024 * 1024)
+		, verboseFormat(OMR_GC_VERBOSE_FORMAT_XML)
+		, taskTimeline(false)
+		, taskTimelineFileName(NULL)
+		, liveObjectCensus(false)
+		, liveObjectCensusSampleRate(64)
+		, liveObjectCensusTopK(10)
+		, objectCensus(NULL)
+		, allocationSamplingInterval(0)
 		, lowAllocationThreshold(UDATA_MAX)
 		, highAllocationThreshold(UDATA_MAX)
 		, disableInlineCacheForAllocationThreshold(false)
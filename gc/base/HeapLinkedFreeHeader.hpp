@@ -150,6 +150,22 @@ public:
 		_size += increment;
 	}
 
+	/**
+	 * Shrink this entry to the specified number of bytes, unless a concurrent caller
+	 * has already shrunk it further. Safe against any number of concurrent callers.
+	 */
+	MMINLINE void shrinkSizeAtomic(uintptr_t size)
+	{
+		uintptr_t oldSize = _size;
+		while (size < oldSize) {
+			uintptr_t seenSize = MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_size, oldSize, size);
+			if (seenSize == oldSize) {
+				break;
+			}
+			oldSize = seenSize;
+		}
+	}
+
 	/**
 	 * Return the address immediately following the free section
 	 * described by this header
@@ -131,6 +131,17 @@ MM_HeapMapIterator::nextObject()
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
 			_heapMapSlotValue = *_heapMapSlotCurrent;
+			if (J9MODRON_HMI_SLOT_EMPTY == _heapMapSlotValue) {
+				/* A run of empty slots - skip to the next marked slot covering the chunk in one go */
+				const uintptr_t heapSlotsPerMapSlot = J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * J9BITS_BITS_IN_SLOT;
+				uintptr_t mapSlotsToTop = ((uintptr_t)(_heapChunkTop - _heapSlotCurrent) + heapSlotsPerMapSlot - 1) / heapSlotsPerMapSlot;
+				uintptr_t *markedMapSlot = _extensions->bitmapScanner.skipEmptySlots(_heapMapSlotCurrent + 1, _heapMapSlotCurrent + mapSlotsToTop);
+				_heapSlotCurrent += heapSlotsPerMapSlot * (uintptr_t)(markedMapSlot - _heapMapSlotCurrent);
+				_heapMapSlotCurrent = markedMapSlot;
+				if(_heapSlotCurrent < _heapChunkTop) {
+					_heapMapSlotValue = *_heapMapSlotCurrent;
+				}
+			}
 		}
 	}
 
@@ -36,6 +36,7 @@
 #include "Heap.hpp"
 #include "MarkMap.hpp"
 #include "MarkingScheme.hpp"
+#include "ModronAssertions.h"
 #include "Task.hpp"
 #if defined(OMR_GC_REALTIME)
 #include "WorkPacketsSATB.hpp"
@@ -46,6 +47,7 @@
 #else
 #include "WorkPacketsStandard.hpp"
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#include "WorkPacketsStealing.hpp"
 
 /**
  * Allocate and initialize a new instance of the receiver.
@@ -96,6 +98,14 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	if (_extensions->liveObjectCensus) {
+		_liveObjectCensus = MM_LiveObjectCensus::newInstance(env);
+		if (NULL == _liveObjectCensus) {
+			goto error_no_memory;
+		}
+		_extensions->objectCensus = _liveObjectCensus;
+	}
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -117,6 +127,12 @@ MM_MarkingScheme::tearDown(MM_EnvironmentBase *env)
 		_workPackets->kill(env);
 		_workPackets = NULL;
 	}
+
+	if (NULL != _liveObjectCensus) {
+		_extensions->objectCensus = NULL;
+		_liveObjectCensus->kill(env);
+		_liveObjectCensus = NULL;
+	}
 }
 
 /**
@@ -321,13 +337,21 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t scanStartTime = omrtime_hires_clock();
+
 	do {
 		omrobjectptr_t objectPtr = NULL;
 		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
 			env->_markStats._bytesScanned += scanObject(env, objectPtr);
 			env->_markStats._objectsScanned += 1;
+			if (NULL != _liveObjectCensus) {
+				_liveObjectCensus->sampleObject(env, objectPtr);
+			}
 		}
 	} while (_workPackets->handleWorkPacketOverflow(env));
+
+	env->_markStats.addToScanTime(scanStartTime, omrtime_hires_clock());
 }
 
 /****************************************
@@ -392,6 +416,8 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 {
 	MM_WorkPackets *workPackets = NULL;
 	if (_extensions->isConcurrentMarkEnabled()) {
+		/* option parsing rejects workStealingMark with concurrent mark, mutator threads have no work stealing deque */
+		Assert_MM_false(_extensions->workStealingMark);
 		if (_extensions->configuration->isSnapshotAtTheBeginningBarrierEnabled()) {
 #if defined(OMR_GC_REALTIME)
 			MM_WorkPacketsSATB *workPacketsSATB = MM_WorkPacketsSATB::newInstance(env);
@@ -403,6 +429,8 @@ MM_MarkingScheme::createWorkPackets(MM_EnvironmentBase *env)
 			workPackets = MM_WorkPacketsConcurrent::newInstance(env);
 #endif /* defined OMR_GC_MODRON_CONCURRENT_MARK */
 		}
+	} else if (_extensions->workStealingMark) {
+		workPackets = MM_WorkPacketsStealing::newInstance(env);
 	} else {
 		workPackets = MM_WorkPacketsStandard::newInstance(env);
 	}
@@ -31,6 +31,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "LiveObjectCensus.hpp"
 #include "MarkingDelegate.hpp"
 #include "MarkMap.hpp"
 #include "ModronAssertions.h"
@@ -56,6 +57,7 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	MM_LiveObjectCensus *_liveObjectCensus; /**< Samples scanned objects if -Xgc:liveObjectCensus is enabled, otherwise NULL */
 
 public:
 
@@ -254,6 +256,9 @@ public:
 		env->_markStats._bytesScanned += sizeToDo;
 		if (SCAN_REASON_PACKET == reason) {
 			env->_markStats._objectsScanned += 1;
+			if (NULL != _liveObjectCensus) {
+				_liveObjectCensus->sampleObject(env, objectPtr);
+			}
 		}
 
 		return sizeToDo;
@@ -262,6 +267,7 @@ public:
 	MM_MarkingDelegate *getMarkingDelegate() { return &_delegate; }
 
 	MM_MarkMap *getMarkMap() { return _markMap; }
+	MM_LiveObjectCensus *getLiveObjectCensus() { return _liveObjectCensus; }
 	void setMarkMap(MM_MarkMap *markMap) { _markMap = markMap; }
 	
 	bool isMarkedOutline(omrobjectptr_t objectPtr);
@@ -308,6 +314,7 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _liveObjectCensus(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
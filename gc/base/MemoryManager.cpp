@@ -75,6 +75,11 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 
 	uintptr_t allocateSize = size;
 
+	if (extensions->transparentHugePages) {
+		/* back the heap with transparent huge pages and let the kernel reclaim contracted memory lazily (ignored for large pages) */
+		options |= OMRPORT_VMEM_ADVISE_HUGEPAGE | OMRPORT_VMEM_ADVISE_FREE_ON_DECOMMIT;
+	}
+
 	uintptr_t concurrentScavengerPageSize = 0;
 	if (extensions->isConcurrentScavengerHWSupported()) {
 		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
@@ -452,6 +457,11 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			uintptr_t mode = (OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE);
 			uintptr_t options = 0;
 
+			if (extensions->transparentHugePages) {
+				/* mark map, card table and other metadata are touched sparsely, a huge page would mostly hold untouched memory */
+				options |= OMRPORT_VMEM_ADVISE_NOHUGEPAGE;
+			}
+
 			uintptr_t pageSize = extensions->gcmetadataPageSize;
 			uintptr_t pageFlags = extensions->gcmetadataPageFlags;
 			Assert_MM_true(0 != pageSize);
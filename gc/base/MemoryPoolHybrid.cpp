@@ -258,7 +258,7 @@ retry:
 }
 
 bool
-MM_MemoryPoolHybrid::internalAllocateTLH(MM_EnvironmentBase* env, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop, bool lockingRequired, MM_LargeObjectAllocateStats* largeObjectAllocateStatsForFreeList)
+MM_MemoryPoolHybrid::internalAllocateTLH(MM_EnvironmentBase* env, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop, bool lockingRequired, MM_LargeObjectAllocateStats* largeObjectAllocateStatsForFreeList, uintptr_t* freeListIndex)
 {
 	bool const compressed = compressObjectReferences();
 	uintptr_t freeEntrySize = 0;
@@ -339,6 +339,9 @@ retry:
 
 	/* Update our current free list */
 	_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = curFreeList;
+	if (NULL != freeListIndex) {
+		*freeListIndex = curFreeList;
+	}
 
 	/* Consume the bytes and set the return pointer values */
 	Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
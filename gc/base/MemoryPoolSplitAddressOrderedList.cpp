@@ -73,6 +73,24 @@ MM_MemoryPoolSplitAddressOrderedList::newInstance(MM_EnvironmentBase* env, uintp
 	return memoryPool;
 }
 
+bool
+MM_MemoryPoolSplitAddressOrderedList::initialize(MM_EnvironmentBase* env)
+{
+	if (!MM_MemoryPoolSplitAddressOrderedListBase::initialize(env)) {
+		return false;
+	}
+
+	if (_extensions->splitFreeListLockFreeTLHCarving) {
+		_tlhCarveWindowSize = _extensions->splitFreeListCarveWindowSize;
+		if (0 == _tlhCarveWindowSize) {
+			/* large enough for a few maximum size TLHs between refills */
+			_tlhCarveWindowSize = 4 * _extensions->tlhMaximumSize;
+		}
+	}
+
+	return true;
+}
+
 /****************************************
  * Allocation
  ****************************************
@@ -299,7 +317,7 @@ skipSearch:
 }
 
 bool
-MM_MemoryPoolSplitAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase* env, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop, bool lockingRequired, MM_LargeObjectAllocateStats* largeObjectAllocateStatsForFreeList)
+MM_MemoryPoolSplitAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase* env, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop, bool lockingRequired, MM_LargeObjectAllocateStats* largeObjectAllocateStatsForFreeList, uintptr_t* freeListIndex)
 {
 	bool const compressed = compressObjectReferences();
 	uintptr_t freeEntrySize = 0;
@@ -403,6 +421,9 @@ skipSearch:
 
 	/* Update our current free list */
 	_currentThreadFreeList[env->getEnvironmentId() % _heapFreeListCount] = curFreeList;
+	if (NULL != freeListIndex) {
+		*freeListIndex = curFreeList;
+	}
 
 	/* Consume the bytes and set the return pointer values */
 	Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
@@ -659,6 +680,49 @@ MM_MemoryPoolSplitAddressOrderedList::postProcess(MM_EnvironmentBase* env, Cause
  * @todo check if this routine can eliminate any of the other similar routines.
  *
  */
+bool
+MM_MemoryPoolSplitAddressOrderedList::returnCarveWindowRemainder(MM_EnvironmentBase* env, void* addrBase, uintptr_t size, uintptr_t curFreeList)
+{
+	if (size < _minimumFreeEntrySize) {
+		return false;
+	}
+
+	bool const compressed = compressObjectReferences();
+	J9ModronFreeList* freeList = &_heapFreeLists[curFreeList];
+	MM_HeapLinkedFreeHeader* freeEntry = (MM_HeapLinkedFreeHeader*)addrBase;
+
+	freeList->_lock.acquire();
+	freeList->_timesLocked += 1;
+
+	/* Windows are detached from the front of the list, so the remainder usually goes back close to the head */
+	MM_HeapLinkedFreeHeader* previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader* nextFreeEntry = freeList->_freeList;
+	while ((NULL != nextFreeEntry) && (nextFreeEntry < freeEntry)) {
+		previousFreeEntry = nextFreeEntry;
+		nextFreeEntry = nextFreeEntry->getNext(compressed);
+	}
+
+	/* Turn the hole header at the base of the remainder into a free entry */
+	freeEntry->setNext(nextFreeEntry, compressed);
+	freeEntry->setSize(size);
+	setNextForFreeEntryInFreeList(freeList, previousFreeEntry, freeEntry);
+
+	/* The reserved free entry is identified by its predecessor, which is now the remainder */
+	if (isPreviousReservedFreeEntry(previousFreeEntry, curFreeList)) {
+		_previousReservedFreeEntry = freeEntry;
+	}
+
+	freeList->_freeSize += size;
+	freeList->_freeCount += 1;
+	_largeObjectAllocateStatsForFreeList[curFreeList].incrementFreeEntrySizeClassStats(size);
+	/* The hints only cover the entries that were in the list when they were taken */
+	freeList->clearHints();
+
+	freeList->_lock.release();
+
+	return true;
+}
+
 void
 MM_MemoryPoolSplitAddressOrderedList::expandWithRange(MM_EnvironmentBase* env, uintptr_t expandSize, void* lowAddress, void* highAddress, bool canCoalesce)
 {
@@ -821,6 +885,8 @@ MM_MemoryPoolSplitAddressOrderedList::contractWithRange(MM_EnvironmentBase* env,
 		return NULL;
 	}
 
+	invalidateCarveWindows();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	uintptr_t freeListIndex;
@@ -1078,6 +1144,8 @@ MM_MemoryPoolSplitAddressOrderedList::removeFreeEntriesWithinRange(MM_Environmen
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	invalidateCarveWindows();
+
 	/* Find the first free entry, if any, within specified range */
 	uintptr_t currentFreeListIndex;
 	previousFreeEntry = NULL;
@@ -45,6 +45,7 @@
 #include "MemoryPool.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "ObjectAllocationInterface.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "HeapRegionManager.hpp"
 #include "HeapLinkedFreeHeader.hpp"
@@ -113,6 +114,7 @@ void J9ModronFreeList::reset()
 	_freeCount = 0;
 	_timesLocked = 0;
 	clearHints();
+	invalidateCarveWindow();
 }
 
 bool
@@ -285,7 +287,19 @@ MM_MemoryPoolSplitAddressOrderedListBase::allocateTLH(MM_EnvironmentBase* env, M
 {
 	void* tlhBase = NULL;
 
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStatsForFreeList)) {
+	if (0 != _tlhCarveWindowSize) {
+		/* Lock free fast path: carve from the window of this thread's preferred free list */
+		J9ModronFreeList* freeList = &_heapFreeLists[env->getEnvironmentId() % _heapFreeListCount];
+		if (carveTLH(freeList, maximumSizeInBytesRequired, addrBase, addrTop)
+			|| refillCarveWindow(env, freeList, maximumSizeInBytesRequired, addrBase, addrTop)) {
+			tlhBase = addrBase;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+			env->_objectAllocationInterface->getAllocationStats()->_tlhCarvedCount += 1;
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+		}
+	}
+
+	if ((NULL == tlhBase) && internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStatsForFreeList, NULL)) {
 		tlhBase = addrBase;
 	}
 
@@ -308,7 +322,7 @@ MM_MemoryPoolSplitAddressOrderedListBase::collectorAllocateTLH(MM_EnvironmentBas
 														   void*& addrBase, void*& addrTop, bool lockingRequired)
 {
 	void* base = NULL;
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, lockingRequired, _largeObjectCollectorAllocateStatsForFreeList)) {
+	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, lockingRequired, _largeObjectCollectorAllocateStatsForFreeList, NULL)) {
 		base = addrBase;
 		allocDescription->setTLHAllocation(true);
 		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
@@ -317,6 +331,91 @@ MM_MemoryPoolSplitAddressOrderedListBase::collectorAllocateTLH(MM_EnvironmentBas
 	return base;
 }
 
+bool
+MM_MemoryPoolSplitAddressOrderedListBase::refillCarveWindow(MM_EnvironmentBase* env, J9ModronFreeList* freeList, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop)
+{
+	uint64_t window = freeList->_carveWindow;
+	if ((0 != (window & CARVE_WINDOW_REFILLING)) || ((window & CARVE_WINDOW_REMAINING_MASK) >= (2 * _minimumFreeEntrySize))) {
+		/* Another thread is refilling the window, or has just done so */
+		return false;
+	}
+	if (window != MM_AtomicOperations::lockCompareExchangeU64(&freeList->_carveWindow, window, window | CARVE_WINDOW_REFILLING)) {
+		return false;
+	}
+
+	/* No carve can start any more; wait for the carvers already in flight to be done with the hole header */
+	window |= CARVE_WINDOW_REFILLING;
+	while (0 != (window & CARVE_WINDOW_CARVERS_MASK)) {
+		MM_AtomicOperations::yieldCPU();
+		window = freeList->_carveWindow;
+	}
+	MM_AtomicOperations::readWriteBarrier();
+
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	MM_AllocationStats* stats = env->_objectAllocationInterface->getAllocationStats();
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+
+	/* Whatever was left of the previous window goes back to the free list it came from. If it cannot, it stays
+	 * behind as a hole recovered by the next sweep, and is counted as approximate free memory until then.
+	 */
+	uintptr_t remainderSize = (uintptr_t)(window & CARVE_WINDOW_REMAINING_MASK);
+	if (0 != remainderSize) {
+		if (returnCarveWindowRemainder(env, freeList->_carveBase, remainderSize, freeList->_carveFreeListIndex)) {
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+			stats->_tlhCarveWindowReturnedBytes += remainderSize;
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+		} else {
+			MM_AtomicOperations::add((volatile uintptr_t*)&_approximateFreeMemorySize, remainderSize);
+		}
+	}
+	uint64_t newWindow = (window & ~(CARVE_WINDOW_GENERATION_INCREMENT - 1)) + CARVE_WINDOW_GENERATION_INCREMENT;
+	bool carved = false;
+	void* windowBase = NULL;
+	void* windowTop = NULL;
+	uintptr_t windowFreeListIndex = 0;
+
+	/* The window is detached from the head of a split list through the locked path, which recycles the rest of the free entry.
+	 * Windows are larger than any TLH, so they are kept out of the TLH size class stats.
+	 */
+	if (internalAllocateTLH(env, OMR_MAX(_tlhCarveWindowSize, maximumSizeInBytesRequired), windowBase, windowTop, true, NULL, &windowFreeListIndex)) {
+		uintptr_t windowSize = (uintptr_t)windowTop - (uintptr_t)windowBase;
+		Assert_MM_true(windowSize <= CARVE_WINDOW_REMAINING_MASK);
+		if (windowSize < (2 * _minimumFreeEntrySize)) {
+			/* Too small to carve from while keeping the hole header: hand it all out */
+			addrBase = windowBase;
+			addrTop = windowTop;
+			carved = true;
+		} else {
+			MM_HeapLinkedFreeHeader::fillWithHoles(windowBase, windowSize, compressObjectReferences());
+			freeList->_carveBase = windowBase;
+			freeList->_carveFreeListIndex = windowFreeListIndex;
+			MM_AtomicOperations::writeBarrier();
+			newWindow |= (uint64_t)windowSize;
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+			stats->_tlhCarveWindowRefillCount += 1;
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+		}
+	}
+
+	uint64_t seenWindow = MM_AtomicOperations::lockCompareExchangeU64(&freeList->_carveWindow, window, newWindow);
+	Assert_MM_true(seenWindow == window);
+
+	if (!carved) {
+		carved = carveTLH(freeList, maximumSizeInBytesRequired, addrBase, addrTop);
+	}
+	return carved;
+}
+
+void
+MM_MemoryPoolSplitAddressOrderedListBase::invalidateCarveWindows()
+{
+	uintptr_t abandonedSize = 0;
+	for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
+		abandonedSize += _heapFreeLists[i].invalidateCarveWindow();
+	}
+	_approximateFreeMemorySize += abandonedSize;
+}
+
 /****************************************
  * Free list building
  ****************************************
@@ -722,6 +821,8 @@ void
 MM_MemoryPoolSplitAddressOrderedListBase::moveHeap(MM_EnvironmentBase* env, void* srcBase, void* srcTop, void* dstBase)
 {
 	bool const compressed = compressObjectReferences();
+
+	invalidateCarveWindows();
 	for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
 		MM_HeapLinkedFreeHeader* currentFreeEntry, *previousFreeEntry;
 
@@ -827,6 +928,22 @@ MM_MemoryPoolSplitAddressOrderedListBase::getActualFreeMemorySize()
 	return result;
 }
 
+/**
+ * The approximate free memory also includes the bytes of the carve windows which have not been carved yet:
+ * they were removed from the free lists when the windows were detached, but are still free.
+ */
+uintptr_t
+MM_MemoryPoolSplitAddressOrderedListBase::getApproximateFreeMemorySize()
+{
+	uintptr_t result = MM_MemoryPool::getApproximateFreeMemorySize();
+	if (0 != _tlhCarveWindowSize) {
+		for (uintptr_t i = 0; i < _heapFreeListCount; ++i) {
+			result += (uintptr_t)(_heapFreeLists[i]._carveWindow & CARVE_WINDOW_REMAINING_MASK);
+		}
+	}
+	return result;
+}
+
 uintptr_t
 MM_MemoryPoolSplitAddressOrderedListBase::getActualFreeEntryCount()
 {
@@ -32,6 +32,7 @@
 #include "omrcfg.h"
 #include "modronopt.h"
 
+#include "AtomicOperations.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
@@ -39,6 +40,18 @@
 
 class MM_AllocateDescription;
 
+/*
+ * Layout of J9ModronFreeList::_carveWindow: a generation in the top 16 bits (bumped every time the
+ * window is replaced or invalidated, so a stale carve can never succeed), a refill in progress flag,
+ * the number of carvers still updating the hole header at the window base, and the number of bytes
+ * of the window which have not been carved yet.
+ */
+#define CARVE_WINDOW_GENERATION_INCREMENT ((uint64_t)1 << 48)
+#define CARVE_WINDOW_REFILLING ((uint64_t)1 << 47)
+#define CARVE_WINDOW_CARVER_INCREMENT ((uint64_t)1 << 40)
+#define CARVE_WINDOW_CARVERS_MASK (CARVE_WINDOW_REFILLING - CARVE_WINDOW_CARVER_INCREMENT)
+#define CARVE_WINDOW_REMAINING_MASK (CARVE_WINDOW_CARVER_INCREMENT - 1)
+
 class J9ModronFreeList {
 public:
 	MM_LightweightNonReentrantLock _lock;
@@ -54,12 +67,31 @@ public:
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
 
+	/* Lock free TLH carving support */
+	volatile uint64_t _carveWindow; /**< generation, refill flag, carvers in flight and remaining bytes of the window mutator TLHs are carved from (see CARVE_WINDOW_*) */
+	void* _carveBase; /**< base of the carve window; the part not carved yet is kept walkable as a hole starting here */
+	uintptr_t _carveFreeListIndex; /**< index of the split free list the carve window was detached from */
+
 	bool initialize(MM_EnvironmentBase* env);
 	void tearDown();
 
 	void clearHints();
 	void reset();
 
+	/**
+	 * Drop the carve window so that no further TLH can be carved from it. The part of the window
+	 * which was not carved yet stays a hole in the heap until the next sweep.
+	 * Must only be called while mutators cannot be allocating (e.g. under exclusive access).
+	 *
+	 * @return the number of bytes of the window which had not been carved
+	 */
+	MMINLINE uintptr_t invalidateCarveWindow()
+	{
+		uint64_t window = _carveWindow;
+		_carveWindow = (window & ~(CARVE_WINDOW_GENERATION_INCREMENT - 1)) + CARVE_WINDOW_GENERATION_INCREMENT;
+		return (uintptr_t)(window & CARVE_WINDOW_REMAINING_MASK);
+	}
+
 	MMINLINE void addHint(MM_HeapLinkedFreeHeader* freeEntry, uintptr_t lookupSize)
 	{
 		/* Travel the list removing any hints that this new hint will override */
@@ -245,6 +277,9 @@ public:
 		, _hintActive(NULL)
 		, _hintInactive(NULL)
 		, _hintLru(0)
+		, _carveWindow(0)
+		, _carveBase(NULL)
+		, _carveFreeListIndex(0)
 	{
 	}
 };
@@ -267,6 +302,8 @@ protected:
 
 	MM_LargeObjectAllocateStats* _largeObjectAllocateStatsForFreeList; /**< Approximate allocation profile for large objects. An array of stat structs for each free list */
 	MM_LargeObjectAllocateStats* _largeObjectCollectorAllocateStatsForFreeList; /**< Same as _largeObjectAllocateStatsForFreeList except specifically for collector allocates */
+
+	uintptr_t _tlhCarveWindowSize; /**< Size of the windows detached from the split free lists for lock free TLH carving, 0 if lock free carving is disabled for this pool */
 public:
 	/*
 	 * Function members
@@ -275,7 +312,18 @@ private:
 
 protected:
 	virtual void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats) = 0;
-	virtual bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats) = 0;
+	virtual bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats, uintptr_t *freeListIndex) = 0;
+
+	/**
+	 * Return the part of a retired carve window which was not carved to the split free list it was detached from.
+	 * No carver may still be updating the hole header at addrBase.
+	 *
+	 * @param[in] addrBase base of the part of the window not carved
+	 * @param[in] size size in bytes of the part of the window not carved
+	 * @param[in] curFreeList index of the split free list the window was detached from
+	 * @return true if the memory was returned to the free list, false if it stays a hole until the next sweep
+	 */
+	virtual bool returnCarveWindowRemainder(MM_EnvironmentBase* env, void* addrBase, uintptr_t size, uintptr_t curFreeList) { return false; }
 
 	bool recycleHeapChunk(MM_EnvironmentBase* env, void* addrBase, void* addrTop, MM_HeapLinkedFreeHeader* previousFreeEntry, MM_HeapLinkedFreeHeader* nextFreeEntry, uintptr_t curFreeList);
 
@@ -309,6 +357,67 @@ protected:
 		}
 	}
 
+	/**
+	 * Carve a mutator TLH from the top of the carve window of the given free list, without locking.
+	 * The bottom _minimumFreeEntrySize bytes of the window are never handed out, so that the part of the
+	 * window not carved yet is always described by the hole header at its base. Carvers are counted in
+	 * the window until they are done with that header.
+	 *
+	 * @param[in]  freeList the free list owning the window
+	 * @param[in]  maximumSizeInBytesRequired the largest TLH the caller wants
+	 * @param[out] addrBase base of the TLH carved
+	 * @param[out] addrTop top of the TLH carved
+	 * @return true if a TLH was carved, false if the window is exhausted or being refilled
+	 */
+	MMINLINE bool carveTLH(J9ModronFreeList* freeList, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop)
+	{
+		uint64_t window = freeList->_carveWindow;
+		while (0 == (window & CARVE_WINDOW_REFILLING)) {
+			uintptr_t remaining = (uintptr_t)(window & CARVE_WINDOW_REMAINING_MASK);
+			if ((remaining < (2 * _minimumFreeEntrySize)) || (CARVE_WINDOW_CARVERS_MASK == (window & CARVE_WINDOW_CARVERS_MASK))) {
+				break;
+			}
+			uintptr_t carvable = remaining - _minimumFreeEntrySize;
+			uintptr_t consumedSize = OMR_MIN(maximumSizeInBytesRequired, carvable);
+			/* If what would be left is too small to be carved later, hand it out */
+			if ((carvable - consumedSize) < _minimumFreeEntrySize) {
+				consumedSize = carvable;
+			}
+
+			/* The base is published before the window, and only changes once the window has changed */
+			MM_AtomicOperations::readBarrier();
+			uint8_t* windowBase = (uint8_t*)freeList->_carveBase;
+			uint64_t seenWindow = MM_AtomicOperations::lockCompareExchangeU64(&freeList->_carveWindow, window, window - consumedSize + CARVE_WINDOW_CARVER_INCREMENT);
+			if (seenWindow == window) {
+				addrTop = (void*)(windowBase + remaining);
+				addrBase = (void*)(windowBase + remaining - consumedSize);
+				MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(windowBase)->shrinkSizeAtomic(remaining - consumedSize);
+				/* Once no carver is in flight, the refill may hand the rest of the window back to the free list */
+				MM_AtomicOperations::readWriteBarrier();
+				MM_AtomicOperations::subtractU64(&freeList->_carveWindow, CARVE_WINDOW_CARVER_INCREMENT);
+				return true;
+			}
+			window = seenWindow;
+		}
+		return false;
+	}
+
+	/**
+	 * Replace the exhausted carve window of the given free list with a new one detached from the
+	 * split free lists through the locked path, and carve a TLH from it. Only one thread refills a
+	 * given window at a time; the others fall back to the locked path meanwhile. What is left of the
+	 * exhausted window is returned to the free list it was detached from.
+	 *
+	 * @return true if a TLH was carved, false if the caller should fall back to the locked path
+	 */
+	bool refillCarveWindow(MM_EnvironmentBase* env, J9ModronFreeList* freeList, uintptr_t maximumSizeInBytesRequired, void*& addrBase, void*& addrTop);
+
+	/**
+	 * Invalidate the carve windows of all free lists (see J9ModronFreeList::invalidateCarveWindow()).
+	 * The bytes they had not carved are counted as approximate free memory until the next sweep.
+	 */
+	void invalidateCarveWindows();
+
 	bool printFreeListValidity(MM_EnvironmentBase* env);
 public:
 	virtual void* allocateObject(MM_EnvironmentBase* env, MM_AllocateDescription* allocDescription);
@@ -367,6 +476,7 @@ public:
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase* env);
 
 	virtual uintptr_t getActualFreeMemorySize();
+	virtual uintptr_t getApproximateFreeMemorySize();
 	virtual uintptr_t getActualFreeEntryCount();
 
 	/**
@@ -380,6 +490,7 @@ public:
 		, _heapFreeLists(NULL)
 		, _largeObjectAllocateStatsForFreeList(NULL)
 		, _largeObjectCollectorAllocateStatsForFreeList(NULL)
+		, _tlhCarveWindowSize(0)
 	{
 	}
 
@@ -391,6 +502,7 @@ public:
 		, _heapFreeLists(NULL)
 		, _largeObjectAllocateStatsForFreeList(NULL)
 		, _largeObjectCollectorAllocateStatsForFreeList(NULL)
+		, _tlhCarveWindowSize(0)
 	{
 	}
 
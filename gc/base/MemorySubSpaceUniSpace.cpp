@@ -26,6 +26,8 @@
 #include "omrmodroncore.h"
 
 #include "AllocateDescription.hpp"
+#include "CollectionStatistics.hpp"
+#include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
 #include "GlobalCollector.hpp"
 #include "PhysicalSubArena.hpp"
@@ -82,6 +84,11 @@ MM_MemorySubSpaceUniSpace::performResize(MM_EnvironmentBase *env, MM_AllocateDes
 	} else if (_expansionSize != 0) {
 		resizeAmount = performExpand(env);
 	}
+
+	if (extensions->heapResizePredictive) {
+		/* The next interval between collections is measured from here */
+		extensions->heap->getResizeStats()->getForecast()->resizeCompleted(env, getApproximateActiveFreeMemorySize());
+	}
 	
 	env->popVMstate(oldVMState);
 
@@ -95,6 +102,13 @@ void
 MM_MemorySubSpaceUniSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool _systemGC)
 {
 	uintptr_t oldVMState = env->pushVMstate(OMRVMSTATE_GC_CHECK_RESIZE);
+	if (_extensions->heapResizePredictive) {
+		observeCollectionForPredictiveResize(env);
+		if (isPredictiveResizeActive(env)) {
+			/* Forecast even if the heap is resized for other reasons, so that verbose:gc can compare it with the next cycle */
+			calculatePredictiveTargetHeapSize(env);
+		}
+	}
 	if (!timeForHeapContract(env, allocDescription, _systemGC)) {
 		timeForHeapExpand(env, allocDescription);
 	}
@@ -294,11 +308,18 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	/* No need to shrink if we will not be above -Xmaxf after satisfying the allocate */
 	uintptr_t allocSize = allocDescription ? allocDescription->getBytesRequested() : 0;
 	
-	/* Are we spending too little time in GC ? */
-	bool ratioContract = checkForRatioContract(env);
-	
-	/* How much, if any, do we need to contract by ? */
-	_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	bool predictiveContract = isPredictiveResizeActive(env);
+	bool ratioContract = false;
+	if (predictiveContract) {
+		/* Would a smaller heap still meet the target GC overhead ? */
+		_contractionSize = calculatePredictiveContractSize(env, allocSize);
+	} else {
+		/* Are we spending too little time in GC ? */
+		ratioContract = checkForRatioContract(env);
+
+		/* How much, if any, do we need to contract by ? */
+		_contractionSize = calculateTargetContractSize(env, allocSize, ratioContract);
+	}
 	
 	if (_contractionSize == 0 ) {
 		Trc_MM_MemorySubSpaceUniSpace_timeForHeapContract_Exit3(env->getLanguageVMThread());
@@ -338,7 +359,9 @@ MM_MemorySubSpaceUniSpace::timeForHeapContract(MM_EnvironmentBase *env, MM_Alloc
 	 }	
 	
 	/* Remember reason for contraction for later */
-	if (ratioContract) {
+	if (predictiveContract) {
+		_extensions->heap->getResizeStats()->setLastContractReason(GC_OVERHEAD_FORECAST_LOW);
+	} else if (ratioContract) {
 		_extensions->heap->getResizeStats()->setLastContractReason(GC_RATIO_TOO_LOW);
 	} else {
 		_extensions->heap->getResizeStats()->setLastContractReason(FREE_SPACE_GREATER_MAXF);
@@ -395,31 +418,7 @@ MM_MemorySubSpaceUniSpace::calculateTargetContractSize(MM_EnvironmentBase *env,
 							
 				Trc_MM_MemorySubSpaceUniSpace_calculateTargetContractSize_Event1(env->getLanguageVMThread(), contractionSize);
 				
-				/* But we don't contract too quickly or by a trivial amount */	
-				uintptr_t maxContract = (uintptr_t)(currentHeapSize * _extensions->globalMaximumContraction);
-				uintptr_t minContract = (uintptr_t)(currentHeapSize * _extensions->globalMinimumContraction);
-				uintptr_t contractionGranule = _extensions->regionSize;
-				
-				/* If max contraction is less than a single region (minimum contraction granularity) round it up */
-				if (maxContract < contractionGranule) {
-					maxContract = contractionGranule;
-				} else {
-					maxContract = MM_Math::roundToCeiling(contractionGranule, maxContract);
-				}
-				
-				contractionSize = OMR_MIN(contractionSize, maxContract);
-				
-				/* We will contract in multiples of region size. Result may become zero */
-				contractionSize = MM_Math::roundToFloor(contractionGranule, contractionSize);
-				
-				/* Make sure contract is worthwhile, don't want to go to possible expense of a 
-				 * compact for a small contraction
-				 */
-				if (contractionSize < minContract) { 
-					contractionSize = 0;
-				}	
-				
-				Trc_MM_MemorySubSpaceUniSpace_calculateTargetContractSize_Event2(env->getLanguageVMThread(), contractionSize, maxContract);
+				contractionSize = limitContractionSize(env, currentHeapSize, contractionSize);
 			}
 		} else {
 			/* No need to contract as current free less than max */
@@ -431,6 +430,151 @@ MM_MemorySubSpaceUniSpace::calculateTargetContractSize(MM_EnvironmentBase *env,
 	return contractionSize;
 }	
 
+/**
+ * Limit a contraction so that we don't contract too quickly or by a trivial amount.
+ * The result is bounded by the heap maximum/minimum contraction sizes and rounded down to a multiple of the region size.
+ * @return the contraction size in bytes, which may be zero
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::limitContractionSize(MM_EnvironmentBase *env, uintptr_t currentHeapSize, uintptr_t contractionSize)
+{
+	uintptr_t maxContract = (uintptr_t)(currentHeapSize * _extensions->globalMaximumContraction);
+	uintptr_t minContract = (uintptr_t)(currentHeapSize * _extensions->globalMinimumContraction);
+	uintptr_t contractionGranule = _extensions->regionSize;
+	
+	/* If max contraction is less than a single region (minimum contraction granularity) round it up */
+	if (maxContract < contractionGranule) {
+		maxContract = contractionGranule;
+	} else {
+		maxContract = MM_Math::roundToCeiling(contractionGranule, maxContract);
+	}
+	
+	contractionSize = OMR_MIN(contractionSize, maxContract);
+	
+	/* We will contract in multiples of region size. Result may become zero */
+	contractionSize = MM_Math::roundToFloor(contractionGranule, contractionSize);
+	
+	/* Make sure contract is worthwhile, don't want to go to possible expense of a 
+	 * compact for a small contraction
+	 */
+	if (contractionSize < minContract) { 
+		contractionSize = 0;
+	}	
+	
+	Trc_MM_MemorySubSpaceUniSpace_calculateTargetContractSize_Event2(env->getLanguageVMThread(), contractionSize, maxContract);
+	return contractionSize;
+}
+
+/**
+ * Determine whether -Xgc:heapResizePredictive sizes this subspace.
+ * The model only describes the whole heap, so it is not used when the scavenger is enabled, and it falls back
+ * to the GC time ratio until it has measured an interval between collections.
+ * @return true if the forecast decides expansion and contraction
+ */
+bool
+MM_MemorySubSpaceUniSpace::isPredictiveResizeActive(MM_EnvironmentBase *env)
+{
+	return _extensions->heapResizePredictive
+		&& !_extensions->isScavengerEnabled()
+		&& _extensions->heap->getResizeStats()->getForecast()->isReady();
+}
+
+/**
+ * Feed the measurements of the collection in progress to the heap resize forecast.
+ * Must be called once the collection has freed memory and before resize decisions are made.
+ */
+void
+MM_MemorySubSpaceUniSpace::observeCollectionForPredictiveResize(MM_EnvironmentBase *env)
+{
+	if ((NULL != env->_cycleState) && (NULL != env->_cycleState->_collectionStatistics)) {
+		MM_CollectionStatistics *stats = env->_cycleState->_collectionStatistics;
+		uintptr_t gcCount = 0;
+#if defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME)
+		gcCount = _extensions->globalGCStats.gcCount;
+#endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
+		uintptr_t heapSize = getActiveMemorySize();
+		uintptr_t freeBytes = getApproximateActiveFreeMemorySize();
+		uintptr_t liveBytes = (heapSize > freeBytes) ? (heapSize - freeBytes) : 0;
+		_extensions->heap->getResizeStats()->getForecast()->observeCollection(env, gcCount, stats->_startTime, stats->_totalFreeHeapSize, liveBytes);
+	}
+}
+
+/**
+ * Calculate the heap size which meets -Xgc:heapResizeTargetGCOverhead= for the forecast allocation rate and GC cost.
+ * The result leaves at least -Xminf and at most -Xmaxf of the heap free for the current live data.
+ * @return the target heap size in bytes
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculatePredictiveTargetHeapSize(MM_EnvironmentBase *env)
+{
+	uintptr_t currentHeapSize = getActiveMemorySize();
+	uintptr_t currentFree = getApproximateActiveFreeMemorySize();
+	uintptr_t liveBytes = (currentHeapSize > currentFree) ? (currentHeapSize - currentFree) : 0;
+
+	uintptr_t minimumHeapSize = (liveBytes / (_extensions->heapFreeMinimumRatioDivisor - _extensions->heapFreeMinimumRatioMultiplier))
+								* _extensions->heapFreeMinimumRatioDivisor;
+	uintptr_t maximumHeapSize = UDATA_MAX;
+	if (_extensions->heapFreeMaximumRatioMultiplier < _extensions->heapFreeMaximumRatioDivisor) {
+		maximumHeapSize = (liveBytes / (_extensions->heapFreeMaximumRatioDivisor - _extensions->heapFreeMaximumRatioMultiplier))
+							* _extensions->heapFreeMaximumRatioDivisor;
+	}
+	maximumHeapSize = OMR_MAX(minimumHeapSize, maximumHeapSize);
+
+	return _extensions->heap->getResizeStats()->getForecast()->calculateTargetHeapSize(_extensions->heapResizeTargetGCOverhead, minimumHeapSize, maximumHeapSize);
+}
+
+/**
+ * Determine how much to expand by so that the forecast GC overhead meets the target.
+ * The heap expands only if the target is more than -Xgc:heapResizeHysteresis= percent above the current size.
+ * @return the expansion size in bytes, or 0
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculatePredictiveExpandSize(MM_EnvironmentBase *env)
+{
+	uintptr_t currentHeapSize = getActiveMemorySize();
+	uintptr_t targetHeapSize = calculatePredictiveTargetHeapSize(env);
+	uintptr_t expandSize = 0;
+
+	if (targetHeapSize > currentHeapSize) {
+		uintptr_t band = (currentHeapSize / 100) * _extensions->heapResizeHysteresis;
+		if ((targetHeapSize - currentHeapSize) > band) {
+			expandSize = MM_Math::roundToCeiling(_extensions->heapAlignment, targetHeapSize - currentHeapSize);
+		}
+	}
+
+	return expandSize;
+}
+
+/**
+ * Determine how much to contract by so that the forecast GC overhead stays near the target.
+ * The heap contracts if the target is more than twice -Xgc:heapResizeHysteresis= percent below the current size,
+ * or if more than -Xmaxf of the heap is free.
+ * @return the contraction size in bytes, or 0
+ */
+uintptr_t
+MM_MemorySubSpaceUniSpace::calculatePredictiveContractSize(MM_EnvironmentBase *env, uintptr_t allocSize)
+{
+	uintptr_t contractionSize = 0;
+
+	/* If there is not enough memory to satisfy the alloc, don't contract */
+	if (allocSize <= getApproximateActiveFreeMemorySize()) {
+		uintptr_t currentFree = getApproximateActiveFreeMemorySize() - allocSize;
+		uintptr_t currentHeapSize = getActiveMemorySize();
+		uintptr_t targetHeapSize = calculatePredictiveTargetHeapSize(env);
+		uintptr_t maximumFree = (currentHeapSize / _extensions->heapFreeMaximumRatioDivisor) * (_extensions->heapFreeMaximumRatioMultiplier + 1);
+
+		if (targetHeapSize < currentHeapSize) {
+			uintptr_t band = (currentHeapSize / 100) * (2 * _extensions->heapResizeHysteresis);
+			if (((currentHeapSize - targetHeapSize) > band) || (currentFree > maximumFree)) {
+				/* Note: PSA code will ensure we do not drop below initial heap size */
+				contractionSize = limitContractionSize(env, currentHeapSize, currentHeapSize - targetHeapSize);
+			}
+		}
+	}
+
+	return contractionSize;
+}
+
 
 /**
  * Determine how much space we need to expand the heap by on this GC cycle to meet the users specified -Xminf amount
@@ -463,18 +607,24 @@ MM_MemorySubSpaceUniSpace::calculateExpandSize(MM_EnvironmentBase *env, uintptr_
 			gcCount = _extensions->globalGCStats.gcCount;
 #endif /* defined(OMR_GC_MODRON_STANDARD) || defined(OMR_GC_REALTIME) */
 			if (_extensions->heap->getResizeStats()->getLastHeapExpansionGCCount() + _extensions->heapExpansionStabilizationCount <= gcCount ) {
-				/* Determine if its time for a ratio expand ? */
-				expandSize = checkForRatioExpand(env,bytesRequired);
+				if (isPredictiveResizeActive(env)) {
+					/* Is the heap too small to meet the target GC overhead ? */
+					expandSize = calculatePredictiveExpandSize(env);
+					if (expandSize > 0) {
+						_extensions->heap->getResizeStats()->setLastExpandReason(GC_OVERHEAD_FORECAST_HIGH);
+					}
+				} else {
+					/* Determine if its time for a ratio expand ? */
+					expandSize = checkForRatioExpand(env,bytesRequired);
+					if (expandSize > 0) {
+						/* Remember reason for expansion for later */
+						_extensions->heap->getResizeStats()->setLastExpandReason(GC_RATIO_TOO_HIGH);
+					}
+				}
 			}
 		} else {
 			Assert_MM_unimplemented();
 		}
-
-
-		if (expandSize > 0 ) {
-			/* Remember reason for expansion for later */
-			_extensions->heap->getResizeStats()->setLastExpandReason(GC_RATIO_TOO_HIGH);
-		} 
 	} else {
 		/* Calculate how much we need to expand the heap by in order to meet the 
 		 * allocation request and the desired -Xminf amount AFTER expansion 
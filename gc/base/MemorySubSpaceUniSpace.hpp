@@ -54,6 +54,13 @@ protected:
 	uintptr_t performExpand(MM_EnvironmentBase *env);
 	uintptr_t performContract(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
 
+	bool isPredictiveResizeActive(MM_EnvironmentBase *env);
+	void observeCollectionForPredictiveResize(MM_EnvironmentBase *env);
+	uintptr_t calculatePredictiveTargetHeapSize(MM_EnvironmentBase *env);
+	uintptr_t calculatePredictiveExpandSize(MM_EnvironmentBase *env);
+	uintptr_t calculatePredictiveContractSize(MM_EnvironmentBase *env, uintptr_t allocSize);
+	uintptr_t limitContractionSize(MM_EnvironmentBase *env, uintptr_t currentHeapSize, uintptr_t contractionSize);
+
 public:
 	virtual void checkResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL, bool _systemGC = false);
 	virtual intptr_t performResize(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription = NULL);
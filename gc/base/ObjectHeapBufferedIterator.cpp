@@ -21,6 +21,8 @@
  *******************************************************************************/
 
 
+#include <string.h>
+
 #include "ModronAssertions.h"
 
 #include "GCExtensionsBase.hpp"
@@ -77,10 +79,46 @@ GC_ObjectHeapBufferedIterator::nextObject()
 	}
 
 	omrobjectptr_t next = _cache[_cacheIndex];
+	if ((_cacheIndex + PREFETCH_DISTANCE) < _cacheCount) {
+		prefetchObject(_cache[_cacheIndex + PREFETCH_DISTANCE]);
+	}
 	_cacheIndex++;
 	return next;
 }
 
+uintptr_t
+GC_ObjectHeapBufferedIterator::nextObjects(omrobjectptr_t *objects, uintptr_t maxCount)
+{
+	uintptr_t count = 0;
+
+	if (0 != _cacheCount) {
+		/* Hand out whatever is left in the cache before populating the batch directly */
+		count = OMR_MIN(_cacheCount - _cacheIndex, maxCount);
+		memcpy(objects, &_cache[_cacheIndex], count * sizeof(omrobjectptr_t));
+		_cacheIndex += count;
+
+		/* Only populate the batch directly once the cache is drained (count < maxCount). If the cache still
+		 * holds objects, the batch is already full and the next nextObject() call resumes from _cacheIndex;
+		 * otherwise _cacheIndex == _cacheCount and the next nextObject() call repopulates the cache.
+		 */
+		while (count < maxCount) {
+			uintptr_t populated = _populator->populateObjectHeapBufferedIteratorCache(objects + count, maxCount - count, &_state);
+			if (0 == populated) {
+				_cacheCount = 0;
+				break;
+			}
+			count += populated;
+		}
+
+		uintptr_t prefetchCount = OMR_MIN(count, (uintptr_t)PREFETCH_DISTANCE);
+		for (uintptr_t i = 0; i < prefetchCount; i++) {
+			prefetchObject(objects[i]);
+		}
+	}
+
+	return count;
+}
+
 const MM_ObjectHeapBufferedIteratorPopulator*
 GC_ObjectHeapBufferedIterator::getPopulator()
 {
@@ -47,6 +47,16 @@ typedef struct GC_ObjectHeapBufferedIteratorState {
 	uintptr_t data4;
 } GC_ObjectHeapBufferedIteratorState;
 
+/**
+ * Hint the processor to start loading the cache line holding the given address.
+ * Compiles to nothing on compilers with no prefetch intrinsic.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define OMR_GC_PREFETCH_FOR_READ(address) __builtin_prefetch((const void *)(address), 0, 3)
+#else /* defined(__GNUC__) || defined(__clang__) */
+#define OMR_GC_PREFETCH_FOR_READ(address)
+#endif /* defined(__GNUC__) || defined(__clang__) */
+
 class GC_ObjectHeapBufferedIterator
 {
 /* Data Members */
@@ -58,6 +68,10 @@ private:
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedListPopulator _segregatedListPopulator;
 #endif /* OMR_GC_SEGREGATED_HEAP */
+public:
+	enum {
+		PREFETCH_DISTANCE = 8 /**< how many objects ahead of the one being returned the iterator prefetches */
+	};
 protected:
 	enum {
 		CACHE_SIZE = 256
@@ -80,6 +94,29 @@ public:
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	GC_ObjectHeapBufferedIterator(MM_GCExtensionsBase *extensions, MM_HeapRegionDescriptor *region, void *base, void *top, bool includeDeadObjects = false, uintptr_t maxElementsToCache = CACHE_SIZE);
 	omrobjectptr_t nextObject();
+
+	/**
+	 * Fetch the next batch of objects. The batch is populated directly rather than through the
+	 * iterator's cache, so it can be as large as the caller likes, and the headers of the first
+	 * PREFETCH_DISTANCE objects are prefetched. Callers should prefetch further objects with
+	 * prefetchObject() as they work through the batch.
+	 * Batches may be freely mixed with nextObject() calls.
+	 *
+	 * @param[out] objects the array to be filled with object pointers
+	 * @param[in] maxCount the capacity of objects
+	 * @return the number of objects in the batch, or 0 if the iteration is finished
+	 */
+	uintptr_t nextObjects(omrobjectptr_t *objects, uintptr_t maxCount);
+
+	/**
+	 * Prefetch the header of an object about to be visited.
+	 * @param[in] object the object to prefetch
+	 */
+	MMINLINE static void prefetchObject(omrobjectptr_t object)
+	{
+		OMR_GC_PREFETCH_FOR_READ(object);
+	}
+
 	void advance(uintptr_t sizeInBytes);
 	void reset(uintptr_t *base, uintptr_t *top);
 };
@@ -297,6 +297,33 @@ public:
 		return _delegate.initializeAllocation(env, allocatedBytes, allocateInitialization);
 	}
 
+	/**
+	 * Identify the type of an object for the live object census.
+	 *
+	 * @param[in] objectPtr points to the object
+	 * @return the non-zero type key of the object
+	 */
+	MMINLINE uintptr_t
+	getObjectTypeForCensus(omrobjectptr_t objectPtr)
+	{
+		return _delegate.getObjectTypeForCensus(objectPtr);
+	}
+
+	/**
+	 * Describe a type returned by getObjectTypeForCensus().
+	 *
+	 * @param[in] env points to the environment for the calling thread
+	 * @param[in] type the type key
+	 * @param[out] buffer receives the type name if the name must be formatted
+	 * @param[in] bufferLength size of buffer
+	 * @return the type name
+	 */
+	MMINLINE const char *
+	getObjectTypeNameForCensus(MM_EnvironmentBase *env, uintptr_t type, char *buffer, uintptr_t bufferLength)
+	{
+		return _delegate.getObjectTypeNameForCensus(env, type, buffer, bufferLength);
+	}
+
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	/**
 	 * Calculate the actual object size and the size adjusted to object alignment. The calculated object size
@@ -221,6 +221,16 @@ MM_ParallelDispatcher::kill(MM_EnvironmentBase *env)
 		_synchronizeMutex = NULL;
 	}
 
+	if (NULL != _threadCountController) {
+		_threadCountController->kill(env);
+		_threadCountController = NULL;
+	}
+
+	if (NULL != _taskTimeline) {
+		_taskTimeline->kill(env);
+		_taskTimeline = NULL;
+	}
+
 	if(_taskTable) {
 		forge->free(_taskTable);
 		_taskTable = NULL;
@@ -270,6 +280,21 @@ MM_ParallelDispatcher::initialize(MM_EnvironmentBase *env)
 	}
 	memset(_taskTable, 0, _threadCountMaximum * sizeof(MM_Task *));
 
+	/* The adaptive thread count learns from the same per thread timing */
+	if (_extensions->taskTimeline || _extensions->adaptiveGCThreads) {
+		_taskTimeline = MM_TaskTimeline::newInstance(env, _threadCountMaximum);
+		if (NULL == _taskTimeline) {
+			goto error_no_memory;
+		}
+	}
+
+	if (_extensions->adaptiveGCThreads) {
+		_threadCountController = MM_TaskThreadCountController::newInstance(env);
+		if (NULL == _threadCountController) {
+			goto error_no_memory;
+		}
+	}
+
 	return true;
 
 error_no_memory:
@@ -428,6 +453,11 @@ MM_ParallelDispatcher::recomputeActiveThreadCountForTask(MM_EnvironmentBase *env
 	 * available and ready to run).
 	 */
 	uintptr_t taskActiveThreadCount = OMR_MIN(_activeThreadCount, threadCount);
+
+	/* Only tasks left to the dispatcher's choice are adapted, explicit counts are obeyed as they are */
+	if ((NULL != _threadCountController) && (UDATA_MAX == threadCount) && !_extensions->isMetronomeGC()) {
+		taskActiveThreadCount = _threadCountController->getThreadCount(env, task, taskActiveThreadCount);
+	}
 	task->setThreadCount(taskActiveThreadCount);
  	return taskActiveThreadCount;
 }
@@ -474,6 +504,10 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 	_slaveThreadsReservedForGC = true; 
 
 	task->setSynchronizeMutex(_synchronizeMutex);
+
+	if (NULL != _taskTimeline) {
+		_taskTimeline->taskDispatched(task, threadCount);
+	}
 	
 	for(uintptr_t index=0; index < threadCount; index++) {
 		_statusTable[index] = slave_status_reserved;
@@ -492,6 +526,10 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 	_statusTable[slaveID] = slave_status_active;
 	env->_currentTask = _taskTable[slaveID];
 
+	if (NULL != _taskTimeline) {
+		_taskTimeline->threadStarted(env);
+	}
+
 	env->_currentTask->accept(env);
 }
 
@@ -505,12 +543,24 @@ MM_ParallelDispatcher::completeTask(MM_EnvironmentBase *env)
 	env->_currentTask = NULL;
 	_taskTable[slaveID] = NULL;
 
+	if (NULL != _taskTimeline) {
+		_taskTimeline->threadCompleted(env);
+	}
+
 	currentTask->complete(env);
 }
 
 void
 MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 {
+	/* All threads have completed the task, so their timing is final */
+	if (NULL != _taskTimeline) {
+		_taskTimeline->taskCompleted(env);
+		if (NULL != _threadCountController) {
+			_threadCountController->taskCompleted(env, _taskTimeline->getLastDispatch());
+		}
+	}
+
 	omrthread_monitor_enter(_slaveThreadMutex);
 	
 	_slaveThreadsReservedForGC = false;
@@ -37,6 +37,8 @@
 #include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "TaskThreadCountController.hpp"
+#include "TaskTimeline.hpp"
 
 class MM_EnvironmentBase;
 
@@ -81,6 +83,9 @@ protected:
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
 
+	MM_TaskTimeline *_taskTimeline; /**< Per thread task timing, if -Xgc:taskTimeline or -Xgc:adaptiveGCThreads is enabled */
+	MM_TaskThreadCountController *_threadCountController; /**< Thread count per task type, if -Xgc:adaptiveGCThreads is enabled */
+
 public:
 
 	/*
@@ -132,6 +137,9 @@ public:
 
 	virtual void reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThreadCount);
 
+	virtual MM_TaskTimeline *getTaskTimeline() { return _taskTimeline; }
+	virtual MM_TaskThreadCountController *getTaskThreadCountController() { return _threadCountController; }
+
 	MM_ParallelDispatcher(MM_EnvironmentBase *env, omrsig_handler_fn handler, void* handler_arg, uintptr_t defaultOSStackSize) :
 		MM_Dispatcher(env)
 		,_extensions(MM_GCExtensionsBase::getExtensions(env->getOmrVM()))
@@ -150,6 +158,8 @@ public:
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
+		,_taskTimeline(NULL)
+		,_threadCountController(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -33,6 +33,30 @@
 
 #include "ModronAssertions.h"
 
+/**
+ * Start timing a synchronization point for the task timeline.
+ * @return the start time, or 0 if the dispatcher has no task timeline
+ */
+static MMINLINE uint64_t
+startSyncStall(MM_EnvironmentBase *env)
+{
+	uint64_t startTime = 0;
+	if (NULL != env->getExtensions()->dispatcher->getTaskTimeline()) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		startTime = omrtime_hires_clock();
+	}
+	return startTime;
+}
+
+static MMINLINE void
+endSyncStall(MM_EnvironmentBase *env, uint64_t startTime)
+{
+	if (0 != startTime) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		env->_taskThreadStats.addToSyncStallTime(startTime, omrtime_hires_clock());
+	}
+}
+
 bool
 MM_ParallelTask::handleNextWorkUnit(MM_EnvironmentBase *env)
 {
@@ -77,6 +101,7 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 	env->_lastSyncPointReached = id;
 	
 	if(1 < _totalThreadCount) {
+		uint64_t stallStartTime = startSyncStall(env);
 		omrthread_monitor_enter(_synchronizeMutex);
 
 		/*check synchronization point*/
@@ -104,7 +129,7 @@ MM_ParallelTask::synchronizeGCThreads(MM_EnvironmentBase *env, const char *id)
 			} while(index == _synchronizeIndex);
 		}
 		omrthread_monitor_exit(_synchronizeMutex);
-
+		endSyncStall(env, stallStartTime);
 	}
 
 	Trc_MM_SynchronizeGCThreads_Exit(env->getLanguageVMThread());
@@ -114,12 +139,14 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, const char *id)
 {
 	bool isMasterThread = false;
+	uint64_t stallStartTime = 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseMaster_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
+		stallStartTime = startSyncStall(env);
 
 		omrthread_monitor_enter(_synchronizeMutex);
 
@@ -161,6 +188,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseMaster(MM_EnvironmentBase *env, c
 	}
 
 done:
+	endSyncStall(env, stallStartTime);
 	Trc_MM_SynchronizeGCThreadsAndReleaseMaster_Exit(env->getLanguageVMThread());
 	return isMasterThread;	
 }
@@ -169,12 +197,14 @@ bool
 MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *env, const char *id)
 {
 	bool isReleasedThread = false;
+	uint64_t stallStartTime = 0;
 
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Entry(env->getLanguageVMThread(), id);
 	env->_lastSyncPointReached = id;
 
 	if(1 < _totalThreadCount) {
 		volatile uintptr_t index = _synchronizeIndex;
+		stallStartTime = startSyncStall(env);
 		uintptr_t workUnitIndex = env->getWorkUnitIndex();
 
 		omrthread_monitor_enter(_synchronizeMutex);
@@ -208,6 +238,7 @@ MM_ParallelTask::synchronizeGCThreadsAndReleaseSingleThread(MM_EnvironmentBase *
 	}
 
 done:
+	endSyncStall(env, stallStartTime);
 	Trc_MM_SynchronizeGCThreadsAndReleaseSingleThread_Exit(env->getLanguageVMThread());
 	return isReleasedThread;
 }
@@ -37,7 +37,19 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCCOMPACTREGIONPARTITIONED "-Xgc:compactRegionPartitioned"
+#define OMR_XGCCOMPACTREGIONPARTITIONED_LENGTH 29
+#define OMR_XGCCOMPACTPARTITIONSPERTHREAD "-Xgc:compactPartitionsPerThread="
+#define OMR_XGCCOMPACTPARTITIONSPERTHREAD_LENGTH 32
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#define OMR_XGCCARDCLEANINGPACINGBOUND "-Xgc:cardCleaningPacingBound="
+#define OMR_XGCCARDCLEANINGPACINGBOUND_LENGTH 29
+#define OMR_XGCCARDCLEANINGPACINGBUDGET "-Xgc:cardCleaningPacingBudget="
+#define OMR_XGCCARDCLEANINGPACINGBUDGET_LENGTH 30
+#define OMR_XGCCARDCLEANINGPACING "-Xgc:cardCleaningPacing"
+#define OMR_XGCCARDCLEANINGPACING_LENGTH 23
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
@@ -48,6 +60,48 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE "-Xgc:asyncLoggingBufferSize="
+#define OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH 28
+#define OMR_XGCASYNC_LOGGING "-Xgc:asyncLogging"
+#define OMR_XGCASYNC_LOGGING_LENGTH 17
+#define OMR_XGCVERBOSE_FORMAT "-Xgc:verboseFormat="
+#define OMR_XGCVERBOSE_FORMAT_LENGTH 19
+#define OMR_XGCWORKSTEALINGMARK "-Xgc:workStealingMark"
+#define OMR_XGCWORKSTEALINGMARK_LENGTH 21
+#define OMR_XGCTASKTIMELINEFILE "-Xgc:taskTimelineFile="
+#define OMR_XGCTASKTIMELINEFILE_LENGTH 22
+#define OMR_XGCTASKTIMELINE "-Xgc:taskTimeline"
+#define OMR_XGCTASKTIMELINE_LENGTH 17
+#define OMR_XGCADAPTIVETHREADSPROBEINTERVAL "-Xgc:adaptiveGCThreadsProbeInterval="
+#define OMR_XGCADAPTIVETHREADSPROBEINTERVAL_LENGTH 36
+#define OMR_XGCADAPTIVETHREADS "-Xgc:adaptiveGCThreads"
+#define OMR_XGCADAPTIVETHREADS_LENGTH 22
+#define OMR_XGCLIVEOBJECTCENSUSSAMPLERATE "-Xgc:liveObjectCensusSampleRate="
+#define OMR_XGCLIVEOBJECTCENSUSSAMPLERATE_LENGTH 32
+#define OMR_XGCLIVEOBJECTCENSUSTOPK "-Xgc:liveObjectCensusTopK="
+#define OMR_XGCLIVEOBJECTCENSUSTOPK_LENGTH 26
+#define OMR_XGCLIVEOBJECTCENSUS "-Xgc:liveObjectCensus"
+#define OMR_XGCLIVEOBJECTCENSUS_LENGTH 21
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL "-Xgc:allocationSamplingInterval="
+#define OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH 32
+#define OMR_XGCHEAPRESIZETARGETGCOVERHEAD "-Xgc:heapResizeTargetGCOverhead="
+#define OMR_XGCHEAPRESIZETARGETGCOVERHEAD_LENGTH 32
+#define OMR_XGCHEAPRESIZEHYSTERESIS "-Xgc:heapResizeHysteresis="
+#define OMR_XGCHEAPRESIZEHYSTERESIS_LENGTH 26
+#define OMR_XGCHEAPRESIZEPREDICTIVE "-Xgc:heapResizePredictive"
+#define OMR_XGCHEAPRESIZEPREDICTIVE_LENGTH 25
+#define OMR_XGCTRANSPARENTHUGEPAGES "-Xgc:transparentHugePages"
+#define OMR_XGCTRANSPARENTHUGEPAGES_LENGTH 25
+#define OMR_XGCBITMAPSCAN "-Xgc:bitmapScan="
+#define OMR_XGCBITMAPSCAN_LENGTH 16
+#define OMR_XGCSCAVENGERREMEMBEREDSETMAP "-Xgc:scavengerRememberedSetMap"
+#define OMR_XGCSCAVENGERREMEMBEREDSETMAP_LENGTH 30
+#define OMR_XGCSCAVENGERREMEMBEREDSETLISTMAXSIZE "-Xgc:scavengerRememberedSetListMaxSize="
+#define OMR_XGCSCAVENGERREMEMBEREDSETLISTMAXSIZE_LENGTH 39
+#define OMR_XGCSPLITFREELISTLOCKFREETLHCARVING "-Xgc:splitFreeListLockFreeTLHCarving"
+#define OMR_XGCSPLITFREELISTLOCKFREETLHCARVING_LENGTH 36
+#define OMR_XGCSPLITFREELISTCARVEWINDOWSIZE "-Xgc:splitFreeListCarveWindowSize="
+#define OMR_XGCSPLITFREELISTCARVEWINDOWSIZE_LENGTH 34
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
 
@@ -178,6 +232,14 @@ MM_StartupManager::parseGcOptions(MM_GCExtensionsBase *extensions)
 		result = parseLanguageOptions(extensions);
 	}
 
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	if (result && extensions->workStealingMark && extensions->concurrentMark) {
+		/* mutator threads take part in concurrent marking and have no work stealing deque to push to */
+		omrtty_printf("Error parsing OMR GC options: -Xgc:workStealingMark is not supported with concurrent mark\n");
+		result = false;
+	}
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+
 	return result;
 }
 
@@ -263,8 +325,37 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->compactOnGlobalGC = 0;
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
+	} else if (0 == strncmp(option, OMR_XGCCOMPACTREGIONPARTITIONED, OMR_XGCCOMPACTREGIONPARTITIONED_LENGTH)) {
+		extensions->compactRegionPartitioned = true;
+	} else if (0 == strncmp(option, OMR_XGCCOMPACTPARTITIONSPERTHREAD, OMR_XGCCOMPACTPARTITIONSPERTHREAD_LENGTH)) {
+		uintptr_t partitionsPerThread = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCOMPACTPARTITIONSPERTHREAD_LENGTH, &partitionsPerThread)) || (0 == partitionsPerThread)) {
+			result = false;
+		} else {
+			extensions->compactPartitionsPerThread = partitionsPerThread;
+		}
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+	else if (0 == strncmp(option, OMR_XGCCARDCLEANINGPACINGBOUND, OMR_XGCCARDCLEANINGPACINGBOUND_LENGTH)) {
+		uintptr_t bound = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCCARDCLEANINGPACINGBOUND_LENGTH, &bound)) || (0 == bound)) {
+			result = false;
+		} else {
+			extensions->cardCleaningPacingBound = bound;
+		}
+	} else if (0 == strncmp(option, OMR_XGCCARDCLEANINGPACINGBUDGET, OMR_XGCCARDCLEANINGPACINGBUDGET_LENGTH)) {
+		/* a budget of 0 turns the budget off and leaves the bound as given */
+		uintptr_t budget = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCCARDCLEANINGPACINGBUDGET_LENGTH, &budget)) {
+			result = false;
+		} else {
+			extensions->cardCleaningPacingBudget = budget;
+		}
+	} else if (0 == strncmp(option, OMR_XGCCARDCLEANINGPACING, OMR_XGCCARDCLEANINGPACING_LENGTH)) {
+		extensions->cardCleaningPacing = true;
+	}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
 		if (NULL == verboseFileName) {
@@ -276,6 +367,43 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING_BUFFER_SIZE, OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH)) {
+		uintptr_t bufferSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCASYNC_LOGGING_BUFFER_SIZE_LENGTH, &bufferSize) || (0 == bufferSize)) {
+			result = false;
+		} else {
+			extensions->asyncLoggingBufferSize = bufferSize;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCASYNC_LOGGING, OMR_XGCASYNC_LOGGING_LENGTH)) {
+		extensions->asyncLogging = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCVERBOSE_FORMAT, OMR_XGCVERBOSE_FORMAT_LENGTH)) {
+		const char *format = option + OMR_XGCVERBOSE_FORMAT_LENGTH;
+		if (0 == strcmp(format, "xml")) {
+			extensions->verboseFormat = MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_XML;
+		} else if (0 == strcmp(format, "json")) {
+			extensions->verboseFormat = MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES;
+		} else {
+			result = false;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCWORKSTEALINGMARK, OMR_XGCWORKSTEALINGMARK_LENGTH)) {
+		extensions->workStealingMark = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCTASKTIMELINEFILE, OMR_XGCTASKTIMELINEFILE_LENGTH)) {
+		/* freed by MM_GCExtensionsBase::tearDown() */
+		extensions->taskTimelineFileName = (char *) omrmem_allocate_memory(strlen(option + OMR_XGCTASKTIMELINEFILE_LENGTH) + 1, OMRMEM_CATEGORY_MM);
+		if (NULL == extensions->taskTimelineFileName) {
+			result = false;
+		} else {
+			strcpy(extensions->taskTimelineFileName, option + OMR_XGCTASKTIMELINEFILE_LENGTH);
+			extensions->taskTimeline = true;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCTASKTIMELINE, OMR_XGCTASKTIMELINE_LENGTH)) {
+		extensions->taskTimeline = true;
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -295,6 +423,92 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 			extensions->gcThreadCount = forcedThreadCount;
 			extensions->gcThreadCountForced = true;
 		}
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVETHREADSPROBEINTERVAL, OMR_XGCADAPTIVETHREADSPROBEINTERVAL_LENGTH)) {
+		uintptr_t probeInterval = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCADAPTIVETHREADSPROBEINTERVAL_LENGTH, &probeInterval)) || (0 == probeInterval)) {
+			result = false;
+		} else {
+			extensions->adaptiveGCThreadsProbeInterval = probeInterval;
+		}
+	} else if (0 == strncmp(option, OMR_XGCADAPTIVETHREADS, OMR_XGCADAPTIVETHREADS_LENGTH)) {
+		extensions->adaptiveGCThreads = true;
+	} else if (0 == strncmp(option, OMR_XGCLIVEOBJECTCENSUSSAMPLERATE, OMR_XGCLIVEOBJECTCENSUSSAMPLERATE_LENGTH)) {
+		uintptr_t sampleRate = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCLIVEOBJECTCENSUSSAMPLERATE_LENGTH, &sampleRate)) || (0 == sampleRate)) {
+			result = false;
+		} else {
+			extensions->liveObjectCensusSampleRate = sampleRate;
+		}
+	} else if (0 == strncmp(option, OMR_XGCLIVEOBJECTCENSUSTOPK, OMR_XGCLIVEOBJECTCENSUSTOPK_LENGTH)) {
+		uintptr_t topK = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCLIVEOBJECTCENSUSTOPK_LENGTH, &topK)) || (0 == topK)) {
+			result = false;
+		} else {
+			extensions->liveObjectCensusTopK = topK;
+		}
+	} else if (0 == strncmp(option, OMR_XGCLIVEOBJECTCENSUS, OMR_XGCLIVEOBJECTCENSUS_LENGTH)) {
+		extensions->liveObjectCensus = true;
+	} else if (0 == strncmp(option, OMR_XGCALLOCATIONSAMPLINGINTERVAL, OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH)) {
+		uintptr_t interval = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATIONSAMPLINGINTERVAL_LENGTH, &interval)) {
+			result = false;
+		} else {
+			extensions->allocationSamplingInterval = interval;
+		}
+	} else if (0 == strncmp(option, OMR_XGCHEAPRESIZETARGETGCOVERHEAD, OMR_XGCHEAPRESIZETARGETGCOVERHEAD_LENGTH)) {
+		uintptr_t overhead = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAPRESIZETARGETGCOVERHEAD_LENGTH, &overhead)) || (0 == overhead) || (100 <= overhead)) {
+			result = false;
+		} else {
+			extensions->heapResizeTargetGCOverhead = overhead;
+		}
+	} else if (0 == strncmp(option, OMR_XGCHEAPRESIZEHYSTERESIS, OMR_XGCHEAPRESIZEHYSTERESIS_LENGTH)) {
+		uintptr_t hysteresis = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCHEAPRESIZEHYSTERESIS_LENGTH, &hysteresis)) || (50 <= hysteresis)) {
+			result = false;
+		} else {
+			extensions->heapResizeHysteresis = hysteresis;
+		}
+	} else if (0 == strncmp(option, OMR_XGCHEAPRESIZEPREDICTIVE, OMR_XGCHEAPRESIZEPREDICTIVE_LENGTH)) {
+		extensions->heapResizePredictive = true;
+	} else if (0 == strncmp(option, OMR_XGCTRANSPARENTHUGEPAGES, OMR_XGCTRANSPARENTHUGEPAGES_LENGTH)) {
+		extensions->transparentHugePages = true;
+	} else if (0 == strncmp(option, OMR_XGCBITMAPSCAN, OMR_XGCBITMAPSCAN_LENGTH)) {
+		const char *implementationName = option + OMR_XGCBITMAPSCAN_LENGTH;
+		MM_BitmapScanner::Implementation implementation = MM_BitmapScanner::SCAN_SCALAR;
+		if (0 == strcmp(implementationName, MM_BitmapScanner::getImplementationName(MM_BitmapScanner::SCAN_SCALAR))) {
+			implementation = MM_BitmapScanner::SCAN_SCALAR;
+		} else if (0 == strcmp(implementationName, MM_BitmapScanner::getImplementationName(MM_BitmapScanner::SCAN_SSE2))) {
+			implementation = MM_BitmapScanner::SCAN_SSE2;
+		} else if (0 == strcmp(implementationName, MM_BitmapScanner::getImplementationName(MM_BitmapScanner::SCAN_AVX2))) {
+			implementation = MM_BitmapScanner::SCAN_AVX2;
+		} else {
+			result = false;
+		}
+		if (result) {
+			/* an implementation the processor does not support is capped at the most capable one it does */
+			extensions->bitmapScanner.setImplementation(OMR_MIN(implementation, extensions->bitmapScanner.getSupportedImplementation()));
+		}
+	} else if (0 == strncmp(option, OMR_XGCSPLITFREELISTLOCKFREETLHCARVING, OMR_XGCSPLITFREELISTLOCKFREETLHCARVING_LENGTH)) {
+		extensions->splitFreeListLockFreeTLHCarving = true;
+	} else if (0 == strncmp(option, OMR_XGCSPLITFREELISTCARVEWINDOWSIZE, OMR_XGCSPLITFREELISTCARVEWINDOWSIZE_LENGTH)) {
+		uintptr_t windowSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCSPLITFREELISTCARVEWINDOWSIZE_LENGTH, &windowSize) || (0 == windowSize)) {
+			result = false;
+		} else {
+			extensions->splitFreeListCarveWindowSize = windowSize;
+		}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	} else if (0 == strncmp(option, OMR_XGCSCAVENGERREMEMBEREDSETMAP, OMR_XGCSCAVENGERREMEMBEREDSETMAP_LENGTH)) {
+		extensions->scavengerRememberedSetMap = true;
+	} else if (0 == strncmp(option, OMR_XGCSCAVENGERREMEMBEREDSETLISTMAXSIZE, OMR_XGCSCAVENGERREMEMBEREDSETLISTMAXSIZE_LENGTH)) {
+		uintptr_t maxSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCSCAVENGERREMEMBEREDSETLISTMAXSIZE_LENGTH, &maxSize)) {
+			result = false;
+		} else {
+			extensions->scavengerRememberedSetListMaxSize = maxSize;
+		}
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
 	} else {
 		/* unknown option */
 		result = false;
@@ -42,6 +42,7 @@
 #include "GCExtensionsBase.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
+#include "mmomrhook_internal.h"
 
 #if defined(OMR_GC_THREAD_LOCAL_HEAP)
 /**
@@ -83,6 +84,9 @@ MM_TLHAllocationInterface::initialize(MM_EnvironmentBase *env)
 	}
 
 	if (result) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		/* Threads must not sample in lock step, so mix the receiver's address into the seed */
+		_allocationSampler.initialize(extensions->allocationSamplingInterval, omrtime_hires_clock() ^ (uint64_t)(uintptr_t)this);
 		reconnect(env, false);
 	}
 
@@ -209,11 +213,41 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 
 	}
 
+	if ((NULL != result) && _allocationSampler.isEnabled()) {
+		sampleAllocation(env, allocDescription, result);
+	}
+
 	env->_oolTraceAllocationBytes += (_stats.bytesAllocated() - _bytesAllocatedBase); /* Increment by bytes allocated */
 
 	return result;
 }
 
+/**
+ * Account an allocation made by the owning thread, together with everything the thread allocated inline from
+ * its TLHs since the previous slow path allocation, and report it if a sample point falls within those bytes.
+ * Inline allocations are only seen here when they exhaust the TLH, so a sample point falling within them is
+ * reported against the allocation which refreshes the TLH.
+ */
+void
+MM_TLHAllocationInterface::sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *object)
+{
+	uintptr_t objectSize = allocDescription->getContiguousBytes();
+	uintptr_t bytes = objectSize + _tlhAllocationSupport.takeInlineAllocatedBytes();
+#if defined(OMR_GC_NON_ZERO_TLH)
+	bytes += _tlhAllocationSupportNonZero.takeInlineAllocatedBytes();
+#endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	if (_allocationSampler.allocated(bytes)) {
+		uintptr_t sampledBytes = _allocationSampler.takeSampledBytes();
+		TRIGGER_J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED(
+			env->getExtensions()->omrHookInterface,
+			env->getOmrVMThread(),
+			(omrobjectptr_t)object,
+			objectSize,
+			sampledBytes);
+	}
+}
+
 void *
 MM_TLHAllocationInterface::allocateArray(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, MM_MemorySpace *memorySpace, bool shouldCollectOnFailure)
 {
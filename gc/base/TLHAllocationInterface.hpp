@@ -32,6 +32,7 @@
 #include "omrcomp.h"
 #include "omrmodroncore.h"
 
+#include "AllocationSampler.hpp"
 #include "ObjectAllocationInterface.hpp"
 #include "TLHAllocationSupport.hpp"
 
@@ -63,6 +64,7 @@ private:
 
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	uintptr_t _bytesAllocatedBase; /**< Bytes allocated at the start of an allocation request.  Relative to _stats.bytesAllocated(). */
+	MM_AllocationSampler _allocationSampler; /**< Decides which allocations of the owning thread are reported by J9HOOK_MM_OMR_OBJECT_ALLOCATION_SAMPLED */
 
 public:
 	static MM_TLHAllocationInterface *newInstance(MM_EnvironmentBase *env);
@@ -90,6 +92,7 @@ protected:
 private:
 	void reconnect(MM_EnvironmentBase *env, bool shouldFlush);
 	void *allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool shouldCollectOnFailure);
+	void sampleAllocation(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, void *object);
 
 	/**
 	 * Create a ThreadLocalHeap object.
@@ -102,7 +105,8 @@ private:
 		_tlhAllocationSupportNonZero(env, false),
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
 		_cachedAllocationsEnabled(true),
-		_bytesAllocatedBase(0)
+		_bytesAllocatedBase(0),
+		_allocationSampler()
 	{
 		_typeId = __FUNCTION__;
 		_tlhAllocationSupport._objectAllocationInterface = this;
@@ -306,6 +306,8 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 	if(sizeInBytesRequired <= getSize()) {
 		memPtr = (void *)getAlloc();
 		setAlloc((void *)((uintptr_t)getAlloc() + sizeInBytesRequired));
+		_inlineAllocatedBytes += (uintptr_t)memPtr - (uintptr_t)_sampledAlloc;
+		_sampledAlloc = getAlloc();
 #if defined(OMR_GC_TLH_PREFETCH_FTA)
 		if (*_pointerToTlhPrefetchFTA < (intptr_t)sizeInBytesRequired) {
 			*_pointerToTlhPrefetchFTA = 0;
@@ -365,6 +367,7 @@ MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void
 	setBase(addrBase);
 	setAlloc(addrBase);
 	setTop(addrTop);
+	_sampledAlloc = addrBase;
 	if (NULL != memorySubSpace) {
 		setObjectFlags(memorySubSpace->getObjectFlags());
 	}
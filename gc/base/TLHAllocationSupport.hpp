@@ -83,6 +83,9 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	void *_sampledAlloc; /**< Allocation pointer up to which the bytes allocated from this TLH have been accounted for the allocation sampler */
+	uintptr_t _inlineAllocatedBytes; /**< Bytes allocated from TLHs without calling the collector (e.g. by JIT-ed code), not yet accounted for the allocation sampler */
+
 public:
 protected:
 private:
@@ -110,7 +113,11 @@ private:
 	MMINLINE void setAlloc(void *allocPtr) { *_pointerToHeapAlloc = (uint8_t *)allocPtr; };
 	MMINLINE void *getTop() { return (void *) *_pointerToHeapTop; };
 	MMINLINE void setTop(void *topPtr) { *_pointerToHeapTop = (uint8_t *)topPtr; };
-	MMINLINE void setAllZeroes(void) { memset((void *)_tlh, 0, sizeof(LanguageThreadLocalHeapStruct)); };
+	MMINLINE void setAllZeroes(void)
+	{
+		memset((void *)_tlh, 0, sizeof(LanguageThreadLocalHeapStruct));
+		_sampledAlloc = NULL;
+	};
 
 	/**
 	 * Determine how much space is left in the TLH
@@ -142,8 +149,21 @@ private:
 
 	void setupTLH(MM_EnvironmentBase *env, void *addrBase, void *addrTop, MM_MemorySubSpace *memorySubSpace, MM_MemoryPool *memoryPool);
 
+	/**
+	 * Return the bytes allocated inline from TLHs since the last call, so they can be accounted for the allocation sampler.
+	 */
+	MMINLINE uintptr_t
+	takeInlineAllocatedBytes()
+	{
+		uintptr_t bytes = _inlineAllocatedBytes;
+		_inlineAllocatedBytes = 0;
+		return bytes;
+	}
+
 	MMINLINE void wipeTLH(MM_EnvironmentBase *env)
 	{
+		/* Whatever was allocated past the last slow path allocation was allocated inline */
+		_inlineAllocatedBytes += (uintptr_t)getRealAlloc() - (uintptr_t)_sampledAlloc;
 #if defined(OMR_GC_OBJECT_ALLOCATION_NOTIFY)
 		objectAllocationNotify(env, _tlh->heapBase, getRealAlloc());
 #endif /* OMR_GC_OBJECT_ALLOCATION_NOTIFY */
@@ -185,7 +205,9 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_sampledAlloc(NULL),
+		_inlineAllocatedBytes(0)
 	{};
 
 	/*
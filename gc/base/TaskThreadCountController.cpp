@@ -0,0 +1,171 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Task.hpp"
+
+#include "TaskThreadCountController.hpp"
+
+/**
+ * Weight of the newest measurement in the moving averages. The work volume follows the application
+ * quickly, the per thread cost is a property of the machine and is smoothed harder.
+ */
+#define TASK_THREAD_COUNT_WORK_WEIGHT 0.5
+#define TASK_THREAD_COUNT_COST_WEIGHT 0.25
+
+MM_TaskThreadCountController *
+MM_TaskThreadCountController::newInstance(MM_EnvironmentBase *env)
+{
+	MM_TaskThreadCountController *controller = (MM_TaskThreadCountController *)env->getForge()->allocate(sizeof(MM_TaskThreadCountController), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != controller) {
+		new(controller) MM_TaskThreadCountController(env);
+		if (!controller->initialize(env)) {
+			controller->kill(env);
+			controller = NULL;
+		}
+	}
+	return controller;
+}
+
+void
+MM_TaskThreadCountController::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_TaskThreadCountController::initialize(MM_EnvironmentBase *env)
+{
+	_probeInterval = env->getExtensions()->adaptiveGCThreadsProbeInterval;
+	return true;
+}
+
+void
+MM_TaskThreadCountController::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+uintptr_t
+MM_TaskThreadCountController::getThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t staticThreadCount)
+{
+	uintptr_t threadCount = staticThreadCount;
+	MM_TaskThreadCountModel *model = getModel(task->getBaseVirtualTypeId());
+
+	if (NULL != model) {
+		bool trusted = (TASK_THREAD_COUNT_WARMUP_DISPATCHES <= model->_sampleCount);
+		if (trusted && ((model->_dispatchesSinceProbe + 1) < _probeInterval)) {
+			/* Fewer threads win ties, they leave the CPUs to the application sooner */
+			double bestTime = model->predictTime(1);
+			threadCount = 1;
+			for (uintptr_t candidate = 2; candidate <= staticThreadCount; candidate++) {
+				double candidateTime = model->predictTime(candidate);
+				if (candidateTime < bestTime) {
+					bestTime = candidateTime;
+					threadCount = candidate;
+				}
+			}
+		}
+
+		if (threadCount == staticThreadCount) {
+			model->_dispatchesSinceProbe = 0;
+		} else {
+			model->_dispatchesSinceProbe += 1;
+		}
+
+		model->_cycleDispatchCount += 1;
+		model->_cycleThreadCount = threadCount;
+		model->_cycleStaticThreadCount = staticThreadCount;
+		if (trusted) {
+			model->_cyclePredictedTime += (uint64_t)model->predictTime(threadCount);
+			model->_cycleStaticPredictedTime += (uint64_t)model->predictTime(staticThreadCount);
+		}
+	}
+
+	return threadCount;
+}
+
+void
+MM_TaskThreadCountController::taskCompleted(MM_EnvironmentBase *env, MM_TaskTimelineDispatch *dispatch)
+{
+	if ((0 == dispatch->threadCount) || (NULL == dispatch->taskName)) {
+		return;
+	}
+
+	MM_TaskThreadCountModel *model = getModel(dispatch->taskName);
+	if (NULL != model) {
+		double threadCount = (double)dispatch->threadCount;
+		double work = (double)dispatch->busyTime;
+		/* Whatever the threads did not spend busy on their share of the work is overhead of running with this many */
+		double overhead = (double)dispatch->elapsedTime - (work / threadCount);
+		double costPerThread = (overhead > 0.0) ? (overhead / threadCount) : 0.0;
+
+		if (0 == model->_sampleCount) {
+			model->_workEstimate = work;
+			model->_costPerThreadEstimate = costPerThread;
+		} else {
+			model->_workEstimate += (work - model->_workEstimate) * TASK_THREAD_COUNT_WORK_WEIGHT;
+			model->_costPerThreadEstimate += (costPerThread - model->_costPerThreadEstimate) * TASK_THREAD_COUNT_COST_WEIGHT;
+		}
+		model->_sampleCount += 1;
+	}
+}
+
+void
+MM_TaskThreadCountController::resetCycle()
+{
+	for (uintptr_t index = 0; index < _modelCount; index++) {
+		MM_TaskThreadCountModel *model = &_models[index];
+		model->_cycleDispatchCount = 0;
+		model->_cycleThreadCount = 0;
+		model->_cycleStaticThreadCount = 0;
+		model->_cyclePredictedTime = 0;
+		model->_cycleStaticPredictedTime = 0;
+	}
+}
+
+MM_TaskThreadCountModel *
+MM_TaskThreadCountController::getModel(const char *taskName)
+{
+	MM_TaskThreadCountModel *model = NULL;
+
+	/* Task type ids are the string literals from __FUNCTION__, so pointers can be compared */
+	for (uintptr_t index = 0; index < _modelCount; index++) {
+		if (taskName == _models[index]._taskName) {
+			model = &_models[index];
+			break;
+		}
+	}
+
+	if ((NULL == model) && (_modelCount < TASK_TIMELINE_MAX_TASK_TYPES)) {
+		model = &_models[_modelCount];
+		_modelCount += 1;
+		memset(model, 0, sizeof(MM_TaskThreadCountModel));
+		model->_taskName = taskName;
+	}
+
+	return model;
+}
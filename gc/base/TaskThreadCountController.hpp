@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(TASKTHREADCOUNTCONTROLLER_HPP_)
+#define TASKTHREADCOUNTCONTROLLER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "BaseVirtual.hpp"
+#include "TaskTimeline.hpp"
+
+class MM_EnvironmentBase;
+class MM_Task;
+
+/**
+ * Number of dispatches of a task type run with the full thread count before its model is trusted.
+ */
+#define TASK_THREAD_COUNT_WARMUP_DISPATCHES 3
+
+/**
+ * Parallel efficiency model of one task type, and what it predicted over the current cycle.
+ * The wall time of a dispatch to n threads is modelled as T(n) = W / n + c * n, where W is the busy
+ * time of all threads (the work volume) and c is the cost each additional thread adds in wakeup,
+ * synchronization and imbalance. Both are tracked as moving averages of what was measured.
+ * Times are in hi-res ticks.
+ */
+class MM_TaskThreadCountModel
+{
+public:
+	const char *_taskName; /**< Type id of the task */
+	uintptr_t _sampleCount; /**< Dispatches measured so far */
+	uintptr_t _dispatchesSinceProbe; /**< Dispatches since the task last ran with the full thread count */
+	double _workEstimate; /**< Moving average of W */
+	double _costPerThreadEstimate; /**< Moving average of c */
+
+	uintptr_t _cycleDispatchCount; /**< Dispatches in the current cycle */
+	uintptr_t _cycleThreadCount; /**< Thread count chosen for the last dispatch in the current cycle */
+	uintptr_t _cycleStaticThreadCount; /**< Thread count the last dispatch in the current cycle would have had without the model */
+	uint64_t _cyclePredictedTime; /**< Sum of the predicted time of the dispatches in the current cycle */
+	uint64_t _cycleStaticPredictedTime; /**< Sum of the predicted time of those dispatches at their static thread count */
+
+	/**
+	 * @return the predicted wall time of a dispatch to threadCount threads
+	 */
+	MMINLINE double
+	predictTime(uintptr_t threadCount)
+	{
+		return (_workEstimate / (double)threadCount) + (_costPerThreadEstimate * (double)threadCount);
+	}
+};
+
+/**
+ * Learns, per task type, the thread count which minimizes the wall time of a dispatch given the recent
+ * work volume of that type and chooses it in place of the static count (-Xgcthreads, CPU count and heap size).
+ * Enabled by -Xgc:adaptiveGCThreads. Measurements come from the dispatcher's MM_TaskTimeline.
+ * @ingroup GC_Base_Core
+ */
+class MM_TaskThreadCountController : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_TaskThreadCountModel _models[TASK_TIMELINE_MAX_TASK_TYPES];
+	uintptr_t _modelCount;
+	uintptr_t _probeInterval; /**< Every this many dispatches of a type run it with the full thread count */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_TaskThreadCountModel *getModel(const char *taskName);
+protected:
+public:
+	static MM_TaskThreadCountController *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Choose the number of threads to dispatch a task to.
+	 * @param[in] task the task about to be dispatched
+	 * @param[in] staticThreadCount the number of threads the dispatcher would otherwise use
+	 * @return the thread count, between 1 and staticThreadCount
+	 */
+	uintptr_t getThreadCount(MM_EnvironmentBase *env, MM_Task *task, uintptr_t staticThreadCount);
+
+	/**
+	 * Fold the measurements of a completed dispatch into the model of its task type.
+	 */
+	void taskCompleted(MM_EnvironmentBase *env, MM_TaskTimelineDispatch *dispatch);
+
+	MMINLINE uintptr_t getModelCount() { return _modelCount; }
+	MMINLINE MM_TaskThreadCountModel *getModelAt(uintptr_t index) { return &_models[index]; }
+
+	/**
+	 * Start new cycle predictions. Called by the collector once the cycle end has been reported.
+	 */
+	void resetCycle();
+
+	MM_TaskThreadCountController(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _modelCount(0)
+		, _probeInterval(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* TASKTHREADCOUNTCONTROLLER_HPP_ */
@@ -0,0 +1,364 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrport.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+#include "ModronAssertions.h"
+#include "Task.hpp"
+
+#include "TaskTimeline.hpp"
+
+MM_TaskTimeline *
+MM_TaskTimeline::newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum)
+{
+	MM_TaskTimeline *timeline = (MM_TaskTimeline *)env->getForge()->allocate(sizeof(MM_TaskTimeline), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != timeline) {
+		new(timeline) MM_TaskTimeline(env, threadCountMaximum);
+		if (!timeline->initialize(env)) {
+			timeline->kill(env);
+			timeline = NULL;
+		}
+	}
+	return timeline;
+}
+
+void
+MM_TaskTimeline::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_TaskTimeline::initialize(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	_threadStats = (MM_TaskThreadStats *)env->getForge()->allocate(_threadCountMaximum * sizeof(MM_TaskThreadStats), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _threadStats) {
+		return false;
+	}
+	for (uintptr_t index = 0; index < _threadCountMaximum; index++) {
+		new(&_threadStats[index]) MM_TaskThreadStats();
+	}
+	memset(&_lastDispatch, 0, sizeof(_lastDispatch));
+
+	if (NULL != extensions->taskTimelineFileName) {
+		_buffer = (uint8_t *)env->getForge()->allocate(TASK_TIMELINE_BUFFER_SIZE, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _buffer) {
+			return false;
+		}
+		_pendingBuffer = (uint8_t *)env->getForge()->allocate(TASK_TIMELINE_BUFFER_SIZE, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _pendingBuffer) {
+			return false;
+		}
+		if (0 != omrthread_monitor_init_with_name(&_pendingMonitor, 0, "MM_TaskTimeline::pendingMonitor")) {
+			_pendingMonitor = NULL;
+			return false;
+		}
+		_fileDescriptor = omrfile_open(extensions->taskTimelineFileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+		if (-1 == _fileDescriptor) {
+			return false;
+		}
+		_baseTime = omrtime_hires_clock();
+
+		MM_TaskTimelineFileHeader *header = (MM_TaskTimelineFileHeader *)reserveRecord(env, sizeof(MM_TaskTimelineFileHeader));
+		memcpy(header->eyecatcher, "OMRGCTTL", sizeof(header->eyecatcher));
+		header->version = TASK_TIMELINE_VERSION;
+		header->reserved = 0;
+	}
+
+	return true;
+}
+
+void
+MM_TaskTimeline::tearDown(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (-1 != _fileDescriptor) {
+		flush(env);
+		if (0 != _bufferUsed) {
+			omrfile_write(_fileDescriptor, _buffer, _bufferUsed);
+			_bufferUsed = 0;
+		}
+		omrfile_close(_fileDescriptor);
+		_fileDescriptor = -1;
+	}
+	if (NULL != _pendingMonitor) {
+		omrthread_monitor_destroy(_pendingMonitor);
+		_pendingMonitor = NULL;
+	}
+	if (NULL != _pendingBuffer) {
+		env->getForge()->free(_pendingBuffer);
+		_pendingBuffer = NULL;
+	}
+	if (NULL != _buffer) {
+		env->getForge()->free(_buffer);
+		_buffer = NULL;
+	}
+	if (NULL != _threadStats) {
+		env->getForge()->free(_threadStats);
+		_threadStats = NULL;
+	}
+}
+
+void
+MM_TaskTimeline::threadStarted(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	env->_taskThreadStats.clear();
+	env->_taskThreadStats._startTime = omrtime_hires_clock();
+}
+
+void
+MM_TaskTimeline::threadCompleted(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t slaveID = env->getSlaveID();
+
+	env->_taskThreadStats._endTime = omrtime_hires_clock();
+	if (slaveID < _threadCountMaximum) {
+		_threadStats[slaveID] = env->_taskThreadStats;
+	}
+}
+
+void
+MM_TaskTimeline::taskCompleted(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t threadCount = OMR_MIN(_taskThreadCount, _threadCountMaximum);
+	const char *taskName = _task->getBaseVirtualTypeId();
+
+	uint64_t firstStartTime = UINT64_MAX;
+	uint64_t lastEndTime = 0;
+	uint64_t maxBusyTime = 0;
+	uint64_t totalBusyTime = 0;
+	uint64_t syncStallTime = 0;
+	uint64_t idleTime = 0;
+	uint64_t stealTime = 0;
+	uintptr_t busiestID = 0;
+	for (uintptr_t slaveID = 0; slaveID < threadCount; slaveID++) {
+		MM_TaskThreadStats *stats = &_threadStats[slaveID];
+		uint64_t busyTime = stats->getBusyTime();
+		firstStartTime = OMR_MIN(firstStartTime, stats->_startTime);
+		lastEndTime = OMR_MAX(lastEndTime, stats->_endTime);
+		if (busyTime > maxBusyTime) {
+			maxBusyTime = busyTime;
+			busiestID = slaveID;
+		}
+		totalBusyTime += busyTime;
+		syncStallTime += stats->_syncStallTime;
+		idleTime += stats->_idleTime;
+		stealTime += stats->_stealTime;
+	}
+	uint64_t meanBusyTime = (0 == threadCount) ? 0 : (totalBusyTime / threadCount);
+
+	_lastDispatch.taskName = taskName;
+	_lastDispatch.threadCount = threadCount;
+	_lastDispatch.elapsedTime = (lastEndTime > firstStartTime) ? (lastEndTime - firstStartTime) : 0;
+	_lastDispatch.busyTime = totalBusyTime;
+
+	MM_TaskTimelineSummary *summary = getSummary(taskName);
+	if (NULL != summary) {
+		summary->_dispatchCount += 1;
+		summary->_maxThreadCount = OMR_MAX(summary->_maxThreadCount, threadCount);
+		summary->_elapsedTime += _lastDispatch.elapsedTime;
+		summary->_maxBusyTime += maxBusyTime;
+		summary->_meanBusyTime += meanBusyTime;
+		summary->_syncStallTime += syncStallTime;
+		summary->_idleTime += idleTime;
+		summary->_stealTime += stealTime;
+		if ((maxBusyTime - meanBusyTime) > summary->_worstStragglerTime) {
+			summary->_worstStragglerTime = maxBusyTime - meanBusyTime;
+			summary->_worstStragglerID = busiestID;
+		}
+	}
+
+	if ((-1 != _fileDescriptor) && (0 != threadCount)) {
+		uint16_t typeIndex = (uint16_t)getTaskTypeIndex(env, taskName);
+		MM_TaskTimelineTaskRecord *taskRecord = (MM_TaskTimelineTaskRecord *)reserveRecord(env, sizeof(MM_TaskTimelineTaskRecord) + (threadCount * sizeof(MM_TaskTimelineThreadRecord)));
+		taskRecord->tag = TASK_TIMELINE_TAG_TASK;
+		taskRecord->typeIndex = typeIndex;
+		taskRecord->threadCount = (uint16_t)threadCount;
+		taskRecord->startTime = omrtime_hires_delta(_baseTime, firstStartTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		MM_TaskTimelineThreadRecord *threadRecord = (MM_TaskTimelineThreadRecord *)(taskRecord + 1);
+		for (uintptr_t slaveID = 0; slaveID < threadCount; slaveID++) {
+			MM_TaskThreadStats *stats = &_threadStats[slaveID];
+			threadRecord->slaveID = (uint32_t)slaveID;
+			threadRecord->startOffset = (uint32_t)omrtime_hires_delta(firstStartTime, stats->_startTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			threadRecord->endOffset = (uint32_t)omrtime_hires_delta(firstStartTime, stats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			threadRecord->busyTime = (uint32_t)omrtime_hires_delta(0, stats->getBusyTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			threadRecord->syncStallTime = (uint32_t)omrtime_hires_delta(0, stats->_syncStallTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			threadRecord->idleTime = (uint32_t)omrtime_hires_delta(0, stats->_idleTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			threadRecord->stealTime = (uint32_t)omrtime_hires_delta(0, stats->_stealTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			threadRecord->reserved = 0;
+			threadRecord += 1;
+		}
+	}
+
+	for (uintptr_t slaveID = 0; slaveID < threadCount; slaveID++) {
+		_threadStats[slaveID].clear();
+	}
+	_task = NULL;
+	_taskThreadCount = 0;
+}
+
+MM_TaskTimelineSummary *
+MM_TaskTimeline::getSummary(const char *taskName)
+{
+	MM_TaskTimelineSummary *summary = NULL;
+
+	/* Task type ids are the string literals from __FUNCTION__, so pointers can be compared */
+	for (uintptr_t index = 0; index < _summaryCount; index++) {
+		if (taskName == _summaries[index]._taskName) {
+			summary = &_summaries[index];
+			break;
+		}
+	}
+
+	if ((NULL == summary) && (_summaryCount < TASK_TIMELINE_MAX_TASK_TYPES)) {
+		summary = &_summaries[_summaryCount];
+		_summaryCount += 1;
+		memset(summary, 0, sizeof(MM_TaskTimelineSummary));
+		summary->_taskName = taskName;
+	}
+
+	return summary;
+}
+
+uintptr_t
+MM_TaskTimeline::getTaskTypeIndex(MM_EnvironmentBase *env, const char *taskName)
+{
+	for (uintptr_t index = 0; index < _taskTypeCount; index++) {
+		if (taskName == _taskTypes[index]) {
+			return index;
+		}
+	}
+
+	uintptr_t typeIndex = UINT16_MAX;
+	if (_taskTypeCount < TASK_TIMELINE_MAX_TASK_TYPES) {
+		typeIndex = _taskTypeCount;
+		_taskTypes[_taskTypeCount] = taskName;
+		_taskTypeCount += 1;
+
+		/* The name is padded so the records which follow stay 8 byte aligned */
+		uintptr_t nameLength = strlen(taskName);
+		uintptr_t paddedLength = MM_Math::roundToCeiling(sizeof(uint64_t), nameLength);
+		MM_TaskTimelineTypeRecord *typeRecord = (MM_TaskTimelineTypeRecord *)reserveRecord(env, sizeof(MM_TaskTimelineTypeRecord) + paddedLength);
+		typeRecord->tag = TASK_TIMELINE_TAG_TYPE;
+		typeRecord->typeIndex = (uint16_t)typeIndex;
+		typeRecord->nameLength = (uint16_t)nameLength;
+		memset(typeRecord + 1, 0, paddedLength);
+		memcpy(typeRecord + 1, taskName, nameLength);
+	}
+
+	return typeIndex;
+}
+
+/**
+ * Reserve space for a record in the buffer. All record sizes are multiples of 8 bytes, so records are
+ * aligned in the buffer.
+ */
+void *
+MM_TaskTimeline::reserveRecord(MM_EnvironmentBase *env, uintptr_t size)
+{
+	Assert_MM_true(size <= TASK_TIMELINE_BUFFER_SIZE);
+	if ((_bufferUsed + size) > TASK_TIMELINE_BUFFER_SIZE) {
+		/* A single cycle filled the buffer, so the pending records have to be written out now */
+		handOff(env, true);
+	}
+	void *record = _buffer + _bufferUsed;
+	_bufferUsed += size;
+	return record;
+}
+
+/**
+ * Swap the buffer with the pending buffer, if that has been written out.
+ * @param waitForPending write out the pending buffer first if it has not been, rather than keeping the records
+ * @return true if the records were handed off
+ */
+bool
+MM_TaskTimeline::handOff(MM_EnvironmentBase *env, bool waitForPending)
+{
+	bool handedOff = false;
+
+	if (waitForPending) {
+		omrthread_monitor_enter(_pendingMonitor);
+		writePending(env);
+	} else if (0 != omrthread_monitor_try_enter(_pendingMonitor)) {
+		/* flush() is still writing the records of an earlier cycle */
+		return false;
+	}
+
+	if (0 == _pendingBufferUsed) {
+		uint8_t *buffer = _pendingBuffer;
+		_pendingBuffer = _buffer;
+		_pendingBufferUsed = _bufferUsed;
+		_buffer = buffer;
+		_bufferUsed = 0;
+		handedOff = true;
+	}
+	omrthread_monitor_exit(_pendingMonitor);
+
+	return handedOff;
+}
+
+/**
+ * Write out the pending buffer. The caller must hold the pending monitor.
+ */
+void
+MM_TaskTimeline::writePending(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (0 != _pendingBufferUsed) {
+		omrfile_write(_fileDescriptor, _pendingBuffer, _pendingBufferUsed);
+		_pendingBufferUsed = 0;
+	}
+}
+
+void
+MM_TaskTimeline::cycleCompleted(MM_EnvironmentBase *env)
+{
+	_summaryCount = 0;
+
+	if ((-1 != _fileDescriptor) && (0 != _bufferUsed)) {
+		handOff(env, false);
+	}
+}
+
+void
+MM_TaskTimeline::flush(MM_EnvironmentBase *env)
+{
+	if (-1 != _fileDescriptor) {
+		omrthread_monitor_enter(_pendingMonitor);
+		writePending(env);
+		omrthread_monitor_exit(_pendingMonitor);
+	}
+}
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Base_Core
+ */
+
+#if !defined(TASKTIMELINE_HPP_)
+#define TASKTIMELINE_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "omrthread.h"
+
+#include "BaseVirtual.hpp"
+#include "TaskThreadStats.hpp"
+
+class MM_EnvironmentBase;
+class MM_Task;
+
+#define TASK_TIMELINE_MAX_TASK_TYPES 32
+#define TASK_TIMELINE_BUFFER_SIZE (64 * 1024)
+#define TASK_TIMELINE_VERSION 2
+
+/**
+ * Binary timeline records. The file starts with a MM_TaskTimelineFileHeader and is followed by
+ * records in native byte order, each starting with a 32 bit tag:
+ *  - TASK_TIMELINE_TAG_TYPE: a MM_TaskTimelineTypeRecord and the task type name, written the first
+ *    time a task type is dispatched. Later records refer to the type by its index.
+ *  - TASK_TIMELINE_TAG_TASK: a MM_TaskTimelineTaskRecord followed by one MM_TaskTimelineThreadRecord
+ *    per thread which ran the task.
+ * Times are in microseconds. Task start times are relative to the time the file was opened, thread
+ * offsets are relative to the start of their task.
+ */
+#define TASK_TIMELINE_TAG_TYPE 1
+#define TASK_TIMELINE_TAG_TASK 2
+
+typedef struct MM_TaskTimelineFileHeader {
+	char eyecatcher[8]; /**< "OMRGCTTL" */
+	uint32_t version;
+	uint32_t reserved;
+} MM_TaskTimelineFileHeader;
+
+typedef struct MM_TaskTimelineTypeRecord {
+	uint32_t tag;
+	uint16_t typeIndex;
+	uint16_t nameLength; /**< Length of the name which follows the record, without a terminating NUL */
+} MM_TaskTimelineTypeRecord;
+
+typedef struct MM_TaskTimelineTaskRecord {
+	uint32_t tag;
+	uint16_t typeIndex;
+	uint16_t threadCount;
+	uint64_t startTime;
+} MM_TaskTimelineTaskRecord;
+
+typedef struct MM_TaskTimelineThreadRecord {
+	uint32_t slaveID;
+	uint32_t startOffset;
+	uint32_t endOffset;
+	uint32_t busyTime;
+	uint32_t syncStallTime;
+	uint32_t idleTime;
+	uint32_t stealTime;
+	uint32_t reserved;
+} MM_TaskTimelineThreadRecord;
+
+/**
+ * Totals of the most recently completed dispatch. Times are in hi-res ticks.
+ */
+typedef struct MM_TaskTimelineDispatch {
+	const char *taskName; /**< Type id of the task */
+	uintptr_t threadCount; /**< Number of threads the task was dispatched to */
+	uint64_t elapsedTime; /**< Time from the first thread starting to the last one completing */
+	uint64_t busyTime; /**< Sum of the busy time of all threads */
+} MM_TaskTimelineDispatch;
+
+/**
+ * Per cycle load balance summary of all the dispatches of one task type. Times are in hi-res ticks.
+ */
+class MM_TaskTimelineSummary
+{
+public:
+	const char *_taskName; /**< Type id of the task */
+	uintptr_t _dispatchCount; /**< Number of times the task was dispatched */
+	uintptr_t _maxThreadCount; /**< Largest number of threads the task ran with */
+	uint64_t _elapsedTime; /**< Sum of the time from the first thread starting to the last one completing */
+	uint64_t _maxBusyTime; /**< Sum of the busy time of the busiest thread of each dispatch */
+	uint64_t _meanBusyTime; /**< Sum of the mean busy time of the threads of each dispatch */
+	uint64_t _syncStallTime; /**< Time all threads spent blocked at synchronization points */
+	uint64_t _idleTime; /**< Time all threads spent waiting for work */
+	uint64_t _stealTime; /**< Time all threads spent taking work from other threads */
+	uint64_t _worstStragglerTime; /**< Largest difference between the busiest thread and the mean in a single dispatch */
+	uintptr_t _worstStragglerID; /**< Slave ID of the thread behind _worstStragglerTime */
+
+	/**
+	 * @return the share of the busiest threads' time the other threads were not busy, in hundredths of a percent
+	 */
+	MMINLINE uintptr_t
+	getImbalance()
+	{
+		uintptr_t imbalance = 0;
+		if (0 != _maxBusyTime) {
+			imbalance = (uintptr_t)(((_maxBusyTime - _meanBusyTime) * 10000) / _maxBusyTime);
+		}
+		return imbalance;
+	}
+};
+
+/**
+ * Records per thread timing of every task dispatched by the parallel dispatcher. It keeps a per cycle
+ * load balance summary by task type for verbose GC and, if -Xgc:taskTimelineFile= was specified,
+ * appends a binary timeline of every dispatch to that file. Records are only buffered during a
+ * collection. The buffer is handed off when the cycle completes and written out by the collecting
+ * thread once it has released exclusive access.
+ * @ingroup GC_Base_Core
+ */
+class MM_TaskTimeline : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _threadCountMaximum; /**< Size of _threadStats */
+	MM_TaskThreadStats *_threadStats; /**< Timing of each thread over the current dispatch, indexed by slave ID */
+	MM_Task *_task; /**< Task currently dispatched */
+	uintptr_t _taskThreadCount; /**< Number of threads the current task was dispatched to */
+
+	MM_TaskTimelineDispatch _lastDispatch; /**< Totals of the most recently completed dispatch */
+	MM_TaskTimelineSummary _summaries[TASK_TIMELINE_MAX_TASK_TYPES]; /**< Summaries for the current cycle */
+	uintptr_t _summaryCount;
+
+	const char *_taskTypes[TASK_TIMELINE_MAX_TASK_TYPES]; /**< Task types written to the binary timeline so far */
+	uintptr_t _taskTypeCount;
+
+	intptr_t _fileDescriptor; /**< Binary timeline file, or -1 */
+	uint8_t *_buffer; /**< Records of the current cycle, not yet handed off to be written */
+	uintptr_t _bufferUsed;
+	uint8_t *_pendingBuffer; /**< Records handed off by a completed cycle, written once the pause is over */
+	uintptr_t _pendingBufferUsed;
+	omrthread_monitor_t _pendingMonitor; /**< Serializes writing the pending buffer and handing records off to it */
+	uint64_t _baseTime; /**< Time the binary timeline was opened */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	MM_TaskTimelineSummary *getSummary(const char *taskName);
+	uintptr_t getTaskTypeIndex(MM_EnvironmentBase *env, const char *taskName);
+	void *reserveRecord(MM_EnvironmentBase *env, uintptr_t size);
+	bool handOff(MM_EnvironmentBase *env, bool waitForPending);
+	void writePending(MM_EnvironmentBase *env);
+protected:
+public:
+	static MM_TaskTimeline *newInstance(MM_EnvironmentBase *env, uintptr_t threadCountMaximum);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Called by the master thread before the task is handed to the slave threads.
+	 */
+	MMINLINE void
+	taskDispatched(MM_Task *task, uintptr_t threadCount)
+	{
+		_task = task;
+		_taskThreadCount = threadCount;
+	}
+
+	/**
+	 * Called by each thread as it accepts the task.
+	 */
+	void threadStarted(MM_EnvironmentBase *env);
+
+	/**
+	 * Called by each thread before it completes the task.
+	 */
+	void threadCompleted(MM_EnvironmentBase *env);
+
+	/**
+	 * Called by the master thread once all threads have completed the task.
+	 * Folds the dispatch into the cycle summary and the binary timeline.
+	 */
+	void taskCompleted(MM_EnvironmentBase *env);
+
+	MMINLINE MM_TaskTimelineDispatch *getLastDispatch() { return &_lastDispatch; }
+	MMINLINE uintptr_t getSummaryCount() { return _summaryCount; }
+	MMINLINE MM_TaskTimelineSummary *getSummaryAt(uintptr_t index) { return &_summaries[index]; }
+
+	/**
+	 * Called by the collector once the cycle end has been reported. Starts a new cycle summary and
+	 * hands the records of the cycle off to be written by flush().
+	 */
+	void cycleCompleted(MM_EnvironmentBase *env);
+
+	/**
+	 * Write out the records handed off by completed cycles. Called outside of collections.
+	 */
+	void flush(MM_EnvironmentBase *env);
+
+	MM_TaskTimeline(MM_EnvironmentBase *env, uintptr_t threadCountMaximum)
+		: MM_BaseVirtual()
+		, _threadCountMaximum(threadCountMaximum)
+		, _threadStats(NULL)
+		, _task(NULL)
+		, _taskThreadCount(0)
+		, _summaryCount(0)
+		, _taskTypeCount(0)
+		, _fileDescriptor(-1)
+		, _buffer(NULL)
+		, _bufferUsed(0)
+		, _pendingBuffer(NULL)
+		, _pendingBufferUsed(0)
+		, _pendingMonitor(NULL)
+		, _baseTime(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* TASKTIMELINE_HPP_ */
@@ -190,11 +190,40 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case GC_OVERHEAD_FORECAST_LOW:
+		return "forecast gc overhead below target";
 	default:
 		return "unknown";
 	}
 }
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+/**
+ * Return the reason a generational segregated collect was a full mark as a string
+ * @param collectType collect type
+ */
+const char *
+getSegregatedCollectReasonAsString(MM_SegregatedCollectType collectType)
+{
+	switch(collectType) {
+	case SEGREGATED_COLLECT_MINOR:
+		return "none";
+	case SEGREGATED_COLLECT_MAJOR_INITIAL:
+		return "heap size changed";
+	case SEGREGATED_COLLECT_MAJOR_REQUESTED:
+		return "explicit or out of memory collect";
+	case SEGREGATED_COLLECT_MAJOR_INTERVAL:
+		return "maximum minor collects reached";
+	case SEGREGATED_COLLECT_MAJOR_LOW_FREE:
+		return "insufficient free space following minor collect";
+	case SEGREGATED_COLLECT_MAJOR_OVERFLOW:
+		return "remembered set overflow";
+	default:
+		return "unknown";
+	}
+}
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 /**
  * Return the reason for contraction as a string
  * @param reason reason code
@@ -217,6 +246,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case GC_OVERHEAD_FORECAST_HIGH:
+		return "forecast gc overhead above target";
 	default:
 		return "unknown";
 	}
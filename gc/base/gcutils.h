@@ -54,6 +54,10 @@ const char *getGCReasonAsString(GCReason reason);
 const char *getPercolateReasonAsString(PercolateReason mode);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+const char *getSegregatedCollectReasonAsString(MM_SegregatedCollectType collectType);
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 const char *getExpandReasonAsString(ExpandReason reason);
 const char *getContractReasonAsString(ContractReason reason);
 const char *getLoaResizeReasonAsString(LoaResizeReason reason);
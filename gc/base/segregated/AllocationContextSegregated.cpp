@@ -247,7 +247,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* The generational collector tells young objects from old ones by their mark, so new cells must start unmarked */
+	return !env->getExtensions()->segregatedGenerational;
 }
 
 /*
@@ -80,11 +80,13 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 
 	bool success = false;
 
-	/* OMRTODO investigate why these must be equal or it segfaults. */
 	MM_GCExtensionsBase *extensions = env->getExtensions();
-	extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 
 	if (MM_Configuration::initialize(env)) {
+		/* OMRTODO investigate why these must be equal or it segfaults. The GC thread count is only
+		 * known once the base configuration is initialized; the region pool is created after that.
+		 */
+		extensions->splitAvailableListSplitAmount = extensions->gcThreadCount;
 		env->getOmrVM()->_sizeClasses = _delegate.getSegregatedSizeClasses(env);
 		if (NULL != env->getOmrVM()->_sizeClasses) {
 			extensions->setSegregatedHeap(true);
@@ -106,6 +108,16 @@ MM_ConfigurationSegregated::tearDown(MM_EnvironmentBase* env)
 		extensions->defaultSizeClasses = NULL;
 	}
 
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	if (NULL != extensions->sizeClassProfileOutput) {
+		omrmem_free_memory(extensions->sizeClassProfileOutput);
+		extensions->sizeClassProfileOutput = NULL;
+	}
+	if (NULL != extensions->sizeClassProfileInput) {
+		omrmem_free_memory(extensions->sizeClassProfileInput);
+		extensions->sizeClassProfileInput = NULL;
+	}
+
 	MM_Configuration::tearDown(env);
 }
 
@@ -306,6 +306,11 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 			region = _coalesceFreeList->allocate(env, szClass, numRegions, maxExcess);
 		}
 	}
+
+	/* With lazy sweep, small regions left unswept by the last collect may be empty, so recover them before giving up */
+	while ((region == NULL) && (numRegions == 1) && env->getExtensions()->segregatedLazySweep && lazySweepForFreeRegion(env)) {
+		region = _singleFreeList->allocate(env, szClass);
+	}
 	
 	
 	if (region != NULL) {
@@ -407,7 +412,7 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 	MM_HeapRegionDescriptorSegregated *region = _smallSweepRegions[sizeClass]->dequeue();
 
 	if (region != NULL) {
-		_sweepScheme->sweepRegion(env, region);
+		lazySweepRegion(env, region);
 		/* Keep maintaining the occupancy info even while doing nondeterministic sweeps */
 		_smallOccupancy[sizeClass] = (_smallOccupancy[sizeClass] * 0.9f) + (region->getMemoryPoolACL()->getMarkCount() / region->getNumCells() * 0.1f );
 		decrementCurrentCountOfSweepRegions(sizeClass, 1);
@@ -417,6 +422,51 @@ MM_RegionPoolSegregated::sweepAndAllocateRegionFromSmallSizeClass(MM_Environment
 	return region;
 }
 
+bool
+MM_RegionPoolSegregated::lazySweepForFreeRegion(MM_EnvironmentBase *env)
+{
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	uintptr_t splitIndex = env->getEnvironmentId() % _splitAvailableListSplitCount;
+	bool freedRegion = false;
+
+	for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; !freedRegion && (0 != _currentTotalCountOfSweepRegions) && (sizeClass <= OMR_SIZECLASSES_MAX_SMALL); sizeClass++) {
+		uintptr_t numCells = sizeClasses->getNumCells(sizeClass);
+		MM_HeapRegionDescriptorSegregated *region = NULL;
+		while (!freedRegion && (NULL != (region = _smallSweepRegions[sizeClass]->dequeue()))) {
+			lazySweepRegion(env, region);
+			decrementCurrentCountOfSweepRegions(sizeClass, 1);
+			decrementCurrentTotalCountOfSweepRegions(1);
+
+			MM_MemoryPoolAggregatedCellList *memoryPoolACL = region->getMemoryPoolACL();
+			if (memoryPoolACL->getFreeCount() == numCells) {
+				region->emptyRegionReturned(env);
+				addFreeRegion(env, region);
+				freedRegion = true;
+			} else if (memoryPoolACL->getMarkCount() == numCells) {
+				_smallFullRegions[sizeClass]->enqueue(region);
+			} else {
+				/* The non-primary buckets are only searched while the collector is sweeping, so go straight to the primary one */
+				(&(_smallAvailableRegions[sizeClass][PRIMARY_BUCKET])[splitIndex])->enqueue(region);
+				_skipAvailableRegionForAllocation[sizeClass] = 0;
+			}
+		}
+	}
+
+	return freedRegion;
+}
+
+void
+MM_RegionPoolSegregated::lazySweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
+	_sweepScheme->sweepRegion(env, region);
+
+	MM_AtomicOperations::addU64(&_lazySweepTime, omrtime_hires_clock() - startTime);
+	MM_AtomicOperations::add(&_lazySweptRegionCount, 1);
+}
+
 void
 MM_RegionPoolSegregated::updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy)
 {
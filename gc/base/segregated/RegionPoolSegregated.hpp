@@ -138,6 +138,8 @@ private:
 	bool _isSweepingSmall; /**< if GC is sweeping small pages */
 	uintptr_t _splitAvailableListSplitCount; /* number of split available region queues per size class per defragment bucket */
 	uint8_t _skipAvailableRegionForAllocation[OMR_SIZECLASSES_NUM_SMALL+1]; /* per size class flag to indicate if there is any available regions left for allocation for that size class */
+	volatile uintptr_t _lazySweptRegionCount; /**< Number of small regions swept from the allocation path since the stats were last reset */
+	volatile uint64_t _lazySweepTime; /**< Hires ticks spent sweeping small regions from the allocation path since the stats were last reset */
 
 
 protected:
@@ -157,6 +159,11 @@ private:
 	{
 		MM_AtomicOperations::subtract(&_regionsInUse, value);
 	}
+
+	/**
+	 * Sweep a small region outside of a collect and account for it in the lazy sweep statistics.
+	 */
+	void lazySweepRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	
 protected:
 public:
@@ -174,6 +181,14 @@ public:
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
+
+	/**
+	 * Sweep small regions of any size class that were left unswept by the last collect until one of
+	 * them is found to be empty and returned to the free region lists, or no unswept regions remain.
+	 * Regions that still hold live objects are handed back to allocation for their size class.
+	 * @return true if a free region was recovered
+	 */
+	bool lazySweepForFreeRegion(MM_EnvironmentBase *env);
 	void enqueueAvailable(MM_HeapRegionDescriptorSegregated *region, uintptr_t sizeClass, uintptr_t occupancy, uintptr_t splitListIndex);
 
 	/**
@@ -241,6 +256,14 @@ public:
 	void resetSkipAvailableRegionForAllocation() { memset(&_skipAvailableRegionForAllocation[0], 0, sizeof(_skipAvailableRegionForAllocation)); }
 
 	void updateOccupancy (uintptr_t sizeClass, uintptr_t occupancy);
+
+	MMINLINE uintptr_t getLazySweptRegionCount() const { return _lazySweptRegionCount; }
+	MMINLINE uint64_t getLazySweepTime() const { return _lazySweepTime; }
+	MMINLINE void resetLazySweepStats()
+	{
+		_lazySweptRegionCount = 0;
+		_lazySweepTime = 0;
+	}
 	
 
 	MMINLINE MM_FreeHeapRegionList *getSingleFreeList() { return _singleFreeList; }
@@ -276,7 +299,11 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _initialTotalCountOfSweepRegions(0)
+		, _currentTotalCountOfSweepRegions(0)
 		, _isSweepingSmall(false)
+		, _lazySweptRegionCount(0)
+		, _lazySweepTime(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -98,6 +98,15 @@ MM_SegregatedAllocationInterface::initialize(MM_EnvironmentBase *env)
 		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
 			_replenishSizes[sizeClass] = extensions->allocationCacheInitialSize;
 		}
+
+		if (_sizeClasses->isProfilingAllocations()) {
+			_allocationProfile = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * OMR_SIZECLASSES_PROFILE_ENTRIES, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL == _allocationProfile) {
+				result = false;
+			} else {
+				memset(_allocationProfile, 0, sizeof(uintptr_t) * OMR_SIZECLASSES_PROFILE_ENTRIES);
+			}
+		}
 	}
 	
 	return result;
@@ -113,6 +122,15 @@ MM_SegregatedAllocationInterface::tearDown(MM_EnvironmentBase *env)
 		_frequentObjectsStats->kill(env);
 		_frequentObjectsStats = NULL;
 	}
+
+	if (NULL != _allocationProfile) {
+		MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+		if (NULL != sizeClasses) {
+			sizeClasses->mergeAllocationProfile(_allocationProfile);
+		}
+		env->getForge()->free(_allocationProfile);
+		_allocationProfile = NULL;
+	}
 }
 
 /**
@@ -149,6 +167,11 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 	uintptr_t sizeInBytes = allocateDescription->getBytesRequested();
 	/* Record the memory space from which the allocation takes place in the AD */
 	allocateDescription->setMemorySpace(memorySpace);
+
+	/* Allocations inlined by the JIT never get here, so the profile only covers allocations made through the GC */
+	if ((NULL != _allocationProfile) && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES)) {
+		_allocationProfile[(sizeInBytes + sizeof(uintptr_t) - 1) / sizeof(uintptr_t)] += 1;
+	}
 	
 	if (shouldCollectOnFailure) {
 		allocateDescription->setObjectFlags(memorySpace->getDefaultMemorySubSpace()->getObjectFlags());
@@ -264,6 +287,9 @@ MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	memset(_allocationCache, 0, sizeof(LanguageSegregatedAllocationCache));
 	env->getExtensions()->allocationStats.merge(&_stats);
 	_stats.clear();
+	if (NULL != _allocationProfile) {
+		_sizeClasses->mergeAllocationProfile(_allocationProfile);
+	}
 }
 
 /**
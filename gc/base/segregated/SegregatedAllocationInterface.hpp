@@ -58,6 +58,7 @@ private:
 	bool _cachedAllocationsEnabled; /**< Are cached allocations enabled? */
 	
 	uintptr_t *_allocationCacheBases[OMR_SIZECLASSES_NUM_SMALL + 1]; /**< The Base of each current cache (per size class). */
+	uintptr_t *_allocationProfile; /**< Histogram of small allocation sizes since the last flush, or NULL when not profiling (see MM_SizeClasses::mergeAllocationProfile()). */
 
 	/*
 	 * Function members
@@ -102,7 +103,8 @@ protected:
 	MM_SegregatedAllocationInterface(MM_EnvironmentBase *env) :
 		MM_ObjectAllocationInterface(env),
 		_sizeClasses(NULL),
-		_cachedAllocationsEnabled(true)
+		_cachedAllocationsEnabled(true),
+		_allocationProfile(NULL)
 	{
 		_typeId = __FUNCTION__;
 		memset(_allocationCacheBases, 0, sizeof(_allocationCacheBases));
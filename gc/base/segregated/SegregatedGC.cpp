@@ -30,9 +30,14 @@
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SegregatedMinorMarkTask.hpp"
 #include "SegregatedSweepTask.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
 #include "WorkPackets.hpp"
@@ -94,6 +99,12 @@ MM_SegregatedGC::initialize(MM_EnvironmentBase *env)
 	}
 
 	_sweepScheme->setClearMarkMapAfterSweep(false);
+
+	if (!_rememberedSet.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET)) {
+		return false;
+	}
+	_rememberedSet.setGrowSize(OMR_SCV_REMSET_SIZE);
+
 	return true;
 }
 
@@ -112,6 +123,8 @@ MM_SegregatedGC::tearDown(MM_EnvironmentBase *env)
 		_sweepScheme->kill(env);
 		_sweepScheme = NULL;
 	}
+
+	_rememberedSet.tearDown(env);
 }
 
 bool
@@ -179,10 +192,22 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	_extensions->globalGCStats.clear();
 	_extensions->globalGCStats.gcCount++;
 
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+	MM_MemoryPoolSegregated *memoryPool = (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool();
+	MM_RegionPoolSegregated *regionPool = memoryPool->getRegionPool();
+
+	/* Collect the work done by the allocation path since the last collect. Any small regions it did not
+	 * get to are still on the sweep lists and will simply be swept against the new mark below.
+	 */
+	sweepStats->_lazySweptRegions = regionPool->getLazySweptRegionCount();
+	sweepStats->_lazySweepTime = regionPool->getLazySweepTime();
+	sweepStats->_lazyUnsweptRegions = regionPool->getCurrentTotalCountOfSweepRegions();
+	regionPool->resetLazySweepStats();
+
 	/*
 	 * Marking
 	 */
-	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
 
 	/* OMRTODO the allocation contexts are never flushed for realtime, do
@@ -204,9 +229,38 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 //	}
 
 	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+	MM_SegregatedCollectType collectType = SEGREGATED_COLLECT_MAJOR_REQUESTED;
+	if (_extensions->segregatedGenerational) {
+		collectType = selectCollectType(env);
+		_extensions->globalGCStats.segregatedCollectType = collectType;
+		_extensions->globalGCStats.segregatedRememberedObjects = _rememberedSet.countElements();
+	}
+
+	MM_LiveObjectCensus *liveObjectCensus = _markingScheme->getLiveObjectCensus();
+	if (SEGREGATED_COLLECT_MINOR == collectType) {
+		/* Survivors of the previous collect keep their mark and are not traced again */
+		_rememberedSet.startProcessingSublist();
+		MM_SegregatedMinorMarkTask markTask(env, _dispatcher, _markingScheme, &_rememberedSet, env->_cycleState);
+		/* Only young objects are traced, so the live object census waits for the next full collect */
+		if (NULL != liveObjectCensus) {
+			liveObjectCensus->setSampling(false);
+		}
+		_dispatcher->run(env, &markTask);
+		if (NULL != liveObjectCensus) {
+			liveObjectCensus->setSampling(true);
+		}
+		_rememberedSet.clear(env);
+	} else {
+		if (_extensions->segregatedGenerational) {
+			forgetRememberedSet(env);
+		}
+		bool initMarkMap = true; // reset the markmap?
+		MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+		if (NULL != liveObjectCensus) {
+			liveObjectCensus->censusCompleted(env);
+		}
+	}
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -219,11 +273,11 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/*
 	 * Sweeping
 	 */
-	MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
 	reportSweepStart(env);
 	sweepStats->_startTime = omrtime_hires_clock();
-	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, (MM_MemoryPoolSegregated *) env->getDefaultMemorySubSpace()->getMemoryPool());
+	MM_SegregatedSweepTask sweepTask(env, _dispatcher, _sweepScheme, memoryPool);
 	_dispatcher->run(env, &sweepTask);
+	sweepStats->_lazyDeferredRegions = regionPool->getCurrentTotalCountOfSweepRegions();
 	MM_MemorySubSpace *activeSubSpace = env->_cycleState->_activeSubSpace;
 	bool isExplicitGC = env->_cycleState->_gcCode.isExplicitGC();
 	/* We now have accurate free space statistics so recalculate any expand/contract amount */
@@ -237,6 +291,10 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/* Heap size now fixed for next cycle so reset heap statistics */
 	_extensions->heap->resetHeapStatistics(true);
 
+	if (_extensions->segregatedGenerational) {
+		updateGenerationalState(env, collectType);
+	}
+
 	/* Restart allocation caches */
 	GC_OMRVMThreadListIterator vmThreadListIterator(env->getOmrVM());
 	while(OMR_VMThread* thread = vmThreadListIterator.nextOMRVMThread()) {
@@ -247,6 +305,63 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	return true;
 }
 
+MM_SegregatedCollectType
+MM_SegregatedGC::selectCollectType(MM_EnvironmentBase *env)
+{
+	MM_SegregatedCollectType collectType = SEGREGATED_COLLECT_MINOR;
+	MM_GCCode gcCode = env->_cycleState->_gcCode;
+
+	if (_heapSizeAtLastCollect != _extensions->heap->getActiveMemorySize()) {
+		/* Mark bits of memory added since the previous collect are not known to be clear */
+		collectType = SEGREGATED_COLLECT_MAJOR_INITIAL;
+	} else if (gcCode.isExplicitGC() || gcCode.isOutOfMemoryGC()) {
+		collectType = SEGREGATED_COLLECT_MAJOR_REQUESTED;
+	} else if (_rememberedSetOverflow) {
+		collectType = SEGREGATED_COLLECT_MAJOR_OVERFLOW;
+	} else if (_minorCollects >= _extensions->segregatedMaxMinorCollects) {
+		collectType = SEGREGATED_COLLECT_MAJOR_INTERVAL;
+	} else if (_lowFreeAfterMinor) {
+		collectType = SEGREGATED_COLLECT_MAJOR_LOW_FREE;
+	}
+
+	return collectType;
+}
+
+void
+MM_SegregatedGC::forgetRememberedSet(MM_EnvironmentBase *env)
+{
+	GC_SublistIterator rememberedSetIterator(&_rememberedSet);
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = rememberedSetIterator.nextList())) {
+		GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+			_extensions->objectModel.clearRemembered(*slotPtr);
+		}
+	}
+	_rememberedSet.clear(env);
+	_rememberedSetOverflow = false;
+}
+
+void
+MM_SegregatedGC::updateGenerationalState(MM_EnvironmentBase *env, MM_SegregatedCollectType collectType)
+{
+	MM_Heap *heap = _extensions->heap;
+	uintptr_t heapSize = heap->getActiveMemorySize();
+
+	if (SEGREGATED_COLLECT_MINOR == collectType) {
+		_minorCollects += 1;
+		/* Regions left for the lazy sweep were credited as free from the mark map when the sweep deferred them */
+		uintptr_t freeBytes = heap->getApproximateFreeMemorySize();
+		_lowFreeAfterMinor = ((freeBytes / 100) < ((heapSize / 100) * _extensions->segregatedMinorMinimumFreeRatio));
+	} else {
+		_minorCollects = 0;
+		_lowFreeAfterMinor = false;
+	}
+	_extensions->globalGCStats.segregatedMinorCollects = _minorCollects;
+	_heapSizeAtLastCollect = heapSize;
+}
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -29,7 +29,9 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "GlobalCollector.hpp"
 #include "MarkMap.hpp"
+#include "ObjectModel.hpp"
 #include "SegregatedMarkingScheme.hpp"
+#include "SublistPool.hpp"
 #include "SweepSchemeSegregated.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
@@ -48,6 +50,12 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+
+	MM_SublistPool _rememberedSet; /**< Old objects which were given a reference to a young object since the previous collect */
+	volatile bool _rememberedSetOverflow; /**< Set if an old object could not be added to the remembered set */
+	uintptr_t _minorCollects; /**< Number of minor collects run since the previous full mark */
+	uintptr_t _heapSizeAtLastCollect; /**< Active heap size after the previous collect, 0 before the first one */
+	bool _lowFreeAfterMinor; /**< Set if the previous minor collect left less than segregatedMinorMinimumFreeRatio of the heap free */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -73,6 +81,23 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	/**
+	 * Decide whether the collect about to run may be a minor collect.
+	 * @return SEGREGATED_COLLECT_MINOR, or the reason a full mark is required
+	 */
+	MM_SegregatedCollectType selectCollectType(MM_EnvironmentBase *env);
+
+	/**
+	 * Clear the remembered state of every object in the remembered set and empty it.
+	 * Called before a full mark, which does not need the set.
+	 */
+	void forgetRememberedSet(MM_EnvironmentBase *env);
+
+	/**
+	 * Record how much of the heap the collect left free, to decide whether the next collect can be minor.
+	 */
+	void updateGenerationalState(MM_EnvironmentBase *env, MM_SegregatedCollectType collectType);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -99,6 +124,30 @@ public:
 
 	virtual bool isMarked(void *objectPtr) { return _markingScheme->isMarked(static_cast<omrobjectptr_t>(objectPtr)); }
 
+	/**
+	 * Generational write barrier. Objects which survived a collect keep their mark, so a marked parent
+	 * receiving an unmarked child is an old to young reference, and the parent is remembered so the
+	 * next minor collect can trace the child without marking through the rest of the old objects.
+	 * @param parentObject the object being written to
+	 * @param childObject the reference being stored
+	 */
+	MMINLINE void
+	rememberOldToYoungReference(MM_EnvironmentBase *env, omrobjectptr_t parentObject, omrobjectptr_t childObject)
+	{
+		if ((NULL != childObject) && _markingScheme->isMarked(parentObject) && !_markingScheme->isMarked(childObject)) {
+			if (_extensions->objectModel.atomicSetRememberedState(parentObject, STATE_REMEMBERED)) {
+				uintptr_t *entry = _rememberedSet.allocateElement(env);
+				if (NULL != entry) {
+					*entry = (uintptr_t)parentObject;
+				} else {
+					/* The next collect has to be a full mark, which does not need the remembered set */
+					_extensions->objectModel.clearRemembered(parentObject);
+					_rememberedSetOverflow = true;
+				}
+			}
+		}
+	}
+
 	/**
 	 * Return reference to Marking Scheme
 	 */
@@ -119,6 +168,11 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _rememberedSet()
+		, _rememberedSetOverflow(false)
+		, _minorCollects(0)
+		, _heapSizeAtLastCollect(0)
+		, _lowFreeAfterMinor(false)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
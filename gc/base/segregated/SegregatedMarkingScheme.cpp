@@ -21,6 +21,10 @@
  *******************************************************************************/
 
 #include "EnvironmentBase.hpp"
+#include "ObjectModel.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 
 #include "SegregatedMarkingScheme.hpp"
 
@@ -57,4 +61,22 @@ MM_SegregatedMarkingScheme::kill(MM_EnvironmentBase *env)
 	env->getForge()->free(this);
 }
 
+void
+MM_SegregatedMarkingScheme::scanRememberedSet(MM_EnvironmentBase *env, MM_SublistPool *rememberedSet)
+{
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = rememberedSet->popPreviousPuddle(puddle))) {
+		GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)rememberedSetSlotIterator.nextSlot())) {
+			omrobjectptr_t objectPtr = *slotPtr;
+			/* The object is old, so it is already marked and would never be pushed by marking */
+			Assert_MM_true(isMarked(objectPtr));
+			_extensions->objectModel.clearRemembered(objectPtr);
+			env->_markStats._bytesScanned += scanObject(env, objectPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
+			env->_markStats._objectsScanned += 1;
+		}
+	}
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -35,6 +35,7 @@
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 class MM_EnvironmentBase;
+class MM_SublistPool;
 
 class MM_SegregatedMarkingScheme : public MM_MarkingScheme
 {
@@ -50,6 +51,13 @@ private:
 public:
 	static MM_SegregatedMarkingScheme *newInstance(MM_EnvironmentBase *env);
 	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Mark the children of every old object in the remembered set and clear their remembered state.
+	 * Puddles are popped under the pool lock, so all threads of a mark task may call this.
+	 * @param rememberedSet the remembered set, on which startProcessingSublist() has been called
+	 */
+	void scanRememberedSet(MM_EnvironmentBase *env, MM_SublistPool *rememberedSet);
 	
 	MMINLINE void
 	preMarkSmallCells(MM_EnvironmentBase* env, MM_HeapRegionDescriptorSegregated *containingRegion, uintptr_t *cellList, uintptr_t preAllocatedBytes)
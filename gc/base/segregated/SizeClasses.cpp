@@ -19,9 +19,13 @@
  *
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
+#include <stdlib.h>
+
 #include "SizeClasses.hpp"
 
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -30,6 +34,11 @@
  */
 uintptr_t initialCellSizes[OMR_SIZECLASSES_NUM_SMALL+1] = SMALL_SIZECLASSES;
 
+/* Derived cell sizes are kept to multiples of 8 so no two adjacent size classes can both be unaligned */
+#define SIZECLASSES_CELL_ALIGNMENT 8
+#define SIZECLASSES_MIN_CELL_SIZE ((uintptr_t)1 << OMR_SIZECLASSES_LOG_SMALLEST)
+#define SIZECLASSES_CANDIDATE_COUNT (((OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES - SIZECLASSES_MIN_CELL_SIZE) / SIZECLASSES_CELL_ALIGNMENT) + 1)
+
 MM_SizeClasses*
 MM_SizeClasses::newInstance(MM_EnvironmentBase* env)
 {
@@ -62,6 +71,26 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 	_sizeClassIndex = sizeClasses->sizeClassIndex;
 	
 	memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (NULL != extensions->sizeClassProfileInput) {
+		uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+		if (!readAllocationProfile(env, extensions->sizeClassProfileInput, profile)) {
+			return false;
+		}
+		deriveCellSizes(profile, _smallCellSizes);
+		_derivedFromProfile = true;
+		_defaultFragmentation = calculateFragmentation(profile, initialCellSizes);
+		_derivedFragmentation = calculateFragmentation(profile, _smallCellSizes);
+	}
+
+	if (NULL != extensions->sizeClassProfileOutput) {
+		_allocationProfile = (uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * OMR_SIZECLASSES_PROFILE_ENTRIES, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _allocationProfile) {
+			return false;
+		}
+		memset((void *)_allocationProfile, 0, sizeof(uintptr_t) * OMR_SIZECLASSES_PROFILE_ENTRIES);
+	}
 	
 	_sizeClassIndex[0] = 0;
 	_smallNumCells[0] = 0;
@@ -79,7 +108,187 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 void
 MM_SizeClasses::tearDown(MM_EnvironmentBase *envModron)
 {
-	
+	if (NULL != _allocationProfile) {
+		uintptr_t profile[OMR_SIZECLASSES_PROFILE_ENTRIES];
+		for (uintptr_t i = 0; i < OMR_SIZECLASSES_PROFILE_ENTRIES; i++) {
+			profile[i] = _allocationProfile[i];
+		}
+		writeAllocationProfile(envModron, envModron->getExtensions()->sizeClassProfileOutput, profile, _smallCellSizes);
+		envModron->getForge()->free((void *)_allocationProfile);
+		_allocationProfile = NULL;
+	}
+}
+
+void
+MM_SizeClasses::mergeAllocationProfile(uintptr_t *threadProfile)
+{
+	for (uintptr_t i = 0; i < OMR_SIZECLASSES_PROFILE_ENTRIES; i++) {
+		if (0 != threadProfile[i]) {
+			MM_AtomicOperations::add(&_allocationProfile[i], threadProfile[i]);
+			threadProfile[i] = 0;
+		}
+	}
+}
+
+void
+MM_SizeClasses::deriveCellSizes(const uintptr_t *profile, uintptr_t *cellSizes)
+{
+	uint64_t cumulativeCount[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	uint64_t cumulativeBytes[OMR_SIZECLASSES_PROFILE_ENTRIES];
+	cumulativeCount[0] = 0;
+	cumulativeBytes[0] = 0;
+	for (uintptr_t i = 1; i < OMR_SIZECLASSES_PROFILE_ENTRIES; i++) {
+		cumulativeCount[i] = cumulativeCount[i - 1] + profile[i];
+		cumulativeBytes[i] = cumulativeBytes[i - 1] + ((uint64_t)profile[i] * i * sizeof(uintptr_t));
+	}
+
+	if (0 == cumulativeCount[OMR_SIZECLASSES_PROFILE_ENTRIES - 1]) {
+		/* nothing to optimize for */
+		memcpy(cellSizes, initialCellSizes, sizeof(initialCellSizes));
+		return;
+	}
+
+	/* Candidate j is a cell size of SIZECLASSES_MIN_CELL_SIZE + j * SIZECLASSES_CELL_ALIGNMENT bytes. A size class
+	 * whose cell size is candidate j and whose next smaller class is candidate i serves every request above the
+	 * smaller cell size, so the bytes it wastes only depend on i and j. That makes the best table with k classes
+	 * ending at j the best table with k - 1 classes ending at some i < j, plus the waste of class (i, j].
+	 */
+	uint64_t previousWaste[SIZECLASSES_CANDIDATE_COUNT];
+	uint64_t currentWaste[SIZECLASSES_CANDIDATE_COUNT];
+	uint16_t smallerCandidate[OMR_SIZECLASSES_NUM_SMALL + 1][SIZECLASSES_CANDIDATE_COUNT];
+
+	for (uintptr_t j = 0; j < SIZECLASSES_CANDIDATE_COUNT; j++) {
+		uintptr_t cellSize = SIZECLASSES_MIN_CELL_SIZE + (j * SIZECLASSES_CELL_ALIGNMENT);
+		uintptr_t high = cellSize / sizeof(uintptr_t);
+		previousWaste[j] = (cumulativeCount[high] * cellSize) - cumulativeBytes[high];
+	}
+
+	for (uintptr_t k = 2; k <= OMR_SIZECLASSES_NUM_SMALL; k++) {
+		for (uintptr_t j = k - 1; j < SIZECLASSES_CANDIDATE_COUNT; j++) {
+			uintptr_t cellSize = SIZECLASSES_MIN_CELL_SIZE + (j * SIZECLASSES_CELL_ALIGNMENT);
+			uintptr_t high = cellSize / sizeof(uintptr_t);
+			uint64_t bestWaste = (uint64_t)-1;
+			uint16_t bestCandidate = 0;
+			for (uintptr_t i = k - 2; i < j; i++) {
+				uintptr_t low = (SIZECLASSES_MIN_CELL_SIZE + (i * SIZECLASSES_CELL_ALIGNMENT)) / sizeof(uintptr_t);
+				uint64_t waste = previousWaste[i] + ((cumulativeCount[high] - cumulativeCount[low]) * cellSize) - (cumulativeBytes[high] - cumulativeBytes[low]);
+				if (waste < bestWaste) {
+					bestWaste = waste;
+					bestCandidate = (uint16_t)i;
+				}
+			}
+			currentWaste[j] = bestWaste;
+			smallerCandidate[k][j] = bestCandidate;
+		}
+		memcpy(previousWaste, currentWaste, sizeof(previousWaste));
+	}
+
+	/* the largest class is pinned to the largest small size, walk back down from it */
+	uintptr_t candidate = SIZECLASSES_CANDIDATE_COUNT - 1;
+	cellSizes[0] = 0;
+	for (uintptr_t k = OMR_SIZECLASSES_NUM_SMALL; k >= 1; k--) {
+		cellSizes[k] = SIZECLASSES_MIN_CELL_SIZE + (candidate * SIZECLASSES_CELL_ALIGNMENT);
+		if (k > 1) {
+			candidate = smallerCandidate[k][candidate];
+		}
+	}
+}
+
+uintptr_t
+MM_SizeClasses::calculateFragmentation(const uintptr_t *profile, const uintptr_t *cellSizes)
+{
+	uint64_t wastedBytes = 0;
+	uint64_t consumedBytes = 0;
+	uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL;
+
+	for (uintptr_t i = 1; i < OMR_SIZECLASSES_PROFILE_ENTRIES; i++) {
+		uintptr_t size = i * sizeof(uintptr_t);
+		while (cellSizes[sizeClass] < size) {
+			sizeClass += 1;
+		}
+		wastedBytes += (uint64_t)profile[i] * (cellSizes[sizeClass] - size);
+		consumedBytes += (uint64_t)profile[i] * cellSizes[sizeClass];
+	}
+
+	return (0 == consumedBytes) ? 0 : (uintptr_t)((wastedBytes * 10000) / consumedBytes);
+}
+
+/**
+ * Lines hold a size in bytes and an allocation count, lines starting with '#' are comments.
+ */
+bool
+MM_SizeClasses::readAllocationProfile(MM_EnvironmentBase *env, const char *fileName, uintptr_t *profile)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	bool result = false;
+
+	memset(profile, 0, sizeof(uintptr_t) * OMR_SIZECLASSES_PROFILE_ENTRIES);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 != fd) {
+		int64_t length = omrfile_flength(fd);
+		if (0 <= length) {
+			char *buffer = (char *)env->getForge()->allocate((uintptr_t)length + 1, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+			if (NULL != buffer) {
+				if (length == omrfile_read(fd, buffer, (intptr_t)length)) {
+					buffer[length] = '\0';
+					char *cursor = buffer;
+					while ('\0' != *cursor) {
+						if ('#' != *cursor) {
+							char *end = NULL;
+							uintptr_t size = (uintptr_t)strtoul(cursor, &end, 10);
+							uintptr_t count = (uintptr_t)strtoul(end, &end, 10);
+							uintptr_t index = (size + sizeof(uintptr_t) - 1) / sizeof(uintptr_t);
+							if ((0 < index) && (index < OMR_SIZECLASSES_PROFILE_ENTRIES)) {
+								profile[index] += count;
+							}
+							cursor = end;
+						}
+						while (('\0' != *cursor) && ('\n' != *cursor)) {
+							cursor += 1;
+						}
+						while ('\n' == *cursor) {
+							cursor += 1;
+						}
+					}
+					result = true;
+				}
+				env->getForge()->free(buffer);
+			}
+		}
+		omrfile_close(fd);
+	}
+
+	return result;
+}
+
+void
+MM_SizeClasses::writeAllocationProfile(MM_EnvironmentBase *env, const char *fileName, const uintptr_t *profile, const uintptr_t *cellSizes)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 != fd) {
+		uintptr_t derivedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+		deriveCellSizes(profile, derivedCellSizes);
+		uintptr_t currentFragmentation = calculateFragmentation(profile, cellSizes);
+		uintptr_t derivedFragmentation = calculateFragmentation(profile, derivedCellSizes);
+
+		omrfile_printf(fd, "# small object allocation profile: <size in bytes> <allocation count>\n");
+		omrfile_printf(fd, "# fragmentation with the table in use: %zu.%02zu%%\n", currentFragmentation / 100, currentFragmentation % 100);
+		omrfile_printf(fd, "# fragmentation with the derived table: %zu.%02zu%%\n", derivedFragmentation / 100, derivedFragmentation % 100);
+		omrfile_printf(fd, "# derived table:");
+		for (uintptr_t sizeClass = OMR_SIZECLASSES_MIN_SMALL; sizeClass <= OMR_SIZECLASSES_MAX_SMALL; sizeClass++) {
+			omrfile_printf(fd, " %zu", derivedCellSizes[sizeClass]);
+		}
+		omrfile_printf(fd, "\n");
+		for (uintptr_t i = 1; i < OMR_SIZECLASSES_PROFILE_ENTRIES; i++) {
+			if (0 != profile[i]) {
+				omrfile_printf(fd, "%zu %zu\n", i * sizeof(uintptr_t), profile[i]);
+			}
+		}
+		omrfile_close(fd);
+	}
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -31,6 +31,9 @@
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+/* Number of entries in an allocation size profile, one per uintptr_t sized step up to the largest small size */
+#define OMR_SIZECLASSES_PROFILE_ENTRIES ((OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / sizeof(uintptr_t)) + 1)
+
 class MM_EnvironmentBase;
 
 class MM_SizeClasses : public MM_BaseVirtual
@@ -42,11 +45,54 @@ private:
 	uintptr_t* _smallCellSizes; /**< Array mapping size classes to the cell size of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _smallNumCells; /**< Array mapping size classes to the number of cells on a region of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _sizeClassIndex; /**< maps size request to size classes. The array actually lives in the OMR vm. */
+	volatile uintptr_t* _allocationProfile; /**< Merged histogram of small allocation sizes, indexed like _sizeClassIndex, or NULL when not profiling */
+	bool _derivedFromProfile; /**< True if the cell sizes were derived from a recorded profile rather than the static table */
+	uintptr_t _defaultFragmentation; /**< Internal fragmentation of the static table for the input profile, in hundredths of a percent */
+	uintptr_t _derivedFragmentation; /**< Internal fragmentation of the derived table for the input profile, in hundredths of a percent */
 	
 /* Methods */
 public:
 	static MM_SizeClasses* newInstance(MM_EnvironmentBase* env);
 	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Derive the small cell sizes which minimize internal fragmentation for an allocation size profile.
+	 * Cell sizes are multiples of 8 bytes, the smallest is at least 1 << OMR_SIZECLASSES_LOG_SMALLEST
+	 * and the largest is OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES, as the static table requires.
+	 * @param[in] profile allocation counts, OMR_SIZECLASSES_PROFILE_ENTRIES entries
+	 * @param[out] cellSizes derived table, OMR_SIZECLASSES_NUM_SMALL + 1 entries with entry 0 unused
+	 */
+	static void deriveCellSizes(const uintptr_t *profile, uintptr_t *cellSizes);
+
+	/**
+	 * Compute the internal fragmentation a table of cell sizes incurs for an allocation size profile.
+	 * @return bytes lost to rounding up to the cell size, in hundredths of a percent of the bytes consumed
+	 */
+	static uintptr_t calculateFragmentation(const uintptr_t *profile, const uintptr_t *cellSizes);
+
+	/**
+	 * Read an allocation size profile written by writeAllocationProfile().
+	 * @param[out] profile allocation counts, OMR_SIZECLASSES_PROFILE_ENTRIES entries
+	 * @return false if the file could not be read
+	 */
+	static bool readAllocationProfile(MM_EnvironmentBase *env, const char *fileName, uintptr_t *profile);
+
+	/**
+	 * Write an allocation size profile, with the fragmentation of the table in use and of the table derived from it as comments.
+	 * @param[in] profile allocation counts, OMR_SIZECLASSES_PROFILE_ENTRIES entries
+	 * @param[in] cellSizes table in use, OMR_SIZECLASSES_NUM_SMALL + 1 entries
+	 */
+	static void writeAllocationProfile(MM_EnvironmentBase *env, const char *fileName, const uintptr_t *profile, const uintptr_t *cellSizes);
+
+	/**
+	 * Add a thread's allocation size histogram to the merged profile and clear it.
+	 */
+	void mergeAllocationProfile(uintptr_t *threadProfile);
+
+	MMINLINE bool isProfilingAllocations() const { return NULL != _allocationProfile; }
+	MMINLINE bool isDerivedFromProfile() const { return _derivedFromProfile; }
+	MMINLINE uintptr_t getDefaultFragmentation() const { return _defaultFragmentation; }
+	MMINLINE uintptr_t getDerivedFragmentation() const { return _derivedFragmentation; }
 	
 	MMINLINE uintptr_t getCellSize(uintptr_t sizeClass) const
 	{
@@ -77,11 +123,16 @@ protected:
 	bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	MM_SizeClasses(MM_EnvironmentBase* env)
+		: _smallCellSizes(NULL)
+		, _smallNumCells(NULL)
+		, _sizeClassIndex(NULL)
+		, _allocationProfile(NULL)
+		, _derivedFromProfile(false)
+		, _defaultFragmentation(0)
+		, _derivedFragmentation(0)
 	{
 		_typeId = __FUNCTION__;
 	};
-	
-private:
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -24,11 +24,13 @@
 #include "sizeclasses.h"
 #include "ModronAssertions.h"
 
+#include "Dispatcher.hpp"
 #include "EnvironmentBase.hpp"
 #include "FreeHeapRegionList.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
+#include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "MarkMap.hpp"
 #include "MemoryPoolAggregatedCellList.hpp"
@@ -118,7 +120,12 @@ MM_SweepSchemeSegregated::sweep(MM_EnvironmentBase *env, MM_MemoryPoolSegregated
 		env->_currentTask->releaseSynchronizedGCThreads(env);
 	}
 
-	incrementalSweepSmall(env);
+	/* With lazy sweep the small regions stay on the sweep lists for the allocation path to sweep on demand */
+	if (!_extensions->segregatedLazySweep) {
+		incrementalSweepSmall(env);
+	} else {
+		creditUnsweptSmall(env);
+	}
 	regionPool->joinBucketListsForSplitIndex(env);
 
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
@@ -357,10 +364,48 @@ MM_SweepSchemeSegregated::addBytesFreedAfterSweep(MM_EnvironmentBase *env, MM_He
 	} else {
 		Assert_MM_unreachable();
 	}
-	env->_allocationTracker->addBytesFreed(env, (currentFreeBytes - memoryPoolACL->getPreSweepFreeBytes()));
+	updateBytesFreed(env, memoryPoolACL, currentFreeBytes);
+}
+
+void
+MM_SweepSchemeSegregated::updateBytesFreed(MM_EnvironmentBase *env, MM_MemoryPoolAggregatedCellList *memoryPoolACL, uintptr_t currentFreeBytes)
+{
+	uintptr_t preSweepFreeBytes = memoryPoolACL->getPreSweepFreeBytes();
+	if (currentFreeBytes >= preSweepFreeBytes) {
+		env->_allocationTracker->addBytesFreed(env, currentFreeBytes - preSweepFreeBytes);
+	} else {
+		/* the region was credited by creditUnsweptSmall() with cells that the sweep left as dark matter */
+		env->_allocationTracker->addBytesAllocated(env, preSweepFreeBytes - currentFreeBytes);
+	}
 	memoryPoolACL->setPreSweepFreeBytes(currentFreeBytes);
 }
 
+void
+MM_SweepSchemeSegregated::creditUnsweptSmall(MM_EnvironmentBase *env)
+{
+	/* Every small region in use has been moved to a sweep list by preSweep(), so the regions are found through
+	 * the region table and shared among the GC threads, leaving the sweep lists as they are.
+	 */
+	GC_HeapRegionIterator regionIterator(_extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+
+	while (NULL != (region = (MM_HeapRegionDescriptorSegregated *)regionIterator.nextRegion())) {
+		if (region->isSmall() && J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			uintptr_t cellSize = region->getCellSize();
+			uintptr_t numCells = region->getNumCells();
+			uintptr_t cellAddress = (uintptr_t)region->getLowAddress();
+			uintptr_t markedCells = 0;
+			for (uintptr_t cell = 0; cell < numCells; cell++) {
+				if (_markMap->isBitSet((omrobjectptr_t)cellAddress)) {
+					markedCells += 1;
+				}
+				cellAddress += cellSize;
+			}
+			updateBytesFreed(env, region->getMemoryPoolACL(), (numCells - markedCells) * cellSize);
+		}
+	}
+}
+
 uintptr_t
 MM_SweepSchemeSegregated::resetCoalesceFreeRegionCount(MM_EnvironmentBase *env)
 {
@@ -98,7 +98,17 @@ private:
 	void sweepArrayletRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void sweepLargeRegion(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
 	void addBytesFreedAfterSweep(MM_EnvironmentBase *env, MM_HeapRegionDescriptorSegregated *region);
+	void updateBytesFreed(MM_EnvironmentBase *env, MM_MemoryPoolAggregatedCellList *memoryPoolACL, uintptr_t currentFreeBytes);
 	void incrementalSweepSmall(MM_EnvironmentBase *env);
+
+	/**
+	 * Credit the allocation tracker with the bytes that the small regions left on the sweep lists for the
+	 * lazy sweep will free, as counted from the mark map, so that free memory reported after this collect
+	 * does not depend on how much of the heap has been swept yet. The credit is corrected when the regions
+	 * are swept and unmarked cells too small to be reused turn into dark matter. Called by every GC thread,
+	 * the regions being handed out as work units.
+	 */
+	void creditUnsweptSmall(MM_EnvironmentBase *env);
 	void incrementalSweepLarge(MM_EnvironmentBase *env);
 	void incrementalCoalesceFreeRegions(MM_EnvironmentBase *env);
 
@@ -431,12 +431,14 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
 				_subAreaTable[i].state = state;
+				_subAreaTable[i].liveBytes = 0;
 				_subAreaTable[i++].currentAction = SubAreaEntry::none;
 			}
 			_subAreaTable[i].freeChunk = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].memoryPool = NULL;
 			_subAreaTable[i].firstObject = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].state = SubAreaEntry::end_segment;
+			_subAreaTable[i].liveBytes = 0;
 			_subAreaTable[i++].currentAction = SubAreaEntry::none;
 		}
 		_subAreaTable[i].state = SubAreaEntry::end_heap;
@@ -489,6 +491,7 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 				_subAreaTable[j].firstObject = _subAreaTable[i].firstObject;
 				_subAreaTable[j].memoryPool = _subAreaTable[i].memoryPool;
 				_subAreaTable[j].state = _subAreaTable[i].state;
+				_subAreaTable[j].liveBytes = 0;
 				if ((j > 0) && (_subAreaTable[j-1].state == SubAreaEntry::init)) {
 					_compactFrom = (_compactFrom < _subAreaTable[j-1].firstObject) ? _compactFrom : _subAreaTable[j-1].firstObject;
 					_compactTo = (_compactTo > _subAreaTable[j].firstObject) ? _compactTo : _subAreaTable[j].firstObject;
@@ -527,6 +530,87 @@ MM_CompactScheme::completeSubAreaTable(MM_EnvironmentStandard *env)
 	}
 }
 
+/**
+ *  Summary phase of a region partitioned compaction: record the live bytes of each sub area.
+ */
+void
+MM_CompactScheme::summarizeSubAreas(MM_EnvironmentStandard *env)
+{
+	for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+		if (SubAreaEntry::init != _subAreaTable[i].state) {
+			continue;
+		}
+
+		if (changeSubAreaAction(env, &_subAreaTable[i], SubAreaEntry::summarizing)) {
+			/* same range as doCompact() will walk for this sub area */
+			uintptr_t *start = (uintptr_t *)_subAreaTable[i].firstObject;
+			uintptr_t *end = (uintptr_t *)pageStart(pageIndex(_subAreaTable[i + 1].firstObject));
+			MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, start, end);
+			omrobjectptr_t objectPtr = NULL;
+			uintptr_t liveBytes = 0;
+
+			while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+				liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+			}
+			_subAreaTable[i].liveBytes = liveBytes;
+		}
+	}
+}
+
+/**
+ *  Coalesce the sub area table into partitions of roughly equal live bytes.
+ */
+void
+MM_CompactScheme::partitionSubAreas(MM_EnvironmentStandard *env)
+{
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		uintptr_t totalLiveBytes = 0;
+		for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+			if (SubAreaEntry::init == _subAreaTable[i].state) {
+				totalLiveBytes += _subAreaTable[i].liveBytes;
+			}
+		}
+
+		/* A few partitions per thread so that threads which finish early can pick up another one */
+		uintptr_t partitionCount = env->_currentTask->getThreadCount() * OMR_MAX(_extensions->compactPartitionsPerThread, 1);
+		uintptr_t partitionLiveBytes = OMR_MAX(totalLiveBytes / partitionCount, 1);
+
+		/* Coalesce in place. A sub area starts a new partition at a segment boundary, next to a sub area
+		 * which is not compacted, or once the current partition holds its share of the live bytes. The
+		 * first object of each partition is the first object of its first sub area, so the limits found by
+		 * setRealLimitsSubAreas() remain valid, and the partitions are evacuated and fixed up exactly like
+		 * sub areas.
+		 */
+		uintptr_t j = 0;
+		uintptr_t partitions = 0;
+		for (uintptr_t i = 0; SubAreaEntry::end_heap != _subAreaTable[i].state; i++) {
+			if ((0 == j)
+			|| (SubAreaEntry::init != _subAreaTable[i].state)
+			|| (SubAreaEntry::init != _subAreaTable[j - 1].state)
+			|| (_subAreaTable[j - 1].liveBytes >= partitionLiveBytes)
+			) {
+				_subAreaTable[j].firstObject = _subAreaTable[i].firstObject;
+				_subAreaTable[j].memoryPool = _subAreaTable[i].memoryPool;
+				_subAreaTable[j].freeChunk = _subAreaTable[i].freeChunk;
+				_subAreaTable[j].state = _subAreaTable[i].state;
+				_subAreaTable[j].liveBytes = _subAreaTable[i].liveBytes;
+				_subAreaTable[j].currentAction = SubAreaEntry::none;
+				if (SubAreaEntry::init == _subAreaTable[j].state) {
+					partitions += 1;
+				}
+				j++;
+			} else {
+				_subAreaTable[j - 1].liveBytes += _subAreaTable[i].liveBytes;
+			}
+		}
+		_subAreaTable[j].state = SubAreaEntry::end_heap;
+
+		env->_compactStats._partitionCount = partitions;
+
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
 void
 MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, bool aggressive)
 {
@@ -568,6 +652,18 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	workerSetupForGC(env, singleThreaded);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
 
+	/* A region partitioned compaction plans the work from the live bytes of each sub area, so that the
+	 * units the threads evacuate and fix up are balanced by live data rather than by address range.
+	 * Partitions still evacuate into the space freed by earlier ones. A single threaded compaction
+	 * already uses one sub area per segment, so there is nothing to partition.
+	 */
+	if (!singleThreaded && _extensions->compactRegionPartitioned) {
+		env->_compactStats._summaryStartTime = omrtime_hires_clock();
+		summarizeSubAreas(env);
+		partitionSubAreas(env);
+		env->_compactStats._summaryEndTime = omrtime_hires_clock();
+	}
+
 	/* If a single threaded compaction force compact to run on master thread. Required
 	 * to ensure all events issued on master thread.
 	 */
@@ -600,6 +696,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 
 	MM_AtomicOperations::sync();
 
+	env->_compactStats._rebuildStartTime = omrtime_hires_clock();
 	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
 		rebuildFreelist(env);
 
@@ -618,6 +715,7 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		rebuildMarkbits(env);
 		MM_AtomicOperations::sync();
 	}
+	env->_compactStats._rebuildEndTime = omrtime_hires_clock();
 
 	_delegate.workerCleanupAfterGC(env);
 
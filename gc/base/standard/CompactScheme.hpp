@@ -93,11 +93,13 @@ private:
 		omrobjectptr_t freeChunk;
         volatile uintptr_t state;
         volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+        uintptr_t liveBytes; /**< bytes of marked objects in the subarea, recorded by the summary phase of a region partitioned compaction */
         
     	/* legal values for currentAction */
     	enum {
     		none = 0,
     		setting_real_limits,
+    		summarizing,
     		evacuating,
     		fixing_up,
     		rebuilding_mark_bits,
@@ -169,6 +171,21 @@ protected:
     void removeNullSubAreas(MM_EnvironmentStandard *env);
     void completeSubAreaTable(MM_EnvironmentStandard *env);
 
+    /**
+     * Record the live bytes of every sub area (summary phase of a region partitioned compaction)
+     *
+     * @param env[in] the current thread
+     */
+    void summarizeSubAreas(MM_EnvironmentStandard *env);
+
+    /**
+     * Coalesce adjacent sub areas into partitions holding roughly equal live bytes, which are then
+     * evacuated and fixed up as sub areas, so that each unit of work costs about the same.
+     *
+     * @param env[in] the current thread
+     */
+    void partitionSubAreas(MM_EnvironmentStandard *env);
+
     void saveForwardingPtr(class CompactTableEntry&,
                             omrobjectptr_t objectPtr,
                             omrobjectptr_t forwardingPtr,
@@ -1259,7 +1259,9 @@ MM_ConcurrentCardTable::isCardTableEmpty(MM_EnvironmentBase *env)
 			endCard = heapAddrToCardAddr(env, region->getHighAddress());
 
 			while(currentCard < endCard) {
-				if ((Card)CARD_DIRTY == *currentCard) {
+				/* skip clean cards many at a time; only cards which are not clean need to be examined */
+				currentCard = (Card *)_extensions->bitmapScanner.skipZeroBytes((uint8_t *)currentCard, (uint8_t *)endCard);
+				if ((currentCard < endCard) && ((Card)CARD_DIRTY == *currentCard)) {
 					empty = false;
 					break;
 				}
@@ -1627,25 +1629,17 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 
 		for (currentCard = firstCard; currentCard < lastCardToClean; currentCard++) {
 
-			/* Are we are on an uintptr_t boundary? If so scan the card table a uintptr_t
-	 		 * at a time until we find a slot which is non-zero or the end of card table
-	 		 * found. This is based on the premise that the card table will be mostly
-	 		 * empty and scanning an uintptr_t at a time will reduce the time taken to
+			/* Is this card clean? If so skip the run of clean (zero) cards which follows,
+	 		 * many cards at a time, until we find a card which is not clean or the end of
+	 		 * card table. This is based on the premise that the card table will be mostly
+	 		 * empty and testing many cards at once will reduce the time taken to
 	 		 * scan the card table.
 	 		 */
-			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
-				uintptr_t *nextSlot = (uintptr_t *)currentCard;
-				/* Last card may be in middle of a slot so only scan up to an including last
-				 * complete slots worth of cards; then go card at a time
-				 **/
-				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
-				}
+			if ((Card)CARD_CLEAN == *currentCard) {
 				/*
-			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
+			     * Either end of scan or a card which is not clean found. Reset scan ptr
 				 */
-				currentCard = (Card *)nextSlot;
+				currentCard = (Card *)_extensions->bitmapScanner.skipZeroBytes((uint8_t *)currentCard, (uint8_t *)lastCardToClean);
 
 				if (currentCard >= lastCardToClean) {
 					break;
@@ -351,23 +351,17 @@ MM_ConcurrentCardTableForWC::prepareCardTableChunk(MM_EnvironmentBase *env, Card
 				endCard = prepareAddress + currentPrepareSize;
 				
 				for (Card *currentCard = firstCard; currentCard < endCard; currentCard++) {
-					/* Are we are on an uintptr_t boundary ?. If so scan the card table a uintptr_t
-					 * at a time until we find a slot which is non-zero or the end of card table
-					 * found. This is based on the premise that the card table will be mostly
-					 * empty and scanning an uintptr_t at a time will reduce the time taken to
+					/* Is this card clean ? If so skip the run of clean (zero) cards which follows,
+					 * many cards at a time, until we find a card which is not clean or the end of
+					 * card table. This is based on the premise that the card table will be mostly
+					 * empty and testing many cards at once will reduce the time taken to
 					 * scan the card table.
 					 */
-					if (((Card)CARD_CLEAN == *currentCard) &&
-						((uintptr_t)currentCard % sizeof(uintptr_t) == 0)) {
-						 uintptr_t *nextSlot= (uintptr_t *)currentCard;
-						while ( ((Card *)nextSlot < endCard) && (*nextSlot == SLOT_ALL_CLEAN) ) {
-							nextSlot++;
-						}
-						
+					if ((Card)CARD_CLEAN == *currentCard) {
 						/*
-						 * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
+						 * Either end of scan or a card which is not clean found. Reset scan ptr
 						 */
-						currentCard= (Card *)nextSlot; 
+						currentCard = (Card *)_extensions->bitmapScanner.skipZeroBytes((uint8_t *)currentCard, (uint8_t *)endCard);
 
 						/* End of card table reached ? */
 						if (currentCard >= endCard) {
@@ -80,6 +80,10 @@
 #if defined(OMR_GC_REALTIME)
 #include "RememberedSetSATB.hpp"
 #endif /* defined(OMR_GC_REALTIME) */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetMap.hpp"
+#include "RememberedSetMapChunkIterator.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 typedef struct ConHelperThreadInfo {
 	OMR_VM *omrVM;
@@ -318,7 +322,11 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, u
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase3Kickoff(),
-		_stats.getConcurrentWorkStackOverflowCount()
+		_stats.getConcurrentWorkStackOverflowCount(),
+		_extensions->cardCleaningPacing ? getCardCleaningPacingBound() : 0,
+		_predictedFinalCleanCards,
+		_predictedFinalCleanTime,
+		_unpacedCardCleaningThreshold
 	);
 }
 
@@ -1431,6 +1439,10 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 
 	/* Determine card cleaning thresholds */
 	cardCleaningThreshold = ((uintptr_t)((float)kickoffThreshold / _cardCleaningThresholdFactor));
+	uintptr_t unpacedCardCleaningThreshold = cardCleaningThreshold;
+	if (_extensions->cardCleaningPacing) {
+		cardCleaningThreshold = pacedCardCleaningThreshold(env, cardCleaningThreshold, kickoffThreshold);
+	}
 
 	/* We need to ensure that we complete tracing just before we run out of
 	 * storage otherwise we will more than likely get an AF whilst last few allocates
@@ -1455,6 +1467,9 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 	kickoffThresholdPlusBuffer = (uintptr_t)((float)kickoffThreshold + boost + ((float)_extensions->concurrentSlack * kickoffProportion));
 	_stats.setKickoffThreshold(kickoffThresholdPlusBuffer);
 	_stats.setCardCleaningThreshold((uintptr_t)((float)cardCleaningThreshold + boost + ((float)_extensions->concurrentSlack * cardCleaningProportion)));
+	/* Buffer the threshold card cleaning would have had without pacing the same way, for reporting */
+	cardCleaningProportion = (float)unpacedCardCleaningThreshold / (float)kickoffThreshold;
+	_unpacedCardCleaningThreshold = (uintptr_t)((float)unpacedCardCleaningThreshold + boost + ((float)_extensions->concurrentSlack * cardCleaningProportion));
 	_kickoffThresholdBuffer = MM_Math::saturatingSubtract(kickoffThresholdPlusBuffer, kickoffThreshold);
 
 	if (_extensions->debugConcurrentMark) {
@@ -1467,6 +1482,10 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 							 _stats.getKickoffThreshold(), _kickoffThresholdBuffer);
 		omrtty_printf("               Card Cleaning Threshold=\"%zu\" \n",
 							_stats.getCardCleaningThreshold());
+		if (_extensions->cardCleaningPacing) {
+			omrtty_printf("               Card Cleaning Pacing: Bound=\"%zu\" Cards dirtied per KB=\"%.3f\" Pacing factor=\"%.3f\"\n",
+							getCardCleaningPacingBound(), _cardsDirtiedPerByte * 1024, _cardCleaningPacingFactor);
+		}
 		omrtty_printf("               Init Work Required=\"%zu\" \n",
 							_stats.getInitWorkRequired());
 	}
@@ -1490,6 +1509,152 @@ MM_ConcurrentGC::tuneToHeap(MM_EnvironmentBase *env)
 	Trc_MM_ConcurrentGC_tuneToHeap_Exit2(env->getLanguageVMThread(), _stats.getTraceSizeTarget(), _stats.getInitWorkRequired(), _stats.getKickoffThreshold());
 }
 
+/**
+ * Determine how many dirty cards final card cleaning should be left with when card cleaning is paced.
+ * Once the cost of final cleaning a card is known a final card cleaning time budget can tighten,
+ * but never relax, the configured bound.
+ *
+ * @return the number of dirty cards pacing aims to leave for final card cleaning
+ */
+uintptr_t
+MM_ConcurrentGC::getCardCleaningPacingBound()
+{
+	uintptr_t bound = _extensions->cardCleaningPacingBound;
+
+	if ((0 != _extensions->cardCleaningPacingBudget) && (0 < _finalCleanTimePerCard)) {
+		uintptr_t budgetBound = (uintptr_t)((float)_extensions->cardCleaningPacingBudget / _finalCleanTimePerCard);
+		bound = OMR_MIN(bound, budgetBound);
+	}
+
+	return bound;
+}
+
+/**
+ * Pace the start of concurrent card cleaning.
+ * Cards cleaned concurrently are re-dirtied by mutators at a rate which follows allocation, so the
+ * longer the card cleaning window (bytes allocated between card cleaning kickoff and the final
+ * collection) the more cards are left for final card cleaning. Pick the longest window which keeps
+ * the predicted number of re-dirtied cards under the pacing bound, but never one too short for
+ * mutators and helpers to clean the predicted cards at the maximum allocation tax.
+ *
+ * @param cardCleaningThreshold the card cleaning threshold derived from the kickoff threshold
+ * @param kickoffThreshold the concurrent kickoff threshold; card cleaning can not start before it
+ * @return the paced card cleaning threshold
+ */
+uintptr_t
+MM_ConcurrentGC::pacedCardCleaningThreshold(MM_EnvironmentBase *env, uintptr_t cardCleaningThreshold, uintptr_t kickoffThreshold)
+{
+	uintptr_t pacedThreshold = cardCleaningThreshold;
+
+	/* Nothing to pace against until a completed cycle has measured the dirtying rate */
+	if ((0 < _cardsDirtiedPerByte) && (0 < getAllocToTraceRateMax())) {
+		float bytesToClean = (float)(_bytesToCleanPass1 + _bytesToCleanPass2);
+		float shortestWindow = (bytesToClean / getAllocToTraceRateMax()) * _cardCleaningPacingFactor;
+		float pacedWindow = (float)getCardCleaningPacingBound() / _cardsDirtiedPerByte;
+
+		pacedWindow = OMR_MIN(pacedWindow, (float)cardCleaningThreshold);
+		pacedWindow = OMR_MAX(pacedWindow, shortestWindow);
+		pacedThreshold = OMR_MIN((uintptr_t)pacedWindow, kickoffThreshold);
+	}
+
+	return pacedThreshold;
+}
+
+/**
+ * Determine if card cleaning should wait for the paced card cleaning threshold even though
+ * tracing has run out of work. Starting early only gives mutators longer to re-dirty the
+ * cards cleaned first.
+ *
+ * @return TRUE if card cleaning should not be kicked off yet; FALSE otherwise
+ */
+bool
+MM_ConcurrentGC::isCardCleaningDeferredByPacing(MM_EnvironmentBase *env)
+{
+	bool deferred = false;
+
+	if (_extensions->cardCleaningPacing && (0 < _cardsDirtiedPerByte)) {
+		MM_Heap *heap = (MM_Heap *)_extensions->heap;
+		deferred = (heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD) >= _stats.getCardCleaningThreshold());
+	}
+
+	return deferred;
+}
+
+/**
+ * Determine how many bytes have been allocated since the first phase of card cleaning started.
+ *
+ * @return the card cleaning window in bytes, or 0 if card cleaning has not been started
+ */
+uintptr_t
+MM_ConcurrentGC::getCardCleaningWindow(MM_EnvironmentBase *env)
+{
+	uintptr_t window = 0;
+	uintptr_t kickoffFree = _cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff();
+
+	if (HIGH_VALUES != kickoffFree) {
+		MM_Heap *heap = (MM_Heap *)_extensions->heap;
+		window = MM_Math::saturatingSubtract(kickoffFree, heap->getApproximateActiveFreeMemorySize(MEMORY_TYPE_OLD));
+	}
+
+	return window;
+}
+
+/**
+ * Predict how many cards final card cleaning will find dirty, and how long cleaning them
+ * will take, from the card cleaning window of the cycle being completed.
+ */
+void
+MM_ConcurrentGC::predictFinalCardCleaning(MM_EnvironmentBase *env)
+{
+	_predictedFinalCleanCards = (uintptr_t)(_cardsDirtiedPerByte * (float)getCardCleaningWindow(env));
+	_predictedFinalCleanTime = (uint64_t)((float)_predictedFinalCleanCards * _finalCleanTimePerCard);
+}
+
+/**
+ * Feed the outcome of final card cleaning back into the pacing model.
+ *
+ * @param duration the final card cleaning time in hi-res ticks
+ */
+void
+MM_ConcurrentGC::updateCardCleaningPacing(MM_EnvironmentBase *env, uint64_t duration)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t finalCleanedCards = _cardTable->getCardTableStats()->getFinalCleanedCards();
+
+	/* A system GC cuts the cycle short so says nothing about how fast cards get dirtied */
+	if ((NULL == env->_cycleState) || env->_cycleState->_gcCode.isExplicitGC()) {
+		return;
+	}
+
+	if (0 < finalCleanedCards) {
+		uint64_t durationUs = omrtime_hires_delta(0, duration, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		float timePerCard = (float)durationUs / (float)finalCleanedCards;
+		_finalCleanTimePerCard = (0 < _finalCleanTimePerCard) ? MM_Math::weightedAverage(_finalCleanTimePerCard, timePerCard, CARD_CLEANING_PACING_HISTORY_WEIGHT) : timePerCard;
+	}
+
+	switch (_stats.getExecutionModeAtGC()) {
+	/* Card cleaning completed so every card left dirty was dirtied inside the window */
+	case CONCURRENT_EXHAUSTED:
+	case CONCURRENT_FINAL_COLLECTION:
+	{
+		uintptr_t window = getCardCleaningWindow(env);
+		if (0 < window) {
+			float cardsDirtiedPerByte = (float)finalCleanedCards / (float)window;
+			_cardsDirtiedPerByte = (0 < _cardsDirtiedPerByte) ? MM_Math::weightedAverage(_cardsDirtiedPerByte, cardsDirtiedPerByte, CARD_CLEANING_PACING_HISTORY_WEIGHT) : cardsDirtiedPerByte;
+		}
+		_cardCleaningPacingFactor = MM_Math::weightedAverage(_cardCleaningPacingFactor, (float)1.0, CARD_CLEANING_PACING_HISTORY_WEIGHT);
+		break;
+	}
+	/* Card cleaning was started too late to complete; allow it a longer window next cycle */
+	case CONCURRENT_TRACE_ONLY:
+	case CONCURRENT_CLEAN_TRACE:
+		_cardCleaningPacingFactor = OMR_MIN(_cardCleaningPacingFactor * CARD_CLEANING_PACING_FACTOR_INCREMENT, CARD_CLEANING_PACING_FACTOR_MAX);
+		break;
+	default:
+		break;
+	}
+}
+
 /**
  * Adjust the current trace target after heap change.
  * The heap has been reconfigured (i.e expanded or contracted) midway through a
@@ -2617,7 +2782,8 @@ MM_ConcurrentGC::doConcurrentTrace(MM_EnvironmentBase *env,
 				 * we have passed the peak of tracing activity then we may as well
 				 * start card cleaning now.
 				 */
-				if ((_markingScheme->getWorkPackets()->tracingExhausted() || tracingRateDropped(env)) && _stats.isRootTracingComplete()) {
+				if ((_markingScheme->getWorkPackets()->tracingExhausted() || tracingRateDropped(env)) && _stats.isRootTracingComplete()
+					&& !isCardCleaningDeferredByPacing(env)) {
 					kickoffCardCleaning(env, TRACING_COMPLETED);
 				} else {
 					/* Nothing to do and not time to start card cleaning yet */
@@ -3039,7 +3205,7 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 			_dispatcher->run(env, &clearNewMarkBitsTask);
 
 			/* If remembered set if not empty then re-scan any objects in the remembered set */
-			if (!(_extensions->rememberedSet.isEmpty())) {
+			if (!(_extensions->rememberedSet.isEmpty()) || (NULL != _extensions->rememberedSetMap)) {
 				MM_ConcurrentScanRememberedSetTask scanRememberedSetTask(env, _dispatcher, this, env->_cycleState);
 				_dispatcher->run(env, &scanRememberedSetTask);
 			}
@@ -3050,6 +3216,10 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 
 		if (_extensions->configuration->isIncrementalUpdateBarrierEnabled()) {
 
+			if (_extensions->cardCleaningPacing) {
+				predictFinalCardCleaning(env);
+			}
+
 			reportConcurrentFinalCardCleaningStart(env);
 			uint64_t startTime = omrtime_hires_clock();
 
@@ -3073,7 +3243,11 @@ MM_ConcurrentGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *
 			/* reset overflow flag */
 			_markingScheme->getWorkPackets()->clearOverflowFlag();
 
-			reportConcurrentFinalCardCleaningEnd(env, omrtime_hires_clock() - startTime);
+			uint64_t duration = omrtime_hires_clock() - startTime;
+			reportConcurrentFinalCardCleaningEnd(env, duration);
+			if (_extensions->cardCleaningPacing) {
+				updateCardCleaningPacing(env, duration);
+			}
 #if defined(DEBUG)
 			Assert_MM_true(_cardTable->isCardTableEmpty(env));
 #endif
@@ -3509,6 +3683,47 @@ MM_ConcurrentGC::finalCleanCards(MM_EnvironmentBase *env)
 }
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
+MMINLINE bool
+MM_ConcurrentGC::scanRememberedObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t maxPushes, uintptr_t *bytesTraced)
+{
+	/* For all objects in remembered set that have been marked scan the object
+	 * unless its card is dirty in which case we leave it for later processing
+	 * by finalCleanCards()
+	 */
+	if((objectPtr >= _heapBase)
+		&& (objectPtr <  _heapAlloc)
+		&& _markingScheme->isMarkedOutline(objectPtr)
+		&& !_cardTable->isObjectInDirtyCardNoCheck(env,objectPtr)) {
+			if (_extensions->dirtCardDuringRSScan) {
+				_cardTable->dirtyCard(env, objectPtr);
+			} else {
+				/* VMDESIGN 2048 -- due to barrier elision optimizations, the JIT may not have dirtied
+				 * cards for some objects in the remembered set. Therefore we may discover references
+				 * to both nursery and tenure objects while scanning remembered objects.
+				 */
+
+				*bytesTraced += _markingScheme->scanObject(env,objectPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
+
+				/* Have we pushed enough new references? */
+				if(env->_workStack.getPushCount() >= maxPushes) {
+					/* To reduce the chances of mark stack overflow, we do some marking
+					 * of what we have just pushed.
+					 *
+					 * WARNING. If we HALTED concurrent then we will process any remaining
+					 * workpackets at this point. This will make RS processing appear more
+					 * expensive than it really is.
+					 */
+					while(NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
+						*bytesTraced += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_PACKET);
+					}
+					env->_workStack.clearPushCount();
+				}
+			}
+			return true;
+	}
+	return false;
+}
+
 /**
  * Scan remembered set looking for any MARKED objects which are not in dirty cards.
  * A marked object which is not in a dirty card needs rescanning now for any references
@@ -3536,40 +3751,26 @@ MM_ConcurrentGC::scanRememberedSet(MM_EnvironmentBase *env)
 			GC_SublistSlotIterator rememberedSetSlotIterator(puddle);
 			while((slotPtr = (omrobjectptr_t*)rememberedSetSlotIterator.nextSlot()) != NULL) {
 				objectPtr = *slotPtr;
-				/* For all objects in remembered set that have been marked scan the object
-				 * unless its card is dirty in which case we leave it for later processing
-				 * by finalCleanCards()
-				 */
-				if((objectPtr >= _heapBase)
-					&& (objectPtr <  _heapAlloc)
-					&& _markingScheme->isMarkedOutline(objectPtr)
-					&& !_cardTable->isObjectInDirtyCardNoCheck(env,objectPtr)) {
-						RSObjects += 1;
-						if (_extensions->dirtCardDuringRSScan) {
-							_cardTable->dirtyCard(env, objectPtr);
-						} else {
-							/* VMDESIGN 2048 -- due to barrier elision optimizations, the JIT may not have dirtied
-							 * cards for some objects in the remembered set. Therefore we may discover references
-							 * to both nursery and tenure objects while scanning remembered objects.
-							 */
+				if (scanRememberedObject(env, objectPtr, maxPushes, &bytesTraced)) {
+					RSObjects += 1;
+				}
+			}
+		}
+	}
 
-							bytesTraced += _markingScheme->scanObject(env,objectPtr, SCAN_REASON_REMEMBERED_SET_SCAN);
-
-							/* Have we pushed enough new references? */
-							if(env->_workStack.getPushCount() >= maxPushes) {
-								/* To reduce the chances of mark stack overflow, we do some marking
-								 * of what we have just pushed.
-								 *
-								 * WARNING. If we HALTED concurrent then we will process any remaining
-								 * workpackets at this point. This will make RS processing appear more
-								 * expensive than it really is.
-								 */
-								while(NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
-									bytesTraced += _markingScheme->scanObject(env, objectPtr, SCAN_REASON_PACKET);
-								}
-								env->_workStack.clearPushCount();
-							}
-						}
+	/* Objects remembered once the remembered set list reached its maximum size are recorded in the remembered set map */
+	MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+	if (NULL != rememberedSetMap) {
+		GC_RememberedSetMapChunkIterator chunkIterator(_extensions);
+		uintptr_t *chunkBase = NULL;
+		uintptr_t *chunkTop = NULL;
+		while (chunkIterator.nextChunk(&chunkBase, &chunkTop)) {
+			if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				MM_HeapMapIterator rememberedObjectIterator(_extensions, rememberedSetMap, chunkBase, chunkTop, false);
+				while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+					if (scanRememberedObject(env, objectPtr, maxPushes, &bytesTraced)) {
+						RSObjects += 1;
+					}
 				}
 			}
 		}
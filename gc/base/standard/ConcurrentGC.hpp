@@ -96,6 +96,18 @@ void J9ConcurrentWriteBarrierBatchStore (OMR_VMThread *vmThread, omrobjectptr_t
 #define CARD_CLEANING_THRESHOLD_FACTOR_8 (float)3.0  
 #define CARD_CLEANING_THRESHOLD_FACTOR_10 (float)1.5   
  
+/**
+ * @}
+ */
+
+/**
+ * @name Concurrent mark card cleaning pacing
+ * @{
+ */
+#define CARD_CLEANING_PACING_HISTORY_WEIGHT ((float)0.7)
+#define CARD_CLEANING_PACING_FACTOR_INCREMENT ((float)1.25)
+#define CARD_CLEANING_PACING_FACTOR_MAX ((float)4.0)
+
 /**
  * @}
  */
@@ -249,6 +261,14 @@ private:
 	float _maxCardCleaningFactorPass2;
 	float _cardCleaningThresholdFactor;
 
+	/* Concurrent card cleaning pacing statistics */
+	float _cardsDirtiedPerByte; /**< weighted average of cards left dirty for final card cleaning per byte allocated since card cleaning kickoff */
+	float _finalCleanTimePerCard; /**< weighted average of final card cleaning time per card, in microseconds */
+	float _cardCleaningPacingFactor; /**< stretch applied to the shortest card cleaning window; raised whenever paced card cleaning did not complete */
+	uintptr_t _predictedFinalCleanCards; /**< cards the pacing model expected to be dirty at the start of the last final card cleaning */
+	uint64_t _predictedFinalCleanTime; /**< final card cleaning time, in microseconds, the pacing model expected for the last collection */
+	uintptr_t _unpacedCardCleaningThreshold; /**< card cleaning threshold derived from the kickoff threshold before pacing was applied */
+
 	bool _forcedKickoff;	/**< Kickoff forced externally flag */
 
 	uintptr_t _languageKickoffReason;
@@ -306,6 +326,13 @@ private:
 	void updateTuningStatistics(MM_EnvironmentBase *env);
 	void tuneToHeap(MM_EnvironmentBase *env);
 
+	uintptr_t getCardCleaningPacingBound();
+	uintptr_t pacedCardCleaningThreshold(MM_EnvironmentBase *env, uintptr_t cardCleaningThreshold, uintptr_t kickoffThreshold);
+	bool isCardCleaningDeferredByPacing(MM_EnvironmentBase *env);
+	uintptr_t getCardCleaningWindow(MM_EnvironmentBase *env);
+	void predictFinalCardCleaning(MM_EnvironmentBase *env);
+	void updateCardCleaningPacing(MM_EnvironmentBase *env, uint64_t duration);
+
 	void conHelperEntryPoint(OMR_VMThread *omrThread, uintptr_t slaveID);
 	void shutdownAndExitConHelperThread(OMR_VMThread *omrThread);
 
@@ -316,6 +343,16 @@ private:
 	bool tracingRateDropped(MM_EnvironmentBase *env);
 #if defined(OMR_GC_MODRON_SCAVENGER)	
 	uintptr_t potentialFreeSpace(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription);
+
+	/**
+	 * Rescan a single remembered object if it is marked and its card is not dirty.
+	 * @param env The environment for the calling thread
+	 * @param objectPtr The remembered object
+	 * @param maxPushes Number of work stack pushes after which the pushed references are traced immediately
+	 * @param bytesTraced[out] Incremented by the number of bytes traced
+	 * @return true if the object was rescanned (or had its card dirtied), false if it was skipped
+	 */
+	MMINLINE bool scanRememberedObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr, uintptr_t maxPushes, uintptr_t *bytesTraced);
 #endif /*OMR_GC_MODRON_SCAVENGER */	
 
 	bool cleanCards(MM_EnvironmentBase *env, bool isMutator, uintptr_t sizeToDo, uintptr_t  *sizeDone, bool threadAtSafePoint);
@@ -518,6 +555,12 @@ public:
 		,_lastTotalTraced(0)
 		,_lastConHelperTraceSizeCount(0)
 		,_alloc2ConHelperTraceRate(0)
+		,_cardsDirtiedPerByte(0)
+		,_finalCleanTimePerCard(0)
+		,_cardCleaningPacingFactor(1.0)
+		,_predictedFinalCleanCards(0)
+		,_predictedFinalCleanTime(0)
+		,_unpacedCardCleaningThreshold(0)
 		,_forcedKickoff(false)
 		,_languageKickoffReason(NO_LANGUAGE_KICKOFF_REASON)
 		,_conHelpersRequest(CONCURRENT_HELPER_WAIT)
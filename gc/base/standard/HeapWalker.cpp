@@ -29,13 +29,18 @@
 #include "Dispatcher.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "HeapMapIterator.hpp"
 #include "HeapRegionIterator.hpp"
 #include "HeapRegionManager.hpp"
 #include "MemorySubSpace.hpp"
-#include "ObjectHeapIteratorAddressOrderedList.hpp"
+#include "ObjectHeapBufferedIterator.hpp"
 #include "ObjectIterator.hpp"
 #include "ObjectModel.hpp"
 #include "OMRVMInterface.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetMap.hpp"
+#include "RememberedSetMapChunkIterator.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #include "SlotObject.hpp"
 #include "SublistIterator.hpp"
 #include "SublistSlotIterator.hpp"
@@ -151,6 +156,22 @@ MM_HeapWalker::rememberedObjectSlotsDo(MM_EnvironmentBase *env, MM_HeapWalkerSlo
 			}
 		}
 	}
+
+	MM_RememberedSetMap *rememberedSetMap = env->getExtensions()->rememberedSetMap;
+	if (NULL != rememberedSetMap) {
+		GC_RememberedSetMapChunkIterator chunkIterator(env->getExtensions());
+		uintptr_t *chunkBase = NULL;
+		uintptr_t *chunkTop = NULL;
+		while (chunkIterator.nextChunk(&chunkBase, &chunkTop)) {
+			if (!parallel || J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+				MM_HeapMapIterator rememberedObjectIterator(env->getExtensions(), rememberedSetMap, chunkBase, chunkTop, false);
+				omrobjectptr_t objectPtr = NULL;
+				while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+					heapWalkerObjectSlotDo(omrVMThread, NULL, objectPtr, &slotObjectDoUserData);
+				}
+			}
+		}
+	}
 }
 #endif /* OMR_GC_MODRON_SCAVENGER */
 
@@ -205,14 +226,21 @@ MM_HeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc fun
 	MM_HeapRegionDescriptor *region = NULL;
 	OMR_VMThread *omrVMThread = env->getOmrVMThread();
 	
+	omrobjectptr_t batch[HEAP_WALK_BATCH_SIZE];
+
 	while (NULL != (region = regionIterator.nextRegion())) {
 		if (typeFlags == (region->getTypeFlags() & typeFlags)) {
-			/* Optimization to avoid virtual dispatch for every slot in the system */
-			omrobjectptr_t object = NULL;
-			GC_ObjectHeapIteratorAddressOrderedList liveObjectIterator(extensions, region, false);
-
-			while (NULL != (object = liveObjectIterator.nextObject())) {
-				function(omrVMThread, region, object, userData);
+			/* Walk in batches, prefetching the headers of the objects the function is about to visit */
+			GC_ObjectHeapBufferedIterator liveObjectIterator(extensions, region);
+			uintptr_t count = 0;
+
+			while (0 != (count = liveObjectIterator.nextObjects(batch, HEAP_WALK_BATCH_SIZE))) {
+				for (uintptr_t i = 0; i < count; i++) {
+					if ((i + GC_ObjectHeapBufferedIterator::PREFETCH_DISTANCE) < count) {
+						GC_ObjectHeapBufferedIterator::prefetchObject(batch[i + GC_ObjectHeapBufferedIterator::PREFETCH_DISTANCE]);
+					}
+					function(omrVMThread, region, batch[i], userData);
+				}
 			}
 		}
 	}
@@ -39,6 +39,11 @@ typedef void (*MM_HeapWalkerSlotFunc)(OMR_VM *, omrobjectptr_t *, void *, uint32
 
 class MM_HeapWalker : public MM_BaseVirtual
 {
+private:
+	enum {
+		HEAP_WALK_BATCH_SIZE = 256 /**< number of objects allObjectsDo() fetches from the heap at once */
+	};
+
 protected:
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
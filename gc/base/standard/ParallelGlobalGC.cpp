@@ -50,6 +50,7 @@
 #include "MemorySubSpaceSemiSpace.hpp"
 #include "MemoryPoolLargeObjects.hpp"
 #include "ObjectAllocationInterface.hpp"
+#include "ObjectHeapIteratorAddressOrderedList.hpp"
 #if defined(OMR_GC_OBJECT_MAP)
 #include "ObjectMap.hpp"
 #endif /* defined(OMR_GC_OBJECT_MAP) */
@@ -63,6 +64,10 @@
 #include "ParallelSweepScheme.hpp"
 #include "ParallelTask.hpp"
 #if defined(OMR_GC_MODRON_SCAVENGER)
+#include "RememberedSetMap.hpp"
+#include "RememberedSetMapChunkIterator.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#if defined(OMR_GC_MODRON_SCAVENGER)
 #include "Scavenger.hpp"
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #include "WorkPackets.hpp"
@@ -302,6 +307,22 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 	}
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/* Concurrent scavenger scans the remembered set list while mutators run, so it keeps the overflow handling */
+	if (_extensions->scavengerEnabled && _extensions->scavengerRememberedSetMap
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		&& !_extensions->isConcurrentScavengerEnabled()
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+	) {
+		_extensions->rememberedSetMap = MM_RememberedSetMap::newInstance(env, _extensions->heap->getMaximumPhysicalRange());
+		if (NULL == _extensions->rememberedSetMap) {
+			goto error_no_memory;
+		}
+		/* The map takes whatever does not fit, so the list can be bounded */
+		_extensions->rememberedSet.setMaxSize(_extensions->scavengerRememberedSetListMaxSize);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 #if defined(OMR_GC_MODRON_COMPACTION)
 	_compactScheme = MM_CompactScheme::newInstance(env, _markingScheme);
 	if(NULL == _compactScheme) {
@@ -378,6 +399,13 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
 	}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetMap) {
+		_extensions->rememberedSetMap->kill(env);
+		_extensions->rememberedSetMap = NULL;
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 }
 
 uintptr_t
@@ -461,6 +489,13 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	markAll(env, initMarkMap);
 
 	_delegate.postMarkProcessing(env);
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	_rememberedSetMapObjects = 0;
+	if (NULL != _extensions->rememberedSetMap) {
+		_rememberedSetMapObjects = masterThreadRetainLiveRememberedObjects(env);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	
 	sweep(env, allocDescription, rebuildMarkBits);
 
@@ -474,6 +509,11 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 		}
 
 		masterThreadCompact(env, allocDescription, rebuildMarkBits);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (0 != _rememberedSetMapObjects) {
+			masterThreadRebuildRememberedSetMap(env);
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		_collectionStatistics._tenureFragmentation = NO_FRAGMENTATION;
 		if (_extensions->processLargeAllocateStats) {
 			processLargeAllocateStatsAfterCompact(env);
@@ -595,11 +635,13 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		goto compactionReqd;
 	}
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
 	/* Aborted CS needs global GC with Nursery compaction */
 	if (_extensions->isConcurrentScavengerEnabled() && _extensions->isScavengerBackOutFlagRaised()) {
 		compactReason = COMPACT_ABORTED_SCAVENGE;
 		goto compactionReqd;
 	}	
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	/* Is this a system GC ? */ 
 	if(gcCode.isExplicitGC()) { 
@@ -721,7 +763,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t totalSize = memorySubSpace->getActiveMemorySize();
 		MM_MemoryPool *memoryPool= memorySubSpace->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -956,6 +998,9 @@ MM_ParallelGlobalGC::markAll(MM_EnvironmentBase *env, bool initMarkMap)
 	/* Do any post mark checks */
 	postMark(env);
 	_markingScheme->masterCleanupAfterGC(env);
+	if (NULL != _markingScheme->getLiveObjectCensus()) {
+		_markingScheme->getLiveObjectCensus()->censusCompleted(env);
+	}
 	markStats->_endTime = omrtime_hires_clock();
 	reportMarkEnd(env);
 }
@@ -996,6 +1041,56 @@ MM_ParallelGlobalGC::masterThreadCompact(MM_EnvironmentBase *env, MM_AllocateDes
 }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+uintptr_t
+MM_ParallelGlobalGC::masterThreadRetainLiveRememberedObjects(MM_EnvironmentBase *env)
+{
+	MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+	MM_MarkMap *markMap = _markingScheme->getMarkMap();
+	uintptr_t remaining = 0;
+
+	GC_RememberedSetMapChunkIterator chunkIterator(_extensions);
+	uintptr_t *chunkBase = NULL;
+	uintptr_t *chunkTop = NULL;
+	while (chunkIterator.nextChunk(&chunkBase, &chunkTop)) {
+		remaining += rememberedSetMap->retainMarkedObjects(env, markMap, chunkBase, chunkTop);
+	}
+
+	return remaining;
+}
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+void
+MM_ParallelGlobalGC::masterThreadRebuildRememberedSetMap(MM_EnvironmentBase *env)
+{
+	MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+
+	/* The remembered objects have moved; find them again by their header state */
+	if (!_fixHeapForWalkCompleted) {
+		getCompactScheme(env)->fixHeapForWalk(env);
+		_fixHeapForWalkCompleted = true;
+	}
+
+	_extensions->rememberedSet.clear(env);
+
+	GC_HeapRegionIteratorStandard regionIterator(_extensions->heap->getHeapRegionManager());
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	while (NULL != (region = regionIterator.nextRegion())) {
+		if (region->isCommitted() && (MEMORY_TYPE_OLD == (region->getTypeFlags() & MEMORY_TYPE_OLD))) {
+			rememberedSetMap->forgetRange(env, region->getLowAddress(), region->getHighAddress());
+			GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, region, false);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = objectIterator.nextObject())) {
+				if (_extensions->objectModel.isRemembered(objectPtr)) {
+					rememberedSetMap->rememberObject(objectPtr);
+				}
+			}
+		}
+	}
+}
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 void
 MM_ParallelGlobalGC::masterThreadRestartAllocationCaches(MM_EnvironmentBase *env)
 {
@@ -1247,8 +1342,16 @@ MM_ParallelGlobalGC::prepareHeapForWalk(MM_EnvironmentBase *env)
 	
 	/* Run a parallel mark */
 	/* TODO CRGTMP fix the cycleState parameter */
+	MM_LiveObjectCensus *liveObjectCensus = _markingScheme->getLiveObjectCensus();
+	if (NULL != liveObjectCensus) {
+		/* The walk does not collect, so its marking is not part of the census */
+		liveObjectCensus->setSampling(false);
+	}
 	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, true, NULL);
 	_dispatcher->run(env, &markTask);
+	if (NULL != liveObjectCensus) {
+		liveObjectCensus->setSampling(true);
+	}
 
 	_delegate.prepareHeapForWalk(env);
 }
@@ -1307,6 +1410,15 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetMap) {
+		result = _extensions->rememberedSetMap->heapAddRange(env, size, lowAddress, highAddress);
+		if (0 == result) {
+			goto rememberedSetMap_failed_heapAddRange;
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	result = _delegate.heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto parallelGlobalGC_failed_heapAddRange;
@@ -1315,6 +1427,12 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	return true;
 
 parallelGlobalGC_failed_heapAddRange:
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetMap) {
+		_extensions->rememberedSetMap->heapRemoveRange(env, size, lowAddress, highAddress, NULL, NULL);
+	}
+rememberedSetMap_failed_heapAddRange:
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_OBJECT_MAP)
 	_extensions->getObjectMap()->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 objectMap_failed_heapAddRange:
@@ -1335,6 +1453,11 @@ MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 {
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (NULL != _extensions->rememberedSetMap) {
+		result = result && _extensions->rememberedSetMap->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	result = result && _delegate.heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -80,6 +80,9 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 	bool _fixHeapForWalkCompleted;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	uintptr_t _rememberedSetMapObjects; /**< Number of live objects left in the scavenger remembered set map by the current cycle */
+#endif /* OMR_GC_MODRON_SCAVENGER */
 public:
 	
 /*
@@ -173,6 +176,23 @@ private:
 
 	void masterThreadRestartAllocationCaches(MM_EnvironmentBase *env);
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Remove the objects found dead by the mark phase from the scavenger remembered set map.
+	 * @return the number of objects remaining in the map
+	 */
+	uintptr_t masterThreadRetainLiveRememberedObjects(MM_EnvironmentBase *env);
+
+#if defined(OMR_GC_MODRON_COMPACTION)
+	/**
+	 * Rebuild the scavenger remembered set map once compaction has moved old objects. Every
+	 * old object in the remembered state is recorded in the map and the remembered set list
+	 * is emptied, so each remembered object is held by exactly one of the two.
+	 */
+	void masterThreadRebuildRememberedSetMap(MM_EnvironmentBase *env);
+#endif /* OMR_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	/**
 	 *	Initializations before GC cycle 
 	 */
@@ -345,6 +365,9 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _fixHeapForWalkCompleted(false)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		, _rememberedSetMapObjects(0)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	{
 		_typeId = __FUNCTION__;
 	}
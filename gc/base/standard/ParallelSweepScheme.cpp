@@ -343,11 +343,9 @@ MM_ParallelSweepScheme::sweepMarkMapBody(
 
 		markMapCurrent += 1;
 
-		while(markMapCurrent < markMapChunkTop) {
-			if(*markMapCurrent != J9MODRON_OBM_SLOT_EMPTY) {
-				break;
-			}
-			markMapCurrent += 1;
+		/* Check the next slot inline so that short runs of free slots do not pay for the call */
+		if ((markMapCurrent < markMapChunkTop) && (*markMapCurrent == J9MODRON_OBM_SLOT_EMPTY)) {
+			markMapCurrent = _extensions->bitmapScanner.skipEmptySlots(markMapCurrent + 1, markMapChunkTop);
 		}
 
 		/* Find the number of slots we've walked
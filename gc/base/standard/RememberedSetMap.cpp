@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "ModronAssertions.h"
+
+#include "RememberedSetMap.hpp"
+
+MM_RememberedSetMap *
+MM_RememberedSetMap::newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
+{
+	MM_RememberedSetMap *rememberedSetMap = (MM_RememberedSetMap *)env->getForge()->allocate(sizeof(MM_RememberedSetMap), OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL != rememberedSetMap) {
+		new(rememberedSetMap) MM_RememberedSetMap(env, maxHeapSize);
+		if (!rememberedSetMap->initialize(env)) {
+			rememberedSetMap->kill(env);
+			rememberedSetMap = NULL;
+		}
+	}
+
+	return rememberedSetMap;
+}
+
+void
+MM_RememberedSetMap::forgetRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	uintptr_t *slot = getSlotPtrForAddress((omrobjectptr_t)lowAddress);
+	uintptr_t *slotTop = getSlotPtrForAddress((omrobjectptr_t)highAddress);
+	OMRZeroMemory(slot, (slotTop - slot) * sizeof(uintptr_t));
+}
+
+uintptr_t
+MM_RememberedSetMap::retainMarkedObjects(MM_EnvironmentBase *env, MM_HeapMap *markMap, void *lowAddress, void *highAddress)
+{
+	Assert_MM_true(markMap->getObjectGrain() == getObjectGrain());
+
+	MM_BitmapScanner *bitmapScanner = &_extensions->bitmapScanner;
+	uintptr_t *slot = getSlotPtrForAddress((omrobjectptr_t)lowAddress);
+	uintptr_t *slotTop = getSlotPtrForAddress((omrobjectptr_t)highAddress);
+	uintptr_t *markSlot = markMap->getSlotPtrForAddress((omrobjectptr_t)lowAddress);
+	uintptr_t retained = 0;
+
+	while (slot < slotTop) {
+		/* most of old space has nothing remembered, so skip straight to the next recorded object */
+		uintptr_t *nextSlot = bitmapScanner->skipEmptySlots(slot, slotTop);
+		markSlot += nextSlot - slot;
+		slot = nextSlot;
+		if (slot < slotTop) {
+			uintptr_t value = *slot & *markSlot;
+			*slot = value;
+			retained += MM_Bits::populationCount(value);
+			slot += 1;
+			markSlot += 1;
+		}
+	}
+
+	return retained;
+}
+
+uintptr_t
+MM_RememberedSetMap::countObjects(MM_EnvironmentBase *env, void *lowAddress, void *highAddress)
+{
+	return _extensions->bitmapScanner.countBits(getSlotPtrForAddress((omrobjectptr_t)lowAddress), getSlotPtrForAddress((omrobjectptr_t)highAddress));
+}
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
@@ -0,0 +1,119 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(REMEMBEREDSETMAP_HPP_)
+#define REMEMBEREDSETMAP_HPP_
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "AtomicOperations.hpp"
+#include "HeapMap.hpp"
+
+class MM_EnvironmentBase;
+
+/**
+ * Bitmap form of the scavenger remembered set, one bit per old space object grain.
+ *
+ * Remembered objects that do not fit in the remembered set list are recorded here instead
+ * of putting the remembered set into overflow. An object is recorded at most once (the
+ * remembered state in its header already filters repeated stores), memory use is fixed
+ * by the heap size, and the map is walked directly rather than by scanning old space for
+ * remembered headers.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RememberedSetMap : public MM_HeapMap
+{
+public:
+protected:
+private:
+
+public:
+	static MM_RememberedSetMap *newInstance(MM_EnvironmentBase *env, uintptr_t maxHeapSize);
+
+	/**
+	 * Record an object as remembered. Safe against concurrent callers.
+	 * @param objectPtr an old space object
+	 * @return true if the object was not already recorded
+	 */
+	MMINLINE bool rememberObject(omrobjectptr_t objectPtr) { return atomicSetBit(objectPtr); }
+
+	/**
+	 * @return true if the object is recorded in the map
+	 */
+	MMINLINE bool isObjectRemembered(omrobjectptr_t objectPtr) { return isBitSet(objectPtr); }
+
+	/**
+	 * Remove an object from the map. Safe against concurrent callers updating
+	 * other objects covered by the same map slot.
+	 * @param objectPtr an object recorded in the map
+	 */
+	MMINLINE void
+	forgetObject(omrobjectptr_t objectPtr)
+	{
+		uintptr_t slotIndex = 0;
+		uintptr_t bitMask = 0;
+		getSlotIndexAndMask(objectPtr, &slotIndex, &bitMask);
+		volatile uintptr_t *slotAddress = &(_heapMapBits[slotIndex]);
+		uintptr_t oldValue = 0;
+		do {
+			oldValue = *slotAddress;
+		} while (oldValue != MM_AtomicOperations::lockCompareExchange(slotAddress, oldValue, oldValue & ~bitMask));
+	}
+
+	/**
+	 * Remove every object recorded for the heap range [lowAddress, highAddress).
+	 */
+	void forgetRange(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Remove the objects recorded for the heap range [lowAddress, highAddress) that
+	 * are not marked in the given map.
+	 * @param markMap a mark map covering the same heap, with every live object marked
+	 * @return the number of objects still recorded in the range
+	 */
+	uintptr_t retainMarkedObjects(MM_EnvironmentBase *env, MM_HeapMap *markMap, void *lowAddress, void *highAddress);
+
+	/**
+	 * @return the number of objects recorded for the heap range [lowAddress, highAddress)
+	 */
+	uintptr_t countObjects(MM_EnvironmentBase *env, void *lowAddress, void *highAddress);
+
+	/**
+	 * Create a RememberedSetMap object.
+	 */
+	MM_RememberedSetMap(MM_EnvironmentBase *env, uintptr_t maxHeapSize)
+		: MM_HeapMap(env, maxHeapSize)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#endif /* REMEMBEREDSETMAP_HPP_ */
@@ -0,0 +1,90 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(REMEMBEREDSETMAPCHUNKITERATOR_HPP_)
+#define REMEMBEREDSETMAPCHUNKITERATOR_HPP_
+
+#include "omrcfg.h"
+#include "omrgcconsts.h"
+
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapRegionIteratorStandard.hpp"
+
+/**
+ * Iterate over the old space of the heap in chunks of at most OMR_SCV_REMSET_MAP_CHUNK_SIZE bytes.
+ * Each chunk is a unit of parallel work when walking the remembered set map; every thread
+ * sees the same sequence of chunks, so J9MODRON_HANDLE_NEXT_WORK_UNIT may be used to claim them.
+ * @ingroup GC_Modron_Standard
+ */
+class GC_RememberedSetMapChunkIterator
+{
+private:
+	GC_HeapRegionIteratorStandard _regionIterator; /**< walks every region of the heap */
+	uintptr_t *_chunkBase; /**< base of the next chunk in the current region */
+	uintptr_t *_regionTop; /**< top of the current region */
+
+public:
+	/**
+	 * Get the next old space chunk.
+	 * @param[out] chunkBase base of the chunk
+	 * @param[out] chunkTop top (exclusive) of the chunk
+	 * @return true if a chunk was returned, false if old space is exhausted
+	 */
+	bool
+	nextChunk(uintptr_t **chunkBase, uintptr_t **chunkTop)
+	{
+		while (_chunkBase >= _regionTop) {
+			MM_HeapRegionDescriptorStandard *region = _regionIterator.nextRegion();
+			if (NULL == region) {
+				return false;
+			}
+			if (region->isCommitted() && (MEMORY_TYPE_OLD == (region->getTypeFlags() & MEMORY_TYPE_OLD))) {
+				_chunkBase = (uintptr_t *)region->getLowAddress();
+				_regionTop = (uintptr_t *)region->getHighAddress();
+			}
+		}
+
+		*chunkBase = _chunkBase;
+		if (((uintptr_t)_regionTop - (uintptr_t)_chunkBase) > OMR_SCV_REMSET_MAP_CHUNK_SIZE) {
+			_chunkBase = (uintptr_t *)((uintptr_t)_chunkBase + OMR_SCV_REMSET_MAP_CHUNK_SIZE);
+		} else {
+			_chunkBase = _regionTop;
+		}
+		*chunkTop = _chunkBase;
+		return true;
+	}
+
+	GC_RememberedSetMapChunkIterator(MM_GCExtensionsBase *extensions)
+		: _regionIterator(extensions->heap->getHeapRegionManager())
+		, _chunkBase(NULL)
+		, _regionTop(NULL)
+	{}
+};
+
+#endif /* REMEMBEREDSETMAPCHUNKITERATOR_HPP_ */
@@ -56,6 +56,7 @@
 #include "EnvironmentBase.hpp"
 #include "EnvironmentStandard.hpp"
 #include "ForwardedHeader.hpp"
+#include "HeapMapIterator.hpp"
 #include "IndexableObjectScanner.hpp"
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
@@ -77,6 +78,8 @@
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
 #include "RSOverflow.hpp"
+#include "RememberedSetMap.hpp"
+#include "RememberedSetMapChunkIterator.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
 #include "ScavengerRootScanner.hpp"
@@ -229,6 +232,13 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* The survivor space of a concurrent scavenge is also used by mutators, so it can not be handed to per node stripes */
+	if (_extensions->scavengerNUMAAware && !_extensions->isConcurrentScavengerEnabled()) {
+		if (!_survivorNodeStripes.initialize(env)) {
+			return false;
+		}
+	}
+
 	if (omrthread_monitor_init_with_name(&_scanCacheMonitor, 0, "MM_Scavenger::scanCacheMonitor")) {
 		return false;
 	}
@@ -247,9 +257,11 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	switch (_extensions->scavengerScanOrdering) {
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
 		_cachesPerThread = FLIP_TENURE_LARGE_SCAN;
+		_activeScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
 		break;
 	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL:
-		/* deferred cache is only needed for hierarchical scanning */
+	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_ADAPTIVE:
+		/* deferred cache is only needed for hierarchical scanning (which adaptive ordering may choose in any cycle) */
 		_cachesPerThread = FLIP_TENURE_LARGE_SCAN_DEFERRED;
 		break;
 	default:
@@ -302,6 +314,7 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
+	_survivorNodeStripes.tearDown(env);
 
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
@@ -374,6 +387,8 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	/* Reinitialize the copy scan caches */
 	Assert_MM_true(_scavengeCacheFreeList.areAllCachesReturned());
 	Assert_MM_true(0 == _cachedEntryCount);
+	/* the copy/scan history of the previous cycle is about to be discarded - decide on scan ordering for this cycle first */
+	selectScanOrdering(env);
 	_extensions->copyScanRatio.reset(env, true);
 
 	/* Cache heap ranges for fast "valid object" checks (this can change in an expanding heap situation, so we refetch every cycle) */
@@ -386,6 +401,7 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 
 	/* Clear the cycle gc statistics. Increment level stats will be cleared just prior to increment start. */
 	clearCycleGCStats(env);
+	_extensions->scavengerStats._scanOrdering = _activeScanOrdering;
 
 	/* invoke language-specific interface callback */
 	_delegate.masterSetupForGC(env);
@@ -436,11 +452,74 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (_survivorNodeStripes.isEnabled()) {
+		/* survivor is empty at this point - hand its free memory over to the per node stripes */
+		_survivorNodeStripes.setup(env, _survivorMemorySubSpace, _survivorSpaceBase, _survivorSpaceTop);
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
 }
 
+void
+MM_Scavenger::selectScanOrdering(MM_EnvironmentStandard *env)
+{
+	MM_ScavengerStats *scavengerStats = &_extensions->scavengerStats;
+
+	if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_ADAPTIVE != _extensions->scavengerScanOrdering) {
+		_activeScanOrdering = _extensions->scavengerScanOrdering;
+		return;
+	}
+
+	/* aggregate copy/scan samples over the whole of the previous cycle */
+	uintptr_t recordCount = 0;
+	MM_ScavengerCopyScanRatio::UpdateHistory *historyRecord = _extensions->copyScanRatio.getHistory(&recordCount);
+	uint64_t waits = 0;
+	uint64_t copied = 0;
+	uint64_t scanned = 0;
+	uint64_t updates = 0;
+	uint64_t threads = 0;
+	uint64_t majorUpdates = 0;
+	for (uintptr_t i = 0; i < recordCount; i++) {
+		waits += historyRecord[i].waits;
+		copied += historyRecord[i].copied;
+		scanned += historyRecord[i].scanned;
+		updates += historyRecord[i].updates;
+		threads += historyRecord[i].threads;
+		majorUpdates += historyRecord[i].majorUpdates;
+	}
+
+	if ((0 == scanned) || (0 == updates) || (0 == threads)) {
+		/* first cycle, or too little work to sample - keep the current ordering */
+		scavengerStats->_scanOrderingCopyScanPercent = 0;
+		scavengerStats->_scanOrderingStallPercent = 0;
+		return;
+	}
+
+	uintptr_t copyScanPercent = (uintptr_t)((copied * 100) / scanned);
+	uintptr_t stallPercent = 0;
+	if (threads > majorUpdates) {
+		/* waits is summed per thread update, threads per major update - compare averages of both. A lone
+		 * thread has nobody to share work with, so its waits (it counts itself while flushing) are not stalls. */
+		stallPercent = (uintptr_t)((waits * majorUpdates * 100) / (updates * threads));
+	}
+
+	if (stallPercent > _extensions->scavengerAdaptiveScanOrderingStallPercent) {
+		/* threads were starving for work; breadth first exposes scan work to other threads sooner */
+		_activeScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+	} else if (copyScanPercent >= _extensions->scavengerAdaptiveScanOrderingCopyScanPercent) {
+		/* most scanned slots led to a copy (linked structures); copy children next to their parents */
+		_activeScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL;
+	} else {
+		/* few children to place, so hierarchical aliasing costs more than the locality it buys */
+		_activeScanOrdering = MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST;
+	}
+
+	scavengerStats->_scanOrderingCopyScanPercent = copyScanPercent;
+	scavengerStats->_scanOrderingStallPercent = stallPercent;
+}
+
 void
 MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 {
@@ -459,6 +538,10 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	env->_scavengerRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
 	env->_scavengerRememberedSet.parentList = &_extensions->rememberedSet;
 
+	if (_survivorNodeStripes.isActive()) {
+		_survivorNodeStripes.bindThread(env);
+	}
+
 	/* caches should all be reset */
 	Assert_MM_true(NULL == env->_survivorCopyScanCache);
 	Assert_MM_true(NULL == env->_tenureCopyScanCache);
@@ -709,6 +792,11 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_tenureSpaceAllocationCountLarge += scavStats->_tenureSpaceAllocationCountLarge;
 	finalGCStats->_tenureSpaceAllocationCountSmall += scavStats->_tenureSpaceAllocationCountSmall;
 
+	finalGCStats->_nodeLocalCopyCacheCount += scavStats->_nodeLocalCopyCacheCount;
+	finalGCStats->_nodeLocalCopyCacheBytes += scavStats->_nodeLocalCopyCacheBytes;
+	finalGCStats->_crossNodeCopyCacheCount += scavStats->_crossNodeCopyCacheCount;
+	finalGCStats->_crossNodeCopyCacheBytes += scavStats->_crossNodeCopyCacheBytes;
+
 	/* TODO: Fix this. Not true when merging Master GC threads stats for standard (non CS) Scavenger.
 	   Assert_MM_true(finalGCStats->_flipHistoryNewIndex == scavStats->_flipHistoryNewIndex); */
 
@@ -721,6 +809,10 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_tenureExpandedCount += scavStats->_tenureExpandedCount;
 	finalGCStats->_tenureExpandedTime += scavStats->_tenureExpandedTime;
 
+	finalGCStats->_rememberedSetListObjects += scavStats->_rememberedSetListObjects;
+	finalGCStats->_rememberedSetMapObjects += scavStats->_rememberedSetMapObjects;
+	finalGCStats->_rememberedSetScanTime += scavStats->_rememberedSetScanTime;
+
 #if defined(OMR_SCAVENGER_TRACK_COPY_DISTANCE)
 	for (uintptr_t i = 0; i < OMR_SCAVENGER_DISTANCE_BINS; i++) {
 		finalGCStats->_copy_distance_counts[i] += scavStats->_copy_distance_counts[i];
@@ -999,6 +1091,26 @@ MM_Scavenger::activateDeferredCopyScanCache(MM_EnvironmentStandard *env)
 }
 
 
+bool
+MM_Scavenger::allocateFromSurvivorNodeStripes(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop)
+{
+	bool crossNode = false;
+	bool result = _survivorNodeStripes.allocate(env, minimumSize, maximumSize, addrBase, addrTop, crossNode);
+
+	if (result) {
+		uintptr_t allocatedBytes = (uintptr_t)addrTop - (uintptr_t)addrBase;
+		if (crossNode) {
+			env->_scavengerStats._crossNodeCopyCacheCount += 1;
+			env->_scavengerStats._crossNodeCopyCacheBytes += allocatedBytes;
+		} else {
+			env->_scavengerStats._nodeLocalCopyCacheCount += 1;
+			env->_scavengerStats._nodeLocalCopyCacheBytes += allocatedBytes;
+		}
+	}
+
+	return result;
+}
+
 MMINLINE MM_CopyScanCacheStandard *
 MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes)
 {
@@ -1038,19 +1150,29 @@ retry:
 			} else if (_extensions->tlhSurvivorDiscardThreshold < cacheSize) {
 				MM_AllocateDescription allocDescription(cacheSize, 0, false, true);
 
-				addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
-				if(NULL != addrBase) {
-					addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
-					/* Check that there is no overflow */
-					Assert_MM_true(addrTop >= addrBase);
-					allocateResult = true;
+				if (_survivorNodeStripes.isActive()) {
+					allocateResult = allocateFromSurvivorNodeStripes(env, cacheSize, cacheSize, addrBase, addrTop);
+				}
+				if (!allocateResult) {
+					addrBase = _survivorMemorySubSpace->collectorAllocate(env, this, &allocDescription);
+					if(NULL != addrBase) {
+						addrTop = (void *)(((uint8_t *)addrBase) + cacheSize);
+						/* Check that there is no overflow */
+						Assert_MM_true(addrTop >= addrBase);
+						allocateResult = true;
+					}
 				}
 				env->_scavengerStats._semiSpaceAllocationCountLarge += 1;
 			} else {
 				MM_AllocateDescription allocDescription(0, 0, false, true);
 				/* Update the optimum scan cache size */
 				uintptr_t scanCacheSize = calculateOptimumCopyScanCacheSize(env);
-				allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				if (_survivorNodeStripes.isActive()) {
+					allocateResult = allocateFromSurvivorNodeStripes(env, cacheSize, OMR_MAX(cacheSize, scanCacheSize), addrBase, addrTop);
+				}
+				if (!allocateResult) {
+					allocateResult = (NULL != _survivorMemorySubSpace->collectorAllocateTLH(env, this, &allocDescription, scanCacheSize, addrBase, addrTop));
+				}
 				env->_scavengerStats._semiSpaceAllocationCountSmall += 1;
 			}
 		}
@@ -2154,6 +2276,7 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 					} else {
 						env->_scavengerStats.addToWorkStallTime(waitStartTime, waitEndTime);
 					}
+					env->_taskThreadStats.addToIdleTime(waitStartTime, waitEndTime);
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 				}
 			}
@@ -2316,7 +2439,7 @@ MM_Scavenger::completeScan(MM_EnvironmentStandard *env)
 		omrtty_printf("{SCAV: Completing scan (%p) %p-%p-%p-%p}\n", scanCache, scanCache->cacheBase, scanCache->cacheAlloc, scanCache->scanCurrent, scanCache->cacheTop);
 #endif /* OMR_SCAVENGER_TRACE */
 
-		switch (_extensions->scavengerScanOrdering) {
+		switch (_activeScanOrdering) {
 		case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
 			completeScanCache(env, scanCache);
 			break;
@@ -2417,6 +2540,20 @@ MM_Scavenger::clearRememberedSetLists(MM_EnvironmentStandard *env)
 	_extensions->rememberedSet.clear(env);
 }
 
+void
+MM_Scavenger::clearRememberedSetMap(MM_EnvironmentStandard *env)
+{
+	MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+	if (NULL != rememberedSetMap) {
+		GC_RememberedSetMapChunkIterator chunkIterator(_extensions);
+		uintptr_t *chunkBase = NULL;
+		uintptr_t *chunkTop = NULL;
+		while (chunkIterator.nextChunk(&chunkBase, &chunkTop)) {
+			rememberedSetMap->forgetRange(env, chunkBase, chunkTop);
+		}
+	}
+}
+
 void
 MM_Scavenger::addAllRememberedObjectsToOverflow(MM_EnvironmentStandard *env, MM_RSOverflow *overflow)
 {
@@ -2444,7 +2581,16 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
+		MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+		if (NULL != rememberedSetMap) {
+			MM_SublistFragment::flush((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+			MM_SublistFragment fragment((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+			if (!_extensions->rememberedSet.allocate(env, &fragment)) {
+				/* The list is full - record the object in the map rather than overflowing */
+				rememberedSetMap->rememberObject(objectPtr);
+				return ;
+			}
+		} else if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
 			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
 			if(!isRememberedSetInOverflowState()) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
@@ -2652,6 +2798,9 @@ MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 		pruneRememberedSetOverflow(env);
 	} else {
 		pruneRememberedSetList(env);
+		if (NULL != _extensions->rememberedSetMap) {
+			pruneRememberedSetMap(env);
+		}
 	}
 }
 
@@ -2674,6 +2823,7 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
+		clearRememberedSetMap(env);
 
 		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
 		MM_HeapRegionDescriptorStandard *region = NULL;
@@ -2804,6 +2954,45 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
+void
+MM_Scavenger::pruneRememberedSetMap(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+	GC_RememberedSetMapChunkIterator chunkIterator(_extensions);
+	uintptr_t *chunkBase = NULL;
+	uintptr_t *chunkTop = NULL;
+	while (chunkIterator.nextChunk(&chunkBase, &chunkTop)) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			MM_HeapMapIterator rememberedObjectIterator(_extensions, rememberedSetMap, chunkBase, chunkTop, false);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+				/* Map entries carry no deferred removal flag, so check if object still has nursery references, direct or indirect */
+				bool shouldBeRemembered = shouldRememberObject(env, objectPtr);
+
+				/* Unconditionally remember object if it was recently referenced */
+				if (!shouldBeRemembered && processRememberedThreadReference(env, objectPtr)) {
+					Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+					shouldBeRemembered = true;
+				}
+
+				if (!shouldBeRemembered) {
+					/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
+					_extensions->objectModel.clearRemembered(objectPtr);
+					rememberedSetMap->forgetObject(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference()) {
+						/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set */
+						oldToOldReferenceCreated(env, objectPtr);
+					}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+				}
+			}
+		}
+	}
+}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 void
 MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
@@ -2922,17 +3111,47 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 		}
 
 		Trc_MM_ParallelScavenger_scavengeRememberedSetList_donePuddle(env->getLanguageVMThread(), puddle, numElements);
+		env->_scavengerStats._rememberedSetListObjects += numElements;
 	}
 
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
+void
+MM_Scavenger::scavengeRememberedSetMap(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+	GC_RememberedSetMapChunkIterator chunkIterator(_extensions);
+	uintptr_t *chunkBase = NULL;
+	uintptr_t *chunkTop = NULL;
+	while (chunkIterator.nextChunk(&chunkBase, &chunkTop)) {
+		if (J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			/* Objects tenured by this scavenge may be added to the chunk while it is walked; scanning them here is redundant but harmless */
+			MM_HeapMapIterator rememberedObjectIterator(_extensions, rememberedSetMap, chunkBase, chunkTop, false);
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+				/*
+				 * Scan any remembered objects, but don't adjust their remembered state.
+				 * Objects that no longer need remembering will be pruned at the end of the scavenge.
+				 */
+				scavengeRememberedObject(env, objectPtr);
+				env->_scavengerStats._rememberedSetMapObjects += 1;
+			}
+		}
+	}
+}
+
 /* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
  * Callers of this function must not assume that there is a sync point
  */
 void
 MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 {
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uint64_t startTime = omrtime_hires_clock();
+
 	if (_isRememberedSetInOverflowAtTheBeginning) {
 		env->_scavengerStats._rememberedSetOverflow = 1;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -2945,6 +3164,9 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 	} else {
 		if (!IS_CONCURRENT_ENABLED) {
 			scavengeRememberedSetList(env);
+			if (NULL != _extensions->rememberedSetMap) {
+				scavengeRememberedSetMap(env);
+			}
 		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* Indirect refs are dealt within the root scanning phase (first STW phase), while the direct references are dealt within the main scan phase (typically concurrent). */
@@ -2957,6 +3179,8 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 		}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	}
+
+	env->_scavengerStats._rememberedSetScanTime += (omrtime_hires_clock() - startTime);
 }
 
 void
@@ -3820,6 +4044,27 @@ MM_Scavenger::processRememberedSetInBackout(MM_EnvironmentStandard *env)
 				}
 			}
 		}
+
+		MM_RememberedSetMap *rememberedSetMap = _extensions->rememberedSetMap;
+		if (NULL != rememberedSetMap) {
+#if defined(OMR_SCAVENGER_TRACE_BACKOUT)
+			omrtty_printf("{SCAV: Back out RS map}\n");
+#endif /* OMR_SCAVENGER_TRACE_BACKOUT */
+
+			GC_RememberedSetMapChunkIterator chunkIterator(_extensions);
+			uintptr_t *chunkBase = NULL;
+			uintptr_t *chunkTop = NULL;
+			while (chunkIterator.nextChunk(&chunkBase, &chunkTop)) {
+				MM_HeapMapIterator rememberedObjectIterator(_extensions, rememberedSetMap, chunkBase, chunkTop, false);
+				while (NULL != (objectPtr = rememberedObjectIterator.nextObject())) {
+					if (MM_ForwardedHeader(objectPtr, compressed).isReverseForwardedPointer()) {
+						rememberedSetMap->forgetObject(objectPtr);
+					} else {
+						backOutObjectScan(env, objectPtr);
+					}
+				}
+			}
+		}
 	}
 }
 
@@ -3896,6 +4141,9 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 							if (NULL != fwdObjectPtr) {
 								if(_extensions->objectModel.isRemembered(fwdObjectPtr)) {
 									_extensions->objectModel.clearRemembered(fwdObjectPtr);
+									if (NULL != _extensions->rememberedSetMap) {
+										_extensions->rememberedSetMap->forgetObject(fwdObjectPtr);
+									}
 								}
 #if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
 								evacuateHeapIterator.advance(_extensions->objectModel.getConsumedSizeInBytesWithHeaderBeforeMove(fwdObjectPtr));
@@ -4004,6 +4252,11 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 		scavenge(env);
 	}
 
+	if (_survivorNodeStripes.isActive()) {
+		/* all threads are done copying - give the unused part of the stripes back to the survivor pool */
+		_survivorNodeStripes.release(env);
+	}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	bool lastIncrement = !isConcurrentCycleInProgress();
 #else
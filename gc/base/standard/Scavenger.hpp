@@ -42,6 +42,7 @@
 #include "MasterGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "ScavengerNodeStripes.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
@@ -106,8 +107,10 @@ private:
 
 	MM_CopyScanCacheList _scavengeCacheFreeList; /**< pool of unused copy-scan caches */
 	MM_CopyScanCacheList _scavengeCacheScanList; /**< scan lists */
+	MM_ScavengerNodeStripes _survivorNodeStripes; /**< per NUMA node split of the survivor space (enabled with scavengerNUMAAware) */
 	volatile uintptr_t _cachedEntryCount; /**< non-empty scanCacheList count (not the total count of caches in the lists) */
 	uintptr_t _cachesPerThread; /**< maximum number of copy and scan caches required per thread at any one time */
+	MM_GCExtensionsBase::ScavengerScanOrdering _activeScanOrdering; /**< scan ordering used by the current cycle (never adaptive - adaptive resolves to one of the others each cycle) */
 	omrthread_monitor_t _scanCacheMonitor; /**< monitor to synchronize threads on scan lists */
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
@@ -246,6 +249,12 @@ public:
 	uintptr_t calculateCopyScanCacheSizeForWaitingThreads(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t waitingThreads);
 	uintptr_t calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t scanCacheCount);
 	MMINLINE uintptr_t calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env);
+	/**
+	 * Carve survivor copy cache memory out of the per NUMA node stripes, preferring the node of the current thread,
+	 * and account for it as node local or cross node copy cache memory.
+	 * @return true if memory of at least minimumSize bytes was carved out
+	 */
+	bool allocateFromSurvivorNodeStripes(MM_EnvironmentStandard *env, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop);
 	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 	MM_CopyScanCacheStandard *reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 
@@ -323,6 +332,19 @@ public:
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
 	void pruneRememberedSetOverflow(MM_EnvironmentStandard *env);
 
+	/**
+	 * Scan the objects recorded in the remembered set map (the bitmap that absorbs remembered objects
+	 * once the remembered set list has reached its maximum size). Chunks of the map are handed out as work units.
+	 * @param env Standard Environment
+	 */
+	void scavengeRememberedSetMap(MM_EnvironmentStandard *env);
+
+	/**
+	 * Remove objects that no longer have nursery references from the remembered set map, clearing their remembered state.
+	 * @param env Standard Environment
+	 */
+	void pruneRememberedSetMap(MM_EnvironmentStandard *env);
+
 	/**
 	 * Checks if the  Object should be remembered or not
 	 * @param env Standard Environment
@@ -494,6 +516,12 @@ public:
 
 	void clearRememberedSetLists(MM_EnvironmentStandard *env);
 
+	/**
+	 * Forget every object recorded in the remembered set map, if there is one.
+	 * @param env Standard Environment
+	 */
+	void clearRememberedSetMap(MM_EnvironmentStandard *env);
+
 	MMINLINE bool isRememberedSetInOverflowState() { return _extensions->isRememberedSetInOverflowState(); }
 	MMINLINE void setRememberedSetOverflowState() { _extensions->setRememberedSetOverflowState(); }
 	MMINLINE void clearRememberedSetOverflowState() { _extensions->clearRememberedSetOverflowState(); }
@@ -628,6 +656,14 @@ public:
 	 */
 	bool shouldDoFinalNotify(MM_EnvironmentStandard *env);
 
+	/**
+	 * Pick the scan ordering for the cycle about to start. Fixed orderings are used as configured; the adaptive ordering
+	 * looks at the copy/scan ratio and thread stalls that MM_ScavengerCopyScanRatio recorded during the previous cycle.
+	 * Must be called before the copy/scan ratio history is reset.
+	 * @param env master GC thread
+	 */
+	void selectScanOrdering(MM_EnvironmentStandard *env);
+
 protected:
 	virtual void setupForGC(MM_EnvironmentBase *env);
 	virtual void masterSetupForGC(MM_EnvironmentStandard *env);
@@ -900,6 +936,7 @@ public:
 		, _collectionStatistics()
 		, _cachedEntryCount(0)
 		, _cachesPerThread(0)
+		, _activeScanOrdering(MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 		, _scanCacheMonitor(NULL)
 		, _freeCacheMonitor(NULL)
 		, _waitingCountAliasThreshold(0)
@@ -0,0 +1,245 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <new>
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "ScavengerNodeStripes.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapLinkedFreeHeader.hpp"
+#include "HeapVirtualMemory.hpp"
+#include "Math.hpp"
+#include "MemoryManager.hpp"
+#include "MemoryPool.hpp"
+#include "MemorySubSpace.hpp"
+#include "ModronAssertions.h"
+#include "NUMAManager.hpp"
+
+bool
+MM_ScavengerNodeStripes::initialize(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uintptr_t affinityLeaderCount = 0;
+	J9MemoryNodeDetail const *affinityLeaders = extensions->_numaManager.getAffinityLeaders(&affinityLeaderCount);
+
+	if (1 >= affinityLeaderCount) {
+		/* nothing to split across - the stripes stay disabled */
+		return true;
+	}
+
+	_stripes = (NodeStripe *)extensions->getForge()->allocate(sizeof(NodeStripe) * affinityLeaderCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _stripes) {
+		return false;
+	}
+
+	for (uintptr_t i = 0; i < affinityLeaderCount; i++) {
+		NodeStripe *stripe = &_stripes[i];
+		new (&stripe->_lock) MM_LightweightNonReentrantLock();
+		if (!stripe->_lock.initialize(env, &extensions->lnrlOptions, "MM_ScavengerNodeStripes:_stripes[]._lock")) {
+			/* tear down only what has been initialized so far */
+			_stripeCount = i;
+			return false;
+		}
+		stripe->_j9NodeNumber = affinityLeaders[i].j9NodeNumber;
+		stripe->_boundBase = NULL;
+		stripe->_boundTop = NULL;
+		stripe->_alloc = NULL;
+		stripe->_allocTop = NULL;
+		stripe->_freeList = NULL;
+	}
+	_stripeCount = affinityLeaderCount;
+	_discardThreshold = extensions->tlhSurvivorDiscardThreshold;
+
+	return true;
+}
+
+void
+MM_ScavengerNodeStripes::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _stripes) {
+		for (uintptr_t i = 0; i < _stripeCount; i++) {
+			_stripes[i]._lock.tearDown();
+		}
+		env->getExtensions()->getForge()->free(_stripes);
+		_stripes = NULL;
+	}
+	_stripeCount = 0;
+}
+
+void
+MM_ScavengerNodeStripes::bindThread(MM_EnvironmentBase *env)
+{
+	MM_NUMAManager *numaManager = &env->getExtensions()->_numaManager;
+
+	/* the master may be a mutator thread borrowed for the collection; only dedicated GC threads are bound */
+	if (numaManager->isPhysicalNUMAEnabled() && numaManager->shouldSetCPUAffinity() && (GC_SLAVE_THREAD == env->getThreadType())) {
+		uintptr_t j9NodeNumber = _stripes[getNodeIndex(env)]._j9NodeNumber;
+		env->setNumaAffinity(&j9NodeNumber, 1);
+	}
+}
+
+void
+MM_ScavengerNodeStripes::setup(MM_EnvironmentBase *env, MM_MemorySubSpace *survivorSubSpace, void *survivorBase, void *survivorTop)
+{
+	Assert_MM_true(isEnabled());
+	Assert_MM_false(isActive());
+
+#if defined(OMR_GC_LARGE_OBJECT_AREA)
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_MemoryPool *pool = survivorSubSpace->getMemoryPool();
+	uintptr_t pageSize = extensions->heap->getPageSize();
+	uintptr_t survivorSize = (uintptr_t)survivorTop - (uintptr_t)survivorBase;
+	bool bindMemory = extensions->_numaManager.isPhysicalNUMAEnabled() && !extensions->enableSplitHeap;
+
+	for (uintptr_t i = 0; i < _stripeCount; i++) {
+		NodeStripe *stripe = &_stripes[i];
+		/* stripe boundaries are page aligned so that each stripe can be bound to its node independently */
+		uint8_t *stripeBase = (0 == i) ? (uint8_t *)survivorBase : (uint8_t *)MM_Math::roundToFloor(pageSize, (uintptr_t)survivorBase + ((survivorSize / _stripeCount) * i));
+		uint8_t *stripeTop = ((_stripeCount - 1) == i) ? (uint8_t *)survivorTop : (uint8_t *)MM_Math::roundToFloor(pageSize, (uintptr_t)survivorBase + ((survivorSize / _stripeCount) * (i + 1)));
+
+		stripe->_alloc = NULL;
+		stripe->_allocTop = NULL;
+		stripe->_freeList = NULL;
+		if (stripeTop <= stripeBase) {
+			continue;
+		}
+
+		if (bindMemory && ((stripeBase != stripe->_boundBase) || (stripeTop != stripe->_boundTop))) {
+			/* the semi spaces flip and tilt, so re-bind only when the range of the stripe has moved */
+			void *bindBase = (void *)MM_Math::roundToCeiling(pageSize, (uintptr_t)stripeBase);
+			if ((uint8_t *)bindBase < stripeTop) {
+				extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)extensions->heap)->getVmemHandle(), stripe->_j9NodeNumber, bindBase, (uintptr_t)stripeTop - (uintptr_t)bindBase);
+			}
+			stripe->_boundBase = stripeBase;
+			stripe->_boundTop = stripeTop;
+		}
+
+		MM_HeapLinkedFreeHeader *freeListHead = NULL;
+		MM_HeapLinkedFreeHeader *freeListTail = NULL;
+		uintptr_t freeMemoryCount = 0;
+		uintptr_t freeMemorySize = 0;
+		if (pool->removeFreeEntriesWithinRange(env, stripeBase, stripeTop, pool->getMinimumFreeEntrySize(), freeListHead, freeListTail, freeMemoryCount, freeMemorySize)) {
+			stripe->_freeList = freeListHead;
+		}
+	}
+
+	_pool = pool;
+#endif /* OMR_GC_LARGE_OBJECT_AREA */
+}
+
+bool
+MM_ScavengerNodeStripes::allocateFromStripe(MM_EnvironmentBase *env, NodeStripe *stripe, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop)
+{
+	bool const compressed = env->compressObjectReferences();
+	bool result = false;
+
+	stripe->_lock.acquire();
+	while (true) {
+		uintptr_t available = (uintptr_t)stripe->_allocTop - (uintptr_t)stripe->_alloc;
+		if (available >= minimumSize) {
+			uintptr_t size = OMR_MIN(available, maximumSize);
+			addrBase = stripe->_alloc;
+			stripe->_alloc += size;
+			addrTop = stripe->_alloc;
+			result = true;
+			break;
+		}
+
+		if ((NULL == stripe->_freeList) || (available > _discardThreshold)) {
+			/* no more chunks, or the current one is too valuable to throw away for this request */
+			break;
+		}
+
+		/* discard the remainder of the current chunk and move on to the next one */
+		if (0 != available) {
+			_pool->abandonHeapChunk(stripe->_alloc, stripe->_allocTop);
+		}
+		MM_HeapLinkedFreeHeader *freeEntry = stripe->_freeList;
+		stripe->_freeList = freeEntry->getNext(compressed);
+		stripe->_alloc = (uint8_t *)freeEntry;
+		stripe->_allocTop = (uint8_t *)freeEntry->afterEnd();
+	}
+	stripe->_lock.release();
+
+	return result;
+}
+
+bool
+MM_ScavengerNodeStripes::allocate(MM_EnvironmentBase *env, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop, bool &crossNode)
+{
+	Assert_MM_true(isActive());
+
+	uintptr_t nodeIndex = getNodeIndex(env);
+	for (uintptr_t i = 0; i < _stripeCount; i++) {
+		if (allocateFromStripe(env, &_stripes[(nodeIndex + i) % _stripeCount], minimumSize, maximumSize, addrBase, addrTop)) {
+			crossNode = (0 != i);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void
+MM_ScavengerNodeStripes::release(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(isActive());
+	bool const compressed = env->compressObjectReferences();
+
+	for (uintptr_t i = 0; i < _stripeCount; i++) {
+		NodeStripe *stripe = &_stripes[i];
+		MM_HeapLinkedFreeHeader *freeListHead = stripe->_freeList;
+
+		if (stripe->_alloc < stripe->_allocTop) {
+			/* what is left of the current chunk goes back ahead of the untouched chunks (or becomes a hole, if too small) */
+			if (_pool->createFreeEntry(env, stripe->_alloc, stripe->_allocTop, NULL, freeListHead)) {
+				freeListHead = (MM_HeapLinkedFreeHeader *)stripe->_alloc;
+			}
+		}
+
+		if (NULL != freeListHead) {
+			MM_HeapLinkedFreeHeader *freeListTail = freeListHead;
+			uintptr_t freeMemoryCount = 1;
+			uintptr_t freeMemorySize = freeListHead->getSize();
+			while (NULL != freeListTail->getNext(compressed)) {
+				freeListTail = freeListTail->getNext(compressed);
+				freeMemoryCount += 1;
+				freeMemorySize += freeListTail->getSize();
+			}
+			_pool->addFreeEntries(env, freeListHead, freeListTail, freeMemoryCount, freeMemorySize);
+		}
+
+		stripe->_alloc = NULL;
+		stripe->_allocTop = NULL;
+		stripe->_freeList = NULL;
+	}
+
+	_pool = NULL;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
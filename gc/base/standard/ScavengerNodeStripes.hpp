@@ -0,0 +1,156 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERNODESTRIPES_HPP_)
+#define SCAVENGERNODESTRIPES_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#include "omrcomp.h"
+
+#include "BaseNonVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "LightweightNonReentrantLock.hpp"
+
+class MM_HeapLinkedFreeHeader;
+class MM_MemoryPool;
+class MM_MemorySubSpace;
+
+/**
+ * Splits the survivor semi space into one address stripe per NUMA affinity leader for the
+ * duration of a scavenge, so that each GC thread can copy into memory bound to its own node.
+ * The free memory of each stripe is taken out of the survivor pool when the scavenge starts
+ * and whatever has not been handed out as copy cache memory is returned to the pool at the end.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerNodeStripes : public MM_BaseNonVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct NodeStripe {
+		MM_LightweightNonReentrantLock _lock; /**< Lock for carving memory out of the stripe */
+		uintptr_t _j9NodeNumber; /**< The node the stripe (and the threads using it) is bound to */
+		void *_boundBase; /**< base of the range most recently bound to _j9NodeNumber */
+		void *_boundTop; /**< top of the range most recently bound to _j9NodeNumber */
+		uint8_t *_alloc; /**< current allocation pointer within the current free chunk */
+		uint8_t *_allocTop; /**< top of the current free chunk */
+		MM_HeapLinkedFreeHeader *_freeList; /**< address ordered list of the remaining free chunks of the stripe */
+	};
+
+	NodeStripe *_stripes; /**< An array of NodeStripe structures, one per affinity leader */
+	uintptr_t _stripeCount; /**< Number of stripes (0 if NUMA is not available) */
+	MM_MemoryPool *_pool; /**< Survivor pool the stripes were carved from, NULL if the stripes are not active */
+	uintptr_t _discardThreshold; /**< The largest remainder of a free chunk that may be discarded when moving to the next chunk */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Carve memory out of a single stripe.
+	 * @return true if at least minimumSize bytes were carved out
+	 */
+	bool allocateFromStripe(MM_EnvironmentBase *env, NodeStripe *stripe, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop);
+
+protected:
+public:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if there is more than one node to split the survivor space across
+	 */
+	MMINLINE bool isEnabled() { return 1 < _stripeCount; }
+
+	/**
+	 * @return true if the stripes currently own the survivor memory (between setup() and release())
+	 */
+	MMINLINE bool isActive() { return NULL != _pool; }
+
+	MMINLINE uintptr_t getStripeCount() { return _stripeCount; }
+
+	/**
+	 * Stripe (node) a GC thread is associated with. Threads are distributed round robin across nodes.
+	 * @param env[in] A GC thread
+	 * @return index of the stripe the thread copies into first
+	 */
+	MMINLINE uintptr_t getNodeIndex(MM_EnvironmentBase *env) { return env->getSlaveID() % _stripeCount; }
+
+	/**
+	 * Bind the calling GC thread to the node of its stripe, if physical NUMA is enabled and
+	 * we are permitted to change thread affinity.
+	 */
+	void bindThread(MM_EnvironmentBase *env);
+
+	/**
+	 * Split the (empty) survivor range into one stripe per node, bind each stripe's memory to its node
+	 * and take the stripe's free memory out of the survivor pool. Called by the master thread before workers start.
+	 * @param env[in] master thread
+	 * @param survivorSubSpace[in] survivor space for this scavenge
+	 * @param survivorBase[in] low address of the survivor range
+	 * @param survivorTop[in] high address of the survivor range
+	 */
+	void setup(MM_EnvironmentBase *env, MM_MemorySubSpace *survivorSubSpace, void *survivorBase, void *survivorTop);
+
+	/**
+	 * Carve out copy cache memory, preferring the stripe of the given node and falling back to other nodes in turn.
+	 * @param env[in] A GC thread
+	 * @param minimumSize[in] the least number of bytes that satisfies the request
+	 * @param maximumSize[in] the preferred number of bytes
+	 * @param addrBase[out] base of the memory carved out
+	 * @param addrTop[out] top of the memory carved out
+	 * @param crossNode[out] set to true if the memory came from a stripe of another node
+	 * @return true if memory was carved out
+	 */
+	bool allocate(MM_EnvironmentBase *env, uintptr_t minimumSize, uintptr_t maximumSize, void * &addrBase, void * &addrTop, bool &crossNode);
+
+	/**
+	 * Return memory which was not handed out back to the survivor pool. Called by the master thread once workers are done.
+	 */
+	void release(MM_EnvironmentBase *env);
+
+	MM_ScavengerNodeStripes()
+		: MM_BaseNonVirtual()
+		, _stripes(NULL)
+		, _stripeCount(0)
+		, _pool(NULL)
+		, _discardThreshold(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+#endif /* SCAVENGERNODESTRIPES_HPP_ */
@@ -30,6 +30,9 @@
 #include "GCExtensionsBase.hpp"
 #include "ObjectModel.hpp"
 #include "Scavenger.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SegregatedGC.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #include "SlotObject.hpp"
 
 struct OMR_VMThread;
@@ -48,7 +51,7 @@ struct OMR_VMThread;
 MMINLINE void
 standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP)
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -66,7 +69,12 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->segregatedGenerational) {
+		((MM_SegregatedGC *)extensions->getGlobalCollector())->rememberOldToYoungReference(env, parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP) */
 }
 
 /**
@@ -0,0 +1,213 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omr.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Packet.hpp"
+#include "ParallelDispatcher.hpp"
+
+#include "WorkPacketsStealing.hpp"
+
+/**
+ * Instantiate a MM_WorkPacketsStealing
+ * @return pointer to the new object
+ */
+MM_WorkPacketsStealing *
+MM_WorkPacketsStealing::newInstance(MM_EnvironmentBase *env)
+{
+	MM_WorkPacketsStealing *workPackets = (MM_WorkPacketsStealing *)env->getForge()->allocate(sizeof(MM_WorkPacketsStealing), OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL != workPackets) {
+		new(workPackets) MM_WorkPacketsStealing(env);
+		if (!workPackets->initialize(env)) {
+			workPackets->kill(env);
+			workPackets = NULL;
+		}
+	}
+
+	return workPackets;
+}
+
+/**
+ * Initialize the shared packet lists and one deque for each GC thread
+ * @return true on success, false otherwise
+ */
+bool
+MM_WorkPacketsStealing::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_WorkPacketsStandard::initialize(env)) {
+		return false;
+	}
+
+	uintptr_t dequeCount = OMR_MAX(_extensions->gcThreadCount, 1);
+	_deques = (PacketDeque *)env->getForge()->allocate(sizeof(PacketDeque) * dequeCount, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+	if (NULL == _deques) {
+		return false;
+	}
+	for (uintptr_t i = 0; i < dequeCount; i++) {
+		new(&_deques[i]) PacketDeque();
+	}
+	/* publish the count only once every deque has been constructed so tearDown only frees what was allocated */
+	_dequeCount = dequeCount;
+
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		_deques[i]._entries = (MM_Packet **)env->getForge()->allocate(sizeof(MM_Packet *) * _dequeCapacity, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _deques[i]._entries) {
+			return false;
+		}
+		_deques[i]._mask = _dequeCapacity - 1;
+	}
+
+	return true;
+}
+
+/**
+ * Free the deques and the resources of the shared packet lists
+ */
+void
+MM_WorkPacketsStealing::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _deques) {
+		for (uintptr_t i = 0; i < _dequeCount; i++) {
+			if (NULL != _deques[i]._entries) {
+				env->getForge()->free((void *)_deques[i]._entries);
+				_deques[i]._entries = NULL;
+			}
+		}
+		env->getForge()->free(_deques);
+		_deques = NULL;
+		_dequeCount = 0;
+	}
+
+	MM_WorkPacketsStandard::tearDown(env);
+}
+
+/**
+ * Determine whether an input packet is available, either in a deque or on the shared lists
+ * @return true if yes, false if no
+ */
+bool
+MM_WorkPacketsStealing::inputPacketAvailable(MM_EnvironmentBase *env)
+{
+	for (uintptr_t i = 0; i < _dequeCount; i++) {
+		if (0 < _deques[i].getSize()) {
+			return true;
+		}
+	}
+
+	return MM_WorkPacketsStandard::inputPacketAvailable(env);
+}
+
+/**
+ * Get an input packet if one is available. The most recently filled packet of the calling
+ * thread is preferred as its contents are most likely to still be in cache, then packets stolen
+ * from other threads, and finally the shared lists and the overflow handler.
+ *
+ * @return pointer to a packet, or NULL if none available
+ */
+MM_Packet *
+MM_WorkPacketsStealing::getInputPacketNoWait(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+	PacketDeque *deque = getDeque(env);
+
+	if (NULL != deque) {
+		packet = deque->pop();
+		if (NULL == packet) {
+			packet = stealPacket(env);
+		}
+	}
+
+	if (NULL != packet) {
+		packet->setOwner(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats.workPacketsAcquired += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	} else {
+		packet = MM_WorkPacketsStandard::getInputPacketNoWait(env);
+	}
+
+	return packet;
+}
+
+/**
+ * Hand off a filled output packet. The packet is kept in the calling thread's deque when
+ * there is room for it and placed on the shared lists otherwise.
+ *
+ * @param packet The packet to put
+ */
+void
+MM_WorkPacketsStealing::putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	PacketDeque *deque = getDeque(env);
+
+	if ((NULL != deque) && !packet->isEmpty()) {
+		packet->resetOwner();
+		if (deque->push(packet)) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsReleased += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			/* Make the new bottom visible before reading the wait count, as the locked push onto the shared lists does,
+			 * so that a thread which has just started to wait can not miss both the packet and the notify.
+			 */
+			MM_AtomicOperations::readWriteBarrier();
+			if (_inputListWaitCount > 0) {
+				notifyWaitingThreads(env);
+			}
+			return;
+		}
+		env->_markStats._dequeOverflowCount += 1;
+	}
+
+	MM_WorkPacketsStandard::putOutputPacket(env, packet);
+}
+
+MM_Packet *
+MM_WorkPacketsStealing::stealPacket(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	uintptr_t slaveID = env->getSlaveID();
+	MM_Packet *packet = NULL;
+	uint64_t stealStartTime = 0;
+
+	for (uintptr_t i = 1; (NULL == packet) && (i < _dequeCount); i++) {
+		PacketDeque *victim = &_deques[(slaveID + i) % _dequeCount];
+		if (0 < victim->getSize()) {
+			if ((0 == stealStartTime) && (NULL != _extensions->dispatcher->getTaskTimeline())) {
+				stealStartTime = omrtime_hires_clock();
+			}
+			env->_markStats._stealAttempts += 1;
+			packet = victim->steal();
+		}
+	}
+
+	if (NULL != packet) {
+		env->_markStats._stealCount += 1;
+	}
+	if (0 != stealStartTime) {
+		env->_taskThreadStats.addToStealTime(stealStartTime, omrtime_hires_clock());
+	}
+
+	return packet;
+}
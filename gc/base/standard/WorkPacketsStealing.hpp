@@ -0,0 +1,207 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(WORKPACKETSSTEALING_HPP_)
+#define WORKPACKETSSTEALING_HPP_
+
+#include "omrcfg.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentStandard.hpp"
+#include "WorkPacketsStandard.hpp"
+
+/**
+ * Work packets for stop-the-world marking in which each GC thread hands off the packets it fills
+ * to its own work stealing deque rather than to the shared packet lists.
+ *
+ * The owning thread pushes and pops packets at the bottom of its deque without locking, while idle
+ * threads steal from the top of other threads' deques with a single compare and swap (Chase-Lev).
+ * The shared packet lists are still used for empty packets, for packets which do not fit in a full
+ * deque, and for threads without a deque. Running out of packets is still resolved through the
+ * regular MM_WorkPacketOverflow handler.
+ *
+ * @note Deques are indexed by slave ID, so this class must only be used for marking performed by
+ * dispatched GC threads (i.e. not for concurrent marking on mutator threads).
+ * @ingroup GC_Modron_Standard
+ */
+class MM_WorkPacketsStealing : public MM_WorkPacketsStandard
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * A fixed capacity Chase-Lev deque of packets. The bottom is only updated by the owning thread,
+	 * the top is advanced with a compare and swap by whichever thread takes the oldest entry.
+	 */
+	struct PacketDeque {
+		volatile intptr_t _top; /**< index of the oldest entry, advanced by thieves and by the owner when taking the last entry */
+		uint8_t _topPadding[64 - sizeof(intptr_t)]; /**< keep thieves updating _top off of the owner's cache line */
+		volatile intptr_t _bottom; /**< index one past the newest entry, only written by the owning thread */
+		MM_Packet * volatile *_entries; /**< circular buffer of _mask + 1 entries */
+		intptr_t _mask; /**< capacity - 1, capacity must be a power of two */
+		uint8_t _bottomPadding[64 - sizeof(intptr_t) - sizeof(MM_Packet **) - sizeof(intptr_t)]; /**< keep neighbouring deques off of this cache line */
+
+		/**
+		 * @return an approximation of the number of entries in the deque
+		 */
+		MMINLINE intptr_t
+		getSize()
+		{
+			intptr_t size = _bottom - _top;
+			return (size > 0) ? size : 0;
+		}
+
+		/**
+		 * Push a packet at the bottom of the deque. Must only be called by the owning thread.
+		 * @return true if the packet was pushed, false if the deque is full
+		 */
+		MMINLINE bool
+		push(MM_Packet *packet)
+		{
+			intptr_t bottom = _bottom;
+			intptr_t top = _top;
+			if ((bottom - top) > _mask) {
+				return false;
+			}
+			_entries[bottom & _mask] = packet;
+			/* the entry must be visible before a thief can observe the new bottom */
+			MM_AtomicOperations::writeBarrier();
+			_bottom = bottom + 1;
+			return true;
+		}
+
+		/**
+		 * Pop the most recently pushed packet from the bottom of the deque. Must only be called by the owning thread.
+		 * @return the packet, or NULL if the deque is empty or the last entry was lost to a thief
+		 */
+		MMINLINE MM_Packet *
+		pop()
+		{
+			intptr_t bottom = _bottom - 1;
+			_bottom = bottom;
+			/* the new bottom must be published before top is read, so that a racing thief and the owner can not both take the last entry */
+			MM_AtomicOperations::readWriteBarrier();
+			intptr_t top = _top;
+			MM_Packet *packet = NULL;
+
+			if (top <= bottom) {
+				packet = _entries[bottom & _mask];
+				if (top == bottom) {
+					/* last entry - race against thieves for it */
+					if ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+						packet = NULL;
+					}
+					_bottom = bottom + 1;
+				}
+			} else {
+				_bottom = bottom + 1;
+			}
+
+			return packet;
+		}
+
+		/**
+		 * Steal the oldest packet from the top of the deque. May be called by any thread.
+		 * @return the packet, or NULL if the deque was empty or another thread won the race
+		 */
+		MMINLINE MM_Packet *
+		steal()
+		{
+			intptr_t top = _top;
+			MM_AtomicOperations::readBarrier();
+			intptr_t bottom = _bottom;
+			MM_Packet *packet = NULL;
+
+			if (top < bottom) {
+				packet = _entries[top & _mask];
+				if ((uintptr_t)top != MM_AtomicOperations::lockCompareExchange((volatile uintptr_t *)&_top, (uintptr_t)top, (uintptr_t)(top + 1))) {
+					packet = NULL;
+				}
+			}
+
+			return packet;
+		}
+
+		PacketDeque()
+			: _top(0)
+			, _bottom(0)
+			, _entries(NULL)
+			, _mask(0)
+		{
+		}
+	};
+
+protected:
+private:
+	enum {
+		_dequeCapacity = 256 /**< number of packets each deque can hold before packets spill to the shared lists, must be a power of two */
+	};
+
+	PacketDeque *_deques; /**< one deque per GC thread, indexed by slave ID */
+	uintptr_t _dequeCount; /**< number of entries in _deques */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_WorkPacketsStealing *newInstance(MM_EnvironmentBase *env);
+
+	virtual bool inputPacketAvailable(MM_EnvironmentBase *env);
+	virtual MM_Packet *getInputPacketNoWait(MM_EnvironmentBase *env);
+	virtual void putOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Create a WorkPacketsStealing object.
+	 */
+	MM_WorkPacketsStealing(MM_EnvironmentBase *env)
+		: MM_WorkPacketsStandard(env)
+		, _deques(NULL)
+		, _dequeCount(0)
+	{
+		_typeId = __FUNCTION__;
+	};
+
+protected:
+	virtual bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+private:
+	/**
+	 * Find the deque owned by the calling thread.
+	 * @return the deque, or NULL if the thread does not have one
+	 */
+	MMINLINE PacketDeque *
+	getDeque(MM_EnvironmentBase *env)
+	{
+		uintptr_t slaveID = env->getSlaveID();
+		return (slaveID < _dequeCount) ? &_deques[slaveID] : NULL;
+	}
+
+	/**
+	 * Attempt to steal a packet from the deques of the other GC threads, starting with the thread after the caller.
+	 * @return a stolen packet, or NULL if nothing could be stolen
+	 */
+	MM_Packet *stealPacket(MM_EnvironmentBase *env);
+};
+
+#endif /* WORKPACKETSSTEALING_HPP_ */
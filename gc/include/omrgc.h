@@ -42,6 +42,22 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Rankings of the live object census (-Xgc:liveObjectCensus) */
+#define OMR_GC_LIVE_OBJECT_CENSUS_BY_OBJECTS 0
+#define OMR_GC_LIVE_OBJECT_CENSUS_BY_BYTES 1
+
+typedef struct OMR_GC_LiveObjectCensusEntry {
+	uintptr_t type; /* type key, as returned by GC_ObjectModelDelegate::getObjectTypeForCensus() */
+	uintptr_t value; /* estimated live objects or bytes of the type */
+} OMR_GC_LiveObjectCensusEntry;
+
+/*
+ * Get the types which dominated the live set at the end of the last global collect, highest first.
+ * On entry *entryCount is the size of entries, on return it is the number of entries filled in.
+ * Returns OMR_ERROR_NOT_AVAILABLE if -Xgc:liveObjectCensus is not enabled.
+ */
+omr_error_t OMR_GC_GetLiveObjectCensus(OMR_VMThread* omrVMThread, uintptr_t ranking, OMR_GC_LiveObjectCensusEntry *entries, uintptr_t *entryCount);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
@@ -28,6 +28,7 @@
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
+#include "LiveObjectCensus.hpp"
 #include "omrgcstartup.hpp"
 #include "ModronAssertions.h"
 
@@ -60,3 +61,29 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_GetLiveObjectCensus(OMR_VMThread* omrVMThread, uintptr_t ranking, OMR_GC_LiveObjectCensusEntry *entries, uintptr_t *entryCount)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_LiveObjectCensus *liveObjectCensus = env->getExtensions()->objectCensus;
+	if ((NULL == entryCount) || ((NULL == entries) && (0 != *entryCount))
+		|| ((OMR_GC_LIVE_OBJECT_CENSUS_BY_OBJECTS != ranking) && (OMR_GC_LIVE_OBJECT_CENSUS_BY_BYTES != ranking))
+	) {
+		result = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if (NULL == liveObjectCensus) {
+		*entryCount = 0;
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else {
+		bool byBytes = (OMR_GC_LIVE_OBJECT_CENSUS_BY_BYTES == ranking);
+		MM_LiveObjectCensusEntry *top = byBytes ? liveObjectCensus->getTopByBytes() : liveObjectCensus->getTopByObjects();
+		uintptr_t count = OMR_MIN(*entryCount, byBytes ? liveObjectCensus->getTopByBytesCount() : liveObjectCensus->getTopByObjectsCount());
+		for (uintptr_t rank = 0; rank < count; rank++) {
+			entries[rank].type = top[rank].type;
+			entries[rank].value = top[rank].value;
+		}
+		*entryCount = count;
+	}
+	return result;
+}
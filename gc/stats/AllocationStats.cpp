@@ -34,6 +34,9 @@ MM_AllocationStats::clear()
 	_tlhRequestedBytes = 0;
 	_tlhDiscardedBytes = 0;
 	_tlhMaxAbandonedListSize = 0;
+	_tlhCarvedCount = 0;
+	_tlhCarveWindowRefillCount = 0;
+	_tlhCarveWindowReturnedBytes = 0;
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	_arrayletLeafAllocationCount = 0;
@@ -57,6 +60,9 @@ MM_AllocationStats::merge(MM_AllocationStats *stats)
 	MM_AtomicOperations::add(&_tlhRequestedBytes, stats->_tlhRequestedBytes);
 	MM_AtomicOperations::add(&_tlhDiscardedBytes, stats->_tlhDiscardedBytes);
 	MM_AtomicOperations::add(&_tlhAllocatedReused, stats->_tlhAllocatedReused);
+	MM_AtomicOperations::add(&_tlhCarvedCount, stats->_tlhCarvedCount);
+	MM_AtomicOperations::add(&_tlhCarveWindowRefillCount, stats->_tlhCarveWindowRefillCount);
+	MM_AtomicOperations::add(&_tlhCarveWindowReturnedBytes, stats->_tlhCarveWindowReturnedBytes);
 	/* looping to set a maximum value in _tlhMaxAbandonedListSize */
 	for (
 			uintptr_t prevMax = _tlhMaxAbandonedListSize;
@@ -41,6 +41,9 @@ public:
 	uintptr_t _tlhRequestedBytes; /**< The amount of memory requested for refreshes. */
 	uintptr_t _tlhDiscardedBytes; /**< The amount of memory from discarded TLHs. */
 	uintptr_t _tlhMaxAbandonedListSize; /**< The maximum size of the abandoned list. */
+	uintptr_t _tlhCarvedCount; /**< Number of refreshes carved lock free from a split free list carve window. */
+	uintptr_t _tlhCarveWindowRefillCount; /**< Number of carve windows detached from the split free lists. */
+	uintptr_t _tlhCarveWindowReturnedBytes; /**< The amount of memory left in retired carve windows and returned to the free lists. */
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 
 	uintptr_t _arrayletLeafAllocationCount;	/**< Number of arraylet leaf allocations */
@@ -84,6 +87,9 @@ public:
 		_tlhRequestedBytes(0),
 		_tlhDiscardedBytes(0),
 		_tlhMaxAbandonedListSize(0),
+		_tlhCarvedCount(0),
+		_tlhCarveWindowRefillCount(0),
+		_tlhCarveWindowReturnedBytes(0),
 #endif /* defined (OMR_GC_THREAD_LOCAL_HEAP) */
 		_arrayletLeafAllocationCount(0),
 		_arrayletLeafAllocationBytes(0),
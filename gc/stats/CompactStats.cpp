@@ -40,14 +40,19 @@ MM_CompactStats::clear()
 	_movedBytes = 0;
 	
 	_fixupObjects = 0;
+	_partitionCount = 0;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
+	_summaryStartTime = 0;
+	_summaryEndTime = 0;
 	_moveStartTime = 0;
 	_moveEndTime = 0;
 	_fixupStartTime = 0;
 	_fixupEndTime = 0;
 	_rootFixupStartTime = 0;
 	_rootFixupEndTime = 0;
+	_rebuildStartTime = 0;
+	_rebuildEndTime = 0;
 };
 
 void
@@ -56,15 +61,20 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
+	_partitionCount = OMR_MAX(_partitionCount, statsToMerge->_partitionCount);
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
+	_summaryStartTime = (0 == _summaryStartTime) ? statsToMerge->_summaryStartTime : OMR_MIN(_summaryStartTime, statsToMerge->_summaryStartTime);
+	_summaryEndTime = OMR_MAX(_summaryEndTime, statsToMerge->_summaryEndTime);
 	_moveStartTime = (0 == _moveStartTime) ? statsToMerge->_moveStartTime : OMR_MIN(_moveStartTime, statsToMerge->_moveStartTime);
 	_moveEndTime = OMR_MAX(_moveEndTime, statsToMerge->_moveEndTime);
 	_fixupStartTime = (0 == _fixupStartTime) ? statsToMerge->_fixupStartTime : OMR_MIN(_fixupStartTime, statsToMerge->_fixupStartTime);
 	_fixupEndTime = OMR_MAX(_fixupEndTime, statsToMerge->_fixupEndTime);
 	_rootFixupStartTime = (0 == _rootFixupStartTime) ? statsToMerge->_rootFixupStartTime : OMR_MIN(_rootFixupStartTime, statsToMerge->_rootFixupStartTime);
 	_rootFixupEndTime = OMR_MAX(_rootFixupEndTime, statsToMerge->_rootFixupEndTime);
+	_rebuildStartTime = (0 == _rebuildStartTime) ? statsToMerge->_rebuildStartTime : OMR_MIN(_rebuildStartTime, statsToMerge->_rebuildStartTime);
+	_rebuildEndTime = OMR_MAX(_rebuildEndTime, statsToMerge->_rebuildEndTime);
 };
 
 #endif /* OMR_GC_MODRON_COMPACTION */
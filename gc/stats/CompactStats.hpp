@@ -50,14 +50,19 @@ public:
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
 	uintptr_t _fixupObjects;
+	uintptr_t _partitionCount; /**< number of partitions in a region partitioned compaction, 0 otherwise */
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
+	uint64_t _summaryStartTime;
+	uint64_t _summaryEndTime;
 	uint64_t _moveStartTime;
 	uint64_t _moveEndTime;
 	uint64_t _fixupStartTime;
 	uint64_t _fixupEndTime;
 	uint64_t _rootFixupStartTime;
 	uint64_t _rootFixupEndTime;
+	uint64_t _rebuildStartTime;
+	uint64_t _rebuildEndTime;
 		
 	/* Remember gc count on last compaction of heap */
 	uintptr_t _lastHeapCompaction;
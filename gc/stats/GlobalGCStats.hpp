@@ -57,6 +57,12 @@ public:
 
 	uintptr_t finalizableCount; /**< count of objects pushed for finalization during one GC cycle */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t segregatedCollectType; /**< MM_SegregatedCollectType of the cycle when the segregated collector is generational */
+	uintptr_t segregatedRememberedObjects; /**< Number of old objects remembered by the write barrier since the previous collect */
+	uintptr_t segregatedMinorCollects; /**< Number of minor collects run since the previous full mark, including this one */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 	MMINLINE void clear()
 	{
 		/* gcCount is not cleared as the value must persist across cycles */
@@ -75,6 +81,12 @@ public:
 		metronomeStats.clearStart();
 
 		finalizableCount = 0;
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		segregatedCollectType = SEGREGATED_COLLECT_MINOR;
+		segregatedRememberedObjects = 0;
+		segregatedMinorCollects = 0;
+#endif /* OMR_GC_SEGREGATED_HEAP */
 	};
 
 	MM_GlobalGCStats()
@@ -89,7 +101,13 @@ public:
 		, markStats()
 		, classUnloadStats()
 		, metronomeStats()
-		, finalizableCount(0) {};
+		, finalizableCount(0)
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		, segregatedCollectType(SEGREGATED_COLLECT_MINOR)
+		, segregatedRememberedObjects(0)
+		, segregatedMinorCollects(0)
+#endif /* OMR_GC_SEGREGATED_HEAP */
+		{};
 };
 
 #endif /* GLOBALGCSTATS_HPP_ */
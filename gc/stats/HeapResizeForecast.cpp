@@ -0,0 +1,155 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrport.h"
+
+#include "HeapResizeForecast.hpp"
+
+/**
+ * Fold a new observation into a smoothed value; the first observation is taken as is.
+ */
+static MMINLINE double
+smooth(double average, double observation, bool first)
+{
+	return first ? observation : ((1.0 - HEAP_RESIZE_FORECAST_WEIGHT) * average) + (HEAP_RESIZE_FORECAST_WEIGHT * observation);
+}
+
+void
+MM_HeapResizeForecast::reset()
+{
+	_observations = 0;
+	_intervals = 0;
+	_lastObservedGCCount = UDATA_MAX;
+	_lastResizeTime = 0;
+	_freeBytesAfterLastResize = 0;
+	_allocationRate = 0;
+	_liveGrowth = 0;
+	_gcTimePerLiveByte = 0;
+	_liveBytes = 0;
+	_forecastAllocationRate = 0;
+	_forecastLiveBytes = 0;
+	_forecastGCTime = 0;
+	_forecastOverhead = 0;
+	_forecastHeapSize = 0;
+	_hasForecast = false;
+	_actualAllocationRate = 0;
+	_actualLiveBytes = 0;
+	_actualGCTime = 0;
+	_actualOverhead = 0;
+	_reportedAllocationRate = 0;
+	_reportedLiveBytes = 0;
+	_reportedGCTime = 0;
+	_reportedOverhead = 0;
+	_hasReportedForecast = false;
+	_unreported = false;
+}
+
+void
+MM_HeapResizeForecast::observeCollection(MM_EnvironmentBase *env, uintptr_t gcCount, uint64_t gcStartTime, uintptr_t freeBytesAtStart, uintptr_t liveBytes)
+{
+	if (gcCount == _lastObservedGCCount) {
+		/* the collection may check whether to resize more than once */
+		return;
+	}
+	_lastObservedGCCount = gcCount;
+
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	double gcTime = (double)omrtime_hires_delta(gcStartTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0;
+
+	/* the forecast made after the previous collection is now compared with what happened */
+	_hasReportedForecast = _hasForecast;
+	_reportedAllocationRate = _forecastAllocationRate;
+	_reportedLiveBytes = _forecastLiveBytes;
+	_reportedGCTime = _forecastGCTime;
+	_reportedOverhead = _forecastOverhead;
+	_hasForecast = false;
+
+	bool hasInterval = (0 != _observations) && (0 != _lastResizeTime) && (gcStartTime > _lastResizeTime);
+	if (hasInterval) {
+		double mutatorTime = (double)omrtime_hires_delta(_lastResizeTime, gcStartTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS) / 1000.0;
+		/* the heap may have been resized outside of a collection, in which case nothing was consumed as far as we know */
+		uintptr_t consumedBytes = (_freeBytesAfterLastResize > freeBytesAtStart) ? (_freeBytesAfterLastResize - freeBytesAtStart) : 0;
+		if (0 == mutatorTime) {
+			mutatorTime = 0.001;
+		}
+		_actualAllocationRate = (double)consumedBytes / mutatorTime;
+		_actualOverhead = (gcTime * 100.0) / (gcTime + mutatorTime);
+		_allocationRate = smooth(_allocationRate, _actualAllocationRate, 0 == _intervals);
+		_liveGrowth = smooth(_liveGrowth, (double)liveBytes - (double)_liveBytes, 0 == _intervals);
+		_intervals += 1;
+	} else {
+		_actualAllocationRate = 0;
+		_actualOverhead = 0;
+	}
+
+	if (0 != liveBytes) {
+		_gcTimePerLiveByte = smooth(_gcTimePerLiveByte, gcTime / (double)liveBytes, 0 == _observations);
+	}
+
+	_actualGCTime = gcTime;
+	_actualLiveBytes = liveBytes;
+	_liveBytes = liveBytes;
+	_observations += 1;
+	_unreported = true;
+}
+
+void
+MM_HeapResizeForecast::resizeCompleted(MM_EnvironmentBase *env, uintptr_t freeBytes)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	_lastResizeTime = omrtime_hires_clock();
+	_freeBytesAfterLastResize = freeBytes;
+}
+
+uintptr_t
+MM_HeapResizeForecast::calculateTargetHeapSize(uintptr_t targetOverhead, uintptr_t minimumHeapSize, uintptr_t maximumHeapSize)
+{
+	/* A shrinking live set is not expected to shrink by more than half in a single cycle */
+	double liveBytes = (double)_liveBytes;
+	double nextLiveBytes = OMR_MAX(liveBytes + _liveGrowth, liveBytes / 2);
+	double gcTime = _gcTimePerLiveByte * nextLiveBytes;
+	double freeBytes = _allocationRate * gcTime * (double)(100 - targetOverhead) / (double)targetOverhead;
+
+	double targetHeapSize = nextLiveBytes + freeBytes;
+	if (targetHeapSize > (double)maximumHeapSize) {
+		targetHeapSize = (double)maximumHeapSize;
+	}
+	if (targetHeapSize < (double)minimumHeapSize) {
+		targetHeapSize = (double)minimumHeapSize;
+	}
+
+	_forecastAllocationRate = _allocationRate;
+	_forecastLiveBytes = (uintptr_t)nextLiveBytes;
+	_forecastGCTime = gcTime;
+	_forecastHeapSize = (uintptr_t)targetHeapSize;
+	_forecastOverhead = 0;
+	if ((0 != _allocationRate) && (targetHeapSize > nextLiveBytes)) {
+		double intervalTime = (targetHeapSize - nextLiveBytes) / _allocationRate;
+		_forecastOverhead = (gcTime * 100.0) / (gcTime + intervalTime);
+	} else if (0 != gcTime) {
+		_forecastOverhead = 100.0;
+	}
+	_hasForecast = true;
+
+	return _forecastHeapSize;
+}
@@ -0,0 +1,182 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(HEAPRESIZEFORECAST_HPP_)
+#define HEAPRESIZEFORECAST_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+
+/**
+ * Weight of the newest observation in the smoothed allocation rate, live set growth and GC cost.
+ */
+#define HEAP_RESIZE_FORECAST_WEIGHT 0.3
+
+/**
+ * Cost model behind -Xgc:heapResizePredictive.
+ *
+ * After every global collection the model observes how fast the heap was consumed between the previous
+ * collection and this one, how long this collection took and how large the live set is. It forecasts the
+ * live set of the next collection from the smoothed growth per cycle and the cost of that collection from
+ * the smoothed cost per live byte. Collecting every time freeBytes are consumed gives a GC overhead of
+ *
+ *   gcTime / (gcTime + freeBytes / allocationRate)
+ *
+ * so the heap size which meets -Xgc:heapResizeTargetGCOverhead= is
+ *
+ *   live + allocationRate * gcTime * (100 - target) / target
+ *
+ * The subspace clamps this between the sizes that leave -Xminf and -Xmaxf free and only resizes when it
+ * falls outside the -Xgc:heapResizeHysteresis= band around the current size.
+ *
+ * Each forecast is kept until the following collection so verbose:gc can report it next to what happened.
+ * @ingroup GC_Stats
+ */
+class MM_HeapResizeForecast : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	uintptr_t _observations; /**< Collections observed since the model was (re)started */
+	uintptr_t _intervals; /**< Intervals between collections measured since the model was (re)started */
+	uintptr_t _lastObservedGCCount; /**< Global GC count of the last observation; a collection is observed once */
+	uint64_t _lastResizeTime; /**< Time in hi-res ticks at which the previous collection completed its resize */
+	uintptr_t _freeBytesAfterLastResize; /**< Free bytes left by the previous collection once it had resized the heap */
+
+	double _allocationRate; /**< Smoothed heap consumption in bytes per millisecond of time outside GC */
+	double _liveGrowth; /**< Smoothed change of the live set in bytes per collection */
+	double _gcTimePerLiveByte; /**< Smoothed collection time in milliseconds per live byte */
+	uintptr_t _liveBytes; /**< Live set left by the last observed collection */
+
+	double _forecastAllocationRate; /**< Allocation rate forecast for the interval after the last collection */
+	uintptr_t _forecastLiveBytes; /**< Live set forecast for the next collection */
+	double _forecastGCTime; /**< Duration in milliseconds forecast for the next collection */
+	double _forecastOverhead; /**< GC overhead percentage forecast for the target heap size */
+	uintptr_t _forecastHeapSize; /**< Heap size the forecast was made for */
+	bool _hasForecast; /**< True if a forecast was made after the previous collection */
+
+	double _actualAllocationRate; /**< Allocation rate measured over the interval ending at the last collection */
+	uintptr_t _actualLiveBytes; /**< Live set measured by the last collection */
+	double _actualGCTime; /**< Duration in milliseconds of the last collection */
+	double _actualOverhead; /**< GC overhead percentage of the last interval and collection */
+
+	double _reportedAllocationRate; /**< Forecast made before the last collection, kept for verbose:gc */
+	uintptr_t _reportedLiveBytes;
+	double _reportedGCTime;
+	double _reportedOverhead;
+	bool _hasReportedForecast; /**< True if the _reported fields hold a forecast */
+	bool _unreported; /**< True if an observation has not yet been reported */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Record what the collection in progress measured. Only the first call for a given collection has any effect.
+	 * @param env[in] the master GC thread
+	 * @param gcCount[in] global GC count of the collection in progress
+	 * @param gcStartTime[in] time in hi-res ticks at which the collection started
+	 * @param freeBytesAtStart[in] free bytes in the heap when the collection started
+	 * @param liveBytes[in] bytes in the heap which survived the collection
+	 */
+	void observeCollection(MM_EnvironmentBase *env, uintptr_t gcCount, uint64_t gcStartTime, uintptr_t freeBytesAtStart, uintptr_t liveBytes);
+
+	/**
+	 * Record the state of the heap once the collection has resized it; the next interval is measured from here.
+	 * @param env[in] the master GC thread
+	 * @param freeBytes[in] free bytes in the heap after the resize
+	 */
+	void resizeCompleted(MM_EnvironmentBase *env, uintptr_t freeBytes);
+
+	/**
+	 * @return true once the model has measured at least one complete interval between collections
+	 */
+	MMINLINE bool isReady() { return 0 != _intervals; }
+
+	/**
+	 * Forecast the next collection and calculate the heap size that meets the target GC overhead.
+	 * The forecast is remembered for verbose:gc.
+	 * @param targetOverhead[in] target GC overhead percentage (1..99)
+	 * @param minimumHeapSize[in] smallest acceptable result
+	 * @param maximumHeapSize[in] largest acceptable result
+	 * @return the target heap size in bytes
+	 */
+	uintptr_t calculateTargetHeapSize(uintptr_t targetOverhead, uintptr_t minimumHeapSize, uintptr_t maximumHeapSize);
+
+	/**
+	 * Restart the model, e.g. after a collection whose cost is not representative.
+	 */
+	void reset();
+
+	/**
+	 * Check whether an observation is waiting to be reported, and mark it reported.
+	 * @return true if the caller should report the last observation
+	 */
+	MMINLINE bool takeUnreportedObservation()
+	{
+		bool result = _unreported;
+		_unreported = false;
+		return result;
+	}
+
+	MMINLINE bool hasReportedForecast() { return _hasReportedForecast; }
+	MMINLINE double getReportedAllocationRate() { return _reportedAllocationRate; }
+	MMINLINE uintptr_t getReportedLiveBytes() { return _reportedLiveBytes; }
+	MMINLINE double getReportedGCTime() { return _reportedGCTime; }
+	MMINLINE double getReportedOverhead() { return _reportedOverhead; }
+
+	MMINLINE double getActualAllocationRate() { return _actualAllocationRate; }
+	MMINLINE uintptr_t getActualLiveBytes() { return _actualLiveBytes; }
+	MMINLINE double getActualGCTime() { return _actualGCTime; }
+	MMINLINE double getActualOverhead() { return _actualOverhead; }
+
+	MMINLINE bool hasForecast() { return _hasForecast; }
+	MMINLINE double getForecastAllocationRate() { return _forecastAllocationRate; }
+	MMINLINE uintptr_t getForecastLiveBytes() { return _forecastLiveBytes; }
+	MMINLINE double getForecastGCTime() { return _forecastGCTime; }
+	MMINLINE double getForecastOverhead() { return _forecastOverhead; }
+	MMINLINE uintptr_t getForecastHeapSize() { return _forecastHeapSize; }
+
+	MM_HeapResizeForecast() :
+		MM_Base()
+	{
+		reset();
+	}
+};
+
+#endif /* HEAPRESIZEFORECAST_HPP_ */
@@ -28,6 +28,7 @@
 
 #include "Base.hpp"
 #include "Debug.hpp"
+#include "HeapResizeForecast.hpp"
 
 #define RATIO_RESIZE_HISTORIES				3
 
@@ -70,6 +71,8 @@ private:
 	uint64_t 				_ticksInGC[RATIO_RESIZE_HISTORIES];
 	uint64_t 				_ticksOutsideGC[RATIO_RESIZE_HISTORIES];
 
+	MM_HeapResizeForecast	_forecast; /**< Allocation rate and GC cost model used by -Xgc:heapResizePredictive */
+
 protected:
 public:
 
@@ -155,6 +158,8 @@ public:
 	MMINLINE uint64_t	getLastTimeOutsideGC()			{	return _lastTimeOutsideGC; }
 	MMINLINE void	setGlobalGCCountAtAF(uintptr_t count)	{	_globalGCCountAtAF = count; }
 	MMINLINE uintptr_t   getGlobalGCCountAtAF()			{	return _globalGCCountAtAF; }
+
+	MMINLINE MM_HeapResizeForecast *getForecast() { return &_forecast; }
 	
 	MMINLINE uint32_t	getRatioExpandPercentage()
 	{
@@ -190,7 +195,8 @@ public:
 		_lastContractTime(0),
 		_lastGCPercentage(0),
 		_lastTimeOutsideGC(0),
-		_globalGCCountAtAF(0)
+		_globalGCCountAtAF(0),
+		_forecast()
 	{
 		resetRatioTicks();
 	}
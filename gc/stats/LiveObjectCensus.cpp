@@ -0,0 +1,203 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrport.h"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "Forge.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ObjectModel.hpp"
+
+#include "LiveObjectCensus.hpp"
+
+MM_LiveObjectCensus *
+MM_LiveObjectCensus::newInstance(MM_EnvironmentBase *env)
+{
+	MM_LiveObjectCensus *census = (MM_LiveObjectCensus *)env->getForge()->allocate(sizeof(MM_LiveObjectCensus), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != census) {
+		new(census) MM_LiveObjectCensus(env);
+		if (!census->initialize(env)) {
+			census->kill(env);
+			census = NULL;
+		}
+	}
+	return census;
+}
+
+void
+MM_LiveObjectCensus::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_LiveObjectCensus::initialize(MM_EnvironmentBase *env)
+{
+	OMRPortLibrary *portLibrary = env->getPortLibrary();
+
+	_sampleRate = OMR_MAX(_extensions->liveObjectCensusSampleRate, 1);
+	_topK = OMR_MAX(_extensions->liveObjectCensusTopK, 1);
+	uint32_t sketchSize = (uint32_t)(_topK * LIVE_OBJECT_CENSUS_K_TO_SIZE_RATIO);
+
+	_sketchCount = _extensions->gcThreadCount + LIVE_OBJECT_CENSUS_MUTATOR_SKETCHES;
+	_sketches = (MM_LiveObjectCensusSketch *)env->getForge()->allocate(_sketchCount * sizeof(MM_LiveObjectCensusSketch), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _sketches) {
+		return false;
+	}
+	memset(_sketches, 0, _sketchCount * sizeof(MM_LiveObjectCensusSketch));
+	for (uintptr_t index = 0; index < _sketchCount; index++) {
+		if (NULL == (_sketches[index]._objects = spaceSavingNew(portLibrary, sketchSize))) {
+			return false;
+		}
+		if (NULL == (_sketches[index]._bytes = spaceSavingNew(portLibrary, sketchSize))) {
+			return false;
+		}
+	}
+
+	if (NULL == (_mergedObjects = spaceSavingNew(portLibrary, sketchSize))) {
+		return false;
+	}
+	if (NULL == (_mergedBytes = spaceSavingNew(portLibrary, sketchSize))) {
+		return false;
+	}
+
+	_topByObjects = (MM_LiveObjectCensusEntry *)env->getForge()->allocate(2 * _topK * sizeof(MM_LiveObjectCensusEntry), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _topByObjects) {
+		return false;
+	}
+	_topByBytes = _topByObjects + _topK;
+
+	return true;
+}
+
+void
+MM_LiveObjectCensus::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _sketches) {
+		for (uintptr_t index = 0; index < _sketchCount; index++) {
+			if (NULL != _sketches[index]._objects) {
+				spaceSavingFree(_sketches[index]._objects);
+			}
+			if (NULL != _sketches[index]._bytes) {
+				spaceSavingFree(_sketches[index]._bytes);
+			}
+		}
+		env->getForge()->free(_sketches);
+		_sketches = NULL;
+	}
+	if (NULL != _mergedObjects) {
+		spaceSavingFree(_mergedObjects);
+		_mergedObjects = NULL;
+	}
+	if (NULL != _mergedBytes) {
+		spaceSavingFree(_mergedBytes);
+		_mergedBytes = NULL;
+	}
+	if (NULL != _topByObjects) {
+		env->getForge()->free(_topByObjects);
+		_topByObjects = NULL;
+		_topByBytes = NULL;
+	}
+}
+
+MM_LiveObjectCensusSketch *
+MM_LiveObjectCensus::claimSketch(MM_EnvironmentBase *env)
+{
+	MM_LiveObjectCensusSketch *sketch = NULL;
+	uintptr_t index = MM_AtomicOperations::add(&_sketchesClaimed, 1) - 1;
+	if (index < _sketchCount) {
+		sketch = &_sketches[index];
+	}
+	env->_liveObjectCensusSketch = sketch;
+	env->_liveObjectCensusNumber = _census;
+	return sketch;
+}
+
+void
+MM_LiveObjectCensus::recordSample(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	MM_LiveObjectCensusSketch *sketch = env->_liveObjectCensusSketch;
+	if (_census != env->_liveObjectCensusNumber) {
+		sketch = claimSketch(env);
+	}
+
+	if (NULL == sketch) {
+		MM_AtomicOperations::add(&_droppedSamples, 1);
+	} else {
+		GC_ObjectModel *objectModel = &_extensions->objectModel;
+		void *type = (void *)objectModel->getObjectTypeForCensus(objectPtr);
+		uintptr_t size = objectModel->getConsumedSizeInBytesWithHeader(objectPtr);
+
+		/* Each sample stands for the objects skipped since the previous one */
+		spaceSavingUpdate(sketch->_objects, type, _sampleRate);
+		spaceSavingUpdate(sketch->_bytes, type, _sampleRate * size);
+		sketch->_sampledObjects += 1;
+	}
+}
+
+uintptr_t
+MM_LiveObjectCensus::extractTop(OMRSpaceSaving *merged, MM_LiveObjectCensusEntry *entries)
+{
+	uintptr_t count = OMR_MIN(_topK, spaceSavingGetCurSize(merged));
+	for (uintptr_t rank = 0; rank < count; rank++) {
+		entries[rank].type = (uintptr_t)spaceSavingGetKthMostFreq(merged, rank + 1);
+		entries[rank].value = spaceSavingGetKthMostFreqCount(merged, rank + 1);
+	}
+	return count;
+}
+
+void
+MM_LiveObjectCensus::censusCompleted(MM_EnvironmentBase *env)
+{
+	uintptr_t claimed = OMR_MIN(_sketchesClaimed, _sketchCount);
+
+	spaceSavingClear(_mergedObjects);
+	spaceSavingClear(_mergedBytes);
+	_sampledObjects = 0;
+	for (uintptr_t index = 0; index < claimed; index++) {
+		MM_LiveObjectCensusSketch *sketch = &_sketches[index];
+		for (uintptr_t rank = 1; rank <= spaceSavingGetCurSize(sketch->_objects); rank++) {
+			spaceSavingUpdate(_mergedObjects, spaceSavingGetKthMostFreq(sketch->_objects, rank), spaceSavingGetKthMostFreqCount(sketch->_objects, rank));
+		}
+		for (uintptr_t rank = 1; rank <= spaceSavingGetCurSize(sketch->_bytes); rank++) {
+			spaceSavingUpdate(_mergedBytes, spaceSavingGetKthMostFreq(sketch->_bytes, rank), spaceSavingGetKthMostFreqCount(sketch->_bytes, rank));
+		}
+		_sampledObjects += sketch->_sampledObjects;
+
+		spaceSavingClear(sketch->_objects);
+		spaceSavingClear(sketch->_bytes);
+		sketch->_sampledObjects = 0;
+	}
+
+	_topByObjectsCount = extractTop(_mergedObjects, _topByObjects);
+	_topByBytesCount = extractTop(_mergedBytes, _topByBytes);
+	_lastDroppedSamples = _droppedSamples;
+	_droppedSamples = 0;
+	_resultsReported = false;
+
+	/* Threads holding a sketch from this census claim a fresh one on their next sample */
+	_sketchesClaimed = 0;
+	_census += 1;
+}
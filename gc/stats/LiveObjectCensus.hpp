@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(LIVEOBJECTCENSUS_HPP_)
+#define LIVEOBJECTCENSUS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "objectdescription.h"
+#include "spacesaving.h"
+
+#include "Base.hpp"
+#include "EnvironmentBase.hpp"
+
+class MM_GCExtensionsBase;
+
+/**
+ * Each sketch tracks this many more types than are reported, so the reported top K are accurate.
+ */
+#define LIVE_OBJECT_CENSUS_K_TO_SIZE_RATIO 8
+
+/**
+ * Sketches kept for threads which are not GC slave threads, i.e. mutators which trace during concurrent marking.
+ */
+#define LIVE_OBJECT_CENSUS_MUTATOR_SKETCHES 16
+
+/**
+ * Samples one thread took since the previous census.
+ */
+class MM_LiveObjectCensusSketch
+{
+public:
+	OMRSpaceSaving *_objects; /**< Estimated live objects per type */
+	OMRSpaceSaving *_bytes; /**< Estimated live bytes per type */
+	uintptr_t _sampledObjects; /**< Objects actually sampled */
+};
+
+/**
+ * One type of a census result.
+ */
+typedef struct MM_LiveObjectCensusEntry {
+	uintptr_t type; /**< Type key from GC_ObjectModelDelegate::getObjectTypeForCensus() */
+	uintptr_t value; /**< Estimated live objects or bytes of that type */
+} MM_LiveObjectCensusEntry;
+
+/**
+ * Census of the types which dominate the live set, enabled by -Xgc:liveObjectCensus. One in every
+ * -Xgc:liveObjectCensusSampleRate= objects the marking scheme scans is recorded, by type, in a space
+ * saving sketch of the scanning thread. Once marking completes the thread sketches are merged into the
+ * top -Xgc:liveObjectCensusTopK= types by object count and by bytes.
+ * @ingroup GC_Stats
+ */
+class MM_LiveObjectCensus : public MM_Base
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions;
+	uintptr_t _sampleRate; /**< One in this many scanned objects is sampled */
+	uintptr_t _topK; /**< Number of types reported */
+	bool _sampling; /**< False while marking is not collecting garbage, e.g. when preparing a heap walk */
+
+	MM_LiveObjectCensusSketch *_sketches; /**< Sketches handed out to scanning threads */
+	uintptr_t _sketchCount;
+	volatile uintptr_t _sketchesClaimed; /**< Sketches handed out since the previous census */
+	uintptr_t _census; /**< Number of the census being sampled. A thread whose sketch is from an older census claims a new one */
+
+	OMRSpaceSaving *_mergedObjects; /**< Thread sketches merged by object count */
+	OMRSpaceSaving *_mergedBytes; /**< Thread sketches merged by bytes */
+	MM_LiveObjectCensusEntry *_topByObjects; /**< Result of the last census by object count */
+	MM_LiveObjectCensusEntry *_topByBytes; /**< Result of the last census by bytes */
+	uintptr_t _topByObjectsCount;
+	uintptr_t _topByBytesCount;
+	uintptr_t _sampledObjects; /**< Objects sampled for the last census */
+	volatile uintptr_t _droppedSamples; /**< Samples dropped since the previous census because no sketch was left */
+	uintptr_t _lastDroppedSamples; /**< Samples dropped for the last census */
+	bool _resultsReported; /**< True once the last census has been reported in verbose GC */
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	void recordSample(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+	MM_LiveObjectCensusSketch *claimSketch(MM_EnvironmentBase *env);
+	uintptr_t extractTop(OMRSpaceSaving *merged, MM_LiveObjectCensusEntry *entries);
+protected:
+public:
+	static MM_LiveObjectCensus *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Called by the marking scheme for every object it scans from a work packet.
+	 */
+	MMINLINE void
+	sampleObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+	{
+		if (_sampling) {
+			if (0 == env->_liveObjectCensusCountdown) {
+				env->_liveObjectCensusCountdown = _sampleRate - 1;
+				recordSample(env, objectPtr);
+			} else {
+				env->_liveObjectCensusCountdown -= 1;
+			}
+		}
+	}
+
+	/**
+	 * Suspend sampling while marking does not collect garbage, e.g. when marking to prepare a heap walk.
+	 */
+	MMINLINE void setSampling(bool sampling) { _sampling = sampling; }
+
+	/**
+	 * Merge the thread sketches into the census result and start the next census. Called by the master
+	 * thread once marking for a global collect is complete, with all other threads stopped.
+	 */
+	void censusCompleted(MM_EnvironmentBase *env);
+
+	MMINLINE MM_LiveObjectCensusEntry *getTopByObjects() { return _topByObjects; }
+	MMINLINE uintptr_t getTopByObjectsCount() { return _topByObjectsCount; }
+	MMINLINE MM_LiveObjectCensusEntry *getTopByBytes() { return _topByBytes; }
+	MMINLINE uintptr_t getTopByBytesCount() { return _topByBytesCount; }
+	MMINLINE uintptr_t getSampleRate() { return _sampleRate; }
+	MMINLINE uintptr_t getSampledObjects() { return _sampledObjects; }
+	MMINLINE uintptr_t getDroppedSamples() { return _lastDroppedSamples; }
+
+	/**
+	 * @return true, once, after every census which has not been reported in verbose GC yet
+	 */
+	MMINLINE bool
+	takeUnreportedResults()
+	{
+		bool unreported = !_resultsReported;
+		_resultsReported = true;
+		return unreported;
+	}
+
+	MM_LiveObjectCensus(MM_EnvironmentBase *env)
+		: MM_Base()
+		, _extensions(env->getExtensions())
+		, _sampleRate(1)
+		, _topK(0)
+		, _sampling(true)
+		, _sketches(NULL)
+		, _sketchCount(0)
+		, _sketchesClaimed(0)
+		, _census(1)
+		, _mergedObjects(NULL)
+		, _mergedBytes(NULL)
+		, _topByObjects(NULL)
+		, _topByBytes(NULL)
+		, _topByObjectsCount(0)
+		, _topByBytesCount(0)
+		, _sampledObjects(0)
+		, _droppedSamples(0)
+		, _lastDroppedSamples(0)
+		, _resultsReported(true)
+	{}
+};
+
+#endif /* LIVEOBJECTCENSUS_HPP_ */
@@ -35,6 +35,9 @@ MM_MarkStats::clear()
 	_objectsMarked = 0;
 	_objectsScanned = 0;
 	_bytesScanned = 0;
+	_stealAttempts = 0;
+	_stealCount = 0;
+	_dequeOverflowCount = 0;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	_syncStallCount = 0;
@@ -52,6 +55,9 @@ MM_MarkStats::merge(MM_MarkStats *statsToMerge)
 	_objectsMarked += statsToMerge->_objectsMarked;
 	_objectsScanned += statsToMerge->_objectsScanned;
 	_bytesScanned += statsToMerge->_bytesScanned;
+	_stealAttempts += statsToMerge->_stealAttempts;
+	_stealCount += statsToMerge->_stealCount;
+	_dequeOverflowCount += statsToMerge->_dequeOverflowCount;
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
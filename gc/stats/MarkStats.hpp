@@ -48,6 +48,9 @@ public:
 	uintptr_t _objectsMarked;  /**< The number of objects found through scanning during marking */
 	uintptr_t _objectsScanned;  /**< The number of objects popped and scanned during marking (e.g., non-base type arrays) */
 	uintptr_t _bytesScanned; /**< The number of bytes scanned by the owning thread (or globally) during marking */
+	uintptr_t _stealAttempts; /**< The number of times a non-empty work stealing deque of another thread was targeted */
+	uintptr_t _stealCount; /**< The number of packets successfully stolen from the deques of other threads */
+	uintptr_t _dequeOverflowCount; /**< The number of output packets placed on the shared lists because the owning deque was full */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	uintptr_t _syncStallCount; /**< The number of times the thread stalled at a sync point */
@@ -110,6 +113,9 @@ public:
 		,_objectsMarked(0)
 		,_objectsScanned(0)
 		,_bytesScanned(0)
+		,_stealAttempts(0)
+		,_stealCount(0)
+		,_dequeOverflowCount(0)
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 		,_syncStallCount(0)
 		,_syncStallTime(0)
@@ -70,6 +70,9 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_avgTenureBytes(0)
 	,_avgTenureBytesDeviation(0)
 	,_tiltRatio(0)
+	,_scanOrdering(0)
+	,_scanOrderingCopyScanPercent(0)
+	,_scanOrderingStallPercent(0)
 	,_nextScavengeWillPercolate(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)	
 	,_avgTenureLOABytes(0)
@@ -84,9 +87,16 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_semiSpaceAllocationCountSmall(0)
 	,_tenureSpaceAllocationCountLarge(0)
 	,_tenureSpaceAllocationCountSmall(0)
+	,_nodeLocalCopyCacheCount(0)
+	,_nodeLocalCopyCacheBytes(0)
+	,_crossNodeCopyCacheCount(0)
+	,_crossNodeCopyCacheBytes(0)
 	,_tenureExpandedBytes(0)
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
+	,_rememberedSetListObjects(0)
+	,_rememberedSetMapObjects(0)
+	,_rememberedSetScanTime(0)
 	,_leafObjectCount(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
@@ -186,10 +196,19 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_tenureSpaceAllocationCountLarge = 0;
 	_tenureSpaceAllocationCountSmall = 0;
 
+	_nodeLocalCopyCacheCount = 0;
+	_nodeLocalCopyCacheBytes = 0;
+	_crossNodeCopyCacheCount = 0;
+	_crossNodeCopyCacheBytes = 0;
+
 	_tenureExpandedBytes = 0;
 	_tenureExpandedCount = 0;
 	_tenureExpandedTime = 0;
 
+	_rememberedSetListObjects = 0;
+	_rememberedSetMapObjects = 0;
+	_rememberedSetScanTime = 0;
+
 	_slotsCopied = 0;
 	_slotsScanned = 0;
 
@@ -107,6 +107,9 @@ public:
 	uintptr_t _avgTenureBytesDeviation; /**< The average, weighted deviation of the tenureBytes*/
 	
 	uintptr_t _tiltRatio;	/**< use to pass tiltRatio to verbose */
+	uintptr_t _scanOrdering; /**< scan ordering (MM_GCExtensionsBase::ScavengerScanOrdering) used by this cycle, used to pass it to verbose */
+	uintptr_t _scanOrderingCopyScanPercent; /**< slots copied as a percentage of slots scanned in the previous cycle, as seen by the adaptive scan ordering */
+	uintptr_t _scanOrderingStallPercent; /**< average percentage of GC threads stalled in the previous cycle, as seen by the adaptive scan ordering */
 
 	bool _nextScavengeWillPercolate;
 	
@@ -128,10 +131,19 @@ public:
 	uintptr_t _tenureSpaceAllocationCountLarge;
 	uintptr_t _tenureSpaceAllocationCountSmall;
 
+	uintptr_t _nodeLocalCopyCacheCount; /**< Number of survivor copy caches carved from the stripe of the copying thread's own NUMA node */
+	uintptr_t _nodeLocalCopyCacheBytes; /**< Bytes of survivor copy caches carved from the stripe of the copying thread's own NUMA node */
+	uintptr_t _crossNodeCopyCacheCount; /**< Number of survivor copy caches carved from the stripe of another NUMA node */
+	uintptr_t _crossNodeCopyCacheBytes; /**< Bytes of survivor copy caches carved from the stripe of another NUMA node */
+
 	uintptr_t _tenureExpandedBytes; /**< Bytes by which the heap expanded in order to complete the collection */
 	uintptr_t _tenureExpandedCount; /**< The number of times the heap was expanded in order to complete the collection */
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
+	uintptr_t _rememberedSetListObjects; /**< Number of remembered set list entries scanned as roots */
+	uintptr_t _rememberedSetMapObjects; /**< Number of remembered set map entries scanned as roots */
+	uint64_t _rememberedSetScanTime; /**< Time spent scanning the remembered set as roots, in hi-res ticks summed over GC threads */
+
 	uint64_t _leafObjectCount;
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
@@ -39,6 +39,13 @@ MM_SweepStats::clear()
 	sweepHeapBytesTotal = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	_lazySweptRegions = 0;
+	_lazySweepTime = 0;
+	_lazyUnsweptRegions = 0;
+	_lazyDeferredRegions = 0;
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	idleTime = 0;
 	mergeTime = 0;
@@ -53,6 +60,13 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	_lazySweptRegions += statsToMerge->_lazySweptRegions;
+	_lazySweepTime += statsToMerge->_lazySweepTime;
+	_lazyUnsweptRegions += statsToMerge->_lazyUnsweptRegions;
+	_lazyDeferredRegions += statsToMerge->_lazyDeferredRegions;
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	/* It may not ever be useful to merge these stats, but do it anyways */
 	idleTime += statsToMerge->idleTime;
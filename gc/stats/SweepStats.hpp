@@ -52,6 +52,13 @@ public:
 	uintptr_t sweepChunksProcessed;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	uintptr_t _lazySweptRegions; /**< Small regions swept from the allocation path since the previous collect */
+	uint64_t _lazySweepTime; /**< Time spent sweeping those regions from the allocation path (hires ticks, summed over threads) */
+	uintptr_t _lazyUnsweptRegions; /**< Small regions still unswept when this collect started */
+	uintptr_t _lazyDeferredRegions; /**< Small regions this collect left for the allocation path to sweep */
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
 	uint64_t _startTime;	/**< Sweep start time */
 	uint64_t _endTime;		/**< Sweep end time */
 
@@ -0,0 +1,102 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+/**
+ * @file
+ * @ingroup GC_Stats
+ */
+
+#if !defined(TASKTHREADSTATS_HPP_)
+#define TASKTHREADSTATS_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+/**
+ * Timing of one thread over one dispatched task, collected when -Xgc:taskTimeline is enabled.
+ * All times are in hi-res ticks.
+ * @ingroup GC_Stats
+ */
+class MM_TaskThreadStats
+{
+public:
+	uint64_t _startTime; /**< The time the thread accepted the task */
+	uint64_t _endTime; /**< The time the thread completed the task */
+	uint64_t _syncStallTime; /**< The time the thread spent blocked at task synchronization points */
+	uintptr_t _syncStallCount; /**< The number of synchronization points the thread blocked at */
+	uint64_t _idleTime; /**< The time the thread spent stalled waiting for work to acquire or steal */
+	uint64_t _stealTime; /**< The time the thread spent taking work from other threads */
+
+	MMINLINE void
+	clear()
+	{
+		_startTime = 0;
+		_endTime = 0;
+		_syncStallTime = 0;
+		_syncStallCount = 0;
+		_idleTime = 0;
+		_stealTime = 0;
+	}
+
+	MMINLINE void
+	addToSyncStallTime(uint64_t startTime, uint64_t endTime)
+	{
+		_syncStallCount += 1;
+		_syncStallTime += (endTime - startTime);
+	}
+
+	MMINLINE void
+	addToIdleTime(uint64_t startTime, uint64_t endTime)
+	{
+		_idleTime += (endTime - startTime);
+	}
+
+	MMINLINE void
+	addToStealTime(uint64_t startTime, uint64_t endTime)
+	{
+		_stealTime += (endTime - startTime);
+	}
+
+	/**
+	 * @return the time the thread spent between accepting and completing the task, less stalls and stealing
+	 */
+	MMINLINE uint64_t
+	getBusyTime()
+	{
+		uint64_t elapsed = _endTime - _startTime;
+		uint64_t stalled = _syncStallTime + _idleTime + _stealTime;
+		return (elapsed > stalled) ? (elapsed - stalled) : 0;
+	}
+
+	MM_TaskThreadStats()
+		: _startTime(0)
+		, _endTime(0)
+		, _syncStallTime(0)
+		, _syncStallCount(0)
+		, _idleTime(0)
+		, _stealTime(0)
+	{}
+};
+
+#endif /* TASKTHREADSTATS_HPP_ */
@@ -263,6 +263,27 @@ MM_SublistPool::allocateElementNoContention(MM_EnvironmentBase *env)
 	return element;
 }
  
+/**
+ * Allocate a single entry in the sublist and count it.
+ *
+ * @return A slot in the sublist if successful, NULL otherwise.
+ *
+ * @note The allocate is made under the pool lock, so it is safe for concurrent callers
+ * which add elements too rarely to justify a fragment of their own.
+ */
+uintptr_t *
+MM_SublistPool::allocateElement(MM_EnvironmentBase *env)
+{
+	omrthread_monitor_enter(_mutex);
+	uintptr_t *element = allocateElementNoContention(env);
+	if (NULL != element) {
+		_count += 1;
+	}
+	omrthread_monitor_exit(_mutex);
+
+	return element;
+}
+
 void
 MM_SublistPool::compact(MM_EnvironmentBase *env)
 {
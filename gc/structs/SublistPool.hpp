@@ -106,6 +106,7 @@ public:
 
 	bool allocate(MM_EnvironmentBase *env, MM_SublistFragment *fragment);
 	uintptr_t *allocateElementNoContention(MM_EnvironmentBase *env);
+	uintptr_t *allocateElement(MM_EnvironmentBase *env);
 
 	void compact(MM_EnvironmentBase *env);
 	void clear(MM_EnvironmentBase *env);
@@ -124,6 +124,33 @@ MM_VerboseBuffer::add(MM_EnvironmentBase *env, const char *string)
 	return result;
 }
 
+/**
+ * Add a substring to the buffer
+ *
+ * Concatenates the first length characters of a string to the
+ * end of the buffer's current contents
+ *
+ * @param string String to add
+ * @param length Number of characters to add
+ * @return true on success, false on failure
+ */
+bool
+MM_VerboseBuffer::add(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	bool result = true;
+
+	if(ensureCapacity(env, length + 1)) {
+		memcpy(_bufferAlloc, string, length);
+		_bufferAlloc += length;
+		_bufferAlloc[0] = '\0';
+		result = true;
+	} else {
+		result = false;
+	}
+
+	return result;
+}
+
 bool
 MM_VerboseBuffer::ensureCapacity(MM_EnvironmentBase *env, uintptr_t spaceNeeded)
 {
@@ -91,6 +91,15 @@ public:
 	 * @return true on success, false if the buffer could not be expanded
 	 */
 	bool add(MM_EnvironmentBase *env, const char *string);
+
+	/**
+	 * Append length bytes of the specified string to the buffer.
+	 * @param env[in] the current thread
+	 * @param string[in] the characters to append (need not be NUL terminated)
+	 * @param length[in] the number of characters to append
+	 * @return true on success, false if the buffer could not be expanded
+	 */
+	bool add(MM_EnvironmentBase *env, const char *string, uintptr_t length);
 	
 	/**
 	 * Format the specified data and append it to the buffer.
@@ -26,9 +26,17 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "HeapResizeStats.hpp"
+#include "LiveObjectCensus.hpp"
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SizeClasses.hpp"
+#endif /* OMR_GC_SEGREGATED_HEAP */
+#include "TaskThreadCountController.hpp"
+#include "TaskTimeline.hpp"
 #include "VerboseHandlerOutput.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -37,6 +45,7 @@
 
 static void verboseHandlerInitialized(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+static void outputHeapForecastValues(MM_EnvironmentBase *env, MM_VerboseWriterChain *writer, uintptr_t indentDepth, const char *name, double allocationRate, uintptr_t liveBytes, double gcTime, double overhead);
 
 MM_VerboseHandlerOutput *
 MM_VerboseHandlerOutput::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
@@ -295,6 +304,9 @@ MM_VerboseHandlerOutput::handleInitialized(J9HookInterface** hook, uintptr_t eve
 	writer->formatAndOutput(env, 1, "<attribute name=\"pageType\" value=\"%s\" />", event->heapPageType);
 	writer->formatAndOutput(env, 1, "<attribute name=\"requestedPageSize\" value=\"0x%zx\" />", event->heapRequestedPageSize);
 	writer->formatAndOutput(env, 1, "<attribute name=\"requestedPageType\" value=\"%s\" />", event->heapRequestedPageType);
+	if (_extensions->transparentHugePages) {
+		writer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePages\" value=\"true\" />");
+	}
 	writer->formatAndOutput(env, 1, "<attribute name=\"gcthreads\" value=\"%zu\" />", event->gcThreads);
 	if (gc_policy_gencon == _extensions->configurationOptions._gcPolicy) {
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -310,10 +322,23 @@ MM_VerboseHandlerOutput::handleInitialized(J9HookInterface** hook, uintptr_t eve
 	}
 
 	writer->formatAndOutput(env, 1, "<attribute name=\"packetListSplit\" value=\"%zu\" />", _extensions->packetListSplit);
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if ((NULL != _extensions->defaultSizeClasses) && _extensions->defaultSizeClasses->isDerivedFromProfile()) {
+		MM_SizeClasses *sizeClasses = _extensions->defaultSizeClasses;
+		uintptr_t defaultFragmentation = sizeClasses->getDefaultFragmentation();
+		uintptr_t derivedFragmentation = sizeClasses->getDerivedFragmentation();
+		writer->formatAndOutput(env, 1, "<attribute name=\"sizeClassProfile\" value=\"%s\" />", _extensions->sizeClassProfileInput);
+		writer->formatAndOutput(env, 1, "<attribute name=\"sizeClassFragmentationDefault\" value=\"%zu.%02zu%%\" />", defaultFragmentation / 100, defaultFragmentation % 100);
+		writer->formatAndOutput(env, 1, "<attribute name=\"sizeClassFragmentationDerived\" value=\"%zu.%02zu%%\" />", derivedFragmentation / 100, derivedFragmentation % 100);
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	writer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 #endif /* OMR_GC_MODRON_SCAVENGER */
 	writer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
+	if (_extensions->splitFreeListLockFreeTLHCarving) {
+		writer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListLockFreeTLHCarving\" value=\"true\" />");
+	}
 	writer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", event->numaNodes);
 
 	handleInitializedInnerStanzas(hook, eventNum, eventData);
@@ -454,12 +479,122 @@ MM_VerboseHandlerOutput::handleCycleStartInnerStanzas(J9HookInterface** hook, ui
 bool
 MM_VerboseHandlerOutput::hasCycleEndInnerStanzas()
 {
-	return false;
+	bool result = _extensions->taskTimeline || _extensions->adaptiveGCThreads || _extensions->liveObjectCensus || _extensions->heapResizePredictive;
+	return result;
 }
 void
 MM_VerboseHandlerOutput::handleCycleEndInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth)
 {
-	/* do nothing */
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	MM_TaskTimeline *taskTimeline = _extensions->dispatcher->getTaskTimeline();
+	if (_extensions->taskTimeline && (NULL != taskTimeline) && (0 != taskTimeline->getSummaryCount())) {
+		writer->formatAndOutput(env, indentDepth, "<load-imbalance>");
+		for (uintptr_t i = 0; i < taskTimeline->getSummaryCount(); i++) {
+			MM_TaskTimelineSummary *summary = taskTimeline->getSummaryAt(i);
+			uint64_t elapsedTime = omrtime_hires_delta(0, summary->_elapsedTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t maxBusyTime = omrtime_hires_delta(0, summary->_maxBusyTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t meanBusyTime = omrtime_hires_delta(0, summary->_meanBusyTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t syncStallTime = omrtime_hires_delta(0, summary->_syncStallTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t idleTime = omrtime_hires_delta(0, summary->_idleTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t stealTime = omrtime_hires_delta(0, summary->_stealTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uint64_t stragglerTime = omrtime_hires_delta(0, summary->_worstStragglerTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+			uintptr_t imbalance = summary->getImbalance();
+			writer->formatAndOutput(env, indentDepth + 1, "<task name=\"%s\" dispatches=\"%zu\" threads=\"%zu\" elapsedms=\"%llu.%03llu\" maxbusyms=\"%llu.%03llu\" meanbusyms=\"%llu.%03llu\" imbalance=\"%zu.%02zu%%\" syncstallms=\"%llu.%03llu\" idlems=\"%llu.%03llu\">",
+				summary->_taskName,
+				summary->_dispatchCount,
+				summary->_maxThreadCount,
+				elapsedTime / 1000, elapsedTime % 1000,
+				maxBusyTime / 1000, maxBusyTime % 1000,
+				meanBusyTime / 1000, meanBusyTime % 1000,
+				imbalance / 100, imbalance % 100,
+				syncStallTime / 1000, syncStallTime % 1000,
+				idleTime / 1000, idleTime % 1000);
+			writer->formatAndOutput(env, indentDepth + 2, "<steal timems=\"%llu.%03llu\" />",
+				stealTime / 1000, stealTime % 1000);
+			writer->formatAndOutput(env, indentDepth + 2, "<straggler id=\"%zu\" timems=\"%llu.%03llu\" />",
+				summary->_worstStragglerID,
+				stragglerTime / 1000, stragglerTime % 1000);
+			writer->formatAndOutput(env, indentDepth + 1, "</task>");
+		}
+		writer->formatAndOutput(env, indentDepth, "</load-imbalance>");
+	}
+
+	MM_TaskThreadCountController *threadCountController = _extensions->dispatcher->getTaskThreadCountController();
+	if (NULL != threadCountController) {
+		bool stanzaStarted = false;
+		for (uintptr_t i = 0; i < threadCountController->getModelCount(); i++) {
+			MM_TaskThreadCountModel *model = threadCountController->getModelAt(i);
+			if (0 != model->_cycleDispatchCount) {
+				if (!stanzaStarted) {
+					writer->formatAndOutput(env, indentDepth, "<adaptive-gc-threads>");
+					stanzaStarted = true;
+				}
+				uint64_t predictedTime = omrtime_hires_delta(0, model->_cyclePredictedTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+				uint64_t staticPredictedTime = omrtime_hires_delta(0, model->_cycleStaticPredictedTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+				uint64_t benefit = (staticPredictedTime > predictedTime) ? (staticPredictedTime - predictedTime) : 0;
+				writer->formatAndOutput(env, indentDepth + 1, "<task name=\"%s\" dispatches=\"%zu\" threads=\"%zu\" staticthreads=\"%zu\" predictedms=\"%llu.%03llu\" staticpredictedms=\"%llu.%03llu\" benefitms=\"%llu.%03llu\" />",
+					model->_taskName,
+					model->_cycleDispatchCount,
+					model->_cycleThreadCount,
+					model->_cycleStaticThreadCount,
+					predictedTime / 1000, predictedTime % 1000,
+					staticPredictedTime / 1000, staticPredictedTime % 1000,
+					benefit / 1000, benefit % 1000);
+			}
+		}
+		if (stanzaStarted) {
+			writer->formatAndOutput(env, indentDepth, "</adaptive-gc-threads>");
+		}
+	}
+
+	MM_LiveObjectCensus *liveObjectCensus = _extensions->objectCensus;
+	if ((NULL != liveObjectCensus) && liveObjectCensus->takeUnreportedResults()) {
+		GC_ObjectModel *objectModel = &_extensions->objectModel;
+		char typeName[128];
+		writer->formatAndOutput(env, indentDepth, "<live-object-census samplerate=\"%zu\" sampled=\"%zu\" dropped=\"%zu\">",
+			liveObjectCensus->getSampleRate(),
+			liveObjectCensus->getSampledObjects(),
+			liveObjectCensus->getDroppedSamples());
+		MM_LiveObjectCensusEntry *top = liveObjectCensus->getTopByObjects();
+		for (uintptr_t rank = 0; rank < liveObjectCensus->getTopByObjectsCount(); rank++) {
+			writer->formatAndOutput(env, indentDepth + 1, "<type-by-objects rank=\"%zu\" name=\"%s\" objects=\"%zu\" />",
+				rank + 1,
+				objectModel->getObjectTypeNameForCensus(env, top[rank].type, typeName, sizeof(typeName)),
+				top[rank].value);
+		}
+		top = liveObjectCensus->getTopByBytes();
+		for (uintptr_t rank = 0; rank < liveObjectCensus->getTopByBytesCount(); rank++) {
+			writer->formatAndOutput(env, indentDepth + 1, "<type-by-bytes rank=\"%zu\" name=\"%s\" bytes=\"%zu\" />",
+				rank + 1,
+				objectModel->getObjectTypeNameForCensus(env, top[rank].type, typeName, sizeof(typeName)),
+				top[rank].value);
+		}
+		writer->formatAndOutput(env, indentDepth, "</live-object-census>");
+	}
+
+	MM_HeapResizeForecast *forecast = _extensions->heap->getResizeStats()->getForecast();
+	if (_extensions->heapResizePredictive && forecast->takeUnreportedObservation()) {
+		/* The forecast made after the previous cycle, what this cycle measured and the forecast the heap was sized for */
+		writer->formatAndOutput(env, indentDepth, "<heap-forecast targetoverhead=\"%zu%%\" heapsize=\"%zu\">",
+			_extensions->heapResizeTargetGCOverhead,
+			_extensions->heap->getActiveMemorySize());
+		if (forecast->hasReportedForecast()) {
+			outputHeapForecastValues(env, writer, indentDepth + 1, "forecast",
+				forecast->getReportedAllocationRate(), forecast->getReportedLiveBytes(), forecast->getReportedGCTime(), forecast->getReportedOverhead());
+		}
+		outputHeapForecastValues(env, writer, indentDepth + 1, "actual",
+			forecast->getActualAllocationRate(), forecast->getActualLiveBytes(), forecast->getActualGCTime(), forecast->getActualOverhead());
+		if (forecast->hasForecast()) {
+			outputHeapForecastValues(env, writer, indentDepth + 1, "next",
+				forecast->getForecastAllocationRate(), forecast->getForecastLiveBytes(), forecast->getForecastGCTime(), forecast->getForecastOverhead());
+			writer->formatAndOutput(env, indentDepth + 1, "<target heapsize=\"%zu\" />", forecast->getForecastHeapSize());
+		}
+		writer->formatAndOutput(env, indentDepth, "</heap-forecast>");
+	}
 }
 
 const char *
@@ -779,6 +914,12 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
 		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+		if (_extensions->splitFreeListLockFreeTLHCarving) {
+			writer->formatAndOutput(env, 1, "<tlh-carving carved=\"%zu\" refills=\"%zu\" returnedBytes=\"%zu\" />",
+					systemStats->_tlhCarvedCount, systemStats->_tlhCarveWindowRefillCount, systemStats->_tlhCarveWindowReturnedBytes);
+		}
+#endif /* OMR_GC_THREAD_LOCAL_HEAP */
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
@@ -1074,3 +1215,16 @@ verboseHandlerHeapResize(J9HookInterface** hook, uintptr_t eventNum, void* event
 {
 	((MM_VerboseHandlerOutput*)userData)->handleHeapResize(hook, eventNum, eventData);
 }
+
+static void
+outputHeapForecastValues(MM_EnvironmentBase *env, MM_VerboseWriterChain *writer, uintptr_t indentDepth, const char *name, double allocationRate, uintptr_t liveBytes, double gcTime, double overhead)
+{
+	uint64_t gcTimeMicros = (uint64_t)(gcTime * 1000.0);
+	uint64_t overheadHundredths = (uint64_t)(overhead * 100.0);
+	writer->formatAndOutput(env, indentDepth, "<%s allocbytesperms=\"%llu\" livebytes=\"%zu\" gcms=\"%llu.%03llu\" overhead=\"%llu.%02llu%%\" />",
+		name,
+		(uint64_t)allocationRate,
+		liveBytes,
+		gcTimeMicros / 1000, gcTimeMicros % 1000,
+		overheadHundredths / 100, overheadHundredths % 100);
+}
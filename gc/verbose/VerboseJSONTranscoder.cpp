@@ -0,0 +1,283 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include <string.h>
+
+#include "VerboseJSONTranscoder.hpp"
+
+#include "VerboseBuffer.hpp"
+
+/**
+ * Determine whether an attribute value can be written unquoted, i.e. whether it matches
+ * the JSON number grammar -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ */
+bool
+MM_VerboseJSONTranscoder::isNumber(const char *value, uintptr_t length)
+{
+	const char *cursor = value;
+	const char *end = value + length;
+
+	if ((cursor < end) && ('-' == *cursor)) {
+		cursor += 1;
+	}
+	if (cursor == end) {
+		return false;
+	}
+	if ('0' == *cursor) {
+		cursor += 1;
+	} else if (('1' <= *cursor) && ('9' >= *cursor)) {
+		while ((cursor < end) && ('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+	} else {
+		return false;
+	}
+	if ((cursor < end) && ('.' == *cursor)) {
+		cursor += 1;
+		const char *digits = cursor;
+		while ((cursor < end) && ('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+		if (digits == cursor) {
+			return false;
+		}
+	}
+	if ((cursor < end) && (('e' == *cursor) || ('E' == *cursor))) {
+		cursor += 1;
+		if ((cursor < end) && (('+' == *cursor) || ('-' == *cursor))) {
+			cursor += 1;
+		}
+		const char *digits = cursor;
+		while ((cursor < end) && ('0' <= *cursor) && ('9' >= *cursor)) {
+			cursor += 1;
+		}
+		if (digits == cursor) {
+			return false;
+		}
+	}
+	return cursor == end;
+}
+
+/**
+ * Return the position just after the next occurrence of terminator, or the end of the
+ * string if there is none.
+ */
+const char *
+MM_VerboseJSONTranscoder::skipPast(const char *cursor, const char *terminator)
+{
+	const char *found = strstr(cursor, terminator);
+	if (NULL == found) {
+		return cursor + strlen(cursor);
+	}
+	return found + strlen(terminator);
+}
+
+/**
+ * Append an XML name or attribute value as a quoted JSON string, replacing the predefined
+ * XML entities with the characters they stand for and escaping as JSON requires.
+ */
+bool
+MM_VerboseJSONTranscoder::addString(MM_EnvironmentBase *env, MM_VerboseBuffer *output, const char *value, uintptr_t length)
+{
+	static const struct {
+		const char *entity;
+		uintptr_t length;
+		const char *replacement;
+	} entities[] = {
+		{"&quot;", 6, "\\\""},
+		{"&amp;", 5, "&"},
+		{"&lt;", 4, "<"},
+		{"&gt;", 4, ">"},
+		{"&apos;", 6, "'"}
+	};
+
+	bool result = output->add(env, "\"", 1);
+	const char *end = value + length;
+	const char *run = value;
+	const char *cursor = value;
+
+	while (result && (cursor < end)) {
+		unsigned char c = (unsigned char)*cursor;
+		if (('&' != c) && ('"' != c) && ('\\' != c) && (0x20 <= c)) {
+			cursor += 1;
+			continue;
+		}
+
+		/* flush the run of characters which need no translation */
+		result = output->add(env, run, cursor - run);
+		if (!result) {
+			break;
+		}
+
+		uintptr_t consumed = 1;
+		if ('&' == c) {
+			const char *replacement = "&";
+			for (uintptr_t i = 0; i < sizeof(entities) / sizeof(entities[0]); i++) {
+				if (((uintptr_t)(end - cursor) >= entities[i].length) && (0 == strncmp(cursor, entities[i].entity, entities[i].length))) {
+					replacement = entities[i].replacement;
+					consumed = entities[i].length;
+					break;
+				}
+			}
+			result = output->add(env, replacement);
+		} else if ('"' == c) {
+			result = output->add(env, "\\\"", 2);
+		} else if ('\\' == c) {
+			result = output->add(env, "\\\\", 2);
+		} else if ('\n' == c) {
+			result = output->add(env, "\\n", 2);
+		} else if ('\t' == c) {
+			result = output->add(env, "\\t", 2);
+		} else if ('\r' == c) {
+			result = output->add(env, "\\r", 2);
+		} else {
+			static const char hex[] = "0123456789abcdef";
+			char escape[] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0xF]};
+			result = output->add(env, escape, sizeof(escape));
+		}
+		cursor += consumed;
+		run = cursor;
+	}
+
+	if (result) {
+		result = output->add(env, run, cursor - run);
+	}
+	if (result) {
+		result = output->add(env, "\"", 1);
+	}
+	return result;
+}
+
+bool
+MM_VerboseJSONTranscoder::transcode(MM_EnvironmentBase *env, const char *xml, MM_VerboseBuffer *output)
+{
+	bool result = true;
+	const char *cursor = xml;
+
+	while (result && ('\0' != *cursor)) {
+		if ('<' != *cursor) {
+			/* character data (only ever indentation and newlines) */
+			cursor += 1;
+		} else if ('!' == cursor[1]) {
+			cursor = skipPast(cursor, (0 == strncmp(cursor, "<!--", 4)) ? "-->" : ">");
+		} else if ('?' == cursor[1]) {
+			cursor = skipPast(cursor, "?>");
+		} else if ('/' == cursor[1]) {
+			/* end tag of an element opened by an earlier start tag */
+			cursor = skipPast(cursor, ">");
+			if (0 < _depth) {
+				_depth -= 1;
+				if (_hasChildren[_depth]) {
+					result = output->add(env, "]", 1);
+				}
+				if (result) {
+					result = output->add(env, (0 == _depth) ? "}\n" : "}");
+				}
+			}
+		} else {
+			/* start tag */
+			cursor += 1;
+			const char *name = cursor;
+			while (('\0' != *cursor) && ('>' != *cursor) && ('/' != *cursor) && (' ' != *cursor) && ('\t' != *cursor) && ('\n' != *cursor) && ('\r' != *cursor)) {
+				cursor += 1;
+			}
+			uintptr_t nameLength = cursor - name;
+
+			if (0 < _depth) {
+				if (_hasChildren[_depth - 1]) {
+					result = output->add(env, ",", 1);
+				} else {
+					_hasChildren[_depth - 1] = true;
+					result = output->add(env, ",\"children\":[");
+				}
+			}
+			if (result) {
+				result = output->add(env, "{\"element\":") && addString(env, output, name, nameLength);
+			}
+
+			bool isEmptyElement = false;
+			while (result) {
+				while ((' ' == *cursor) || ('\t' == *cursor) || ('\n' == *cursor) || ('\r' == *cursor)) {
+					cursor += 1;
+				}
+				if ('\0' == *cursor) {
+					break;
+				} else if ('>' == *cursor) {
+					cursor += 1;
+					break;
+				} else if (('/' == *cursor) && ('>' == cursor[1])) {
+					cursor += 2;
+					isEmptyElement = true;
+					break;
+				}
+
+				/* attribute: name="value" or name='value' */
+				const char *attributeName = cursor;
+				while (('\0' != *cursor) && ('=' != *cursor) && (' ' != *cursor) && ('>' != *cursor)) {
+					cursor += 1;
+				}
+				uintptr_t attributeNameLength = cursor - attributeName;
+				while (('\0' != *cursor) && ('"' != *cursor) && ('\'' != *cursor) && ('>' != *cursor)) {
+					cursor += 1;
+				}
+				if (('"' != *cursor) && ('\'' != *cursor)) {
+					/* malformed attribute; drop it */
+					continue;
+				}
+				char quote = *cursor;
+				cursor += 1;
+				const char *value = cursor;
+				while (('\0' != *cursor) && (quote != *cursor)) {
+					cursor += 1;
+				}
+				uintptr_t valueLength = cursor - value;
+				if ('\0' != *cursor) {
+					cursor += 1;
+				}
+
+				result = output->add(env, ",", 1) && addString(env, output, attributeName, attributeNameLength) && output->add(env, ":", 1);
+				if (result) {
+					if (isNumber(value, valueLength)) {
+						result = output->add(env, value, valueLength);
+					} else {
+						result = addString(env, output, value, valueLength);
+					}
+				}
+			}
+
+			if (result) {
+				if (isEmptyElement) {
+					result = output->add(env, (0 == _depth) ? "}\n" : "}");
+				} else if (MAX_ELEMENT_DEPTH == _depth) {
+					/* the nesting is deeper than any stanza the handlers emit */
+					result = false;
+				} else {
+					_hasChildren[_depth] = false;
+					_depth += 1;
+				}
+			}
+		}
+	}
+
+	return result;
+}
@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEJSONTRANSCODER_HPP_)
+#define VERBOSEJSONTRANSCODER_HPP_
+
+#include "omrcfg.h"
+#include "modronbase.h"
+
+#include "EnvironmentBase.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Converts the XML stanzas formatted by the verbose handlers into JSON lines.
+ *
+ * Every top level element becomes one JSON object terminated by a newline. The object holds
+ * the element name under "element", one member per attribute (in document order) and, when
+ * the element has child elements, a "children" array of objects of the same shape. Attribute
+ * values that are valid JSON numbers are written as numbers, everything else as strings, so
+ * <gc-op id="5" type="mark" timems="1.234" /> becomes
+ * {"element":"gc-op","id":5,"type":"mark","timems":1.234}.
+ *
+ * The input is the well formed, attribute only XML produced by MM_VerboseHandlerOutput;
+ * comments, processing instructions and character data are dropped. A stanza may be flushed
+ * in several pieces (e.g. <allocation-stats> is flushed inside an open <gc-start>), so the
+ * transcoder keeps the open elements from one call to the next. Each call must contain
+ * whole tags. Writers may end a file with an empty line, which readers should skip.
+ * @ingroup GC_verbose_output_agents
+ */
+class MM_VerboseJSONTranscoder
+{
+private:
+	enum {
+		MAX_ELEMENT_DEPTH = 64 /**< deepest nesting the transcoder tracks; the schema uses far fewer levels */
+	};
+
+	bool _hasChildren[MAX_ELEMENT_DEPTH]; /**< whether the open element at each depth has started its "children" array */
+	uintptr_t _depth; /**< number of elements opened by earlier start tags and not yet closed */
+
+	static bool isNumber(const char *value, uintptr_t length);
+	static const char *skipPast(const char *cursor, const char *terminator);
+	static bool addString(MM_EnvironmentBase *env, MM_VerboseBuffer *output, const char *value, uintptr_t length);
+
+public:
+	/**
+	 * Append the JSON lines form of the XML stanzas in xml to output.
+	 * @param env[in] the current thread
+	 * @param xml[in] NUL terminated XML text made of whole tags
+	 * @param output[in] the buffer to append to
+	 * @return true on success, false if the output buffer could not be expanded
+	 */
+	bool transcode(MM_EnvironmentBase *env, const char *xml, MM_VerboseBuffer *output);
+
+	MM_VerboseJSONTranscoder()
+		: _depth(0)
+	{}
+};
+
+#endif /* VERBOSEJSONTRANSCODER_HPP_ */
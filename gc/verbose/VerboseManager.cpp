@@ -29,11 +29,15 @@
 #include "VerboseManager.hpp"
 
 #include "VerboseHandlerOutput.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "VerboseHandlerOutputSegregated.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseWriter.hpp"
 #include "VerboseWriterChain.hpp"
 #include "VerboseWriterHook.hpp"
 #include "VerboseWriterFileLogging.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
 #include "VerboseWriterFileLoggingBuffered.hpp"
 #include "VerboseWriterFileLoggingSynchronous.hpp"
 #include "VerboseWriterStreamOutput.hpp"
@@ -120,8 +124,15 @@ MM_VerboseManager::createVerboseHandlerOutputObject(MM_EnvironmentBase *env)
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
 	if (extensions->isStandardGC()) {
+#if defined(OMR_GC_SEGREGATED_HEAP)
+		if (extensions->isSegregatedHeap()) {
+			handler = MM_VerboseHandlerOutputSegregated::newInstance(env, this);
+		}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_MODRON_STANDARD)
-		handler = MM_VerboseHandlerOutputStandard::newInstance(env, this);
+		if (NULL == handler) {
+			handler = MM_VerboseHandlerOutputStandard::newInstance(env, this);
+		}
 #endif /* defined(OMR_GC_MODRON_STANDARD) */
 	} else {
 		handler = MM_VerboseHandlerOutput::newInstance(env, this);
@@ -140,6 +151,16 @@ MM_VerboseManager::closeStreams(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_VerboseManager::flushStreams(MM_EnvironmentBase *env)
+{
+	MM_VerboseWriter *writer = _writerChain->getFirstWriter();
+	while(NULL != writer) {
+		writer->flush(env);
+		writer = writer->getNextWriter();
+	}
+}
+
 void
 MM_VerboseManager::enableVerboseGC()
 {
@@ -235,6 +256,10 @@ MM_VerboseManager::parseWriterType(MM_EnvironmentBase *env, char *filename, uint
 		return VERBOSE_WRITER_HOOK;
 	}
 
+	if (extensions->asyncLogging) {
+		return VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS;
+	}
+
 	if (extensions->bufferedLogging) {
 		return VERBOSE_WRITER_FILE_LOGGING_BUFFERED;
 	}
@@ -315,6 +340,18 @@ MM_VerboseManager::createWriter(MM_EnvironmentBase *env, WriterType type, char *
 			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
 		}
 		break;
+	case VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS:
+		writer = MM_VerboseWriterFileLoggingAsynchronous::newInstance(env, this, filename, fileCount, iterations);
+		if (NULL == writer) {
+			writer = findWriterInChain(VERBOSE_WRITER_STANDARD_STREAM);
+			if (NULL != writer) {
+				writer->isActive(true);
+				return writer;
+			}
+			/* if we failed to create a file stream and there is no stderr stream try to create a stderr stream */
+			writer = MM_VerboseWriterStreamOutput::newInstance(env, NULL);
+		}
+		break;
 
 	default:
 		return NULL;
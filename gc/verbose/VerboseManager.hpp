@@ -116,6 +116,12 @@ public:
 	 */
 	virtual void closeStreams(MM_EnvironmentBase *env);
 
+	/**
+	 * Wait until all output reported so far has been written by every output mechanism on the receiver.
+	 * @param env vm thread.
+	 */
+	void flushStreams(MM_EnvironmentBase *env);
+
 	MMINLINE MM_VerboseWriterChain* getWriterChain() { return _writerChain; }
 	
 	virtual void handleFileOpenError(MM_EnvironmentBase *env, char *fileName) {}
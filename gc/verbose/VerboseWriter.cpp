@@ -34,25 +34,35 @@
 /* Output constants */
 #define VERBOSEGC_HEADER "<?xml version=\"1.0\" ?>\n\n<verbosegc xmlns=\"http://www.ibm.com/j9/verbosegc\" version=\"%s\">\n\n"
 #define VERBOSEGC_FOOTER "</verbosegc>\n"
+#define VERBOSEGC_JSON_HEADER "{\"element\":\"verbosegc\",\"xmlns\":\"http://www.ibm.com/j9/verbosegc\",\"version\":\"%s\"}\n"
+#define VERBOSEGC_JSON_FOOTER ""
 
 MM_VerboseWriter::MM_VerboseWriter(WriterType type)
 	: MM_Base()
 	,_nextWriter(NULL)
 	,_header(NULL)
 	,_footer(NULL)
+	,_jsonHeader(NULL)
 	,_type(type)
+	,_format(MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_XML)
 	,_isActive(false)
 {}
 
 const char*
 MM_VerboseWriter::getHeader(MM_EnvironmentBase *env)
 {
+	if (MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES == _format) {
+		return _jsonHeader;
+	}
 	return _header;
 }
 
 const char*
 MM_VerboseWriter::getFooter(MM_EnvironmentBase *env)
 {
+	if (MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES == _format) {
+		return VERBOSEGC_JSON_FOOTER;
+	}
 	return _footer;
 }
 
@@ -76,6 +86,8 @@ MM_VerboseWriter::tearDown(MM_EnvironmentBase* env)
 	_header = NULL;
 	ext->getForge()->free(_footer);
 	_footer = NULL;
+	ext->getForge()->free(_jsonHeader);
+	_jsonHeader = NULL;
 }
 
 void
@@ -90,6 +102,8 @@ MM_VerboseWriter::initialize(MM_EnvironmentBase* env)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 	MM_GCExtensionsBase* ext = env->getExtensions();
 
+	_format = ext->verboseFormat;
+
 	/* Initialize _header */
 	const char* version = omrgc_get_version(env->getOmrVM());
 	/* The length is -2 for the "%s" in VERBOSEGC_HEADER and +1 for '\0' */
@@ -108,6 +122,18 @@ MM_VerboseWriter::initialize(MM_EnvironmentBase* env)
 		return false;
 	}
 	omrstr_printf(_footer, footerLength, VERBOSEGC_FOOTER);
+
+	/* Initialize _jsonHeader */
+	uintptr_t jsonHeaderLength = strlen(version) + strlen(VERBOSEGC_JSON_HEADER) - 1;
+	_jsonHeader = (char*)ext->getForge()->allocate(sizeof(char) * jsonHeaderLength, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _jsonHeader) {
+		ext->getForge()->free(_header);
+		_header = NULL;
+		ext->getForge()->free(_footer);
+		_footer = NULL;
+		return false;
+	}
+	omrstr_printf(_jsonHeader, jsonHeaderLength, VERBOSEGC_JSON_HEADER, version);
 	
 	return true;
 }
@@ -29,13 +29,15 @@
 #include "Base.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 
 typedef enum {
 	VERBOSE_WRITER_STANDARD_STREAM = 1,
 	VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS = 2,
 	VERBOSE_WRITER_FILE_LOGGING_BUFFERED = 3,
 	VERBOSE_WRITER_TRACE = 4,
-	VERBOSE_WRITER_HOOK = 5
+	VERBOSE_WRITER_HOOK = 5,
+	VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS = 6
 } WriterType;
 
 /**
@@ -54,8 +56,10 @@ private:
 
 	char* _header;
 	char* _footer;
+	char* _jsonHeader; /**< header used in place of the XML prolog when writing JSON lines */
 
 	WriterType _type;
+	MM_GCExtensionsBase::VerboseFormat _format; /**< format of the output passed to outputString() */
 	bool _isActive;
 
 	/*
@@ -75,8 +79,23 @@ public:
 
 	virtual void closeStream(MM_EnvironmentBase *env) = 0;
 
+	/**
+	 * Wait until all output reported so far has reached the stream.
+	 * Only writers which defer their output need to override this.
+	 */
+	virtual void flush(MM_EnvironmentBase *env) {}
+
 	MMINLINE WriterType getType(void) { return _type; }
 
+	/**
+	 * The writer chain transcodes its output into this format before handing it to outputString().
+	 * A writer takes the format selected by -Xgc:verboseFormat= when it is (re)initialized, so
+	 * writers configured at different times may use different formats. The header written
+	 * when a stream is opened follows the format in effect at that time.
+	 */
+	MMINLINE MM_GCExtensionsBase::VerboseFormat getFormat(void) { return _format; }
+	MMINLINE void setFormat(MM_GCExtensionsBase::VerboseFormat format) { _format = format; }
+
 	MMINLINE bool isActive(void) { return _isActive; }
 	MMINLINE void isActive(bool isActive) { _isActive = isActive; }
 
@@ -37,6 +37,8 @@
 MM_VerboseWriterChain::MM_VerboseWriterChain()
 	: MM_Base()
 	,_buffer(NULL)
+	,_jsonBuffer(NULL)
+	,_jsonTranscoder()
 	,_writers(NULL)
 {}
 
@@ -83,9 +85,20 @@ MM_VerboseWriterChain::formatAndOutput(MM_EnvironmentBase *env, uintptr_t indent
 void
 MM_VerboseWriterChain::flush(MM_EnvironmentBase *env)
 {
+	const char *json = NULL;
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
-		writer->outputString(env, _buffer->contents());
+		if (MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES == writer->getFormat()) {
+			if (NULL == json) {
+				/* output which could not be transcoded completely is still written, as XML output would be */
+				_jsonBuffer->reset();
+				_jsonTranscoder.transcode(env, _buffer->contents(), _jsonBuffer);
+				json = _jsonBuffer->contents();
+			}
+			writer->outputString(env, json);
+		} else {
+			writer->outputString(env, _buffer->contents());
+		}
 		writer = writer->getNextWriter();
 	}
 	_buffer->reset();
@@ -98,6 +111,10 @@ MM_VerboseWriterChain::tearDown(MM_EnvironmentBase* env)
 		_buffer->kill(env);
 		_buffer = NULL;
 	}
+	if (NULL != _jsonBuffer) {
+		_jsonBuffer->kill(env);
+		_jsonBuffer = NULL;
+	}
 	MM_VerboseWriter* writer = _writers;
 	while (NULL != writer) {
 		MM_VerboseWriter* nextWriter = writer->getNextWriter();
@@ -119,7 +136,8 @@ MM_VerboseWriterChain::initialize(MM_EnvironmentBase* env)
 	bool result = true;
 
 	_buffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
-	if(NULL == _buffer) {
+	_jsonBuffer = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+	if((NULL == _buffer) || (NULL == _jsonBuffer)) {
 		result = false;
 	}
 	
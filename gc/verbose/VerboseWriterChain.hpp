@@ -30,13 +30,15 @@
 #include "Base.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "VerboseJSONTranscoder.hpp"
 
 class MM_VerboseBuffer;
 class MM_VerboseWriter;
 
 /**
  * This class manages a list of writers. It formats and buffers output, flushing it
- * to the writers when asked.
+ * to the writers when asked. Writers whose format is JSON lines receive the buffered
+ * stanzas transcoded by MM_VerboseJSONTranscoder.
  */
 class MM_VerboseWriterChain : public MM_Base
 {
@@ -44,6 +46,8 @@ public:
 protected:
 private:
 	MM_VerboseBuffer *_buffer;
+	MM_VerboseBuffer *_jsonBuffer; /**< JSON lines form of _buffer, built at most once per flush */
+	MM_VerboseJSONTranscoder _jsonTranscoder; /**< tracks the elements left open by earlier flushes */
 	MM_VerboseWriter *_writers;
 
 public:
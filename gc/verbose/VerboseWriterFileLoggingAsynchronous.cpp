@@ -0,0 +1,583 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "omrutil.h"
+#include "VerboseBuffer.hpp"
+#include "VerboseWriterFileLoggingAsynchronous.hpp"
+
+#include "AtomicOperations.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Math.hpp"
+
+#include <string.h>
+
+/**
+ * Header of a record in the ring.  Records are aligned to the header size and the ring size is a multiple
+ * of it, so a header never wraps around the end of the ring; the text which follows it may.
+ * A header reads as zero until the record is committed.
+ */
+typedef struct MM_VerboseAsyncRecordHeader {
+	volatile uint32_t flags; /**< RECORD_* flags, written last by the reporting thread */
+	uint32_t length; /**< length in bytes of the text following the header */
+} MM_VerboseAsyncRecordHeader;
+
+#define RECORD_COMMITTED ((uint32_t)0x1)
+#define RECORD_END_OF_CYCLE ((uint32_t)0x2)
+
+#define RING_SIZE_MINIMUM ((uintptr_t)64 * 1024)
+#define STAGING_BUFFER_SIZE ((uintptr_t)64 * 1024)
+#define BACKPRESSURE_YIELDS 64
+#define FLUSH_INTERVAL_MILLIS 100
+
+MM_VerboseWriterFileLoggingAsynchronous::MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+	:MM_VerboseWriterFileLoggingSynchronous(env, manager, VERBOSE_WRITER_FILE_LOGGING_ASYNCHRONOUS)
+	,_omrVM(env->getOmrVM())
+	,_ring(NULL)
+	,_ringSize(0)
+	,_reserved(0)
+	,_consumed(0)
+	,_stagingBuffer(NULL)
+	,_stagingBufferSize(0)
+	,_stagingBufferUsed(0)
+	,_droppedRecords(0)
+	,_droppedBytes(0)
+	,_reportedDroppedRecords(0)
+	,_reportedDroppedBytes(0)
+	,_pendingStanza(NULL)
+	,_pendingStanzaDepth(0)
+	,_pendingStanzaDropped(false)
+	,_flusherMonitor(NULL)
+	,_flusherState(FLUSHER_NONE)
+{
+	/* No implementation */
+}
+
+/**
+ * Create a new MM_VerboseWriterFileLoggingAsynchronous instance.
+ * @return Pointer to the new MM_VerboseWriterFileLoggingAsynchronous.
+ */
+MM_VerboseWriterFileLoggingAsynchronous *
+MM_VerboseWriterFileLoggingAsynchronous::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseWriterFileLoggingAsynchronous *agent = (MM_VerboseWriterFileLoggingAsynchronous *)extensions->getForge()->allocate(sizeof(MM_VerboseWriterFileLoggingAsynchronous), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if(agent) {
+		new(agent) MM_VerboseWriterFileLoggingAsynchronous(env, manager);
+		if(!agent->initialize(env, filename, numFiles, numCycles)) {
+			agent->kill(env);
+			agent = NULL;
+		}
+	}
+	return agent;
+}
+
+/**
+ * Initializes the MM_VerboseWriterFileLoggingAsynchronous instance, and starts the flusher thread.
+ * @return true on success, false otherwise
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	if (NULL == _ring) {
+		/* the ring size must be a power of two so that cursors may wrap around the address space */
+		_ringSize = RING_SIZE_MINIMUM;
+		while ((_ringSize < extensions->asyncLoggingBufferSize) && (_ringSize < (UDATA_MAX >> 2))) {
+			_ringSize <<= 1;
+		}
+		_ring = (uint8_t *)extensions->getForge()->allocate(_ringSize, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _ring) {
+			return false;
+		}
+		memset(_ring, 0, _ringSize);
+	}
+
+	if (NULL == _stagingBuffer) {
+		_stagingBuffer = (char *)extensions->getForge()->allocate(STAGING_BUFFER_SIZE, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _stagingBuffer) {
+			return false;
+		}
+		_stagingBufferSize = STAGING_BUFFER_SIZE;
+	}
+
+	if (NULL == _pendingStanza) {
+		_pendingStanza = MM_VerboseBuffer::newInstance(env, INITIAL_BUFFER_SIZE);
+		if (NULL == _pendingStanza) {
+			return false;
+		}
+	}
+
+	if (NULL == _flusherMonitor) {
+		if (0 != omrthread_monitor_init_with_name(&_flusherMonitor, 0, "MM_VerboseWriterFileLoggingAsynchronous::_flusherMonitor")) {
+			_flusherMonitor = NULL;
+			return false;
+		}
+	}
+
+	if (!MM_VerboseWriterFileLoggingSynchronous::initialize(env, filename, numFiles, numCycles)) {
+		return false;
+	}
+
+	return startFlusher(env);
+}
+
+/**
+ * Tear down the structures managed by the MM_VerboseWriterFileLoggingAsynchronous.
+ * Stops the flusher thread, which writes out anything left in the ring, and frees the ring.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::tearDown(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	stopFlusher(env);
+
+	if (NULL != _flusherMonitor) {
+		omrthread_monitor_destroy(_flusherMonitor);
+		_flusherMonitor = NULL;
+	}
+	if (NULL != _pendingStanza) {
+		_pendingStanza->kill(env);
+		_pendingStanza = NULL;
+	}
+	extensions->getForge()->free(_stagingBuffer);
+	_stagingBuffer = NULL;
+	extensions->getForge()->free(_ring);
+	_ring = NULL;
+
+	MM_VerboseWriterFileLoggingSynchronous::tearDown(env);
+}
+
+/**
+ * Output the pieces of a stanza once the stanza is complete.  If a piece cannot be held back the whole
+ * stanza is dropped, so that the log never holds part of a stanza.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	uintptr_t length = strlen(string);
+	bool complete = isStanzaComplete(string, length);
+
+	if (_pendingStanzaDropped) {
+		MM_AtomicOperations::add(&_droppedBytes, length);
+	} else if (complete && (0 == _pendingStanza->currentSize())) {
+		/* the usual case: the string holds whole stanzas */
+		outputStanza(env, string, length);
+	} else if (_pendingStanza->add(env, string, length)) {
+		if (complete) {
+			outputStanza(env, _pendingStanza->contents(), _pendingStanza->currentSize());
+			_pendingStanza->reset();
+		}
+	} else {
+		MM_AtomicOperations::add(&_droppedBytes, _pendingStanza->currentSize() + length);
+		_pendingStanza->reset();
+		_pendingStanzaDropped = true;
+	}
+
+	if (complete && _pendingStanzaDropped) {
+		MM_AtomicOperations::add(&_droppedRecords, 1);
+		_pendingStanzaDropped = false;
+	}
+}
+
+/**
+ * Track the nesting of the output handed to the writer.  XML output is complete when every element
+ * it opened has been closed again.  JSON lines output is complete when it ends with the newline the
+ * transcoder writes after each top level object.  Like the transcoder, this expects whole tags.
+ * @param string[in] the output handed to the writer
+ * @param length[in] the length of the output in bytes
+ * @return true if the output up to and including string ends between two stanzas
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::isStanzaComplete(const char *string, uintptr_t length)
+{
+	bool complete = false;
+
+	if (MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES == getFormat()) {
+		if (0 == length) {
+			complete = (0 == _pendingStanza->currentSize()) && !_pendingStanzaDropped;
+		} else {
+			complete = ('\n' == string[length - 1]);
+		}
+	} else {
+		const char *cursor = string;
+		while (NULL != (cursor = strchr(cursor, '<'))) {
+			const char *tagEnd = strchr(cursor, '>');
+			if (NULL == tagEnd) {
+				break;
+			}
+			if ('/' == cursor[1]) {
+				if (0 < _pendingStanzaDepth) {
+					_pendingStanzaDepth -= 1;
+				}
+			} else if (('!' != cursor[1]) && ('?' != cursor[1]) && ('/' != tagEnd[-1])) {
+				_pendingStanzaDepth += 1;
+			}
+			cursor = tagEnd + 1;
+		}
+		complete = (0 == _pendingStanzaDepth);
+	}
+
+	return complete;
+}
+
+/**
+ * Queue whole stanzas for the flusher, or write them on the caller's thread if there is no flusher.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::outputStanza(MM_EnvironmentBase *env, const char *string, uintptr_t length)
+{
+	if (FLUSHER_RUNNING == _flusherState) {
+		enqueue(env, string, length, 0);
+	} else {
+		/* no flusher (it failed to start, or the stream is closing), so write on the caller's thread */
+		writeToFile(env, string, length);
+	}
+}
+
+/**
+ * Rotate the output files if necessary.  The flusher performs the rotation when it reaches
+ * the end of cycle marker, so that the file is never closed or opened on the reporting thread.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::endOfCycle(MM_EnvironmentBase *env)
+{
+	if (FLUSHER_RUNNING == _flusherState) {
+		enqueue(env, NULL, 0, RECORD_END_OF_CYCLE);
+		wakeFlusher();
+	} else {
+		MM_VerboseWriterFileLoggingSynchronous::endOfCycle(env);
+	}
+}
+
+/**
+ * Wait until everything reported before the call has been written to the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::flush(MM_EnvironmentBase *env)
+{
+	if (NULL != _flusherMonitor) {
+		omrthread_monitor_enter(_flusherMonitor);
+		uintptr_t target = _reserved;
+		while ((FLUSHER_RUNNING == _flusherState) && (0 < (intptr_t)(target - _consumed))) {
+			omrthread_monitor_notify_all(_flusherMonitor);
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+		omrthread_monitor_exit(_flusherMonitor);
+	}
+}
+
+/**
+ * Write out everything still in the ring, stop the flusher and close the file.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::closeStream(MM_EnvironmentBase *env)
+{
+	stopFlusher(env);
+	if (0 < _pendingStanza->currentSize()) {
+		/* the stanza will never be completed; write what there is, as the synchronous writer would have */
+		writeToFile(env, _pendingStanza->contents(), _pendingStanza->currentSize());
+		_pendingStanza->reset();
+	}
+	closeFile(env);
+}
+
+bool
+MM_VerboseWriterFileLoggingAsynchronous::reconfigure(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles)
+{
+	/* the flusher must not write to the file while it is being switched; initialize() restarts it */
+	stopFlusher(env);
+	return MM_VerboseWriterFileLoggingSynchronous::reconfigure(env, filename, numFiles, numCycles);
+}
+
+/**
+ * Append a record to the ring.  Never blocks: if the ring stays full after waking the flusher and
+ * yielding a bounded number of times, the record is dropped.
+ * @param string the text of the record, may be NULL if length is 0
+ * @param length the length of the text in bytes
+ * @param flags RECORD_* flags to attach to the record
+ * @return true if the record was queued, false if it was dropped
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::enqueue(MM_EnvironmentBase *env, const char *string, uintptr_t length, uint32_t flags)
+{
+	uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(MM_VerboseAsyncRecordHeader), sizeof(MM_VerboseAsyncRecordHeader) + length);
+	uintptr_t position = 0;
+	bool reserved = false;
+
+	if (recordSize <= _ringSize) {
+		uintptr_t yields = 0;
+		while (!reserved) {
+			position = _reserved;
+			if ((position + recordSize - _consumed) <= _ringSize) {
+				reserved = (position == MM_AtomicOperations::lockCompareExchange(&_reserved, position, position + recordSize));
+			} else if (yields < BACKPRESSURE_YIELDS) {
+				wakeFlusher();
+				omrthread_yield();
+				yields += 1;
+			} else {
+				break;
+			}
+		}
+	}
+
+	if (!reserved) {
+		MM_AtomicOperations::add(&_droppedRecords, 1);
+		MM_AtomicOperations::add(&_droppedBytes, length);
+	} else {
+		MM_VerboseAsyncRecordHeader *header = (MM_VerboseAsyncRecordHeader *)(_ring + (position & (_ringSize - 1)));
+		if (0 < length) {
+			copyIntoRing(position + sizeof(MM_VerboseAsyncRecordHeader), string, length);
+		}
+		header->length = (uint32_t)length;
+		/* the text must be visible to the flusher before the record is seen as committed */
+		MM_AtomicOperations::writeBarrier();
+		header->flags = flags | RECORD_COMMITTED;
+
+		if ((position + recordSize - _consumed) > (_ringSize / 2)) {
+			wakeFlusher();
+		}
+	}
+
+	return reserved;
+}
+
+/**
+ * Copy into the ring, wrapping around its end if necessary.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::copyIntoRing(uintptr_t position, const void *source, uintptr_t length)
+{
+	uintptr_t offset = position & (_ringSize - 1);
+	uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+	memcpy(_ring + offset, source, firstPart);
+	memcpy(_ring, (const uint8_t *)source + firstPart, length - firstPart);
+}
+
+/**
+ * Wake the flusher if its monitor is free.  Reporting threads never block on the monitor; a missed
+ * wake up only delays the flusher until its next periodic check.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::wakeFlusher()
+{
+	if (0 == omrthread_monitor_try_enter(_flusherMonitor)) {
+		omrthread_monitor_notify_all(_flusherMonitor);
+		omrthread_monitor_exit(_flusherMonitor);
+	}
+}
+
+/**
+ * Start the flusher thread.  If it cannot be started output is written synchronously instead.
+ * @return true (the writer remains usable either way)
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::startFlusher(MM_EnvironmentBase *env)
+{
+	/* hold the monitor over start-up so that the flusher cannot report its state before we wait for it */
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = FLUSHER_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_NORMAL,
+		0,
+		flusherThreadProc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (FLUSHER_STARTING == _flusherState) {
+			omrthread_monitor_wait(_flusherMonitor);
+		}
+	} else {
+		_flusherState = FLUSHER_ERROR;
+	}
+	if (FLUSHER_RUNNING != _flusherState) {
+		_flusherState = FLUSHER_NONE;
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+
+	return true;
+}
+
+/**
+ * Stop the flusher thread once it has written out everything in the ring.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::stopFlusher(MM_EnvironmentBase *env)
+{
+	if (NULL != _flusherMonitor) {
+		omrthread_monitor_enter(_flusherMonitor);
+		if (FLUSHER_RUNNING == _flusherState) {
+			_flusherState = FLUSHER_TERMINATION_REQUESTED;
+			omrthread_monitor_notify_all(_flusherMonitor);
+			while (FLUSHER_TERMINATED != _flusherState) {
+				omrthread_monitor_wait(_flusherMonitor);
+			}
+		}
+		_flusherState = FLUSHER_NONE;
+		omrthread_monitor_exit(_flusherMonitor);
+	}
+}
+
+int J9THREAD_PROC
+MM_VerboseWriterFileLoggingAsynchronous::flusherThreadProc(void *info)
+{
+	MM_VerboseWriterFileLoggingAsynchronous *writer = (MM_VerboseWriterFileLoggingAsynchronous *)info;
+	writer->flusherThreadEntryPoint();
+	return 0;
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::flusherThreadEntryPoint()
+{
+	MM_EnvironmentBase env(_omrVM);
+
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = FLUSHER_RUNNING;
+	omrthread_monitor_notify_all(_flusherMonitor);
+
+	while (FLUSHER_TERMINATION_REQUESTED != _flusherState) {
+		omrthread_monitor_exit(_flusherMonitor);
+		bool progress = drain(&env);
+		omrthread_monitor_enter(_flusherMonitor);
+		/* wake any thread waiting in flush() */
+		omrthread_monitor_notify_all(_flusherMonitor);
+		if (!progress && (FLUSHER_TERMINATION_REQUESTED != _flusherState)) {
+			omrthread_monitor_wait_timed(_flusherMonitor, FLUSH_INTERVAL_MILLIS, 0);
+		}
+	}
+	omrthread_monitor_exit(_flusherMonitor);
+
+	/* reporting has stopped; write out whatever is left */
+	drain(&env);
+
+	omrthread_monitor_enter(_flusherMonitor);
+	_flusherState = FLUSHER_TERMINATED;
+	omrthread_monitor_notify_all(_flusherMonitor);
+	omrthread_exit(_flusherMonitor);
+}
+
+/**
+ * Write out the committed records at the head of the ring, in order, and release their space.
+ * Stops at the first record which has been reserved but not yet committed.
+ * @return true if any record was consumed
+ */
+bool
+MM_VerboseWriterFileLoggingAsynchronous::drain(MM_EnvironmentBase *env)
+{
+	bool progress = false;
+
+	while (_consumed != _reserved) {
+		uintptr_t position = _consumed;
+		uintptr_t offset = position & (_ringSize - 1);
+		MM_VerboseAsyncRecordHeader *header = (MM_VerboseAsyncRecordHeader *)(_ring + offset);
+		uint32_t flags = header->flags;
+		if (0 == (flags & RECORD_COMMITTED)) {
+			break;
+		}
+		/* do not read the text before the committed flag */
+		MM_AtomicOperations::readBarrier();
+
+		uintptr_t length = header->length;
+		uintptr_t recordSize = MM_Math::roundToCeiling(sizeof(MM_VerboseAsyncRecordHeader), sizeof(MM_VerboseAsyncRecordHeader) + length);
+		stage(env, position + sizeof(MM_VerboseAsyncRecordHeader), length);
+		if (0 != (flags & RECORD_END_OF_CYCLE)) {
+			writeStagingBuffer(env);
+			MM_VerboseWriterFileLoggingSynchronous::endOfCycle(env);
+		}
+
+		/* headers are found at arbitrary offsets on the next pass over the ring, so the whole record must read as zero */
+		uintptr_t firstPart = OMR_MIN(recordSize, _ringSize - offset);
+		memset(_ring + offset, 0, firstPart);
+		memset(_ring, 0, recordSize - firstPart);
+		MM_AtomicOperations::writeBarrier();
+		_consumed = position + recordSize;
+		progress = true;
+	}
+
+	writeStagingBuffer(env);
+	reportDroppedRecords(env);
+
+	return progress;
+}
+
+/**
+ * Gather text from the ring into the staging buffer, writing the buffer out first if the text does not fit.
+ * Text larger than the staging buffer is written straight from the ring.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::stage(MM_EnvironmentBase *env, uintptr_t position, uintptr_t length)
+{
+	uintptr_t offset = position & (_ringSize - 1);
+	uintptr_t firstPart = OMR_MIN(length, _ringSize - offset);
+
+	if ((_stagingBufferUsed + length) > _stagingBufferSize) {
+		writeStagingBuffer(env);
+	}
+
+	if (length > _stagingBufferSize) {
+		writeToFile(env, (const char *)(_ring + offset), firstPart);
+		writeToFile(env, (const char *)_ring, length - firstPart);
+	} else {
+		memcpy(_stagingBuffer + _stagingBufferUsed, _ring + offset, firstPart);
+		memcpy(_stagingBuffer + _stagingBufferUsed + firstPart, _ring, length - firstPart);
+		_stagingBufferUsed += length;
+	}
+}
+
+void
+MM_VerboseWriterFileLoggingAsynchronous::writeStagingBuffer(MM_EnvironmentBase *env)
+{
+	if (0 < _stagingBufferUsed) {
+		writeToFile(env, _stagingBuffer, _stagingBufferUsed);
+		_stagingBufferUsed = 0;
+	}
+}
+
+/**
+ * Note in the log how much output was lost since the last note, if any.  The flusher only calls this
+ * between records, and records hold whole stanzas, so the note never splits a stanza.
+ */
+void
+MM_VerboseWriterFileLoggingAsynchronous::reportDroppedRecords(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uintptr_t droppedRecords = _droppedRecords;
+	uintptr_t droppedBytes = _droppedBytes;
+
+	if (droppedRecords != _reportedDroppedRecords) {
+		char note[160];
+		const char *format = "<!-- %zu verbose GC records (%zu bytes) were dropped because the asynchronous logging buffer was full -->\n";
+		if (MM_GCExtensionsBase::OMR_GC_VERBOSE_FORMAT_JSON_LINES == getFormat()) {
+			format = "{\"element\":\"dropped-records\",\"records\":%zu,\"bytes\":%zu}\n";
+		}
+		uintptr_t length = omrstr_printf(note, sizeof(note), format, droppedRecords - _reportedDroppedRecords, droppedBytes - _reportedDroppedBytes);
+		writeToFile(env, note, length);
+		_reportedDroppedRecords = droppedRecords;
+		_reportedDroppedBytes = droppedBytes;
+	}
+}
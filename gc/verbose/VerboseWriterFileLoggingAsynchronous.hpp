@@ -0,0 +1,130 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#if !defined(VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_)
+#define VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+
+#include "VerboseWriterFileLoggingSynchronous.hpp"
+
+class MM_VerboseBuffer;
+
+/**
+ * Ouptut agent which directs verbosegc output to file without doing any I/O on the reporting thread.
+ * Stanzas are appended to a lock-free ring buffer, from which a dedicated flusher thread writes them
+ * to the file.  Any number of threads may report concurrently: each reserves space for its record by
+ * advancing the reservation cursor atomically, copies the record in, and then publishes it by setting
+ * the committed flag in the record header.  The flusher consumes committed records in reservation order,
+ * clears the space they occupied and releases it by advancing the consumption cursor.
+ *
+ * A stanza may be flushed to the writer in several pieces (e.g. <allocation-stats> inside an open
+ * <gc-start>), so pieces are held back until the top level element they belong to is complete, and
+ * each record holds whole stanzas.  A reporting thread never waits for the disk.  If the ring is full
+ * it wakes the flusher and yields a bounded number of times; if space still cannot be found the record
+ * is dropped and counted, and the flusher notes the loss in the log between two stanzas.  File rotation
+ * is requested through a marker record so that it is also performed by the flusher.  The file itself
+ * is opened, written and closed as by MM_VerboseWriterFileLoggingSynchronous.
+ */
+class MM_VerboseWriterFileLoggingAsynchronous : public MM_VerboseWriterFileLoggingSynchronous
+{
+	/*
+	 * Data members
+	 */
+public:
+protected:
+private:
+	enum FlusherState {
+		FLUSHER_NONE = 0, /**< no flusher thread; output is written synchronously */
+		FLUSHER_STARTING,
+		FLUSHER_RUNNING,
+		FLUSHER_TERMINATION_REQUESTED,
+		FLUSHER_TERMINATED,
+		FLUSHER_ERROR
+	};
+
+	OMR_VM *_omrVM; /**< the VM the flusher thread writes on behalf of */
+
+	uint8_t *_ring; /**< the record ring buffer */
+	uintptr_t _ringSize; /**< size in bytes of the ring, a power of two */
+	volatile uintptr_t _reserved; /**< bytes reserved by reporting threads since the ring was created */
+	volatile uintptr_t _consumed; /**< bytes written out and released by the flusher since the ring was created */
+
+	char *_stagingBuffer; /**< records are gathered here so that the flusher writes them in few large writes */
+	uintptr_t _stagingBufferSize; /**< size in bytes of the staging buffer */
+	uintptr_t _stagingBufferUsed; /**< bytes currently held in the staging buffer */
+
+	volatile uintptr_t _droppedRecords; /**< records dropped because the ring was full */
+	volatile uintptr_t _droppedBytes; /**< bytes of output dropped because the ring was full */
+	uintptr_t _reportedDroppedRecords; /**< dropped records already noted in the log */
+	uintptr_t _reportedDroppedBytes; /**< dropped bytes already noted in the log */
+
+	MM_VerboseBuffer *_pendingStanza; /**< pieces of the stanza in progress, held back until it is complete */
+	uintptr_t _pendingStanzaDepth; /**< number of elements the stanza in progress has opened and not yet closed */
+	bool _pendingStanzaDropped; /**< the pieces of the stanza in progress are being dropped */
+
+	omrthread_monitor_t _flusherMonitor; /**< protects the flusher state, and is used to wake the flusher and threads waiting on it */
+	volatile FlusherState _flusherState; /**< lifecycle state of the flusher thread */
+
+	/*
+	 * Function members
+	 */
+public:
+	static MM_VerboseWriterFileLoggingAsynchronous *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager, char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	virtual void outputString(MM_EnvironmentBase *env, const char* string);
+	virtual void endOfCycle(MM_EnvironmentBase *env);
+	virtual void flush(MM_EnvironmentBase *env);
+	virtual void closeStream(MM_EnvironmentBase *env);
+	virtual bool reconfigure(MM_EnvironmentBase *env, const char* filename, uintptr_t fileCount, uintptr_t iterations);
+
+	MMINLINE uintptr_t getDroppedRecords() { return _droppedRecords; }
+	MMINLINE uintptr_t getDroppedBytes() { return _droppedBytes; }
+
+protected:
+	MM_VerboseWriterFileLoggingAsynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+
+	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
+
+private:
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+	bool isStanzaComplete(const char *string, uintptr_t length);
+	void outputStanza(MM_EnvironmentBase *env, const char *string, uintptr_t length);
+	bool enqueue(MM_EnvironmentBase *env, const char *string, uintptr_t length, uint32_t flags);
+	void copyIntoRing(uintptr_t position, const void *source, uintptr_t length);
+	void wakeFlusher();
+
+	bool startFlusher(MM_EnvironmentBase *env);
+	void stopFlusher(MM_EnvironmentBase *env);
+	static int J9THREAD_PROC flusherThreadProc(void *info);
+	void flusherThreadEntryPoint();
+
+	bool drain(MM_EnvironmentBase *env);
+	void stage(MM_EnvironmentBase *env, uintptr_t position, uintptr_t length);
+	void writeStagingBuffer(MM_EnvironmentBase *env);
+	void reportDroppedRecords(MM_EnvironmentBase *env);
+};
+
+#endif /* VERBOSEWRITERFILELOGGINGASYNCHRONOUS_HPP_ */
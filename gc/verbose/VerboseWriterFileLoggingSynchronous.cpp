@@ -29,8 +29,8 @@
 
 #include <string.h>
 
-MM_VerboseWriterFileLoggingSynchronous::MM_VerboseWriterFileLoggingSynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager)
-	:MM_VerboseWriterFileLogging(env, manager, VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS)
+MM_VerboseWriterFileLoggingSynchronous::MM_VerboseWriterFileLoggingSynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type)
+	:MM_VerboseWriterFileLogging(env, manager, type)
 	,_logFileDescriptor(-1)
 {
 	/* No implementation */
@@ -139,6 +139,17 @@ MM_VerboseWriterFileLoggingSynchronous::closeFile(MM_EnvironmentBase *env)
 
 void
 MM_VerboseWriterFileLoggingSynchronous::outputString(MM_EnvironmentBase *env, const char* string)
+{
+	writeToFile(env, string, strlen(string));
+}
+
+/**
+ * Write text to the file, opening it first if necessary.  If the file cannot be opened the text goes to stderr.
+ * @param string[in] the text to write (need not be NUL terminated)
+ * @param length[in] the length of the text in bytes
+ */
+void
+MM_VerboseWriterFileLoggingSynchronous::writeToFile(MM_EnvironmentBase *env, const char *string, uintptr_t length)
 {
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 
@@ -148,8 +159,8 @@ MM_VerboseWriterFileLoggingSynchronous::outputString(MM_EnvironmentBase *env, co
 	}
 
 	if(-1 != _logFileDescriptor){
-		omrfile_write_text(_logFileDescriptor, string, strlen(string));
+		omrfile_write_text(_logFileDescriptor, string, length);
 	} else {
-		omrfile_write_text(OMRPORT_TTY_ERR, string, strlen(string));
+		omrfile_write_text(OMRPORT_TTY_ERR, string, length);
 	}
 }
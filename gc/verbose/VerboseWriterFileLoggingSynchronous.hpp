@@ -37,8 +37,8 @@ class MM_VerboseWriterFileLoggingSynchronous : public MM_VerboseWriterFileLoggin
 	 */
 public:
 protected:
-private:
 	intptr_t _logFileDescriptor; /**< the file being written to */
+private:
 
 	/*
 	 * Function members
@@ -49,15 +49,16 @@ public:
 	virtual void outputString(MM_EnvironmentBase *env, const char* string);
 
 protected:
-	MM_VerboseWriterFileLoggingSynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+	MM_VerboseWriterFileLoggingSynchronous(MM_EnvironmentBase *env, MM_VerboseManager *manager, WriterType type = VERBOSE_WRITER_FILE_LOGGING_SYNCHRONOUS);
 	virtual bool initialize(MM_EnvironmentBase *env, const char *filename, uintptr_t numFiles, uintptr_t numCycles);
-
-private:
 	virtual void tearDown(MM_EnvironmentBase *env);
 
-	bool openFile(MM_EnvironmentBase *env);
-	void closeFile(MM_EnvironmentBase *env);
+	virtual bool openFile(MM_EnvironmentBase *env);
+	virtual void closeFile(MM_EnvironmentBase *env);
+
+	void writeToFile(MM_EnvironmentBase *env, const char *string, uintptr_t length);
 
+private:
 };
 
 #endif /* VERBOSEWRITERFILELOGGINGSYNCHRONOUS_HPP_ */
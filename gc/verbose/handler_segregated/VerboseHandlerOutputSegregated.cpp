@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+
+#include "gcutils.h"
+
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "GlobalGCStats.hpp"
+#include "SweepStats.hpp"
+#include "VerboseHandlerOutputSegregated.hpp"
+#include "VerboseManager.hpp"
+#include "VerboseWriterChain.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+MM_VerboseHandlerOutput *
+MM_VerboseHandlerOutputSegregated::newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager)
+{
+	MM_GCExtensionsBase* extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+
+	MM_VerboseHandlerOutputSegregated *verboseHandlerOutput = (MM_VerboseHandlerOutputSegregated *)extensions->getForge()->allocate(sizeof(MM_VerboseHandlerOutputSegregated), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != verboseHandlerOutput) {
+		new(verboseHandlerOutput) MM_VerboseHandlerOutputSegregated(extensions);
+		if(!verboseHandlerOutput->initialize(env, manager)) {
+			verboseHandlerOutput->kill(env);
+			verboseHandlerOutput = NULL;
+		}
+	}
+	return verboseHandlerOutput;
+}
+
+bool
+MM_VerboseHandlerOutputSegregated::hasCycleEndInnerStanzas()
+{
+	return MM_VerboseHandlerOutputStandard::hasCycleEndInnerStanzas() || _extensions->segregatedLazySweep || _extensions->segregatedGenerational;
+}
+
+void
+MM_VerboseHandlerOutputSegregated::handleCycleEndInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth)
+{
+	MM_VerboseHandlerOutputStandard::handleCycleEndInnerStanzas(hook, eventNum, eventData, indentDepth);
+
+	MM_GCPostCycleEndEvent* event = (MM_GCPostCycleEndEvent*)eventData;
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	MM_VerboseWriterChain* writer = _manager->getWriterChain();
+	MM_GlobalGCStats *globalGCStats = &_extensions->globalGCStats;
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	if (_extensions->segregatedLazySweep) {
+		/* The swept regions and time cover the allocation path since the previous cycle, not this collect */
+		MM_SweepStats *sweepStats = &globalGCStats->sweepStats;
+		uint64_t lazySweepTime = omrtime_hires_delta(0, sweepStats->_lazySweepTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t regionsPerSecond = 0;
+		if (0 != lazySweepTime) {
+			regionsPerSecond = ((uint64_t)sweepStats->_lazySweptRegions * 1000000) / lazySweepTime;
+		}
+		writer->formatAndOutput(env, indentDepth, "<lazy-sweep regions=\"%zu\" timems=\"%llu.%03llu\" regionsperms=\"%llu.%03llu\" unswept=\"%zu\" deferred=\"%zu\" />",
+			sweepStats->_lazySweptRegions,
+			lazySweepTime / 1000, lazySweepTime % 1000,
+			regionsPerSecond / 1000, regionsPerSecond % 1000,
+			sweepStats->_lazyUnsweptRegions,
+			sweepStats->_lazyDeferredRegions);
+	}
+
+	if (_extensions->segregatedGenerational) {
+		if (SEGREGATED_COLLECT_MINOR == globalGCStats->segregatedCollectType) {
+			writer->formatAndOutput(env, indentDepth, "<segregated-generation collect=\"minor\" remembered=\"%zu\" minorcollects=\"%zu\" />",
+				globalGCStats->segregatedRememberedObjects,
+				globalGCStats->segregatedMinorCollects);
+		} else {
+			writer->formatAndOutput(env, indentDepth, "<segregated-generation collect=\"major\" reason=\"%s\" remembered=\"%zu\" minorcollects=\"%zu\" />",
+				getSegregatedCollectReasonAsString((MM_SegregatedCollectType)globalGCStats->segregatedCollectType),
+				globalGCStats->segregatedRememberedObjects,
+				globalGCStats->segregatedMinorCollects);
+		}
+	}
+}
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(VERBOSEHANDLEROUTPUTSEGREGATED_HPP_)
+#define VERBOSEHANDLEROUTPUTSEGREGATED_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+
+#include "VerboseHandlerOutputStandard.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_EnvironmentBase;
+
+/**
+ * Verbose output for the segregated heap. Adds the lazy sweep and segregated generation
+ * stanzas to the cycle end output of the standard handler.
+ */
+class MM_VerboseHandlerOutputSegregated : public MM_VerboseHandlerOutputStandard
+{
+private:
+protected:
+public:
+
+private:
+
+protected:
+	virtual bool hasCycleEndInnerStanzas();
+	virtual void handleCycleEndInnerStanzas(J9HookInterface** hook, uintptr_t eventNum, void* eventData, uintptr_t indentDepth);
+
+	MM_VerboseHandlerOutputSegregated(MM_GCExtensionsBase *extensions) :
+		MM_VerboseHandlerOutputStandard(extensions)
+	{};
+
+public:
+	static MM_VerboseHandlerOutput *newInstance(MM_EnvironmentBase *env, MM_VerboseManager *manager);
+};
+
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+
+#endif /* VERBOSEHANDLEROUTPUTSEGREGATED_HPP_ */
@@ -305,6 +305,14 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
 
+	if (extensions->workStealingMark) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		/* scan time is summed over all GC threads */
+		uint64_t scanTime = omrtime_hires_delta(0, markStats->getScanTime(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<work-stealing attempts=\"%zu\" steals=\"%zu\" dequeoverflows=\"%zu\" scantimems=\"%llu.%03.3llu\" />",
+				markStats->_stealAttempts, markStats->_stealCount, markStats->_dequeOverflowCount, scanTime / 1000, scanTime % 1000);
+	}
+
 	handleMarkEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -379,6 +387,7 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		outputCompactPhases(env, 1, compactStats);
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -391,6 +400,36 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	exitAtomicReportingBlock();
 }
 
+void
+MM_VerboseHandlerOutputStandard::outputCompactPhases(MM_EnvironmentBase *env, uintptr_t indent, MM_CompactStats *compactStats)
+{
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+	uint64_t setupTime = 0;
+	uint64_t summaryTime = 0;
+	uint64_t moveTime = 0;
+	uint64_t fixupTime = 0;
+	uint64_t rootFixupTime = 0;
+	uint64_t rebuildTime = 0;
+
+	getTimeDeltaInMicroSeconds(&setupTime, compactStats->_setupStartTime, compactStats->_setupEndTime);
+	getTimeDeltaInMicroSeconds(&moveTime, compactStats->_moveStartTime, compactStats->_moveEndTime);
+	getTimeDeltaInMicroSeconds(&fixupTime, compactStats->_fixupStartTime, compactStats->_fixupEndTime);
+	getTimeDeltaInMicroSeconds(&rootFixupTime, compactStats->_rootFixupStartTime, compactStats->_rootFixupEndTime);
+	getTimeDeltaInMicroSeconds(&rebuildTime, compactStats->_rebuildStartTime, compactStats->_rebuildEndTime);
+
+	if (0 != compactStats->_partitionCount) {
+		getTimeDeltaInMicroSeconds(&summaryTime, compactStats->_summaryStartTime, compactStats->_summaryEndTime);
+		writer->formatAndOutput(env, indent, "<compact-phases partitions=\"%zu\" setupms=\"%llu.%03llu\" summaryms=\"%llu.%03llu\" movems=\"%llu.%03llu\" fixupms=\"%llu.%03llu\" rootfixupms=\"%llu.%03llu\" rebuildms=\"%llu.%03llu\" />",
+				compactStats->_partitionCount, setupTime / 1000, setupTime % 1000, summaryTime / 1000, summaryTime % 1000,
+				moveTime / 1000, moveTime % 1000, fixupTime / 1000, fixupTime % 1000,
+				rootFixupTime / 1000, rootFixupTime % 1000, rebuildTime / 1000, rebuildTime % 1000);
+	} else {
+		writer->formatAndOutput(env, indent, "<compact-phases setupms=\"%llu.%03llu\" movems=\"%llu.%03llu\" fixupms=\"%llu.%03llu\" rootfixupms=\"%llu.%03llu\" rebuildms=\"%llu.%03llu\" />",
+				setupTime / 1000, setupTime % 1000, moveTime / 1000, moveTime % 1000, fixupTime / 1000, fixupTime % 1000,
+				rootFixupTime / 1000, rootFixupTime % 1000, rebuildTime / 1000, rebuildTime % 1000);
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleCompactEndInternal(MM_EnvironmentBase* env, void* eventData)
 {
@@ -419,6 +458,7 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 	if (event->cycleEnd) {
 		writer->formatAndOutput(env, 1, "<scavenger-info tenureage=\"%zu\" tenuremask=\"%4zx\" tiltratio=\"%zu\" />",
 				cycleScavengerStats->_tenureAge, cycleScavengerStats->getFlipHistory(0)->_tenureMask, cycleScavengerStats->_tiltRatio);
+		outputScanOrderingInfo(env, 1, cycleScavengerStats);
 	}
 
 	if (0 != scavengerStats->_flipCount) {
@@ -429,6 +469,16 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
 				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
 	}
+	if ((0 != scavengerStats->_nodeLocalCopyCacheCount) || (0 != scavengerStats->_crossNodeCopyCacheCount)) {
+		writer->formatAndOutput(env, 1, "<numa-copy-caches localcount=\"%zu\" localbytes=\"%zu\" crossnodecount=\"%zu\" crossnodebytes=\"%zu\" />",
+				scavengerStats->_nodeLocalCopyCacheCount, scavengerStats->_nodeLocalCopyCacheBytes,
+				scavengerStats->_crossNodeCopyCacheCount, scavengerStats->_crossNodeCopyCacheBytes);
+	}
+	if ((0 != scavengerStats->_rememberedSetListObjects) || (0 != scavengerStats->_rememberedSetMapObjects)) {
+		uint64_t scanMicros = omrtime_hires_delta(0, scavengerStats->_rememberedSetScanTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		writer->formatAndOutput(env, 1, "<remembered-set-scan listobjects=\"%zu\" mapobjects=\"%zu\" scantimeus=\"%llu\" />",
+				scavengerStats->_rememberedSetListObjects, scavengerStats->_rememberedSetMapObjects, scanMicros);
+	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedFlipCount, scavengerStats->_failedFlipBytes);
@@ -487,6 +537,37 @@ MM_VerboseHandlerOutputStandard::handleConcurrentGCOpEnd(J9HookInterface** hook,
 }
 
 
+void
+MM_VerboseHandlerOutputStandard::outputScanOrderingInfo(MM_EnvironmentBase *env, uintptr_t indent, MM_ScavengerStats *scavengerStats)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_VerboseWriterChain* writer = getManager()->getWriterChain();
+
+	if (MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_ADAPTIVE == extensions->scavengerScanOrdering) {
+		writer->formatAndOutput(env, indent, "<scan-ordering policy=\"%s\" active=\"%s\" copyscanpercent=\"%zu\" stallpercent=\"%zu\" />",
+				getScanOrderingString(extensions->scavengerScanOrdering), getScanOrderingString(scavengerStats->_scanOrdering),
+				scavengerStats->_scanOrderingCopyScanPercent, scavengerStats->_scanOrderingStallPercent);
+	} else {
+		writer->formatAndOutput(env, indent, "<scan-ordering policy=\"%s\" active=\"%s\" />",
+				getScanOrderingString(extensions->scavengerScanOrdering), getScanOrderingString(scavengerStats->_scanOrdering));
+	}
+}
+
+const char *
+MM_VerboseHandlerOutputStandard::getScanOrderingString(uintptr_t scanOrdering)
+{
+	switch (scanOrdering) {
+	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_BREADTH_FIRST:
+		return "breadth-first";
+	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL:
+		return "hierarchical";
+	case MM_GCExtensionsBase::OMR_GC_SCAVENGER_SCANORDERING_ADAPTIVE:
+		return "adaptive";
+	default:
+		return "unknown";
+	}
+}
+
 void
 MM_VerboseHandlerOutputStandard::handleScavengeEndInternal(MM_EnvironmentBase* env, void* eventData)
 {
@@ -568,6 +649,14 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
 			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
 
+	if (0 != event->pacingBound) {
+		writer->formatAndOutput(
+				env, 1, "<card-cleaning-pacing bound=\"%zu\" threshold=\"%zu\" unpacedThreshold=\"%zu\" concurrentCards=\"%zu\" predictedCards=\"%zu\" actualCards=\"%zu\" predictedms=\"%llu.%03llu\" actualms=\"%llu.%03llu\" />",
+				event->pacingBound, event->cardCleaningThreshold, event->unpacedCardCleaningThreshold, event->concleanedCards,
+				event->predictedCards, event->finalcleanedCards,
+				event->predictedDuration / 1000, event->predictedDuration % 1000, durationUs / 1000, durationUs % 1000);
+	}
+
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
 	handleGCOPOuterStanzaEnd(env);
@@ -30,7 +30,9 @@
 #include "CollectionStatisticsStandard.hpp"
 
 class MM_CollectionStatistics;
+class MM_CompactStats;
 class MM_EnvironmentBase;
+class MM_ScavengerStats;
 
 class MM_VerboseHandlerOutputStandard : public MM_VerboseHandlerOutput
 {
@@ -119,6 +121,14 @@ public:
 	 * @param eventData hook specific event data.
 	 */
 	void handleCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+
+	/**
+	 * Write the time spent in each phase of a compaction (and the partition count, if region partitioned).
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 * @param compactStats merged compaction statistics.
+	 */
+	void outputCompactPhases(MM_EnvironmentBase *env, uintptr_t indent, MM_CompactStats *compactStats);
 #endif /* defined(OMR_GC_MODRON_COMPACTION) */
 
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -131,6 +141,22 @@ public:
 	void handleScavengeEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 	void handleScavengeEndNoLock(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+	/**
+	 * Write the configured scan ordering policy and the ordering used by the scavenge cycle
+	 * (along with the inputs of the decision, if the ordering is adaptive).
+	 * @param env GC thread used for output.
+	 * @param indent base level of indentation for the summary.
+	 * @param scavengerStats cycle scavenger statistics.
+	 */
+	void outputScanOrderingInfo(MM_EnvironmentBase *env, uintptr_t indent, MM_ScavengerStats *scavengerStats);
+
+	/**
+	 * Get the verbose name of a scavenger scan ordering.
+	 * @param scanOrdering a MM_GCExtensionsBase::ScavengerScanOrdering value.
+	 * @return the name of the scan ordering.
+	 */
+	const char *getScanOrderingString(uintptr_t scanOrdering);
+
 	/**
 	 * Write verbose stanza for a percolate event.
 	 * @param hook Hook interface used by the JVM.
@@ -106,6 +106,19 @@ typedef enum MM_MarkingSchemeScanReason {
 	SCAN_REASON_OVERFLOWED_OBJECT = 4, /**< Indicates the object being scanned was in an overflowed region */
 } MM_MarkingSchemeScanReason;
 
+/**
+ * Kinds of collect run by the generational segregated collector. Everything but
+ * SEGREGATED_COLLECT_MINOR is a full mark, and the value records why one was needed.
+ */
+typedef enum MM_SegregatedCollectType {
+	SEGREGATED_COLLECT_MINOR = 0, /**< Only objects allocated since the previous collect were traced */
+	SEGREGATED_COLLECT_MAJOR_INITIAL = 1, /**< First collect, or the heap was resized since the previous collect */
+	SEGREGATED_COLLECT_MAJOR_REQUESTED = 2, /**< Explicit or out of memory collect */
+	SEGREGATED_COLLECT_MAJOR_INTERVAL = 3, /**< Maximum number of minor collects since the previous full mark was reached */
+	SEGREGATED_COLLECT_MAJOR_LOW_FREE = 4, /**< The previous minor collect left too little of the heap free */
+	SEGREGATED_COLLECT_MAJOR_OVERFLOW = 5, /**< The remembered set could not hold an old object written since the previous collect */
+} MM_SegregatedCollectType;
+
 #define OMR_GC_CYCLE_TYPE_DEFAULT     0
 #define OMR_GC_CYCLE_TYPE_GLOBAL      1
 #define OMR_GC_CYCLE_TYPE_SCAVENGE    2
@@ -408,7 +421,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	GC_OVERHEAD_FORECAST_LOW
 } ContractReason;
 
 typedef enum {
@@ -419,7 +433,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	GC_OVERHEAD_FORECAST_HIGH
 } ExpandReason;
 
 typedef enum {
@@ -491,6 +506,7 @@ typedef enum {
 #define OMR_SCV_TENURE_RATIO_HIGH 30
 #define OMR_SCV_REMSET_FRAGMENT_SIZE 32
 #define OMR_SCV_REMSET_SIZE 16384
+#define OMR_SCV_REMSET_MAP_CHUNK_SIZE ((uintptr_t)1024 * 1024)
 
 #define J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK 20
 
@@ -386,6 +386,17 @@ typedef struct J9PortVmemParams {
 	 *		- If set, return whatever mmap gives us (only one allocation attempt)
 	 *		- this option is based on the observation that mmap would take the given address as a hint about where to place the mapping
 	 *		- this option does not apply to large page allocations as the allocation is done with shmat instead of mmap
+	 * \arg OMRPORT_VMEM_ADVISE_HUGEPAGE
+	 *		- enabled for Linux and default page allocations only
+	 *		- If set, the reserved memory is advised with MADV_HUGEPAGE so the kernel backs it with transparent huge pages when it can
+	 * \arg OMRPORT_VMEM_ADVISE_NOHUGEPAGE
+	 *		- enabled for Linux and default page allocations only
+	 *		- If set, the reserved memory is advised with MADV_NOHUGEPAGE, even if transparent huge pages are enabled for the whole system
+	 *		- takes precedence over OMRPORT_VMEM_ADVISE_HUGEPAGE
+	 * \arg OMRPORT_VMEM_ADVISE_FREE_ON_DECOMMIT
+	 *		- enabled for Linux and default page allocations only
+	 *		- If set, omrvmem_decommit_memory advises MADV_FREE rather than MADV_DONTNEED: the kernel reclaims the pages lazily, under
+	 *		  memory pressure, and a range which is committed again before that keeps its pages and their contents
 	 */
 	uintptr_t options;
 
@@ -444,6 +455,9 @@ typedef struct OMRCgroupMetricIteratorState {
 #define OMRPORT_VMEM_ALLOC_QUICK 		32
 #define OMRPORT_VMEM_ZTPF_USE_31BIT_MALLOC 64
 #define OMRPORT_VMEM_ADDRESS_HINT 128
+#define OMRPORT_VMEM_ADVISE_HUGEPAGE 256
+#define OMRPORT_VMEM_ADVISE_NOHUGEPAGE 512
+#define OMRPORT_VMEM_ADVISE_FREE_ON_DECOMMIT 1024
 
 /**
  * @name Virtual Memory Address
@@ -1062,6 +1076,7 @@ typedef struct J9PortVmemIdentifier {
 	uintptr_t allocator;
 	int fd;
 	OMRMemCategory *category;
+	uintptr_t options; /* J9PortVmemParams.options the memory was reserved with; only maintained on Linux */
 } J9PortVmemIdentifier;
 
 typedef struct J9MmapHandle {
@@ -1558,22 +1573,22 @@ identifiers */
 #define OMR_FEATURE_X86_DEPRECATES_FPUCSDS    64 + 13 /* Deprecates FPU CS and FPU DS values */ 
 #define OMR_FEATURE_X86_MPX                   64 + 14 /* Processor supports Intel Memory Protection Extensions */
 #define OMR_FEATURE_X86_RDT_A                 64 + 15 /* Processor supports Intel Resource Director Technology Allocation capability */
-#define OMR_FEATURE_X86_2_16                  64 + 16 /* Reserved */          
-#define OMR_FEATURE_X86_2_17                  64 + 17 /* Reserved */
+#define OMR_FEATURE_X86_AVX512F               64 + 16 /* AVX-512 Foundation */
+#define OMR_FEATURE_X86_AVX512DQ              64 + 17 /* AVX-512 Doubleword and Quadword Instructions */
 #define OMR_FEATURE_X86_RDSEED                64 + 18 /* RDSEED */
 #define OMR_FEATURE_X86_ADX                   64 + 19 /* ADX */
 #define OMR_FEATURE_X86_SMAP                  64 + 20 /* Processor supports Supervisor-Mode Access Prevention */
-#define OMR_FEATURE_X86_2_21                  64 + 21 /* Reserved */
+#define OMR_FEATURE_X86_AVX512_IFMA           64 + 21 /* AVX-512 Integer Fused Multiply-Add Instructions */
 #define OMR_FEATURE_X86_2_22                  64 + 22 /* Reserved */
 #define OMR_FEATURE_X86_CLFLUSHOPT            64 + 23 /* CLFLUSHOPT */
 #define OMR_FEATURE_X86_CLWB                  64 + 24 /* CLWB */
 #define OMR_FEATURE_INTEL_PROCESSOR_TRACE     64 + 25 /* Intel Processor Trace */
-#define OMR_FEATURE_X86_2_26                  64 + 26 /* Reserved */
-#define OMR_FEATURE_X86_2_27                  64 + 27 /* Reserved */
-#define OMR_FEATURE_X86_2_28                  64 + 28 /* Reserved */
+#define OMR_FEATURE_X86_AVX512PF              64 + 26 /* AVX-512 Prefetch Instructions */
+#define OMR_FEATURE_X86_AVX512ER              64 + 27 /* AVX-512 Exponential and Reciprocal Instructions */
+#define OMR_FEATURE_X86_AVX512CD              64 + 28 /* AVX-512 Conflict Detection Instructions */
 #define OMR_FEATURE_X86_SHA                   64 + 29 /* Processor supports Intel Secure Hash Algorithm extensions */
-#define OMR_FEATURE_X86_2_30                  64 + 30 /* Reserved */
-#define OMR_FEATURE_X86_2_31                  64 + 31 /* Reserved */
+#define OMR_FEATURE_X86_AVX512BW              64 + 30 /* AVX-512 Byte and Word Instructions */
+#define OMR_FEATURE_X86_AVX512VL              64 + 31 /* AVX-512 Vector Length Extensions */
 
 struct OMRPortLibrary;
 typedef struct J9Heap J9Heap;
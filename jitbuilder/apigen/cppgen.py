@@ -550,7 +550,8 @@ class CppGenerator:
         writer.indent()
 
         if desc.is_impl_default():
-            writer.write("return 0;\n")
+            if "none" != desc.return_type().name():
+                writer.write("return 0;\n")
         else:
             for parm in desc.parameters():
                 self.write_arg_setup(writer, parm)
@@ -0,0 +1,229 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#include "control/CompilationQueue.hpp"
+
+#include "env/CompilerEnv.hpp"
+#include "ilgen/MethodBuilder.hpp"
+#include "infra/Assert.hpp"
+#include "infra/CriticalSection.hpp"
+
+// The optimizer and code generator recurse deeply on large methods, so do not
+// rely on the platform's default stack size for secondary threads
+#define COMPILATION_THREAD_STACK_SIZE (8 * 1024 * 1024)
+
+extern int32_t compileMethodBuilderOnThread(TR::MethodBuilder *methodBuilder, void **entry, int32_t compThreadID);
+
+// Like the thread library itself, accept attributes the platform does not support
+//
+static bool
+attributeSet(intptr_t rc)
+   {
+   rc &= ~J9THREAD_ERR_OS_ERRNO_SET;
+   return rc == J9THREAD_SUCCESS || rc == J9THREAD_ERR_UNSUPPORTED_ATTR;
+   }
+
+namespace JitBuilder
+{
+
+CompilationQueue::CompilationQueue(int32_t numThreads)
+   : _monitor(TR::Monitor::create("JIT-CompilationQueueMonitor")),
+   _head(NULL),
+   _numOutstanding(0),
+   _shuttingDown(false),
+   _numThreads(numThreads),
+   _numThreadsStarted(0),
+   _threads(static_cast<CompilationThread *>(TR::Compiler->persistentAllocator().allocate(numThreads * sizeof(CompilationThread))))
+   {
+   }
+
+CompilationQueue *
+CompilationQueue::create(int32_t numThreads)
+   {
+   TR_ASSERT(numThreads > 0, "a compilation queue needs at least one compilation thread");
+
+   CompilationQueue *queue = new (TR::Compiler->persistentAllocator()) CompilationQueue(numThreads);
+   if (!queue->startThreads())
+      {
+      destroy(queue);
+      return NULL;
+      }
+
+   return queue;
+   }
+
+void
+CompilationQueue::destroy(CompilationQueue *queue)
+   {
+   // Compilation threads drain the queue before they stop
+   //
+   queue->stopThreads();
+   TR_ASSERT(queue->_head == NULL && queue->_numOutstanding == 0, "compilation threads stopped with requests outstanding");
+
+   TR::Monitor::destroy(queue->_monitor);
+   TR::Compiler->persistentAllocator().deallocate(queue->_threads);
+   queue->~CompilationQueue();
+   TR::Compiler->persistentAllocator().deallocate(queue);
+   }
+
+bool
+CompilationQueue::enqueue(TR::MethodBuilder *methodBuilder, int32_t priority)
+   {
+   Request *request = static_cast<Request *>(TR::Compiler->persistentAllocator().allocate(sizeof(Request)));
+   request->_methodBuilder = methodBuilder;
+   request->_priority = priority;
+
+   OMR::CriticalSection queueing(_monitor);
+   if (_shuttingDown)
+      {
+      TR::Compiler->persistentAllocator().deallocate(request);
+      return false;
+      }
+
+   // Requests of equal priority are compiled in the order they were queued
+   //
+   Request **cursor = &_head;
+   while (*cursor != NULL && (*cursor)->_priority >= priority)
+      cursor = &(*cursor)->_next;
+   request->_next = *cursor;
+   *cursor = request;
+   _numOutstanding++;
+
+   // Threads waiting for the queue to empty share the monitor, so a single
+   // notify could wake one of them instead of an idle compilation thread
+   //
+   _monitor->notifyAll();
+   return true;
+   }
+
+void
+CompilationQueue::waitUntilEmpty()
+   {
+   OMR::CriticalSection waiting(_monitor);
+   while (_numOutstanding > 0)
+      _monitor->wait();
+   }
+
+bool
+CompilationQueue::startThreads()
+   {
+   // Only threads known to the thread library can create omrthreads. If the
+   // application thread is already attached this just counts one more attach.
+   //
+   omrthread_t self = NULL;
+   if (omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT) != J9THREAD_SUCCESS)
+      return false;
+
+   omrthread_attr_t attr = NULL;
+   bool started = false;
+   if (omrthread_attr_init(&attr) == J9THREAD_SUCCESS)
+      {
+      started =
+         attributeSet(omrthread_attr_set_stacksize(&attr, COMPILATION_THREAD_STACK_SIZE)) &&
+         attributeSet(omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE)) &&
+         attributeSet(omrthread_attr_set_category(&attr, J9THREAD_CATEGORY_SYSTEM_JIT_THREAD)) &&
+         attributeSet(omrthread_attr_set_name(&attr, "JIT Compilation Thread"));
+
+      for (int32_t i = 0; started && i < _numThreads; i++)
+         {
+         CompilationThread *thread = &_threads[i];
+         thread->_queue = this;
+         thread->_compThreadID = i + 1;
+
+         started = omrthread_create_ex(&thread->_handle, &attr, 0, threadMain, thread) == J9THREAD_SUCCESS;
+         if (started)
+            _numThreadsStarted++;
+         }
+
+      omrthread_attr_destroy(&attr);
+      }
+
+   omrthread_detach(self);
+   return started;
+   }
+
+void
+CompilationQueue::stopThreads()
+   {
+      {
+      OMR::CriticalSection stopping(_monitor);
+      _shuttingDown = true;
+      _monitor->notifyAll();
+      }
+
+   if (_numThreadsStarted > 0)
+      {
+      // Joining also needs an attached thread
+      //
+      omrthread_t self = NULL;
+      intptr_t rc = omrthread_attach_ex(&self, J9THREAD_ATTR_DEFAULT);
+      TR_ASSERT_FATAL(rc == J9THREAD_SUCCESS, "cannot attach to the thread library to stop the compilation threads");
+
+      for (int32_t i = 0; i < _numThreadsStarted; i++)
+         omrthread_join(_threads[i]._handle);
+
+      omrthread_detach(self);
+      }
+
+   _numThreadsStarted = 0;
+   }
+
+int J9THREAD_PROC
+CompilationQueue::threadMain(void *thread)
+   {
+   CompilationThread *self = static_cast<CompilationThread *>(thread);
+   self->_queue->run(self->_compThreadID);
+   return 0;
+   }
+
+void
+CompilationQueue::run(int32_t compThreadID)
+   {
+   _monitor->enter();
+   while (true)
+      {
+      while (_head == NULL && !_shuttingDown)
+         _monitor->wait();
+
+      if (_head == NULL) // shutting down, and nothing left to compile
+         break;
+
+      Request *request = _head;
+      _head = request->_next;
+      _monitor->exit();
+
+      TR::MethodBuilder *methodBuilder = request->_methodBuilder;
+      TR::Compiler->persistentAllocator().deallocate(request);
+
+      void *entry = NULL;
+      int32_t rc = compileMethodBuilderOnThread(methodBuilder, &entry, compThreadID);
+      methodBuilder->CompilationComplete(rc, entry);
+
+      _monitor->enter();
+      if (--_numOutstanding == 0)
+         _monitor->notifyAll();
+      }
+   _monitor->exit();
+   }
+
+} // namespace JitBuilder
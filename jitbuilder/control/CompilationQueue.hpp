@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Copyright (c) 2020, 2020 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+
+#ifndef JITBUILDER_COMPILATIONQUEUE_HPP
+#define JITBUILDER_COMPILATIONQUEUE_HPP
+
+#include <stdint.h>
+#include "omrthread.h"
+#include "infra/Monitor.hpp"
+
+namespace TR { class MethodBuilder; }
+
+namespace JitBuilder
+{
+
+/**
+ * A queue of MethodBuilders waiting to be compiled, and the pool of
+ * compilation threads that compiles them. Requests are compiled in order of
+ * decreasing priority, and in the order they were queued when priorities are
+ * equal. The result of each request is delivered by calling
+ * CompilationComplete() on its MethodBuilder from the compilation thread.
+ *
+ * Compilation threads are numbered from 1, so that each has its own
+ * compilation thread ID (0 is the application thread compiling
+ * synchronously) for code cache reservations and per-thread logs. They are
+ * omrthreads in the JIT thread category; the application threads that create
+ * and destroy the queue are attached to the thread library while they start
+ * and join them.
+ */
+class CompilationQueue
+   {
+   public:
+
+   /**
+    * @brief create a queue and start its compilation threads
+    * @param numThreads the number of compilation threads
+    * @returns the queue, or NULL if it could not be created
+    */
+   static CompilationQueue *create(int32_t numThreads);
+
+   /**
+    * @brief wait for every queued request to complete, then stop the
+    *        compilation threads and free the queue
+    */
+   static void destroy(CompilationQueue *queue);
+
+   /**
+    * @brief queue a MethodBuilder to be compiled on a compilation thread
+    * @returns false if the queue is being destroyed
+    */
+   bool enqueue(TR::MethodBuilder *methodBuilder, int32_t priority);
+
+   /**
+    * @brief wait until every queued request has completed, including the
+    *        call to CompilationComplete()
+    */
+   void waitUntilEmpty();
+
+   int32_t getNumThreads() const { return _numThreads; }
+
+   private:
+
+   struct Request
+      {
+      Request           *_next;
+      TR::MethodBuilder *_methodBuilder;
+      int32_t            _priority;
+      };
+
+   struct CompilationThread
+      {
+      CompilationQueue  *_queue;
+      int32_t            _compThreadID;
+      omrthread_t        _handle;
+      };
+
+   CompilationQueue(int32_t numThreads);
+
+   bool startThreads();
+   void stopThreads();
+   void run(int32_t compThreadID);
+
+   static int J9THREAD_PROC threadMain(void *thread);
+
+   TR::Monitor       *_monitor;         ///< guards every field below, and is notified when they change
+   Request           *_head;            ///< highest priority request not yet being compiled
+   int32_t            _numOutstanding;  ///< requests queued or being compiled
+   bool               _shuttingDown;
+   int32_t            _numThreads;
+   int32_t            _numThreadsStarted;
+   CompilationThread *_threads;
+   };
+
+} // namespace JitBuilder
+
+#endif // !defined(JITBUILDER_COMPILATIONQUEUE_HPP)
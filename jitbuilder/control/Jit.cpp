@@ -24,7 +24,9 @@
 #include "codegen/CodeGenerator.hpp"
 #include "compile/CompilationTypes.hpp"
 #include "compile/Method.hpp"
+#include "control/CompilationQueue.hpp"
 #include "control/CompileMethod.hpp"
+#include "control/Options.hpp"
 #include "env/CompilerEnv.hpp"
 #include "env/FrontEnd.hpp"
 #include "env/IO.hpp"
@@ -32,6 +34,8 @@
 #include "ilgen/IlGeneratorMethodDetails_inlines.hpp"
 #include "ilgen/MethodBuilder.hpp"
 #include "ilgen/TypeDictionary.hpp"
+#include "infra/CriticalSection.hpp"
+#include "infra/Monitor.hpp"
 #include "runtime/CodeCache.hpp"
 #include "runtime/Runtime.hpp"
 #include "runtime/JBJitConfig.hpp"
@@ -43,6 +47,10 @@
 extern TR_RuntimeHelperTable runtimeHelpers;
 extern void setupCodeCacheParameters(int32_t *, OMR::CodeCacheCodeGenCallbacks *callBacks, int32_t *numHelpers, int32_t *CCPreLoadedCodeSize);
 
+// The compilation queue is only created on the first asynchronous compile
+static TR::Monitor *compilationQueueMonitor = NULL;
+static JitBuilder::CompilationQueue *compilationQueue = NULL;
+
 static void
 initHelper(void *helper, TR_RuntimeHelper id)
    {
@@ -145,9 +153,54 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
 
    initializeCodeCache(fe.codeCacheManager());
 
+   compilationQueueMonitor = TR::Monitor::create("JIT-CompilationQueueCreationMonitor");
+
    return true;
    }
 
+// Compile a MethodBuilder on the calling thread: compThreadID is 0 for an
+// application thread, or the ID of one of the compilation queue's threads.
+// Any number of threads can compile at once; only MethodBuilders that share
+// a TypeDictionary are compiled one at a time.
+//
+int32_t
+compileMethodBuilderOnThread(TR::MethodBuilder *m, void **entry, int32_t compThreadID)
+   {
+   int32_t rc = m->Compile(entry, compThreadID);
+
+#if defined(J9ZOS390)
+   struct FunctionDescriptor
+   {
+      uint64_t environment;
+      void* func;
+   };
+
+   FunctionDescriptor* fd = new FunctionDescriptor();
+   fd->environment = 0;
+   fd->func = *entry;
+
+   *entry = (void*) fd;
+#elif defined(AIXPPC)
+   struct FunctionDescriptor
+      {
+      void* func;
+      void* toc;
+      void* environment;
+      };
+
+   FunctionDescriptor* fd = new FunctionDescriptor();
+   fd->func = *entry;
+   // TODO: There should really be a better way to get this. Usually, we would use
+   // cg->getTOCBase(), but the code generator has already been destroyed by now...
+   fd->toc = toPPCTableOfConstants(JitBuilder::FrontEnd::instance()->getPersistentInfo()->getPersistentTOC())->getTOCBase();
+   fd->environment = NULL;
+
+   *entry = (uint8_t*) fd;
+#endif
+
+   return rc;
+   }
+
 /*
  _____      _                        _
 | ____|_  _| |_ ___ _ __ _ __   __ _| |
@@ -166,6 +219,7 @@ initializeJitBuilder(TR_RuntimeHelper *helperIDs, void **helperAddresses, int32_
 // An individual program should link statically against JitBuilder, then call:
 //     initializeJit() or initializeJitWithOptions() to initialize the Jit
 //     compileMethodBuilder() as many times as needed to create compiled code
+//       or compileMethodBuilderAsync() to compile on a compilation thread
 //     shuwdownJit() when the test is complete
 //
 
@@ -187,44 +241,51 @@ internal_initializeJit()
 int32_t
 internal_compileMethodBuilder(TR::MethodBuilder *m, void **entry)
    {
-   auto rc = m->Compile(entry);
+   return compileMethodBuilderOnThread(m, entry, 0);
+   }
 
-#if defined(J9ZOS390)
-   struct FunctionDescriptor
+// Queue m to be compiled on a compilation thread. The number of compilation
+// threads is set by the compilationThreads= option.
+//
+bool
+internal_compileMethodBuilderAsync(TR::MethodBuilder *m, int32_t priority)
    {
-      uint64_t environment;
-      void* func;
-   };
-
-   FunctionDescriptor* fd = new FunctionDescriptor();
-   fd->environment = 0;
-   fd->func = *entry;
-
-   *entry = (void*) fd;
-#elif defined(AIXPPC)
-   struct FunctionDescriptor
+   JitBuilder::CompilationQueue *queue = NULL;
       {
-      void* func;
-      void* toc;
-      void* environment;
-      };
+      OMR::CriticalSection creatingQueue(compilationQueueMonitor);
+      if (compilationQueue == NULL)
+         compilationQueue = JitBuilder::CompilationQueue::create(TR::Options::getNumUsableCompilationThreads());
+      queue = compilationQueue;
+      }
 
-   FunctionDescriptor* fd = new FunctionDescriptor();
-   fd->func = *entry;
-   // TODO: There should really be a better way to get this. Usually, we would use
-   // cg->getTOCBase(), but the code generator has already been destroyed by now...
-   fd->toc = toPPCTableOfConstants(TR_PersistentMemory::getNonThreadSafePersistentInfo()->getPersistentTOC())->getTOCBase();
-   fd->environment = NULL;
+   return queue != NULL && queue->enqueue(m, priority);
+   }
 
-   *entry = (uint8_t*) fd;
-#endif
+void
+internal_waitForAsyncCompilations()
+   {
+   JitBuilder::CompilationQueue *queue = NULL;
+      {
+      OMR::CriticalSection findingQueue(compilationQueueMonitor);
+      queue = compilationQueue;
+      }
 
-   return rc;
+   if (queue != NULL)
+      queue->waitUntilEmpty();
    }
 
 void
 internal_shutdownJit()
    {
+   // Outstanding asynchronous compiles finish before the code caches go away
+   //
+   if (compilationQueue != NULL)
+      {
+      JitBuilder::CompilationQueue::destroy(compilationQueue);
+      compilationQueue = NULL;
+      }
+   TR::Monitor::destroy(compilationQueueMonitor);
+
    auto fe = JitBuilder::FrontEnd::instance();
 
    TR::CodeCacheManager &codeCacheManager = fe->codeCacheManager();
@@ -55,7 +55,9 @@
 #include "optimizer/LoopCanonicalizer.hpp"
 #include "optimizer/LoopReducer.hpp"
 #include "optimizer/LoopReplicator.hpp"
+#include "optimizer/LoopVectorizer.hpp"
 #include "optimizer/LoopVersioner.hpp"
+#include "optimizer/SLPVectorizer.hpp"
 #include "optimizer/OrderBlocks.hpp"
 #include "optimizer/PartialRedundancy.hpp"
 #include "optimizer/RegDepCopyRemoval.hpp"
@@ -126,8 +128,11 @@ static const OptimizationStrategy JBwarmStrategyOpts[] =
 
    { OMR::basicBlockOrdering,                        OMR::IfLoops                  }, // clean up block order for loop canonicalization, if it will run
    { OMR::loopCanonicalization,                      OMR::IfLoops                  }, // canonicalization must run before inductionVariableAnalysis else indvar data gets messed up
-   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  }, // needed for loop unroller
+   { OMR::inductionVariableAnalysis,                 OMR::IfLoops                  }, // needed for loop vectorizer and unroller
+   { OMR::loopVectorization,                         OMR::IfLoops                  },
+   { OMR::inductionVariableAnalysis,                 OMR::IfEnabled                }, // recompute after loop vectorization
    { OMR::generalLoopUnroller,                       OMR::IfLoops                  },
+   { OMR::slpVectorization                                                         }, // pack adjacent stores, including those exposed by unrolling
    { OMR::basicBlockExtension,                       OMR::MarkLastRun              }, // clean up order and extend blocks now
    { OMR::treeSimplification                                                       },
    { OMR::localCSE                                                                 },
@@ -187,6 +192,10 @@ Optimizer::Optimizer(TR::Compilation *comp, TR::ResolvedMethodSymbol *methodSymb
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopCanonicalizer::create, OMR::loopCanonicalization);
    _opts[OMR::inductionVariableAnalysis] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_InductionVariableAnalysis::create, OMR::inductionVariableAnalysis);
+   _opts[OMR::loopVectorization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_LoopVectorizer::create, OMR::loopVectorization);
+   _opts[OMR::slpVectorization] =
+      new (comp->allocator()) TR::OptimizationManager(self(), TR_SLPVectorizer::create, OMR::slpVectorization);
    _opts[OMR::liveRangeSplitter] =
       new (comp->allocator()) TR::OptimizationManager(self(), TR_LiveRangeSplitter::create, OMR::liveRangeSplitter);
    _opts[OMR::tacticalGlobalRegisterAllocator] =
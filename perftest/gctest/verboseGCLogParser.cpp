@@ -26,6 +26,7 @@
 #include <iterator>
 #include <numeric>
 #include <stdio.h>
+#include <stdlib.h>
 
 #include "pugixml.hpp"
 
@@ -40,7 +41,21 @@ const char* XPATH_GET_TOTAL_GC_TIME = "/verbosegc/gc-end[@type='global']";
 const char* SRC_DIR = "./";
 const char* VERBOSE_GC_FILE_PREFIX = "VerboseGC";
 
+/* JSON lines logs (-Xgc:verboseFormat=json) hold one top level stanza per line */
+const char* JSON_ELEMENT_GC_OP = "{\"element\":\"gc-op\",";
+const char* JSON_ELEMENT_HEAP_RESIZE = "{\"element\":\"heap-resize\",";
+const char* JSON_ELEMENT_GC_END = "{\"element\":\"gc-end\",";
+
+typedef struct CycleStatistics {
+	std::vector<double> mark_values;
+	std::vector<double> sweep_values;
+	std::vector<double> expand_values;
+	std::vector<double> gcduration_values;
+} CycleStatistics;
+
 double getAvg(std::vector<double> v);
+bool analyzeXML(char* fileName, CycleStatistics *stats);
+bool analyzeJSONLines(char* contents, CycleStatistics *stats);
 void analyze(char* fileName, OMRPortLibrary portLibrary);
 
 int main(void)
@@ -102,72 +117,176 @@ getAvg(std::vector<double> v)
 	return avg;
 }
 
-void
-analyze(char* fileName, OMRPortLibrary portLibrary)
+/**
+ * Collect the cycle statistics of an XML verbose GC log.
+ */
+bool
+analyzeXML(char* fileName, CycleStatistics *stats)
 {
-	std::vector<double> mark_values;
-	std::vector<double> sweep_values;
-	std::vector<double> expand_values;
-	std::vector<double> gcduration_values;
-
 	pugi::xpath_node_set markTimes;
 	pugi::xpath_node_set sweepTimes;
 	pugi::xpath_node_set expandTimes;
 	pugi::xpath_node_set gcTimes;
 
-	double maxMark = 0;
-	double minMark = 0;
-	double avgMark = 0;
-
-	double maxSweep = 0;
-	double minSweep = 0;
-	double avgSweep = 0;
-
-	double maxExpand = 0;
-	double minExpand = 0;
-	double avgExpand = 0;
-
-	double maxGCDuration = 0;
-	double minGCDuration = 0;
-	double avgGCDuration = 0;
-
 	pugi::xml_document doc;
 	pugi::xml_parse_result result = doc.load_file(fileName);
-
-	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
 	if(!result) {
-		omrtty_printf("Error loading file : %s\n", fileName);
-		return;
-	} else {
-		omrtty_printf("\nResults for : %s\n",fileName);
+		return false;
 	}
 
 	markTimes = doc.select_nodes(XPATH_GET_ALL_MARK_TIME);
 	for (pugi::xpath_node_set::const_iterator it = markTimes.begin(); it != markTimes.end(); ++it) {
 	    pugi::xpath_node node = *it;
 	    double value = node.node().attribute("timems").as_double();
-	    mark_values.push_back(value);
+	    stats->mark_values.push_back(value);
 	}
 
 	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
 	for (pugi::xpath_node_set::const_iterator it = sweepTimes.begin(); it != sweepTimes.end(); ++it) {
 	    pugi::xpath_node node = *it;
 	    double value = node.node().attribute("timems").as_double();
-	    sweep_values.push_back(value);
+	    stats->sweep_values.push_back(value);
 	}
 
 	expandTimes = doc.select_nodes(XPATH_GET_ALL_EXPAND_TIME);
 	for (pugi::xpath_node_set::const_iterator it = expandTimes.begin(); it != expandTimes.end(); ++it) {
 	    pugi::xpath_node node = *it;
 	    double value = node.node().attribute("timems").as_double();
-	    expand_values.push_back(value);
+	    stats->expand_values.push_back(value);
 	}
 
 	gcTimes = doc.select_nodes(XPATH_GET_TOTAL_GC_TIME);
 	for (pugi::xpath_node_set::const_iterator it = gcTimes.begin(); it != gcTimes.end(); ++it) {
 	    pugi::xpath_node node = *it;
 	    double value = node.node().attribute("durationms").as_double();
-	    gcduration_values.push_back(value);
+	    stats->gcduration_values.push_back(value);
+	}
+
+	return true;
+}
+
+/**
+ * Find the value of an attribute of a JSON lines stanza. Only the stanza's own attributes,
+ * which precede its "children" array, are searched.
+ * @return the start of the value, or NULL if the stanza has no such attribute
+ */
+static const char *
+findJSONAttribute(const char* line, const char* name)
+{
+	char key[64];
+	snprintf(key, sizeof(key), ",\"%s\":", name);
+	const char* value = strstr(line, key);
+	if (NULL != value) {
+		const char* children = strstr(line, ",\"children\":");
+		if ((NULL != children) && (children < value)) {
+			return NULL;
+		}
+		value += strlen(key);
+	}
+	return value;
+}
+
+/**
+ * Collect the cycle statistics of a JSON lines verbose GC log. Each line is matched by its
+ * element name and only the wanted attributes are scanned, so no document is built.
+ * @param contents[in] the NUL terminated log; lines are NUL terminated in place
+ */
+bool
+analyzeJSONLines(char* contents, CycleStatistics *stats)
+{
+	char* line = contents;
+	while ('\0' != *line) {
+		char* lineEnd = strchr(line, '\n');
+		if (NULL != lineEnd) {
+			*lineEnd = '\0';
+		}
+
+		if (0 == strncmp(line, JSON_ELEMENT_GC_OP, strlen(JSON_ELEMENT_GC_OP))) {
+			const char* type = findJSONAttribute(line, "type");
+			const char* time = findJSONAttribute(line, "timems");
+			if ((NULL != type) && (NULL != time)) {
+				if (0 == strncmp(type, "\"mark\"", 6)) {
+					stats->mark_values.push_back(strtod(time, NULL));
+				} else if (0 == strncmp(type, "\"sweep\"", 7)) {
+					stats->sweep_values.push_back(strtod(time, NULL));
+				}
+			}
+		} else if (0 == strncmp(line, JSON_ELEMENT_HEAP_RESIZE, strlen(JSON_ELEMENT_HEAP_RESIZE))) {
+			const char* type = findJSONAttribute(line, "type");
+			const char* time = findJSONAttribute(line, "timems");
+			if ((NULL != type) && (NULL != time) && (0 == strncmp(type, "\"expand\"", 8))) {
+				stats->expand_values.push_back(strtod(time, NULL));
+			}
+		} else if (0 == strncmp(line, JSON_ELEMENT_GC_END, strlen(JSON_ELEMENT_GC_END))) {
+			const char* type = findJSONAttribute(line, "type");
+			const char* duration = findJSONAttribute(line, "durationms");
+			if ((NULL != type) && (NULL != duration) && (0 == strncmp(type, "\"global\"", 8))) {
+				stats->gcduration_values.push_back(strtod(duration, NULL));
+			}
+		}
+
+		if (NULL == lineEnd) {
+			break;
+		}
+		line = lineEnd + 1;
+	}
+	return true;
+}
+
+void
+analyze(char* fileName, OMRPortLibrary portLibrary)
+{
+	CycleStatistics stats;
+	std::vector<double> &mark_values = stats.mark_values;
+	std::vector<double> &sweep_values = stats.sweep_values;
+	std::vector<double> &expand_values = stats.expand_values;
+	std::vector<double> &gcduration_values = stats.gcduration_values;
+
+	double maxMark = 0;
+	double minMark = 0;
+	double avgMark = 0;
+
+	double maxSweep = 0;
+	double minSweep = 0;
+	double avgSweep = 0;
+
+	double maxExpand = 0;
+	double minExpand = 0;
+	double avgExpand = 0;
+
+	double maxGCDuration = 0;
+	double minGCDuration = 0;
+	double avgGCDuration = 0;
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	/* JSON lines logs start with the {"element":"verbosegc",...} header object */
+	bool result = false;
+	const char* format = "JSON lines";
+	uint64_t startTime = omrtime_hires_clock();
+	intptr_t fileDescriptor = omrfile_open(fileName, EsOpenRead, 0444);
+	if (-1 != fileDescriptor) {
+		int64_t length = omrfile_flength(fileDescriptor);
+		char* contents = (char *)omrmem_allocate_memory((uintptr_t)length + 1, OMRMEM_CATEGORY_MM);
+		if ((NULL != contents) && (length == omrfile_read(fileDescriptor, contents, (intptr_t)length))) {
+			contents[length] = '\0';
+			if ('{' == contents[strspn(contents, " \t\r\n")]) {
+				result = analyzeJSONLines(contents, &stats);
+			} else {
+				format = "XML";
+				result = analyzeXML(fileName, &stats);
+			}
+		}
+		omrmem_free_memory(contents);
+		omrfile_close(fileDescriptor);
+	}
+	uint64_t parseTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	if(!result) {
+		omrtty_printf("Error loading file : %s\n", fileName);
+		return;
+	} else {
+		omrtty_printf("\nResults for : %s (%s, parsed in %llu us)\n", fileName, format, parseTime);
 	}
 
 	if (!mark_values.empty()) {
@@ -43,7 +43,7 @@ endif
 all: test
 	
 omr_perfgctest:
-	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
+	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog -logLevel=info
 	./omrperfgctest
 
 .PHONY: all test omr_perfgctest 
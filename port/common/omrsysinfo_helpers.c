@@ -43,7 +43,7 @@
 #include <emmintrin.h>
 #define cpuid(CPUInfo, EAXValue)             __cpuid(EAXValue, CPUInfo[0], CPUInfo[1], CPUInfo[2], CPUInfo[3])
 #define cpuidex(CPUInfo, EAXValue, ECXValue) __cpuid_count(EAXValue, ECXValue, CPUInfo[0], CPUInfo[1], CPUInfo[2], CPUInfo[3])
-inline unsigned long long _xgetbv(unsigned int ecx)
+static inline unsigned long long _xgetbv(unsigned int ecx)
 {
 	unsigned int eax, edx;
 	__asm__ __volatile__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(ecx));
@@ -104,6 +104,13 @@ inline unsigned long long _xgetbv(unsigned int ecx)
 
 #define CUPID_EXTENDEDFAMILYCODE_AMDOPTERON               0x06
 
+/* leaf 1 ECX and leaf 7 EBX feature bits consulted when validating the OS-enabled register state */
+#define CPUID_ECX_OSXSAVE                                 0x08000000
+#define CPUID_EBX_AVX512_MASK                             0xDC230000
+
+/* XCR0 state components: SSE, AVX (upper YMM) and AVX-512 (opmask, upper ZMM0-15, ZMM16-31) */
+#define XCR0_AVX512_STATE_MASK                            0xE6
+
 /**
  * @internal
  * Populates OMRProcessorDesc *desc on Windows and Linux (x86)
@@ -222,6 +229,13 @@ omrsysinfo_get_x86_description(struct OMRPortLibrary *portLibrary, OMRProcessorD
 	cpuidex(CPUInfo, 7, 0);
 	desc->features[2] = CPUInfo[CPUID_EBX];
 
+	/* AVX-512 instructions fault unless the OS saves the opmask and ZMM state across context switches */
+	if ((0 == (desc->features[1] & CPUID_ECX_OSXSAVE))
+		|| (XCR0_AVX512_STATE_MASK != (_xgetbv(0) & XCR0_AVX512_STATE_MASK))
+	) {
+		desc->features[2] &= ~(uint32_t)CPUID_EBX_AVX512_MASK;
+	}
+
 	return 0;
 }
 #endif /* defined(OMR_OS_WINDOWS) || defined(J9X86) || defined(J9HAMMER) */
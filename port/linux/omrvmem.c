@@ -55,6 +55,13 @@
 #if !defined(MADV_HUGEPAGE)
 #define MADV_HUGEPAGE 14
 #endif /* MADV_HUGEPAGE */
+#if !defined(MADV_NOHUGEPAGE)
+#define MADV_NOHUGEPAGE 15
+#endif /* MADV_NOHUGEPAGE */
+/* MADV_FREE is only defined by glibc 2.24 and later */
+#if !defined(MADV_FREE)
+#define MADV_FREE 8
+#endif /* MADV_FREE */
 
 #if defined(OMR_PORT_NUMA_SUPPORT)
 #include <numaif.h>
@@ -132,7 +139,7 @@ static void *allocateMemoryForLargePages(struct OMRPortLibrary *portLibrary, str
 static BOOLEAN isStrictAndOutOfRange(void *memoryPointer, void *startAddress, void *endAddress, uintptr_t vmemOptions);
 static BOOLEAN rangeIsValid(struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount);
 static void *reserveLargePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t pageSize, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode);
-static uintptr_t adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount);
+static uintptr_t adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount, uintptr_t vmemOptions);
 
 static void *default_pageSize_reserve_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t mode, uintptr_t pageSize, OMRMemCategory *category);
 #if defined(OMR_PORT_NUMA_SUPPORT)
@@ -677,7 +684,15 @@ omrvmem_decommit_memory(struct OMRPortLibrary *portLibrary, void *address, uintp
 
 			if (byteAmount > 0) {
 				if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP) {
-					result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+					if (OMR_ARE_ANY_BITS_SET(identifier->options, OMRPORT_VMEM_ADVISE_FREE_ON_DECOMMIT)) {
+						result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_FREE);
+						if ((0 != result) && (EINVAL == errno)) {
+							/* MADV_FREE is not supported before Linux 4.5 */
+							result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+						}
+					} else {
+						result = (intptr_t)madvise((void *)address, (size_t) byteAmount, MADV_DONTNEED);
+					}
 				} else if (identifier->allocator == OMRPORT_VMEM_RESERVE_USED_MMAP_SHM) {
 					/* If heap is created using shared memory with mmap, we must set advice to MADV_REMOVE, because
 					 * pages might not be immediately freed in a successful madvise used with MADV_DONTNEED in
@@ -848,6 +863,10 @@ omrvmem_reserve_memory_ex(struct OMRPortLibrary *portLibrary, struct J9PortVmemI
 		port_numa_interleave_memory(portLibrary, memoryPointer, params->byteAmount);
 	}
 #endif
+	if (NULL != memoryPointer) {
+		/* remembered for omrvmem_decommit_memory */
+		identifier->options = params->options;
+	}
 
 #if defined(OMRVMEM_DEBUG)
 	printf("\tomrvmem_reserve_memory_ex(start=%p,end=%p,size=0x%zx,page=0x%zx,options=0x%zx) returning %p\n",
@@ -924,19 +943,31 @@ reserveLargePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifie
  * Advise memory to enable use of Transparent HugePages (THP) (Linux Only)
  *
  * Notify kernel that the virtual memory region specified by address and byteAmount should be labelled
- * with MADV_HUGEPAGE, where the khugepage process could promote to THP when possible.
+ * with MADV_HUGEPAGE, where the khugepage process could promote to THP when possible. This is done if
+ * requested by OMRPORT_VMEM_ADVISE_HUGEPAGE, or for all memory if THP is set to madvise.
+ * OMRPORT_VMEM_ADVISE_NOHUGEPAGE labels the region with MADV_NOHUGEPAGE instead, which keeps sparsely
+ * used memory in default pages even if THP is set to always.
  *
  * @param[in] portLibrary The port library.
  * @param[in] address The starting virtual address.
  * @param[in] byteAmount The amount of bytes after address to map to hugepage.
+ * @param[in] vmemOptions The options the memory was reserved with.
  *
  * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
  */
 static uintptr_t
-adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount)
+adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount, uintptr_t vmemOptions)
 {
 #if defined(MAP_ANON) || defined(MAP_ANONYMOUS)
-	if (portLibrary->portGlobals->vmemEnableMadvise) {
+	int advice = 0;
+
+	if (OMR_ARE_ANY_BITS_SET(vmemOptions, OMRPORT_VMEM_ADVISE_NOHUGEPAGE)) {
+		advice = MADV_NOHUGEPAGE;
+	} else if (OMR_ARE_ANY_BITS_SET(vmemOptions, OMRPORT_VMEM_ADVISE_HUGEPAGE) || portLibrary->portGlobals->vmemEnableMadvise) {
+		advice = MADV_HUGEPAGE;
+	}
+
+	if (0 != advice) {
 		uintptr_t start = (uintptr_t)address;
 		uintptr_t end = (uintptr_t)address + byteAmount;
 
@@ -944,7 +975,7 @@ adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byte
 		start = start + ((start % PPG_vmem_pageSize[0]) ? (PPG_vmem_pageSize[0] - (start % PPG_vmem_pageSize[0])) : 0);
 		end = end - (end % PPG_vmem_pageSize[0]);
 		if (start < end) {
-			if (0 != madvise((void *)start, end - start, MADV_HUGEPAGE)) {
+			if (0 != madvise((void *)start, end - start, advice)) {
 				return OMRPORT_ERROR_VMEM_OPFAILED;
 			}
 		}
@@ -1316,6 +1347,7 @@ update_vmemIdentifier(J9PortVmemIdentifier *identifier, void *address, void *han
 	identifier->allocator = allocator;
 	identifier->category = category;
 	identifier->fd = fd;
+	identifier->options = 0;
 }
 
 static int
@@ -1602,7 +1634,7 @@ allocAnywhere:
 
 		memoryPointer = NULL;
 	} else {
-		adviseHugepage(portLibrary, memoryPointer, byteAmount);
+		adviseHugepage(portLibrary, memoryPointer, byteAmount, vmemOptions);
 	}
 
 	return memoryPointer;